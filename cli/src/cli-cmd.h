@@ -12,6 +12,7 @@
 
 #include "cli.h"
 #include <glusterfs/list.h>
+#include <glusterfs/latency.h>
 
 #define GLUSTER_SHARED_STORAGE "gluster_shared_storage"
 
@@ -66,6 +67,7 @@ typedef struct cli_profile_info_ {
     double avg_latency;
     char *fop_name;
     double percentage_avg_latency;
+    uint64_t pct_latency[GF_LATENCY_PCT_MAX];
 } cli_profile_info_t;
 
 typedef struct cli_cmd_volume_get_ctx_ cli_cmd_volume_get_ctx_t;
@@ -5492,6 +5492,7 @@ cmd_profile_volume_brick_out(dict_t *dict, int count, int interval)
     int index = 0;
     int is_header_printed = 0;
     int ret = 0;
+    int p = 0;
     double total_percentage_latency = 0;
 
     for (i = 0; i < 32; i++) {
@@ -5545,6 +5546,16 @@ cmd_profile_volume_brick_out(dict_t *dict, int count, int interval)
         if (ret) {
             gf_log("cli", GF_LOG_DEBUG, "failed to get %s from dict", key);
         }
+
+        for (p = 0; p < GF_LATENCY_PCT_MAX; p++) {
+            snprintf(key, sizeof(key), "%d-%d-%d-%slatency", count, interval,
+                     i, gf_latency_pct_names[p]);
+            ret = dict_get_uint64(dict, key, &profile_info[i].pct_latency[p]);
+            if (ret) {
+                gf_log("cli", GF_LOG_DEBUG, "failed to get %s from dict",
+                       key);
+            }
+        }
         profile_info[i].fop_name = (char *)gf_fop_list[i];
 
         total_percentage_latency += (profile_info[i].fop_hits *
@@ -5629,21 +5640,32 @@ cmd_profile_volume_brick_out(dict_t *dict, int count, int interval)
     for (i = 0; i < GF_FOP_MAXVALUE; i++) {
         if (profile_info[i].fop_hits == 0)
             continue;
+        /* percentiles go after the Fop column so that scripts picking
+         * the existing columns by position keep working */
         if (is_header_printed == 0) {
-            cli_out("%10s %13s %13s %13s %14s %11s", "%-latency", "Avg-latency",
-                    "Min-Latency", "Max-Latency", "No. of calls", "Fop");
-            cli_out("%10s %13s %13s %13s %14s %11s", "---------", "-----------",
-                    "-----------", "-----------", "------------", "----");
+            cli_out("%10s %13s %13s %13s %14s %11s %13s %13s %13s %13s",
+                    "%-latency", "Avg-latency", "Min-Latency", "Max-Latency",
+                    "No. of calls", "Fop", "P50-Latency", "P90-Latency",
+                    "P99-Latency", "P99.9-Latency");
+            cli_out("%10s %13s %13s %13s %14s %11s %13s %13s %13s %13s",
+                    "---------", "-----------", "-----------", "-----------",
+                    "------------", "----", "-----------", "-----------",
+                    "-----------", "-------------");
             is_header_printed = 1;
         }
         if (profile_info[i].fop_hits) {
             cli_out(
                 "%10.2lf %10.2lf ns %10.2lf ns %10.2lf ns"
-                " %14" PRId64 " %11s",
+                " %14" PRId64 " %11s %10" PRIu64 " ns %10" PRIu64
+                " ns %10" PRIu64 " ns %10" PRIu64 " ns",
                 profile_info[i].percentage_avg_latency,
                 profile_info[i].avg_latency, profile_info[i].min_latency,
                 profile_info[i].max_latency, profile_info[i].fop_hits,
-                profile_info[i].fop_name);
+                profile_info[i].fop_name,
+                profile_info[i].pct_latency[GF_LATENCY_P50],
+                profile_info[i].pct_latency[GF_LATENCY_P90],
+                profile_info[i].pct_latency[GF_LATENCY_P99],
+                profile_info[i].pct_latency[GF_LATENCY_P999]);
         }
     }
 
@@ -7912,6 +7934,9 @@ cmd_heal_volume_statistics_out(dict_t *dict, int brick)
     uint64_t healed_count = 0;
     uint64_t split_brain_count = 0;
     uint64_t heal_failed_count = 0;
+    uint64_t healed_bytes = 0;
+    uint64_t heal_usecs = 0;
+    gf_boolean_t have_bytes = _gf_false;
     char *start_time_str = NULL;
     char *end_time_str = NULL;
     char *crawl_type = NULL;
@@ -7965,6 +7990,14 @@ cmd_heal_volume_statistics_out(dict_t *dict, int brick)
         ret = dict_get_int32(dict, key, &progress);
         if (ret)
             goto out;
+        /* Not sent by self-heal daemons of older versions. */
+        snprintf(key, sizeof key, "statistics_healed_bytes-%d-%" PRIu64, brick,
+                 i);
+        have_bytes = !dict_get_uint64(dict, key, &healed_bytes);
+        snprintf(key, sizeof key, "statistics_heal_usecs-%d-%" PRIu64, brick,
+                 i);
+        if (dict_get_uint64(dict, key, &heal_usecs))
+            heal_usecs = 0;
 
         cli_out("\nStarting time of crawl: %s", start_time_str);
         if (progress == 1)
@@ -7976,6 +8009,13 @@ cmd_heal_volume_statistics_out(dict_t *dict, int brick)
         cli_out("No. of entries healed: %" PRIu64, healed_count);
         cli_out("No. of entries in split-brain: %" PRIu64, split_brain_count);
         cli_out("No. of heal failed entries: %" PRIu64, heal_failed_count);
+        if (have_bytes) {
+            cli_out("No. of bytes healed: %" PRIu64, healed_bytes);
+            cli_out("Data heal rate: %.2f MB/s",
+                    heal_usecs ? ((double)healed_bytes / heal_usecs) *
+                                     1000000 / (1024 * 1024)
+                               : 0.0);
+        }
     }
 
 out:
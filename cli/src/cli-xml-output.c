@@ -1927,6 +1927,14 @@ cli_xml_output_vol_profile_stats(xmlTextWriterPtr writer, dict_t *dict,
     double avg_latency = 0.0;
     double max_latency = 0.0;
     double min_latency = 0.0;
+    uint64_t pct_latency = 0;
+    static const char *pct_elements[GF_LATENCY_PCT_MAX] = {
+        [GF_LATENCY_P50] = "p50Latency",
+        [GF_LATENCY_P90] = "p90Latency",
+        [GF_LATENCY_P99] = "p99Latency",
+        [GF_LATENCY_P999] = "p999Latency",
+    };
+    int p = 0;
     uint64_t duration = 0;
     uint64_t total_read = 0;
     uint64_t total_write = 0;
@@ -2032,6 +2040,17 @@ cli_xml_output_vol_profile_stats(xmlTextWriterPtr writer, dict_t *dict,
                                               "%f", max_latency);
         XML_RET_CHECK_AND_GOTO(ret, out);
 
+        /* percentiles are missing when the brick runs an older version */
+        for (p = 0; p < GF_LATENCY_PCT_MAX; p++) {
+            snprintf(key, sizeof(key), "%d-%d-%d-%slatency", brick_index,
+                     interval, i, gf_latency_pct_names[p]);
+            if (dict_get_uint64(dict, key, &pct_latency))
+                continue;
+            ret = xmlTextWriterWriteFormatElement(
+                writer, (xmlChar *)pct_elements[p], "%" PRIu64, pct_latency);
+            XML_RET_CHECK_AND_GOTO(ret, out);
+        }
+
         /* </fop> */
         ret = xmlTextWriterEndElement(writer);
         XML_RET_CHECK_AND_GOTO(ret, out);
@@ -23,10 +23,13 @@
 #include <libgen.h>
 #include <errno.h>
 #include <sys/time.h>
+#include <dirent.h>
 
 struct state {
     char need_op_write : 1;
     char need_op_read : 1;
+    char need_op_copy : 1;
+    char need_op_list : 1;
 
     char need_iface_fileio : 1;
     char need_iface_xattr : 1;
@@ -91,6 +94,16 @@ parse_opts(int key, char *arg, struct argp_state *_state)
             } else if (strcasecmp(arg, "both") == 0) {
                 state->need_op_write = 1;
                 state->need_op_read = 1;
+            } else if (strcasecmp(arg, "copy") == 0) {
+                /* the source files have to exist, so write them first */
+                state->need_op_write = 1;
+                state->need_op_read = 0;
+                state->need_op_copy = 1;
+            } else if (strcasecmp(arg, "list") == 0) {
+                /* creates the files empty, then lists their directory */
+                state->need_op_write = 0;
+                state->need_op_read = 0;
+                state->need_op_list = 1;
             } else {
                 fprintf(stderr, "unknown op: %s\n", arg);
                 return -1;
@@ -207,6 +220,147 @@ do_mode_posix_iface_fileio_read(struct state *state)
     return i;
 }
 
+static int
+copy_open(struct state *state, long int i, int *fd_in, int *fd_out)
+{
+    char filename[512];
+    char copyname[520];
+
+    sprintf(filename, "%s.%06ld", state->prefix, i);
+    sprintf(copyname, "%s.copy", filename);
+
+    *fd_in = open(filename, O_RDONLY);
+    if (*fd_in == -1) {
+        fprintf(stderr, "open(%s) => %s\n", filename, strerror(errno));
+        return -1;
+    }
+    *fd_out = open(copyname, O_CREAT | O_TRUNC | O_WRONLY, 00600);
+    if (*fd_out == -1) {
+        fprintf(stderr, "open(%s) => %s\n", copyname, strerror(errno));
+        close(*fd_in);
+        return -1;
+    }
+
+    return 0;
+}
+
+int
+do_mode_posix_iface_fileio_copy_rw(struct state *state)
+{
+    long int i;
+    ssize_t ret = -1;
+    char block[state->block_size];
+
+    for (i = 0; i < state->count; i++) {
+        int fd_in = -1;
+        int fd_out = -1;
+
+        if (copy_open(state, i, &fd_in, &fd_out) != 0)
+            break;
+
+        while ((ret = read(fd_in, block, state->block_size)) > 0) {
+            if (write(fd_out, block, ret) != ret) {
+                ret = -1;
+                break;
+            }
+            state->io_size += ret;
+        }
+        close(fd_in);
+        close(fd_out);
+        if (ret < 0) {
+            fprintf(stderr, "copy (%ld) => %s\n", i, strerror(errno));
+            break;
+        }
+    }
+
+    return i;
+}
+
+int
+do_mode_posix_iface_fileio_copy_offload(struct state *state)
+{
+    long int i;
+    ssize_t ret = -1;
+
+    for (i = 0; i < state->count; i++) {
+        int fd_in = -1;
+        int fd_out = -1;
+
+        if (copy_open(state, i, &fd_in, &fd_out) != 0)
+            break;
+
+        /* the kernel falls back to a page cache copy on EXDEV, which is
+         * what gluster returns when the range cannot be offloaded */
+        while ((ret = copy_file_range(fd_in, NULL, fd_out, NULL,
+                                      state->block_size, 0)) > 0)
+            state->io_size += ret;
+
+        close(fd_in);
+        close(fd_out);
+        if (ret < 0) {
+            fprintf(stderr, "copy_file_range (%ld) => %s\n", i,
+                    strerror(errno));
+            break;
+        }
+    }
+
+    return i;
+}
+
+int
+do_mode_posix_iface_fileio_create(struct state *state)
+{
+    long int i;
+
+    for (i = 0; i < state->count; i++) {
+        int fd = -1;
+        char filename[512];
+
+        sprintf(filename, "%s.%06ld", state->prefix, i);
+
+        fd = open(filename, O_CREAT | O_WRONLY, 00600);
+        if (fd == -1) {
+            fprintf(stderr, "open(%s) => %s\n", filename, strerror(errno));
+            break;
+        }
+        close(fd);
+    }
+
+    return i;
+}
+
+int
+do_mode_posix_iface_fileio_list(struct state *state)
+{
+    long int i = 0;
+    char *dname = NULL, *dirc = NULL;
+    DIR *dir = NULL;
+    struct dirent *entry = NULL;
+    struct stat st;
+
+    dirc = strdup(state->prefix);
+    dname = dirname(dirc);
+
+    dir = opendir(dname);
+    if (!dir) {
+        fprintf(stderr, "opendir(%s) => %s\n", dname, strerror(errno));
+        free(dirc);
+        return 0;
+    }
+
+    /* like 'ls -l', which is what readdirp serves */
+    while ((entry = readdir(dir)) != NULL) {
+        if (fstatat(dirfd(dir), entry->d_name, &st, AT_SYMLINK_NOFOLLOW) != 0)
+            continue;
+        i++;
+    }
+
+    closedir(dir);
+    free(dirc);
+
+    return i;
+}
+
 int
 do_mode_posix_iface_fileio(struct state *state)
 {
@@ -216,6 +370,16 @@ do_mode_posix_iface_fileio(struct state *state)
     if (state->need_op_read)
         MEASURE(do_mode_posix_iface_fileio_read, state);
 
+    if (state->need_op_copy) {
+        MEASURE(do_mode_posix_iface_fileio_copy_rw, state);
+        MEASURE(do_mode_posix_iface_fileio_copy_offload, state);
+    }
+
+    if (state->need_op_list) {
+        MEASURE(do_mode_posix_iface_fileio_create, state);
+        MEASURE(do_mode_posix_iface_fileio_list, state);
+    }
+
     return 0;
 }
 
@@ -320,7 +484,7 @@ do_actions(struct state *state)
 }
 
 static struct argp_option options[] = {
-    {"op", 'o', "OPERATIONS", 0, "WRITE|READ|BOTH - defaults to BOTH"},
+    {"op", 'o', "OPERATIONS", 0, "WRITE|READ|BOTH|COPY|LIST - defaults to BOTH"},
     {"iface", 'i', "INTERFACE", 0, "FILEIO|XATTR|BOTH - defaults to FILEIO"},
     {"block", 'b', "BLOCKSIZE", 0, "<NUM> - defaults to 4096"},
     {"specfile", 's', "SPECFILE", 0, "absolute path to specfile"},
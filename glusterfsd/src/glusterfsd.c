@@ -268,6 +268,8 @@ static struct argp_option gf_options[] = {
     {"brick-mux", ARGP_BRICK_MUX_KEY, 0, 0, "Enable brick mux. "},
     {"io-engine", ARGP_IO_ENGINE_KEY, "ENGINE", OPTION_ARG_OPTIONAL,
      "force utilization of the given I/O ENGINE"},
+    {"timer-threads", ARGP_TIMER_THREADS_KEY, "INTEGER", OPTION_ARG_OPTIONAL,
+     "set the number of threads running timer callbacks [default: 1]"},
     {"fuse-handle-copy_file_range", ARGP_FUSE_HANDLE_COPY_FILE_RANGE, "BOOL",
      OPTION_ARG_OPTIONAL | OPTION_HIDDEN,
      "enable the handler of the FUSE_COPY_FILE_RANGE message"},
@@ -1435,6 +1437,20 @@ parse_opts(int key, char *arg, struct argp_state *state)
             }
             break;
 
+        case ARGP_TIMER_THREADS_KEY:
+            if (gf_string2uint32(arg, &cmd_args->timer_threads)) {
+                argp_failure(state, -1, 0,
+                             "unknown timer thread count option %s", arg);
+            } else if ((cmd_args->timer_threads < 1) ||
+                       (cmd_args->timer_threads > GF_TIMER_MAX_THREADS)) {
+                argp_failure(state, -1, 0,
+                             "Invalid timer thread count %s. "
+                             "Valid range: [\"1, %d\"]",
+                             arg, GF_TIMER_MAX_THREADS);
+            }
+
+            break;
+
         case ARGP_FUSE_SETLK_HANDLE_INTERRUPT_KEY:
             if (!arg)
                 arg = "yes";
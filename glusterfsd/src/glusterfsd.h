@@ -118,6 +118,7 @@ enum argp_option_keys {
     ARGP_FUSE_INODE_TABLESIZE_KEY = 198,
     ARGP_FUSE_SETLK_HANDLE_INTERRUPT_KEY = 199,
     ARGP_FUSE_HANDLE_COPY_FILE_RANGE = 200,
+    ARGP_TIMER_THREADS_KEY = 201,
 };
 
 int
@@ -13,6 +13,17 @@
 #include <zlib.h>
 #include <stdint.h>
 #include <string.h>
+#define XXH_INLINE_ALL
+#include "xxhash.h"
+
+#include "glusterfs/checksum.h"
+
+/* xxhash 0.8 has a native 128 bit hash, older ones (like the one in contrib)
+ * only get two 64 bit hashes of different seeds */
+#if defined(XXH_VERSION_NUMBER) && (XXH_VERSION_NUMBER >= 800)
+#define GF_HAVE_XXH3 1
+#endif
+#define GF_XXH64_SECOND_SEED 0x9e3779b97f4a7c15ULL
 
 /*
  * The "weak" checksum required for the rsync algorithm.
@@ -42,3 +53,38 @@ gf_rsync_md5_checksum(unsigned char *data, size_t len, unsigned char *md5)
 {
     MD5(data, len, md5);
 }
+
+/*
+ * The fast "strong" checksum: not a cryptographic one, but good enough to
+ * tell two copies of a block apart at a fraction of the cost of MD5. Its
+ * name tells which hash computed it, as only those of the same hash can be
+ * compared.
+ */
+const char *
+gf_rsync_xxh128_name(void)
+{
+#ifdef GF_HAVE_XXH3
+    return "xxh3-128";
+#else
+    return "xxh64-128";
+#endif
+}
+
+void
+gf_rsync_xxh128_checksum(unsigned char *data, size_t len, unsigned char *sum)
+{
+#ifdef GF_HAVE_XXH3
+    XXH128_canonical_t canonical;
+
+    XXH128_canonicalFromHash(&canonical, XXH3_128bits(data, len));
+    memcpy(sum, &canonical, GF_XXH128_DIGEST_LENGTH);
+#else
+    XXH64_canonical_t canonical;
+
+    XXH64_canonicalFromHash(&canonical, XXH64(data, len, 0));
+    memcpy(sum, &canonical, sizeof(canonical));
+    XXH64_canonicalFromHash(&canonical,
+                            XXH64(data, len, GF_XXH64_SECOND_SEED));
+    memcpy(sum + sizeof(canonical), &canonical, sizeof(canonical));
+#endif
+}
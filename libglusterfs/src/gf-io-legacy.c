@@ -79,6 +79,23 @@ gf_io_legacy_callback(uint64_t seq, uint64_t id, gf_io_op_t *op, uint32_t count)
     return 0;
 }
 
+static uint64_t
+gf_io_legacy_sendmsg(uint64_t seq, uint64_t id, gf_io_op_t *op, uint32_t count)
+{
+    int32_t res;
+
+    /* The legacy engine has no way to do this asynchronously, so the
+     * message is sent inline. Non-blocking sockets will return -EAGAIN
+     * as usual if the message cannot be sent right now. */
+    do {
+        res = gf_res_errno(sendmsg(op->msg.fd, op->msg.hdr, op->msg.flags));
+    } while (caa_unlikely(res == -EINTR));
+
+    gf_io_legacy_cbk(id, res);
+
+    return 0;
+}
+
 const gf_io_engine_t gf_io_engine_legacy = {
     .name = "legacy",
     .mode = GF_IO_MODE_LEGACY,
@@ -95,5 +112,6 @@ const gf_io_engine_t gf_io_engine_legacy = {
     .flush = gf_io_legacy_flush,
 
     .cancel = gf_io_legacy_cancel,
-    .callback = gf_io_legacy_callback
+    .callback = gf_io_legacy_callback,
+    .sendmsg = gf_io_legacy_sendmsg
 };
@@ -859,6 +859,25 @@ gf_io_uring_callback(uint64_t seq, uint64_t id, gf_io_op_t *op, uint32_t count)
     return gf_io_uring_common(seq, id, sqe, count);
 }
 
+static uint64_t
+gf_io_uring_sendmsg(uint64_t seq, uint64_t id, gf_io_op_t *op, uint32_t count)
+{
+    struct io_uring_sqe *sqe;
+
+    sqe = gf_io_uring_get(seq + count - 1);
+
+    sqe->opcode = IORING_OP_SENDMSG;
+    sqe->flags = 0;
+    sqe->ioprio = 0;
+    sqe->fd = op->msg.fd;
+    sqe->off = 0;
+    sqe->addr = (uintptr_t)op->msg.hdr;
+    sqe->len = 1;
+    sqe->msg_flags = op->msg.flags;
+
+    return gf_io_uring_common(seq, id, sqe, count);
+}
+
 const gf_io_engine_t gf_io_engine_io_uring = {
     .name = "io_uring",
     .mode = GF_IO_MODE_IO_URING,
@@ -875,5 +894,6 @@ const gf_io_engine_t gf_io_engine_io_uring = {
     .flush = gf_io_uring_flush,
 
     .cancel = gf_io_uring_cancel,
-    .callback = gf_io_uring_callback
+    .callback = gf_io_uring_callback,
+    .sendmsg = gf_io_uring_sendmsg
 };
@@ -11,6 +11,13 @@
 #ifndef __CHECKSUM_H__
 #define __CHECKSUM_H__
 
+/* rchecksum xdata: in the request, asks for the fast checksum; in the reply,
+ * the name of the algorithm of the strong checksum when it is not one of
+ * MD5 or SHA256 */
+#define GF_RCHECKSUM_ALGO_KEY "rchecksum-algorithm"
+#define GF_RCHECKSUM_ALGO_FAST "fast"
+#define GF_XXH128_DIGEST_LENGTH 16
+
 uint32_t
 gf_rsync_weak_checksum(unsigned char *buf, size_t len);
 
@@ -19,4 +26,10 @@ gf_rsync_strong_checksum(unsigned char *buf, size_t len, unsigned char *sum);
 
 void
 gf_rsync_md5_checksum(unsigned char *data, size_t len, unsigned char *md5);
+
+const char *
+gf_rsync_xxh128_name(void);
+
+void
+gf_rsync_xxh128_checksum(unsigned char *data, size_t len, unsigned char *sum);
 #endif /* __CHECKSUM_H__ */
@@ -16,6 +16,7 @@
 #include <inttypes.h>
 #include <pthread.h>
 #include <errno.h>
+#include <sys/socket.h>
 
 #include <urcu/uatomic.h>
 
@@ -198,6 +199,18 @@ struct _gf_io_op {
             /* Id of the request to cancel. */
             uint64_t id;
         } cancel;
+
+        struct {
+            /* Message to send. It must remain valid until the request
+             * completes. */
+            struct msghdr *hdr;
+
+            /* Socket where the message will be sent. */
+            int32_t fd;
+
+            /* Flags for sendmsg(). */
+            uint32_t flags;
+        } msg;
     };
 };
 
@@ -287,6 +300,9 @@ typedef struct _gf_io_engine {
     /* Function to call a callback in the background. */
     gf_io_engine_op_t callback;
 
+    /* Function to send a message through a socket. */
+    gf_io_engine_op_t sendmsg;
+
     /* Mode of operation of the engine. */
     gf_io_mode_t mode;
 } gf_io_engine_t;
@@ -602,4 +618,38 @@ gf_io_async_prepare(gf_io_request_t *req, gf_io_async_t async, void *data,
     gf_io_async_common(&req->op, async, cbk, data);
 }
 
+/* Operation 'sendmsg' */
+
+static inline void
+gf_io_sendmsg_common(gf_io_op_t *op, int32_t fd, struct msghdr *hdr,
+                     uint32_t flags)
+{
+    op->msg.hdr = hdr;
+    op->msg.fd = fd;
+    op->msg.flags = flags;
+}
+
+static inline uint64_t
+gf_io_sendmsg(gf_io_callback_t cbk, int32_t fd, struct msghdr *hdr,
+              uint32_t flags, void *data)
+{
+    gf_io_op_t *op;
+    uint64_t seq, id;
+
+    seq = gf_io_reserve(1);
+    id = gf_io_get(seq);
+    op = gf_io_single_common(id, cbk, data);
+    gf_io_sendmsg_common(op, fd, hdr, flags);
+
+    return gf_io.engine.sendmsg(seq, id, op, 1);
+}
+
+static inline void
+gf_io_sendmsg_prepare(gf_io_request_t *req, gf_io_callback_t cbk, int32_t fd,
+                      struct msghdr *hdr, uint32_t flags, void *data)
+{
+    gf_io_prepare_common(req, gf_io.engine.sendmsg, cbk, data);
+    gf_io_sendmsg_common(&req->op, fd, hdr, flags);
+}
+
 #endif /* __GF_IO_H__ */
@@ -239,6 +239,8 @@ enum gf_internal_fop_indicator {
 
 /* afr related */
 #define AFR_XATTR_PREFIX "trusted.afr"
+/* suffix of the range maps, AFR_XATTR_PREFIX ".<client>" AFR_RANGES_SUFFIX */
+#define AFR_RANGES_SUFFIX ".ranges"
 
 /* Index xlator related */
 #define GF_XATTROP_INDEX_GFID "glusterfs.xattrop_index_gfid"
@@ -250,6 +252,9 @@ enum gf_internal_fop_indicator {
 #define GF_XATTROP_ENTRY_OUT_KEY "glusterfs.xattrop-entry-delete"
 #define GF_INDEX_IA_TYPE_GET_REQ "glusterfs.index-ia-type-get-req"
 #define GF_INDEX_IA_TYPE_GET_RSP "glusterfs.index-ia-type-get-rsp"
+/* "<k>/<n>" in readdir xdata of an index directory: list only the entries
+ * whose gfid falls in shard k of n */
+#define GF_INDEX_SHARD_KEY "glusterfs.index-shard"
 
 #define GF_HEAL_INFO "glusterfs.heal-info"
 #define GF_AFR_HEAL_SBRAIN "glusterfs.heal-sbrain"
@@ -262,6 +267,18 @@ enum gf_internal_fop_indicator {
 #define GF_AFR_DIRTY "trusted.afr.dirty"
 #define GF_XATTROP_ENTRY_OUT "glusterfs.xattrop-entry-delete"
 #define GF_XATTROP_PURGE_INDEX "glusterfs.xattrop-purge-index"
+/* xattrop of more inodes in one request: the request carries the number of
+ * extra inodes and for each of them its gfid and serialized xattr dict, the
+ * reply the number of extra inodes handled and for each its errno and
+ * serialized result dict. Extra inodes are numbered from 1. */
+#define GF_XATTROP_BATCH_KEY "glusterfs.xattrop-batch"
+#define GF_XATTROP_BATCH_FMT GF_XATTROP_BATCH_KEY ".%d"
+#define GF_XATTROP_BATCH_GFID_FMT GF_XATTROP_BATCH_FMT ".gfid"
+#define GF_XATTROP_BATCH_ERRNO_FMT GF_XATTROP_BATCH_FMT ".errno"
+#define GF_XATTROP_BATCH_MAX 63 /* extra inodes in a batch at most */
+/* "<offset> <len> <name>..." - the byte range a write modified, to be
+ * recorded by the brick in each of the named range-map xattrs */
+#define GF_XATTROP_DIRTY_RANGE "glusterfs.xattrop-dirty-range"
 
 #define GF_GFIDLESS_LOOKUP "gfidless-lookup"
 #define GF_UNLINKED_LOOKUP "unlinked-lookup"
@@ -456,6 +473,10 @@ fop_enum_to_pri_string(glusterfs_fop_t fop);
 /* key value which quick read uses to get small files in lookup cbk */
 #define GF_CONTENT_KEY "glusterfs.content"
 
+/* key value which asks lookup of a directory for a filter of its names,
+ * see names-filter.h */
+#define GF_NAMES_FILTER_KEY "glusterfs.names-filter"
+
 struct _xlator_cmdline_option {
     struct list_head cmd_args;
     char *volume;
@@ -597,6 +618,8 @@ struct _cmd_args {
     bool brick_mux;
 
     char *io_engine;
+
+    uint32_t timer_threads; /* threads firing gf_timer callbacks */
 };
 typedef struct _cmd_args cmd_args_t;
 
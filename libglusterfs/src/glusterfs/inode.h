@@ -32,8 +32,36 @@ typedef struct _dentry dentry_t;
 #include "glusterfs/compat-uuid.h"
 #include "glusterfs/fd.h"
 
-struct _inode_table {
+/* Number of independently locked partitions of an inode table. Must be a
+ * power of 2. */
+#define GF_INODE_TABLE_SHARDS 32
+
+/* Inodes are spread over the shards of their table when created. The shard
+ * lock protects the lists below and the list membership flags of the inodes
+ * on them. It also serializes the 0 <-> 1 transitions of their ref count,
+ * which are the only ones moving an inode between lists; any other ref or
+ * unref is a lock-free atomic update. hash_lock protects the inode_hash
+ * buckets whose index modulo GF_INODE_TABLE_SHARDS is the shard index. */
+struct _inode_table_shard {
     pthread_mutex_t lock;
+    struct list_head active;     /* inodes currently active (in an fop) */
+    struct list_head lru;        /* inodes recently used, lru.next oldest */
+    struct list_head purge;      /* inodes to be purged soon */
+    struct list_head invalidate; /* inodes in invalidation queue */
+    uint32_t active_size;
+    uint32_t lru_size;
+    uint32_t purge_size;
+    uint32_t invalidate_size;
+    pthread_mutex_t hash_lock;
+    gf_atomic_t ref_fast; /* refs and unrefs done without the lock */
+    gf_atomic_t ref_slow; /* refs and unrefs that needed the lock */
+};
+
+struct _inode_table {
+    /* protects the dentry tree: name_hash, the dentry lists and parents of
+     * the inodes, and linking inodes into inode_hash. Taken for writing to
+     * retire inodes which still have dentries, as that drops them. */
+    pthread_rwlock_t lock;
     size_t dentry_hashsize; /* Number of buckets for dentry hash*/
     size_t inode_hashsize;  /* Size of inode hash table */
     char *name;             /* name of the inode table, just for gf_log() */
@@ -41,14 +69,9 @@ struct _inode_table {
     xlator_t *xl;           /* xlator to be called to do purge */
     struct list_head *inode_hash; /* buckets for inode hash table */
     struct list_head *name_hash;  /* buckets for dentry hash table */
-    struct list_head active; /* list of inodes currently active (in an fop) */
-    uint32_t active_size;    /* count of inodes in active list */
-    uint32_t lru_limit;      /* maximum LRU cache size */
-    struct list_head lru;    /* list of inodes recently used.
-                                lru.next most recent */
-    uint32_t lru_size;       /* count of inodes in lru list  */
-    uint32_t purge_size;     /* count of inodes in purge list */
-    struct list_head purge;  /* list of inodes to be purged soon */
+    uint32_t lru_limit;           /* maximum LRU cache size, all shards */
+    gf_atomic_t shard_rotor;      /* picks the shard of new inodes */
+    struct _inode_table_shard shards[GF_INODE_TABLE_SHARDS];
 
     struct mem_pool *fd_mem_pool; /* memory pool for fd_t */
     int ctxcount;                 /* number of slots in inode->ctx */
@@ -59,8 +82,6 @@ struct _inode_table {
        specially in case of fuse-bridge */
     int32_t (*invalidator_fn)(xlator_t *, inode_t *);
     xlator_t *invalidator_xl;
-    struct list_head invalidate; /* inodes which are in invalidation queue */
-    uint32_t invalidate_size;    /* count of inodes in invalidation list */
     uint32_t root_level; /* Save the xlator level at the time of inode table
                             creation */
     /* flag to indicate whether the cleanup of the inode
@@ -105,7 +126,8 @@ struct _inode {
     gf_atomic_t kids;
     uint32_t fd_count;            /* Open fd count */
     uint32_t active_fd_count;     /* Active open fd count */
-    uint32_t ref;                 /* reference count on this inode */
+    uint32_t ref;                 /* reference count, updated atomically */
+    uint32_t shard;               /* index of the table shard holding it */
     ia_type_t ia_type;            /* what kind of file */
     struct list_head fd_list;     /* list of open files on this inode */
     struct list_head dentry_list; /* list of directory entries for this inode */
@@ -116,6 +138,7 @@ struct _inode {
     bool in_invalidate_list;  /* Set if inode is in table invalidate list */
     bool invalidate_sent;     /* Set it if invalidator_fn is called for inode */
     bool in_lru_list;         /* Set if inode is in table lru list */
+    bool retired;             /* Set once on its way to the purge list */
     struct _inode_ctx _ctx[]; /* replacement for dict_t *(inode->ctx) */
 };
 
@@ -85,6 +85,8 @@ struct iobuf_arena {
     int passive_cnt;
     int max_active; /* max active buffers at a given time */
     uint32_t page_count;
+    int pin_index; /* position in the pinned table, valid if pinned */
+    int pinned;    /* registered with the kernel, never unmapped */
     struct iobuf iobufs[]; /* allocated iobufs list */
 };
 
@@ -107,6 +109,7 @@ struct iobuf_pool {
     uint64_t request_misses; /* mostly the requests for higher
                                value of iobufs */
     int arena_cnt;
+    int pinned_cnt; /* arenas handed out by iobuf_pool_pin_arenas() */
 };
 
 struct iobuf_pool *
@@ -159,6 +162,13 @@ iobuf_stats_dump(struct iobuf_pool *iobuf_pool);
 struct iobuf *
 iobuf_get2(struct iobuf_pool *iobuf_pool, size_t page_size);
 
+struct iobuf *
+iobuf_get_pinned(struct iobuf_pool *iobuf_pool, size_t page_size);
+
+int
+iobuf_pool_pin_arenas(struct iobuf_pool *iobuf_pool, struct iovec *iov,
+                      int max);
+
 struct iobuf *
 iobuf_get_page_aligned(struct iobuf_pool *iobuf_pool, size_t page_size,
                        size_t align_size);
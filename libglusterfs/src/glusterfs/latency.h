@@ -13,12 +13,43 @@
 
 #include <inttypes.h>
 #include <time.h>
+#include <stddef.h>
+
+/* Log-linear (HDR style) latency histogram. Every power of two is split
+ * into GF_LATENCY_HIST_SUB_BUCKETS linear buckets, so a recorded value is
+ * off by at most 1/GF_LATENCY_HIST_SUB_BUCKETS of itself. Values are in
+ * nanoseconds; anything above 2^GF_LATENCY_HIST_MAX_BITS (~18 minutes)
+ * lands in the last bucket. Buckets are bumped with atomic adds, so any
+ * number of threads can record into the same histogram without a lock;
+ * readers merge a snapshot of the buckets when dumping. */
+#define GF_LATENCY_HIST_SUB_BITS 3
+#define GF_LATENCY_HIST_SUB_BUCKETS (1 << GF_LATENCY_HIST_SUB_BITS)
+#define GF_LATENCY_HIST_MAX_BITS 40
+#define GF_LATENCY_HIST_BUCKETS                                                \
+    ((GF_LATENCY_HIST_MAX_BITS - GF_LATENCY_HIST_SUB_BITS + 1)                 \
+     << GF_LATENCY_HIST_SUB_BITS)
+
+typedef struct _gf_latency_hist {
+    uint64_t buckets[GF_LATENCY_HIST_BUCKETS];
+} gf_latency_hist_t;
+
+/* Percentiles reported by the dumps */
+typedef enum {
+    GF_LATENCY_P50 = 0,
+    GF_LATENCY_P90,
+    GF_LATENCY_P99,
+    GF_LATENCY_P999,
+    GF_LATENCY_PCT_MAX
+} gf_latency_pct_t;
+
+extern const char *gf_latency_pct_names[GF_LATENCY_PCT_MAX];
 
 typedef struct _gf_latency {
     uint64_t min;   /* min time for the call (nanoseconds) */
     uint64_t max;   /* max time for the call (nanoseconds) */
     uint64_t total; /* total time (nanoseconds) */
     uint64_t count;
+    gf_latency_hist_t *hist; /* allocated on first use, may be NULL */
 } gf_latency_t;
 
 gf_latency_t *
@@ -30,4 +61,20 @@ gf_latency_reset(gf_latency_t *lat);
 void
 gf_latency_update(gf_latency_t *lat, struct timespec *begin,
                   struct timespec *end);
+
+gf_latency_hist_t *
+gf_latency_hist_new(size_t n);
+
+void
+gf_latency_hist_reset(gf_latency_hist_t *hist);
+
+void
+gf_latency_hist_record(gf_latency_hist_t *hist, uint64_t value);
+
+uint64_t
+gf_latency_hist_merge(gf_latency_hist_t *dst, gf_latency_hist_t *src);
+
+void
+gf_latency_hist_percentiles(gf_latency_hist_t *hist,
+                            uint64_t pct[GF_LATENCY_PCT_MAX]);
 #endif /* __LATENCY_H__ */
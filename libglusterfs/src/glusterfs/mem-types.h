@@ -117,7 +117,10 @@ enum gf_common_mem_types_ {
     gf_common_volfile_t,
     gf_common_mt_server_cmdline_t, /* used only in one location */
     gf_common_mt_latency_t,        /* used only in one location */
+    gf_common_mt_latency_hist_t,
+    gf_common_mt_names_filter_t,
     gf_common_mt_data_pair_t,      /* used only in one location */
+    gf_common_mt_shm_cache_t,
     gf_common_mt_end,
 };
 #endif
@@ -0,0 +1,82 @@
+/*
+  Copyright (c) 2026 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+#ifndef __NAMES_FILTER_H__
+#define __NAMES_FILTER_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "glusterfs/glusterfs.h"
+#include "glusterfs/dict.h"
+
+/* Bloom filter of the names of a directory.
+ *
+ * A lookup of a directory with GF_NAMES_FILTER_KEY set to the size in
+ * bytes of the filter wanted gets the filter of the names the brick has
+ * in it. A name which doesn't pass the filter is not in the directory;
+ * a name which passes may or may not be. Filters of the same size can be
+ * merged, which is how distribute builds the filter of the whole volume
+ * and replicate and disperse the one of a directory from its copies.
+ * gf_names_filter_has_nocase() answers the same without regard to the case
+ * of ASCII letters, for the case insensitive lookups of Samba.
+ *
+ * The filter is sent as it is kept in memory: the header is in network
+ * byte order and the bits are addressed by byte, so it doesn't depend on
+ * the endianness of either side. */
+#define GF_NAMES_FILTER_HASHES 4
+#define GF_NAMES_FILTER_MIN_SIZE 64
+#define GF_NAMES_FILTER_MAX_SIZE (1 << 20)
+
+typedef struct _gf_names_filter {
+    uint32_t size;    /* bytes of bits[], a power of two */
+    uint32_t sources; /* number of filters merged in this one */
+    uint32_t count;   /* number of names added */
+    uint32_t hashes;
+    unsigned char bits[];
+} gf_names_filter_t;
+
+size_t
+gf_names_filter_round(size_t size);
+
+gf_names_filter_t *
+gf_names_filter_new(size_t size);
+
+size_t
+gf_names_filter_len(gf_names_filter_t *filter);
+
+uint32_t
+gf_names_filter_sources(gf_names_filter_t *filter);
+
+void
+gf_names_filter_add(gf_names_filter_t *filter, const char *name);
+
+gf_boolean_t
+gf_names_filter_has(gf_names_filter_t *filter, const char *name);
+
+gf_boolean_t
+gf_names_filter_has_nocase(gf_names_filter_t *filter, const char *name);
+
+int
+gf_names_filter_merge(gf_names_filter_t *dst, gf_names_filter_t *src);
+
+int
+gf_names_filter_merge_copy(gf_names_filter_t *dst, gf_names_filter_t *src);
+
+gf_names_filter_t *
+gf_names_filter_dup(gf_names_filter_t *filter);
+
+gf_names_filter_t *
+gf_names_filter_from_data(data_t *data);
+
+int
+gf_names_filter_to_dict(dict_t *dict, gf_names_filter_t *filter);
+
+#endif /* __NAMES_FILTER_H__ */
@@ -0,0 +1,70 @@
+/*
+  Copyright (c) 2026 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+#ifndef __RANGE_MAP_H__
+#define __RANGE_MAP_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "glusterfs/glusterfs.h"
+
+/* Map of the byte ranges of a file which were modified.
+ *
+ * It has a fixed number of bits, each of them covering 1 << shift bytes.
+ * When a range beyond the end of the map is marked the map gets coarser:
+ * the shift grows and pairs of bits are folded into one, so the map always
+ * covers at least what was marked, never less. Everything from 'tail' on
+ * is marked as well, for the modifications whose extent is not known.
+ * 'marks' counts the modifications recorded, so that a reader can tell
+ * whether the map saw all of those it is expected to cover.
+ *
+ * It is kept on disk and sent as it is in memory, the header in network
+ * byte order. */
+#define GF_RANGE_MAP_BITS 8192
+#define GF_RANGE_MAP_MIN_SHIFT 17 /* 128KB, the block of data self-heal */
+#define GF_RANGE_MAP_MAX_SHIFT 62
+
+typedef struct _gf_range_map {
+    uint32_t shift;
+    uint32_t nbits;
+    uint64_t tail;
+    uint64_t marks;
+    unsigned char bits[GF_RANGE_MAP_BITS / 8];
+} gf_range_map_t;
+
+void
+gf_range_map_init(gf_range_map_t *map);
+
+gf_boolean_t
+gf_range_map_valid(const void *buf, size_t len);
+
+gf_boolean_t
+gf_range_map_empty(const gf_range_map_t *map);
+
+void
+gf_range_map_mark(gf_range_map_t *map, uint64_t offset, uint64_t len);
+
+void
+gf_range_map_record(gf_range_map_t *map, uint64_t offset, uint64_t len);
+
+uint64_t
+gf_range_map_marks(const gf_range_map_t *map);
+
+gf_boolean_t
+gf_range_map_test(const gf_range_map_t *map, uint64_t offset, uint64_t len);
+
+void
+gf_range_map_merge(gf_range_map_t *dst, const gf_range_map_t *src);
+
+uint64_t
+gf_range_map_bytes(const gf_range_map_t *map, uint64_t size);
+
+#endif /* __RANGE_MAP_H__ */
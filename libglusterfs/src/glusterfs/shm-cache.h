@@ -0,0 +1,77 @@
+/*
+  Copyright (c) 2026 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+#ifndef __SHM_CACHE_H__
+#define __SHM_CACHE_H__
+
+#include <stdint.h>
+#include <sys/uio.h>
+
+#include "glusterfs/glusterfs.h"
+#include "glusterfs/atomic.h"
+
+/* Cache of file blocks shared by all the clients of a volume on a host.
+ *
+ * It lives in a file on tmpfs mapped by every process which opens it, so
+ * that FUSE mounts and gfapi consumers of the same volume keep one copy of
+ * the blocks they read instead of one each. A block is the data of a file
+ * from a block aligned offset, at most one block long and shorter only at
+ * the end of the file. It is tagged with the mtime of the file it was read
+ * from, and readers only take it when they expect the same mtime, which
+ * together with the invalidation of all the blocks of a file on upcall keeps
+ * the processes coherent.
+ *
+ * The blocks are kept in sets of GF_SHM_CACHE_WAYS, each with a process
+ * shared lock, the set of a block being picked by a hash of its gfid and
+ * offset and its place within the set by LRU. */
+#define GF_SHM_CACHE_WAYS 8
+#define GF_SHM_CACHE_DIR "/dev/shm"
+
+typedef struct _gf_shm_cache {
+    char *path;
+    void *map;
+    size_t map_size;
+    struct _gf_shm_cache_header *header;
+    struct _gf_shm_cache_set *sets;
+    char *blocks;
+    uint32_t block_size;
+    uint32_t nsets;
+    /* statistics of this process */
+    gf_atomic_t hits;
+    gf_atomic_t misses;
+    gf_atomic_t stale;
+    gf_atomic_t stores;
+    gf_atomic_t invalidations;
+} gf_shm_cache_t;
+
+gf_shm_cache_t *
+gf_shm_cache_open(const char *name, uint64_t size, uint32_t block_size);
+
+void
+gf_shm_cache_close(gf_shm_cache_t *cache);
+
+ssize_t
+gf_shm_cache_get(gf_shm_cache_t *cache, uuid_t gfid, off_t offset,
+                 struct iatt *stbuf, char *buf, size_t size);
+
+void
+gf_shm_cache_put(gf_shm_cache_t *cache, uuid_t gfid, off_t offset,
+                 struct iatt *stbuf, struct iovec *vector, int count);
+
+/* drops the blocks of gfid covering [offset, offset + size), or all of
+ * them when size is 0 */
+void
+gf_shm_cache_invalidate(gf_shm_cache_t *cache, uuid_t gfid, off_t offset,
+                        size_t size);
+
+void
+gf_shm_cache_dump(gf_shm_cache_t *cache, const char *prefix);
+
+#endif /* __SHM_CACHE_H__ */
@@ -13,6 +13,10 @@
 
 typedef int (*syncop_dir_scan_fn_t)(xlator_t *subvol, gf_dirent_t *entry,
                                     loc_t *parent, void *data);
+/* Called with the offset a scan can be resumed from once the entries read
+ * before it were handed to the scan jobs, and with 0 at the end of the
+ * directory. */
+typedef void (*syncop_dir_scan_progress_fn_t)(uint64_t offset, void *data);
 int
 syncop_ftw(xlator_t *subvol, loc_t *loc, int pid, void *data,
            int (*fn)(xlator_t *subvol, gf_dirent_t *entry, loc_t *parent,
@@ -23,6 +27,15 @@ syncop_mt_dir_scan(call_frame_t *frame, xlator_t *subvol, loc_t *loc, int pid,
                    void *data, syncop_dir_scan_fn_t fn, dict_t *xdata,
                    uint32_t max_jobs, uint32_t max_qlen);
 
+/* Scans @loc from @offset, up to the entry at @end when it is not 0. */
+int
+syncop_mt_dir_scan_from(call_frame_t *frame, xlator_t *subvol, loc_t *loc,
+                        int pid, void *data, syncop_dir_scan_fn_t fn,
+                        dict_t *xdata, uint32_t max_jobs, uint32_t max_qlen,
+                        uint64_t offset, uint64_t end,
+                        syncop_dir_scan_progress_fn_t progress,
+                        void *progress_data);
+
 int
 syncop_dir_scan(xlator_t *subvol, loc_t *loc, int pid, void *data,
                 int (*fn)(xlator_t *subvol, gf_dirent_t *entry, loc_t *parent,
@@ -19,7 +19,8 @@ typedef enum tbf_ops {
     TBF_OP_HASH = 0,    /* checksum calculation  */
     TBF_OP_READ = 1,    /* inode read(s)         */
     TBF_OP_READDIR = 2, /* dentry read(s)        */
-    TBF_OP_MAX = 3,
+    TBF_OP_UNLINK = 3,  /* bytes of files removed */
+    TBF_OP_MAX = 4,
 } tbf_ops_t;
 
 /**
@@ -52,6 +53,8 @@ typedef struct tbf_bucket {
     struct list_head queued; /* list of non-conformant requests */
 
     unsigned long token_gen_interval; /* Token generation interval in usec */
+
+    gf_boolean_t stop; /* set by tbf_fini() */
 } tbf_bucket_t;
 
 typedef struct tbf {
@@ -64,6 +67,9 @@ tbf_init(tbf_opspec_t *, unsigned int);
 int
 tbf_mod(tbf_t *, tbf_opspec_t *);
 
+void
+tbf_fini(tbf_t *);
+
 void
 tbf_throttle(tbf_t *, tbf_ops_t, unsigned long);
 
@@ -17,6 +17,21 @@
 
 typedef void (*gf_timer_cbk_t)(void *);
 
+/* Timers live in a hierarchical timing wheel. Level 0 has one slot per
+ * GF_TIMER_TICK_NS, each slot of the next levels spans a whole turn of
+ * the level below it. Timers further away than the last level can hold
+ * (~49 days) wait in its last slot and are re-armed when they get there. */
+#define GF_TIMER_TICK_NS 1000000 /* 1ms */
+#define GF_TIMER_WHEEL_L0_BITS 8
+#define GF_TIMER_WHEEL_LN_BITS 6
+#define GF_TIMER_WHEEL_L0_SIZE (1 << GF_TIMER_WHEEL_L0_BITS)
+#define GF_TIMER_WHEEL_LN_SIZE (1 << GF_TIMER_WHEEL_LN_BITS)
+#define GF_TIMER_WHEEL_L0_MASK (GF_TIMER_WHEEL_L0_SIZE - 1)
+#define GF_TIMER_WHEEL_LN_MASK (GF_TIMER_WHEEL_LN_SIZE - 1)
+#define GF_TIMER_WHEEL_LEVELS 4 /* levels above level 0 */
+
+#define GF_TIMER_MAX_THREADS 16
+
 struct _gf_timer {
     union {
         struct list_head list;
@@ -26,6 +41,7 @@ struct _gf_timer {
         };
     };
     struct timespec at;
+    uint64_t expires; /* tick at which the timer is due */
     gf_timer_cbk_t callbk;
     void *data;
     xlator_t *xl;
@@ -33,10 +49,16 @@ struct _gf_timer {
 };
 
 struct _gf_timer_registry {
-    struct list_head active;
+    struct list_head wheel0[GF_TIMER_WHEEL_L0_SIZE];
+    struct list_head wheel[GF_TIMER_WHEEL_LEVELS][GF_TIMER_WHEEL_LN_SIZE];
+    struct list_head expired; /* due timers waiting for a thread */
+    uint64_t tick;            /* next tick to process */
+    uint64_t wakeup;          /* tick the idle threads sleep until */
+    uint64_t count;           /* timers not yet fired or cancelled */
     pthread_mutex_t lock;
     pthread_cond_t cond;
-    pthread_t th;
+    pthread_t th[GF_TIMER_MAX_THREADS];
+    int threads;
     char fin;
 };
 
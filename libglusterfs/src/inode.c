@@ -15,6 +15,7 @@
 #include <stdint.h>
 #include "glusterfs/list.h"
 #include <assert.h>
+#include <urcu/uatomic.h>
 #include "glusterfs/libglusterfs-messages.h"
 
 /* TODO:
@@ -115,9 +116,8 @@ Based on this, the code could be similar to this:
 */
 // clang-format on
 
-#define INODE_DUMP_LIST(head, key_buf, key_prefix, list_type)                  \
+#define INODE_DUMP_LIST(head, key_buf, key_prefix, list_type, i)               \
     {                                                                          \
-        int i = 1;                                                             \
         inode_t *inode = NULL;                                                 \
         list_for_each_entry(inode, head, list)                                 \
         {                                                                      \
@@ -128,9 +128,39 @@ Based on this, the code could be similar to this:
         }                                                                      \
     }
 
+/* Locking:
+ *
+ * table->lock (rwlock) protects the dentry tree. It is taken for reading by
+ * lookups of names and paths, and for writing by anything that changes
+ * dentries, which includes retiring an inode.
+ *
+ * shard->lock protects the active/lru/purge/invalidate lists of a shard and
+ * the list flags of the inodes living in it, and serializes the 0 <-> 1
+ * transitions of their ref count. It may be taken with or without
+ * table->lock held, but never the other way around, and no two shard locks
+ * are ever held at the same time.
+ *
+ * shard->hash_lock protects a stripe of inode_hash. It is taken after
+ * table->lock and before a shard lock.
+ *
+ * So a ref or unref that keeps the ref count above 0 takes no lock at all,
+ * and one that doesn't drop the last reference of an inode with no lookups
+ * only needs the inode's own shard lock. Pruning works on one shard at a
+ * time under its lock, and only takes table->lock for a batch of inodes
+ * whose dentries have to go. */
+#define INODE_SHARD(inode) (&(inode)->table->shards[(inode)->shard])
+/* How far a shard may go over its lru limit with inodes that still have
+ * dentries before table->lock is taken to retire them. */
+#define INODE_PRUNE_BATCH(limit) ((limit) / 8 + 1)
+#define INODE_HASH_LOCK(table, hash)                                           \
+    (&(table)->shards[(hash) & (GF_INODE_TABLE_SHARDS - 1)].hash_lock)
+
 static inode_t *
 __inode_unref(inode_t *inode, bool clear);
 
+static inode_t *
+__inode_ref(inode_t *inode, bool is_invalidate);
+
 static int
 inode_table_prune(inode_table_t *table);
 
@@ -295,6 +325,7 @@ __is_inode_hashed(inode_t *inode)
     return !list_empty(&inode->hash);
 }
 
+/* Called with the hash_lock of @hash held */
 static void
 __inode_hash(inode_t *inode, const int hash)
 {
@@ -356,11 +387,11 @@ __inode_destroy(inode_t *inode)
 
     if (ns_inode) {
         table = ns_inode->table;
-        pthread_mutex_lock(&table->lock);
+        pthread_rwlock_wrlock(&table->lock);
         {
             __inode_unref(ns_inode, false);
         }
-        pthread_mutex_unlock(&table->lock);
+        pthread_rwlock_unlock(&table->lock);
     }
 
     __inode_ctx_free(inode);
@@ -398,81 +429,173 @@ inode_ctx_merge(fd_t *fd, inode_t *inode, inode_t *linked_inode)
         THIS = old_THIS;
 }
 
+/* Called with the shard lock of @inode held */
 static void
 __inode_activate(inode_t *inode)
 {
-    list_move(&inode->list, &inode->table->active);
-    inode->table->active_size++;
+    struct _inode_table_shard *shard = INODE_SHARD(inode);
+
+    list_move(&inode->list, &shard->active);
+    shard->active_size++;
 }
 
+/* Called with the shard lock of @inode held. Dentries are always hashed
+ * while they are on the dentry list of their inode (see __inode_link() and
+ * __dentry_unset()), so they are simply kept around for the next lookup. */
 static void
 __inode_passivate(inode_t *inode)
 {
-    dentry_t *dentry = NULL;
-    dentry_t *t = NULL;
+    struct _inode_table_shard *shard = INODE_SHARD(inode);
 
     GF_ASSERT(!inode->in_lru_list);
-    list_move_tail(&inode->list, &inode->table->lru);
-    inode->table->lru_size++;
+    list_move_tail(&inode->list, &shard->lru);
+    shard->lru_size++;
     inode->in_lru_list = _gf_true;
+}
 
-    list_for_each_entry_safe(dentry, t, &inode->dentry_list, inode_list)
-    {
-        if (!__is_dentry_hashed(dentry))
-            dentry_destroy(__dentry_unset(dentry));
-    }
+/* Retiring an inode is done in two steps. The first one, with the shard lock
+ * held, takes the inode off its list and marks it so that inode_find() won't
+ * hand it out anymore. The second one, with table->lock held for writing
+ * (unless the inode has no dentries) and no shard lock, unhashes it, drops
+ * its dentries (which unrefs their parents) and finally queues it for
+ * purging. */
+static void
+__inode_retire_begin(inode_t *inode)
+{
+    list_del_init(&inode->list);
+    inode->retired = true;
 }
 
 static void
-__inode_retire(inode_t *inode)
+__inode_retire_end(inode_t *inode)
 {
+    inode_table_t *table = inode->table;
+    struct _inode_table_shard *shard = INODE_SHARD(inode);
+    pthread_mutex_t *hash_lock = NULL;
     dentry_t *dentry = NULL;
     dentry_t *t = NULL;
 
-    list_move_tail(&inode->list, &inode->table->purge);
-    inode->table->purge_size++;
-
-    list_del_init(&inode->hash);
+    if (__is_inode_hashed(inode)) {
+        hash_lock = INODE_HASH_LOCK(
+            table, hash_gfid(inode->gfid, table->inode_hashsize));
+        pthread_mutex_lock(hash_lock);
+        {
+            list_del_init(&inode->hash);
+        }
+        pthread_mutex_unlock(hash_lock);
+    }
 
     list_for_each_entry_safe(dentry, t, &inode->dentry_list, inode_list)
     {
         dentry_destroy(__dentry_unset(dentry));
     }
+
+    pthread_mutex_lock(&shard->lock);
+    {
+        list_add_tail(&inode->list, &shard->purge);
+        shard->purge_size++;
+    }
+    pthread_mutex_unlock(&shard->lock);
 }
 
+/* May be called without any lock from the lock-free ref paths, so the
+ * slot is claimed atomically. */
 static int
 __inode_get_xl_index(inode_t *inode, xlator_t *xlator)
 {
     int set_idx = inode_get_ctx_index(inode->table, xlator);
+    xlator_t *old = inode->_ctx[set_idx].xl_key;
 
-    if (inode->_ctx[set_idx].xl_key == NULL)
-        inode->_ctx[set_idx].xl_key = xlator;
-    else if (inode->_ctx[set_idx].xl_key != xlator)
+    if (old == NULL)
+        old = uatomic_cmpxchg(&inode->_ctx[set_idx].xl_key, NULL, xlator);
+    if ((old != NULL) && (old != xlator))
         return -1;
 
     return set_idx;
 }
 
-static inode_t *
-__inode_unref(inode_t *inode, bool clear)
+/* Takes a reference without any lock as long as the inode already has one,
+ * which means it is on the active or invalidate list of its shard and won't
+ * move. Returns false if the 0 -> 1 transition needs the shard lock. */
+static bool
+inode_ref_fast(inode_t *inode)
 {
+    uint32_t ref = uatomic_read(&inode->ref);
+    uint32_t old = 0;
+    int index = 0;
+
+    while (ref) {
+        /* see __inode_shard_ref() */
+        if (__is_root_gfid(inode->gfid))
+            return true;
+
+        old = uatomic_cmpxchg(&inode->ref, ref, ref + 1);
+        if (old == ref) {
+            index = __inode_get_xl_index(inode, THIS);
+            if (index >= 0)
+                uatomic_inc(&inode->_ctx[index].ref);
+            return true;
+        }
+        ref = old;
+    }
+
+    return false;
+}
+
+/* Drops a reference without any lock as long as it isn't the last one.
+ * Returns false if the 1 -> 0 transition needs the shard lock. */
+static bool
+inode_unref_fast(inode_t *inode)
+{
+    uint32_t ref = uatomic_read(&inode->ref);
+    uint32_t old = 0;
+    int index = 0;
+
+    if (__is_root_gfid(inode->gfid))
+        return true;
+
+    while (ref > 1) {
+        old = uatomic_cmpxchg(&inode->ref, ref, ref - 1);
+        if (old == ref) {
+            index = __inode_get_xl_index(inode, THIS);
+            if (index >= 0)
+                uatomic_dec(&inode->_ctx[index].ref);
+            return true;
+        }
+        ref = old;
+    }
+
+    return false;
+}
+
+/* Drop a reference with the shard lock of @inode held.
+ *
+ * Returns false without doing anything if the inode would have to be
+ * retired and @can_retire is false. Otherwise, if the inode was retired,
+ * sets @retire and the caller has to call __inode_retire_end() once the
+ * shard lock is released.
+ *
+ * The ref count is still updated atomically, inode_ref_fast() and
+ * inode_unref_fast() may be changing it concurrently as long as it stays
+ * above 0. */
+static bool
+__inode_shard_unref(inode_t *inode, bool clear, bool can_retire, bool *retire)
+{
+    struct _inode_table_shard *shard = INODE_SHARD(inode);
     int index = 0;
     xlator_t *this = NULL;
     uint64_t nlookup = 0;
+    uint32_t ref = 0;
+    uint32_t old = 0;
 
     /*
      * Root inode should always be in active list of inode table. So unrefs
      * on root inode are no-ops.
      */
     if (__is_root_gfid(inode->gfid))
-        return inode;
+        return true;
 
-    /*
-     * No need to acquire inode table's lock
-     * as __inode_unref is called after acquiding
-     * the inode table's lock.
-     */
-    if (inode->table->cleanup_started && !inode->ref)
+    if (inode->table->cleanup_started && !uatomic_read(&inode->ref))
         /*
          * There is a good chance that, the inode
          * on which unref came has already been
@@ -500,40 +623,78 @@ __inode_unref(inode_t *inode, bool clear)
          * So return the inode if the inode table cleanup
          * has already started and inode refcount is 0.
          */
-        return inode;
+        return true;
+
+    nlookup = GF_ATOMIC_GET(inode->nlookup);
+    ref = uatomic_read(&inode->ref);
+    for (;;) {
+        GF_ASSERT(ref);
+        if (!ref)
+            return true;
+
+        if (!can_retire && (ref == 1) && !nlookup &&
+            (clear || !inode->in_invalidate_list))
+            return false;
+
+        old = uatomic_cmpxchg(&inode->ref, ref, ref - 1);
+        if (old == ref)
+            break;
+        /* lost a race with a lock-free ref or unref */
+        ref = old;
+    }
+    ref--;
 
     this = THIS;
 
     if (clear && inode->in_invalidate_list) {
         inode->in_invalidate_list = false;
-        inode->table->invalidate_size--;
+        shard->invalidate_size--;
         __inode_activate(inode);
     }
-    GF_ASSERT(inode->ref);
-
-    --inode->ref;
 
     index = __inode_get_xl_index(inode, this);
     if (index >= 0) {
-        inode->_ctx[index].ref--;
+        uatomic_dec(&inode->_ctx[index].ref);
     }
 
-    if (!inode->ref && !inode->in_invalidate_list) {
-        inode->table->active_size--;
+    if (!ref && !inode->in_invalidate_list) {
+        shard->active_size--;
 
-        nlookup = GF_ATOMIC_GET(inode->nlookup);
-        if (nlookup)
+        if (nlookup) {
             __inode_passivate(inode);
-        else
-            __inode_retire(inode);
+        } else {
+            __inode_retire_begin(inode);
+            *retire = true;
+        }
     }
 
+    return true;
+}
+
+/* Called with table->lock held for writing */
+static inode_t *
+__inode_unref(inode_t *inode, bool clear)
+{
+    struct _inode_table_shard *shard = INODE_SHARD(inode);
+    bool retire = false;
+
+    pthread_mutex_lock(&shard->lock);
+    {
+        __inode_shard_unref(inode, clear, true, &retire);
+    }
+    pthread_mutex_unlock(&shard->lock);
+
+    if (retire)
+        __inode_retire_end(inode);
+
     return inode;
 }
 
+/* Called with the shard lock of @inode held */
 static inode_t *
-__inode_ref(inode_t *inode, bool is_invalidate)
+__inode_shard_ref(inode_t *inode, bool is_invalidate)
 {
+    struct _inode_table_shard *shard = INODE_SHARD(inode);
     int index = 0;
     xlator_t *this = NULL;
 
@@ -545,23 +706,23 @@ __inode_ref(inode_t *inode, bool is_invalidate)
      * in inode table increases which is wrong. So just keep the ref
      * count as 1 always
      */
-    if (inode->ref) {
+    if (uatomic_read(&inode->ref)) {
         if (__is_root_gfid(inode->gfid))
             return inode;
     } else {
         if (inode->in_invalidate_list) {
             inode->in_invalidate_list = false;
-            inode->table->invalidate_size--;
+            shard->invalidate_size--;
         } else {
-            GF_ASSERT(inode->table->lru_size > 0);
+            GF_ASSERT(shard->lru_size > 0);
             GF_ASSERT(inode->in_lru_list);
-            inode->table->lru_size--;
+            shard->lru_size--;
             inode->in_lru_list = _gf_false;
         }
         if (is_invalidate) {
             inode->in_invalidate_list = true;
-            inode->table->invalidate_size++;
-            list_move_tail(&inode->list, &inode->table->invalidate);
+            shard->invalidate_size++;
+            list_move_tail(&inode->list, &shard->invalidate);
         } else {
             __inode_activate(inode);
         }
@@ -569,11 +730,33 @@ __inode_ref(inode_t *inode, bool is_invalidate)
 
     this = THIS;
 
-    inode->ref++;
+    uatomic_inc(&inode->ref);
 
     index = __inode_get_xl_index(inode, this);
     if (index >= 0)
-        inode->_ctx[index].ref++;
+        uatomic_inc(&inode->_ctx[index].ref);
+
+    return inode;
+}
+
+/* Takes the shard lock of @inode unless it already has references,
+ * table->lock may or may not be held */
+static inode_t *
+__inode_ref(inode_t *inode, bool is_invalidate)
+{
+    struct _inode_table_shard *shard = INODE_SHARD(inode);
+
+    if (!is_invalidate && inode_ref_fast(inode)) {
+        GF_ATOMIC_INC(shard->ref_fast);
+        return inode;
+    }
+    GF_ATOMIC_INC(shard->ref_slow);
+
+    pthread_mutex_lock(&shard->lock);
+    {
+        inode = __inode_shard_ref(inode, is_invalidate);
+    }
+    pthread_mutex_unlock(&shard->lock);
 
     return inode;
 }
@@ -582,17 +765,37 @@ inode_t *
 inode_unref(inode_t *inode)
 {
     inode_table_t *table = NULL;
+    struct _inode_table_shard *shard = NULL;
+    bool retire = false;
+    bool done = false;
 
     if (!inode)
         return NULL;
 
     table = inode->table;
+    shard = INODE_SHARD(inode);
+
+    if (inode_unref_fast(inode)) {
+        /* no list was touched, nothing to prune */
+        GF_ATOMIC_INC(shard->ref_fast);
+        return inode;
+    }
+    GF_ATOMIC_INC(shard->ref_slow);
 
-    pthread_mutex_lock(&table->lock);
+    pthread_mutex_lock(&shard->lock);
     {
-        inode = __inode_unref(inode, false);
+        done = __inode_shard_unref(inode, false, false, &retire);
+    }
+    pthread_mutex_unlock(&shard->lock);
+
+    if (!done) {
+        /* last ref of an inode nobody looked up, its dentries go away */
+        pthread_rwlock_wrlock(&table->lock);
+        {
+            inode = __inode_unref(inode, false);
+        }
+        pthread_rwlock_unlock(&table->lock);
     }
-    pthread_mutex_unlock(&table->lock);
 
     inode_table_prune(table);
 
@@ -602,20 +805,10 @@ inode_unref(inode_t *inode)
 inode_t *
 inode_ref(inode_t *inode)
 {
-    inode_table_t *table = NULL;
-
     if (!inode)
         return NULL;
 
-    table = inode->table;
-
-    pthread_mutex_lock(&table->lock);
-    {
-        inode = __inode_ref(inode, false);
-    }
-    pthread_mutex_unlock(&table->lock);
-
-    return inode;
+    return __inode_ref(inode, false);
 }
 
 static dentry_t *
@@ -656,6 +849,8 @@ inode_create(inode_table_t *table)
     }
 
     newi->table = table;
+    newi->shard = GF_ATOMIC_INC(table->shard_rotor) &
+                  (GF_INODE_TABLE_SHARDS - 1);
 
     LOCK_INIT(&newi->lock);
 
@@ -675,6 +870,7 @@ inode_t *
 inode_new(inode_table_t *table)
 {
     inode_t *inode = NULL;
+    struct _inode_table_shard *shard = NULL;
 
     if (!table) {
         gf_msg_callingfn(THIS->name, GF_LOG_WARNING, 0,
@@ -686,17 +882,19 @@ inode_new(inode_table_t *table)
 
     inode = inode_create(table);
     if (inode) {
-        pthread_mutex_lock(&table->lock);
+        shard = INODE_SHARD(inode);
+        pthread_mutex_lock(&shard->lock);
         {
-            list_add(&inode->list, &table->lru);
-            table->lru_size++;
+            list_add(&inode->list, &shard->lru);
+            shard->lru_size++;
             GF_ASSERT(!inode->in_lru_list);
             inode->in_lru_list = _gf_true;
-            __inode_ref(inode, false);
-            /* let the dummy, 'unlinked' inodes have root as namespace */
-            inode->ns_inode = __inode_ref(table->root, _gf_false);
+            __inode_shard_ref(inode, false);
         }
-        pthread_mutex_unlock(&table->lock);
+        pthread_mutex_unlock(&shard->lock);
+
+        /* let the dummy, 'unlinked' inodes have root as namespace */
+        inode->ns_inode = __inode_ref(table->root, _gf_false);
     }
 
     return inode;
@@ -710,28 +908,43 @@ inode_new(inode_table_t *table)
  *
  * This function may cause the purging of the inode,
  * hence to be used only in destructor functions and not otherwise.
+ * Called with table->lock held for writing.
  */
 static inode_t *
 __inode_ref_reduce_by_n(inode_t *inode, uint64_t nref)
 {
+    struct _inode_table_shard *shard = INODE_SHARD(inode);
     uint64_t nlookup = 0;
+    uint32_t ref = 0;
+    bool retire = false;
 
-    GF_ASSERT(inode->ref >= nref);
-
-    inode->ref -= nref;
+    pthread_mutex_lock(&shard->lock);
+    {
+        GF_ASSERT(uatomic_read(&inode->ref) >= nref);
 
-    if (!nref)
-        inode->ref = 0;
+        if (nref) {
+            ref = uatomic_sub_return(&inode->ref, nref);
+        } else {
+            uatomic_set(&inode->ref, 0);
+            ref = 0;
+        }
 
-    if (!inode->ref) {
-        inode->table->active_size--;
+        if (!ref) {
+            shard->active_size--;
 
-        nlookup = GF_ATOMIC_GET(inode->nlookup);
-        if (nlookup)
-            __inode_passivate(inode);
-        else
-            __inode_retire(inode);
+            nlookup = GF_ATOMIC_GET(inode->nlookup);
+            if (nlookup) {
+                __inode_passivate(inode);
+            } else {
+                __inode_retire_begin(inode);
+                retire = true;
+            }
+        }
     }
+    pthread_mutex_unlock(&shard->lock);
+
+    if (retire)
+        __inode_retire_end(inode);
 
     return inode;
 }
@@ -794,7 +1007,7 @@ inode_grep(inode_table_t *table, inode_t *parent, const char *name)
 
     int hash = hash_dentry(parent, name, table->dentry_hashsize);
 
-    pthread_mutex_lock(&table->lock);
+    pthread_rwlock_rdlock(&table->lock);
     {
         dentry = __dentry_grep(table, parent, name, hash);
         if (dentry) {
@@ -803,7 +1016,7 @@ inode_grep(inode_table_t *table, inode_t *parent, const char *name)
                 __inode_ref(inode, false);
         }
     }
-    pthread_mutex_unlock(&table->lock);
+    pthread_rwlock_unlock(&table->lock);
 
     return inode;
 }
@@ -870,7 +1083,7 @@ inode_grep_for_gfid(inode_table_t *table, inode_t *parent, const char *name,
 
     int hash = hash_dentry(parent, name, table->dentry_hashsize);
 
-    pthread_mutex_lock(&table->lock);
+    pthread_rwlock_rdlock(&table->lock);
     {
         dentry = __dentry_grep(table, parent, name, hash);
         if (dentry) {
@@ -882,7 +1095,7 @@ inode_grep_for_gfid(inode_table_t *table, inode_t *parent, const char *name,
             }
         }
     }
-    pthread_mutex_unlock(&table->lock);
+    pthread_rwlock_unlock(&table->lock);
 
     return ret;
 }
@@ -899,6 +1112,8 @@ __is_root_gfid(uuid_t gfid)
     return _gf_false;
 }
 
+/* Called with the hash_lock of @hash held. The inode found may be retired
+ * already, callers check that under its shard lock. */
 static inode_t *
 __inode_find(inode_table_t *table, uuid_t gfid, const int hash)
 {
@@ -920,6 +1135,8 @@ inode_t *
 inode_find(inode_table_t *table, uuid_t gfid)
 {
     inode_t *inode = NULL;
+    struct _inode_table_shard *shard = NULL;
+    pthread_mutex_t *hash_lock = NULL;
 
     if (!table) {
         gf_msg_callingfn(THIS->name, GF_LOG_WARNING, 0,
@@ -934,17 +1151,30 @@ inode_find(inode_table_t *table, uuid_t gfid)
 
     int hash = hash_gfid(gfid, table->inode_hashsize);
 
-    pthread_mutex_lock(&table->lock);
+    hash_lock = INODE_HASH_LOCK(table, hash);
+    pthread_mutex_lock(hash_lock);
     {
         inode = __inode_find(table, gfid, hash);
-        if (inode)
-            __inode_ref(inode, false);
+        if (inode) {
+            shard = INODE_SHARD(inode);
+            pthread_mutex_lock(&shard->lock);
+            {
+                /* being retired, not yet unhashed */
+                if (inode->retired)
+                    inode = NULL;
+                else
+                    __inode_shard_ref(inode, false);
+            }
+            pthread_mutex_unlock(&shard->lock);
+        }
     }
-    pthread_mutex_unlock(&table->lock);
+    pthread_mutex_unlock(hash_lock);
 
     return inode;
 }
 
+/* Called with table->lock held for writing, returns the linked inode with a
+ * ref the caller has to drop */
 static inode_t *
 __inode_link(inode_t *inode, inode_t *parent, const char *name,
              struct iatt *iatt, const int dhash)
@@ -954,6 +1184,8 @@ __inode_link(inode_t *inode, inode_t *parent, const char *name,
     inode_t *old_inode = NULL;
     inode_table_t *table = NULL;
     inode_t *link_inode = NULL;
+    struct _inode_table_shard *shard = NULL;
+    bool pinned = false;
     char link_uuid_str[64] = {0}, parent_uuid_str[64] = {0};
 
     table = inode->table;
@@ -998,14 +1230,37 @@ __inode_link(inode_t *inode, inode_t *parent, const char *name,
             link_inode = table->root;
         else {
             int ihash = hash_gfid(iatt->ia_gfid, table->inode_hashsize);
-            old_inode = __inode_find(table, iatt->ia_gfid, ihash);
-            if (old_inode) {
-                link_inode = old_inode;
-            } else {
-                gf_uuid_copy(inode->gfid, iatt->ia_gfid);
-                inode->ia_type = iatt->ia_type;
-                __inode_hash(inode, ihash);
+            pthread_mutex_t *hash_lock = INODE_HASH_LOCK(table, ihash);
+
+            pthread_mutex_lock(hash_lock);
+            {
+                old_inode = __inode_find(table, iatt->ia_gfid, ihash);
+                if (old_inode) {
+                    /* the prune retires inodes without dentries with no
+                     * table->lock, pin the one found before letting go of
+                     * the hash_lock, or take its place if it is already
+                     * being retired */
+                    shard = INODE_SHARD(old_inode);
+                    pthread_mutex_lock(&shard->lock);
+                    {
+                        if (old_inode->retired) {
+                            old_inode = NULL;
+                        } else {
+                            __inode_shard_ref(old_inode, false);
+                            pinned = true;
+                        }
+                    }
+                    pthread_mutex_unlock(&shard->lock);
+                }
+                if (old_inode) {
+                    link_inode = old_inode;
+                } else {
+                    gf_uuid_copy(inode->gfid, iatt->ia_gfid);
+                    inode->ia_type = iatt->ia_type;
+                    __inode_hash(inode, ihash);
+                }
             }
+            pthread_mutex_unlock(hash_lock);
         }
     } else {
         /* @old_inode serves another important purpose - it indicates
@@ -1020,6 +1275,11 @@ __inode_link(inode_t *inode, inode_t *parent, const char *name,
         old_inode = inode;
     }
 
+    /* @link_inode is returned with a ref, the one found by gfid already
+     * has it */
+    if (!pinned)
+        __inode_ref(link_inode, false);
+
     if (name && (!strcmp(name, ".") || !strcmp(name, ".."))) {
         return link_inode;
     }
@@ -1037,6 +1297,7 @@ __inode_link(inode_t *inode, inode_t *parent, const char *name,
                                  "inode %s with parent %s",
                                  uuid_utoa_r(link_inode->gfid, link_uuid_str),
                                  uuid_utoa_r(parent->gfid, parent_uuid_str));
+                __inode_unref(link_inode, false);
                 errno = ENOMEM;
                 return NULL;
             }
@@ -1049,6 +1310,7 @@ __inode_link(inode_t *inode, inode_t *parent, const char *name,
             if (old_inode && __is_dentry_cyclic(dentry)) {
                 errno = ELOOP;
                 dentry_destroy(__dentry_unset(dentry));
+                __inode_unref(link_inode, false);
                 return NULL;
             }
             __dentry_hash(dentry, dhash);
@@ -1085,13 +1347,11 @@ inode_link(inode_t *inode, inode_t *parent, const char *name, struct iatt *iatt)
         return NULL;
     }
 
-    pthread_mutex_lock(&table->lock);
+    pthread_rwlock_wrlock(&table->lock);
     {
         linked_inode = __inode_link(inode, parent, name, iatt, hash);
-        if (linked_inode)
-            __inode_ref(linked_inode, false);
     }
-    pthread_mutex_unlock(&table->lock);
+    pthread_rwlock_unlock(&table->lock);
 
     inode_table_prune(table);
 
@@ -1125,11 +1385,11 @@ inode_ref_reduce_by_n(inode_t *inode, uint64_t nref)
 
     table = inode->table;
 
-    pthread_mutex_lock(&table->lock);
+    pthread_rwlock_wrlock(&table->lock);
     {
         __inode_ref_reduce_by_n(inode, nref);
     }
-    pthread_mutex_unlock(&table->lock);
+    pthread_rwlock_unlock(&table->lock);
 
     inode_table_prune(table);
 
@@ -1169,12 +1429,12 @@ inode_forget_with_unref(inode_t *inode, uint64_t nlookup)
 
     table = inode->table;
 
-    pthread_mutex_lock(&table->lock);
+    pthread_rwlock_wrlock(&table->lock);
     {
         inode_forget_atomic(inode, nlookup);
         __inode_unref(inode, true);
     }
-    pthread_mutex_unlock(&table->lock);
+    pthread_rwlock_unlock(&table->lock);
 
     inode_table_prune(table);
 
@@ -1267,11 +1527,11 @@ inode_unlink(inode_t *inode, inode_t *parent, const char *name)
 
     table = inode->table;
 
-    pthread_mutex_lock(&table->lock);
+    pthread_rwlock_wrlock(&table->lock);
     {
         dentry = __inode_unlink(inode, parent, name);
     }
-    pthread_mutex_unlock(&table->lock);
+    pthread_rwlock_unlock(&table->lock);
 
     dentry_destroy(dentry);
 
@@ -1304,7 +1564,7 @@ inode_rename(inode_table_t *table, inode_t *srcdir, const char *srcname,
         hash = hash_dentry(dstdir, dstname, table->dentry_hashsize);
     }
 
-    pthread_mutex_lock(&table->lock);
+    pthread_rwlock_wrlock(&table->lock);
     {
         linked_inode = __inode_link(inode, dstdir, dstname, iatt, hash);
         /* pick the old dentry */
@@ -1313,9 +1573,10 @@ inode_rename(inode_table_t *table, inode_t *srcdir, const char *srcname,
          * robust, but is that good enough? (Ref: GH PR #1763) */
         if (linked_inode) {
             dentry = __inode_unlink(inode, srcdir, srcname);
+            __inode_unref(linked_inode, false);
         }
     }
-    pthread_mutex_unlock(&table->lock);
+    pthread_rwlock_unlock(&table->lock);
 
     /* free the old dentry */
     dentry_destroy(dentry);
@@ -1372,7 +1633,7 @@ inode_parent(inode_t *inode, uuid_t pargfid, const char *name)
     if (pargfid && !gf_uuid_is_null(pargfid) && name)
         search_for_inode = _gf_true;
 
-    pthread_mutex_lock(&table->lock);
+    pthread_rwlock_rdlock(&table->lock);
     {
         if (search_for_inode) {
             dentry = __dentry_search_for_inode(inode, pargfid, name);
@@ -1386,7 +1647,7 @@ inode_parent(inode_t *inode, uuid_t pargfid, const char *name)
                 __inode_ref(parent, false);
         }
     }
-    pthread_mutex_unlock(&table->lock);
+    pthread_rwlock_unlock(&table->lock);
 
     return parent;
 }
@@ -1524,11 +1785,11 @@ inode_path(inode_t *inode, const char *name, char **bufp)
 
     table = inode->table;
 
-    pthread_mutex_lock(&table->lock);
+    pthread_rwlock_rdlock(&table->lock);
     {
         ret = __inode_path(inode, name, bufp);
     }
-    pthread_mutex_unlock(&table->lock);
+    pthread_rwlock_unlock(&table->lock);
 
     return ret;
 }
@@ -1536,98 +1797,189 @@ inode_path(inode_t *inode, const char *name, char **bufp)
 void
 inode_table_set_lru_limit(inode_table_t *table, uint32_t lru_limit)
 {
-    pthread_mutex_lock(&table->lock);
+    pthread_rwlock_wrlock(&table->lock);
     {
         table->lru_limit = lru_limit;
     }
-    pthread_mutex_unlock(&table->lock);
+    pthread_rwlock_unlock(&table->lock);
 
     inode_table_prune(table);
 
     return;
 }
 
-static int
-inode_table_prune(inode_table_t *table)
+/* The lru limit is split evenly between the shards, each one is pruned on
+ * its own. */
+static uint32_t
+inode_table_shard_lru_limit(inode_table_t *table)
 {
-    int ret = 0;
-    int ret1 = 0;
-    struct list_head purge = {
+    return max(table->lru_limit / GF_INODE_TABLE_SHARDS, 1);
+}
+
+/* Retire the oldest inodes of @shard until it is back to @limit, looking at
+ * no more than the ones over it unless @dentries is set.
+ *
+ * Without @dentries only the shard lock is taken and inodes that still have
+ * dentries are left in place: nothing can add one to an inode nobody holds
+ * a reference on, but dropping them needs table->lock. With @dentries the
+ * caller holds table->lock for writing and all inodes can go.
+ *
+ * Stops at the first inode which has to be invalidated instead, and hands
+ * it back referenced in @invalidate. Returns how many inodes are still
+ * over the limit. */
+static uint32_t
+inode_table_prune_shard(inode_table_t *table, struct _inode_table_shard *shard,
+                        uint32_t limit, bool dentries, int *pruned,
+                        inode_t **invalidate)
+{
+    struct list_head retire = {
         0,
     };
-    inode_t *del = NULL;
-    inode_t *tmp = NULL;
     inode_t *entry = NULL;
+    inode_t *tmp = NULL;
     uint64_t nlookup = 0;
-    int64_t lru_size = 0;
+    uint32_t over = 0;
+    uint32_t count = 0;
 
-    INIT_LIST_HEAD(&purge);
+    INIT_LIST_HEAD(&retire);
 
-    pthread_mutex_lock(&table->lock);
+    pthread_mutex_lock(&shard->lock);
     {
-        if (!table->lru_limit)
-            goto purge_list;
-
-        lru_size = table->lru_size;
-        while (lru_size > (table->lru_limit)) {
-            if (list_empty(&table->lru)) {
-                GF_ASSERT(0);
-                gf_msg_callingfn(THIS->name, GF_LOG_WARNING, 0,
-                                 LG_MSG_INVALID_INODE_LIST,
-                                 "Empty inode lru list found"
-                                 " but with (%d) lru_size",
-                                 table->lru_size);
-                break;
-            }
+        if (shard->lru_size > limit)
+            over = shard->lru_size - limit;
+        count = dentries ? shard->lru_size : over;
 
-            lru_size--;
-            entry = list_entry(table->lru.next, inode_t, list);
+        list_for_each_entry_safe(entry, tmp, &shard->lru, list)
+        {
+            if (!count || !over)
+                break;
+            count--;
             GF_ASSERT(entry->in_lru_list);
-            /* The logic of invalidation is required only if invalidator_fn
-               is present */
+            /* The logic of invalidation is required only if
+               invalidator_fn is present */
             if (table->invalidator_fn) {
                 /* check for valid inode with 'nlookup' */
                 nlookup = GF_ATOMIC_GET(entry->nlookup);
                 if (nlookup) {
                     if (entry->invalidate_sent) {
-                        list_move_tail(&entry->list, &table->lru);
+                        list_move_tail(&entry->list, &shard->lru);
                         continue;
                     }
-                    __inode_ref(entry, true);
-                    tmp = entry;
+                    __inode_shard_ref(entry, true);
+                    *invalidate = entry;
                     break;
                 }
             }
 
-            table->lru_size--;
+            if (!dentries && !list_empty(&entry->dentry_list))
+                continue;
+
+            shard->lru_size--;
+            over--;
             entry->in_lru_list = _gf_false;
-            __inode_retire(entry);
-            ret++;
+            __inode_retire_begin(entry);
+            list_add_tail(&entry->list, &retire);
+            (*pruned)++;
         }
+    }
+    pthread_mutex_unlock(&shard->lock);
 
-    purge_list:
-        list_splice_init(&table->purge, &purge);
-        table->purge_size = 0;
+    list_for_each_entry_safe(entry, tmp, &retire, list)
+    {
+        list_del_init(&entry->list);
+        __inode_retire_end(entry);
+    }
+
+    return over;
+}
+
+static int
+inode_table_prune(inode_table_t *table)
+{
+    int ret = 0;
+    int ret1 = 0;
+    struct list_head purge = {
+        0,
+    };
+    struct _inode_table_shard *shard = NULL;
+    inode_t *del = NULL;
+    inode_t *tmp = NULL;
+    inode_t *invalidate = NULL;
+    uint32_t limit = 0;
+    uint32_t over = 0;
+    uint32_t start = 0;
+    int i = 0;
+
+    INIT_LIST_HEAD(&purge);
+
+    if (!table->lru_limit)
+        goto purge_list;
+
+    /* The lru order is only kept within a shard. Start with a different
+     * shard each time so that no shard is always the last one looked at. */
+    limit = inode_table_shard_lru_limit(table);
+    start = GF_ATOMIC_GET(table->shard_rotor);
+
+    for (i = 0; (i < GF_INODE_TABLE_SHARDS) && !invalidate; i++) {
+        shard = &table->shards[(start + i) & (GF_INODE_TABLE_SHARDS - 1)];
+        /* unlocked peek, a shard that just went over goes with the next
+         * prune */
+        if (shard->lru_size <= limit)
+            continue;
+
+        over = inode_table_prune_shard(table, shard, limit, false, &ret,
+                                       &invalidate);
+
+        /* What is left has dentries, which only go with the whole tree
+         * locked. Let a batch of them build up first so that it isn't
+         * taken each time a shard goes one over its limit. */
+        if (invalidate || (over <= INODE_PRUNE_BATCH(limit)))
+            continue;
+
+        pthread_rwlock_wrlock(&table->lock);
+        {
+            inode_table_prune_shard(table, shard, limit, true, &ret,
+                                    &invalidate);
+        }
+        pthread_rwlock_unlock(&table->lock);
     }
-    pthread_mutex_unlock(&table->lock);
 
     /* Pick 1 inode for invalidation */
-    if (tmp) {
+    if (invalidate) {
         xlator_t *old_THIS = THIS;
         THIS = table->invalidator_xl;
-        ret1 = table->invalidator_fn(table->invalidator_xl, tmp);
+        ret1 = table->invalidator_fn(table->invalidator_xl, invalidate);
         THIS = old_THIS;
-        pthread_mutex_lock(&table->lock);
+        pthread_rwlock_wrlock(&table->lock);
         {
             if (!ret1) {
-                tmp->invalidate_sent = true;
-                __inode_unref(tmp, false);
+                shard = INODE_SHARD(invalidate);
+                pthread_mutex_lock(&shard->lock);
+                {
+                    invalidate->invalidate_sent = true;
+                }
+                pthread_mutex_unlock(&shard->lock);
+                __inode_unref(invalidate, false);
             } else {
                 /* Move this back to the lru list*/
-                __inode_unref(tmp, true);
+                __inode_unref(invalidate, true);
             }
         }
-        pthread_mutex_unlock(&table->lock);
+        pthread_rwlock_unlock(&table->lock);
+    }
+
+purge_list:
+    for (i = 0; i < GF_INODE_TABLE_SHARDS; i++) {
+        shard = &table->shards[i];
+        /* unlocked peek, whatever is missed goes with the next prune */
+        if (!shard->purge_size)
+            continue;
+        pthread_mutex_lock(&shard->lock);
+        {
+            list_splice_init(&shard->purge, &purge);
+            shard->purge_size = 0;
+        }
+        pthread_mutex_unlock(&shard->lock);
     }
 
     /* Just so that if purge list is handled too, then clear it off */
@@ -1645,12 +1997,14 @@ static void
 __inode_table_init_root(inode_table_t *table)
 {
     inode_t *root = NULL;
+    struct _inode_table_shard *shard = NULL;
     static uuid_t root_gfid = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1};
 
     root = inode_create(table);
+    shard = INODE_SHARD(root);
 
-    list_add(&root->list, &table->lru);
-    table->lru_size++;
+    list_add(&root->list, &shard->lru);
+    shard->lru_size++;
     root->in_lru_list = _gf_true;
 
     gf_uuid_copy(root->gfid, root_gfid);
@@ -1670,6 +2024,7 @@ inode_table_with_invalidator(uint32_t lru_limit, xlator_t *xl,
                              uint32_t inode_hashsize)
 {
     inode_table_t *new = NULL;
+    struct _inode_table_shard *shard = NULL;
     uint32_t mem_pool_size = lru_limit;
     size_t diff;
     int ret = -1;
@@ -1755,10 +2110,19 @@ inode_table_with_invalidator(uint32_t lru_limit, xlator_t *xl,
         INIT_LIST_HEAD(&new->name_hash[i]);
     }
 
-    INIT_LIST_HEAD(&new->active);
-    INIT_LIST_HEAD(&new->lru);
-    INIT_LIST_HEAD(&new->purge);
-    INIT_LIST_HEAD(&new->invalidate);
+    for (i = 0; i < GF_INODE_TABLE_SHARDS; i++) {
+        shard = &new->shards[i];
+        pthread_mutex_init(&shard->lock, NULL);
+        pthread_mutex_init(&shard->hash_lock, NULL);
+        INIT_LIST_HEAD(&shard->active);
+        INIT_LIST_HEAD(&shard->lru);
+        INIT_LIST_HEAD(&shard->purge);
+        INIT_LIST_HEAD(&shard->invalidate);
+        GF_ATOMIC_INIT(shard->ref_fast, 0);
+        GF_ATOMIC_INIT(shard->ref_slow, 0);
+    }
+    GF_ATOMIC_INIT(new->shard_rotor, 0);
+    pthread_rwlock_init(&new->lock, NULL);
 
     ret = gf_asprintf(&new->name, "%s/inode", xl->name);
     if (-1 == ret) {
@@ -1770,8 +2134,6 @@ inode_table_with_invalidator(uint32_t lru_limit, xlator_t *xl,
 
     __inode_table_init_root(new);
 
-    pthread_mutex_init(&new->lock, NULL);
-
     ret = 0;
 out:
     if (ret) {
@@ -1824,6 +2186,9 @@ void
 inode_table_destroy(inode_table_t *inode_table)
 {
     inode_t *trav = NULL;
+    struct _inode_table_shard *shard = NULL;
+    bool busy = false;
+    int i = 0;
 
     if (inode_table == NULL)
         return;
@@ -1847,54 +2212,85 @@ inode_table_destroy(inode_table_t *inode_table)
      * Not sure which is the approach to be taken, going by approach 2.
      */
 
-    pthread_mutex_lock(&inode_table->lock);
+    pthread_rwlock_wrlock(&inode_table->lock);
     {
         inode_table->cleanup_started = _gf_true;
-        /* Process lru list first as we need to unset their dentry
+        /* Process lru lists first as we need to unset their dentry
          * entries (the ones which may not be unset during
          * '__inode_passivate' as they were hashed) which in turn
          * shall unref their parent
          *
          * These parent inodes when unref'ed may well again fall
-         * into lru list and if we are at the end of traversing
-         * the list, we may miss to delete/retire that entry. Hence
-         * traverse the lru list till it gets empty.
+         * into an lru list, possibly of a shard already traversed.
+         * Hence traverse all the shards till nothing is left.
          */
-        while (!list_empty(&inode_table->lru)) {
-            trav = list_first_entry(&inode_table->lru, inode_t, list);
-            inode_forget_atomic(trav, 0);
-            GF_ASSERT(inode_table->lru_size > 0);
-            GF_ASSERT(trav->in_lru_list);
-            __inode_retire(trav);
-            inode_table->lru_size--;
-            trav->in_lru_list = _gf_false;
-        }
-
-        /* Same logic for invalidate list */
-        while (!list_empty(&inode_table->invalidate)) {
-            trav = list_first_entry(&inode_table->invalidate, inode_t, list);
-            inode_forget_atomic(trav, 0);
-            __inode_retire(trav);
-            inode_table->invalidate_size--;
-        }
-
-        while (!list_empty(&inode_table->active)) {
-            trav = list_first_entry(&inode_table->active, inode_t, list);
-            /* forget and unref the inode to retire and add it to
-             * purge list. By this time there should not be any
-             * inodes present in the active list except for root
-             * inode. Its a ref_leak otherwise. */
-            if (trav && (trav != inode_table->root))
-                gf_msg_callingfn(THIS->name, GF_LOG_WARNING, 0,
-                                 LG_MSG_REF_COUNT,
-                                 "Active inode(%p) with refcount"
-                                 "(%d) found during cleanup",
-                                 trav, trav->ref);
-            inode_forget_atomic(trav, 0);
-            __inode_ref_reduce_by_n(trav, 0);
-        }
-    }
-    pthread_mutex_unlock(&inode_table->lock);
+        do {
+            busy = false;
+            for (i = 0; i < GF_INODE_TABLE_SHARDS; i++) {
+                shard = &inode_table->shards[i];
+                for (;;) {
+                    trav = NULL;
+                    pthread_mutex_lock(&shard->lock);
+                    {
+                        if (!list_empty(&shard->lru)) {
+                            trav = list_first_entry(&shard->lru, inode_t,
+                                                    list);
+                            GF_ASSERT(shard->lru_size > 0);
+                            GF_ASSERT(trav->in_lru_list);
+                            shard->lru_size--;
+                            trav->in_lru_list = _gf_false;
+                        } else if (!list_empty(&shard->invalidate)) {
+                            /* Same logic for invalidate list */
+                            trav = list_first_entry(&shard->invalidate,
+                                                    inode_t, list);
+                            shard->invalidate_size--;
+                        }
+                        if (trav) {
+                            inode_forget_atomic(trav, 0);
+                            __inode_retire_begin(trav);
+                        }
+                    }
+                    pthread_mutex_unlock(&shard->lock);
+
+                    if (!trav)
+                        break;
+                    __inode_retire_end(trav);
+                    busy = true;
+                }
+            }
+
+            for (i = 0; i < GF_INODE_TABLE_SHARDS; i++) {
+                shard = &inode_table->shards[i];
+                for (;;) {
+                    pthread_mutex_lock(&shard->lock);
+                    {
+                        trav = list_empty(&shard->active)
+                                   ? NULL
+                                   : list_first_entry(&shard->active,
+                                                      inode_t, list);
+                    }
+                    pthread_mutex_unlock(&shard->lock);
+
+                    if (!trav)
+                        break;
+                    /* forget and unref the inode to retire and add it to
+                     * purge list. By this time there should not be any
+                     * inodes present in the active list except for root
+                     * inode. Its a ref_leak otherwise. */
+                    if (trav != inode_table->root)
+                        gf_msg_callingfn(THIS->name, GF_LOG_WARNING, 0,
+                                         LG_MSG_REF_COUNT,
+                                         "Active inode(%p) with refcount"
+                                         "(%d) found during cleanup",
+                                         trav, trav->ref);
+                    inode_forget_atomic(trav, 0);
+                    __inode_ref_reduce_by_n(trav, 0);
+                    busy = true;
+                }
+            }
+        } while (busy);
+    }
+    pthread_rwlock_unlock(&inode_table->lock);
 
     inode_table_prune(inode_table);
 
@@ -1903,7 +2299,11 @@ inode_table_destroy(inode_table_t *inode_table)
     if (inode_table->fd_mem_pool)
         mem_pool_destroy(inode_table->fd_mem_pool);
 
-    pthread_mutex_destroy(&inode_table->lock);
+    pthread_rwlock_destroy(&inode_table->lock);
+    for (i = 0; i < GF_INODE_TABLE_SHARDS; i++) {
+        pthread_mutex_destroy(&inode_table->shards[i].lock);
+        pthread_mutex_destroy(&inode_table->shards[i].hash_lock);
+    }
 
     GF_FREE(inode_table->name);
     GF_FREE(inode_table);
@@ -2331,11 +2731,11 @@ inode_is_linked(inode_t *inode)
 
     table = inode->table;
 
-    pthread_mutex_lock(&table->lock);
+    pthread_rwlock_rdlock(&table->lock);
     {
         ret = __is_inode_hashed(inode);
     }
-    pthread_mutex_unlock(&table->lock);
+    pthread_rwlock_unlock(&table->lock);
 
     return ret;
 }
@@ -2423,17 +2823,39 @@ void
 inode_table_dump(inode_table_t *itable, char *prefix)
 {
     char key[GF_DUMP_MAX_BUF_LEN];
+    struct _inode_table_shard *shard = NULL;
+    uint32_t active_size = 0;
+    uint32_t lru_size = 0;
+    uint32_t purge_size = 0;
+    uint32_t invalidate_size = 0;
+    uint64_t ref_fast = 0;
+    uint64_t ref_slow = 0;
+    int active = 1;
+    int lru = 1;
+    int purge = 1;
+    int invalidate = 1;
     int ret = 0;
+    int i = 0;
 
     if (!itable)
         return;
 
-    ret = pthread_mutex_trylock(&itable->lock);
+    ret = pthread_rwlock_tryrdlock(&itable->lock);
 
     if (ret != 0) {
         return;
     }
 
+    for (i = 0; i < GF_INODE_TABLE_SHARDS; i++) {
+        shard = &itable->shards[i];
+        active_size += shard->active_size;
+        lru_size += shard->lru_size;
+        purge_size += shard->purge_size;
+        invalidate_size += shard->invalidate_size;
+        ref_fast += GF_ATOMIC_GET(shard->ref_fast);
+        ref_slow += GF_ATOMIC_GET(shard->ref_slow);
+    }
+
     gf_proc_dump_build_key(key, prefix, "dentry_hashsize");
     gf_proc_dump_write(key, "%" GF_PRI_SIZET, itable->dentry_hashsize);
     gf_proc_dump_build_key(key, prefix, "inode_hashsize");
@@ -2441,23 +2863,38 @@ inode_table_dump(inode_table_t *itable, char *prefix)
     gf_proc_dump_build_key(key, prefix, "name");
     gf_proc_dump_write(key, "%s", itable->name);
 
+    gf_proc_dump_build_key(key, prefix, "shards");
+    gf_proc_dump_write(key, "%d", GF_INODE_TABLE_SHARDS);
+    gf_proc_dump_build_key(key, prefix, "ref_fast");
+    gf_proc_dump_write(key, "%" PRIu64, ref_fast);
+    gf_proc_dump_build_key(key, prefix, "ref_slow");
+    gf_proc_dump_write(key, "%" PRIu64, ref_slow);
     gf_proc_dump_build_key(key, prefix, "lru_limit");
     gf_proc_dump_write(key, "%d", itable->lru_limit);
     gf_proc_dump_build_key(key, prefix, "active_size");
-    gf_proc_dump_write(key, "%d", itable->active_size);
+    gf_proc_dump_write(key, "%d", active_size);
     gf_proc_dump_build_key(key, prefix, "lru_size");
-    gf_proc_dump_write(key, "%d", itable->lru_size);
+    gf_proc_dump_write(key, "%d", lru_size);
     gf_proc_dump_build_key(key, prefix, "purge_size");
-    gf_proc_dump_write(key, "%d", itable->purge_size);
+    gf_proc_dump_write(key, "%d", purge_size);
     gf_proc_dump_build_key(key, prefix, "invalidate_size");
-    gf_proc_dump_write(key, "%d", itable->invalidate_size);
+    gf_proc_dump_write(key, "%d", invalidate_size);
 
-    INODE_DUMP_LIST(&itable->active, key, prefix, "active");
-    INODE_DUMP_LIST(&itable->lru, key, prefix, "lru");
-    INODE_DUMP_LIST(&itable->purge, key, prefix, "purge");
-    INODE_DUMP_LIST(&itable->invalidate, key, prefix, "invalidate");
+    /* numbered across the shards, as if it was a single list */
+    for (i = 0; i < GF_INODE_TABLE_SHARDS; i++) {
+        shard = &itable->shards[i];
+        pthread_mutex_lock(&shard->lock);
+        {
+            INODE_DUMP_LIST(&shard->active, key, prefix, "active", active);
+            INODE_DUMP_LIST(&shard->lru, key, prefix, "lru", lru);
+            INODE_DUMP_LIST(&shard->purge, key, prefix, "purge", purge);
+            INODE_DUMP_LIST(&shard->invalidate, key, prefix, "invalidate",
+                            invalidate);
+        }
+        pthread_mutex_unlock(&shard->lock);
+    }
 
-    pthread_mutex_unlock(&itable->lock);
+    pthread_rwlock_unlock(&itable->lock);
 }
 
 void
@@ -2505,32 +2942,46 @@ inode_table_dump_to_dict(inode_table_t *itable, char *prefix, dict_t *dict)
     char key[GF_DUMP_MAX_BUF_LEN] = {
         0,
     };
+    struct _inode_table_shard *shard = NULL;
+    uint32_t active_size = 0;
+    uint32_t lru_size = 0;
+    uint32_t purge_size = 0;
     int ret = 0;
+    int i = 0;
 #ifdef DEBUG
     inode_t *inode = NULL;
-    int count = 0;
+    int active = 0;
+    int lru = 0;
+    int purge = 0;
 #endif
-    ret = pthread_mutex_trylock(&itable->lock);
+    ret = pthread_rwlock_tryrdlock(&itable->lock);
     if (ret)
         return;
 
+    for (i = 0; i < GF_INODE_TABLE_SHARDS; i++) {
+        shard = &itable->shards[i];
+        active_size += shard->active_size;
+        lru_size += shard->lru_size;
+        purge_size += shard->purge_size;
+    }
+
     snprintf(key, sizeof(key), "%s.itable.lru_limit", prefix);
     ret = dict_set_uint32(dict, key, itable->lru_limit);
     if (ret)
         goto out;
 
     snprintf(key, sizeof(key), "%s.itable.active_size", prefix);
-    ret = dict_set_uint32(dict, key, itable->active_size);
+    ret = dict_set_uint32(dict, key, active_size);
     if (ret)
         goto out;
 
     snprintf(key, sizeof(key), "%s.itable.lru_size", prefix);
-    ret = dict_set_uint32(dict, key, itable->lru_size);
+    ret = dict_set_uint32(dict, key, lru_size);
     if (ret)
         goto out;
 
     snprintf(key, sizeof(key), "%s.itable.purge_size", prefix);
-    ret = dict_set_uint32(dict, key, itable->purge_size);
+    ret = dict_set_uint32(dict, key, purge_size);
     if (ret)
         goto out;
 
@@ -2541,29 +2992,36 @@ inode_table_dump_to_dict(inode_table_t *itable, char *prefix, dict_t *dict)
        If one wants to debug, let them take statedump and debug, this
        wouldn't be available in CLI during production setup.
     */
-    list_for_each_entry(inode, &itable->active, list)
-    {
-        snprintf(key, sizeof(key), "%s.itable.active%d", prefix, count++);
-        inode_dump_to_dict(inode, key, dict);
-    }
-    count = 0;
+    for (i = 0; i < GF_INODE_TABLE_SHARDS; i++) {
+        shard = &itable->shards[i];
+        pthread_mutex_lock(&shard->lock);
+        {
+            list_for_each_entry(inode, &shard->active, list)
+            {
+                snprintf(key, sizeof(key), "%s.itable.active%d", prefix,
+                         active++);
+                inode_dump_to_dict(inode, key, dict);
+            }
 
-    list_for_each_entry(inode, &itable->lru, list)
-    {
-        snprintf(key, sizeof(key), "%s.itable.lru%d", prefix, count++);
-        inode_dump_to_dict(inode, key, dict);
-    }
-    count = 0;
+            list_for_each_entry(inode, &shard->lru, list)
+            {
+                snprintf(key, sizeof(key), "%s.itable.lru%d", prefix, lru++);
+                inode_dump_to_dict(inode, key, dict);
+            }
 
-    list_for_each_entry(inode, &itable->purge, list)
-    {
-        snprintf(key, sizeof(key), "%s.itable.purge%d", prefix, count++);
-        inode_dump_to_dict(inode, key, dict);
+            list_for_each_entry(inode, &shard->purge, list)
+            {
+                snprintf(key, sizeof(key), "%s.itable.purge%d", prefix,
+                         purge++);
+                inode_dump_to_dict(inode, key, dict);
+            }
+        }
+        pthread_mutex_unlock(&shard->lock);
     }
 #endif
 
 out:
-    pthread_mutex_unlock(&itable->lock);
+    pthread_rwlock_unlock(&itable->lock);
 
     return;
 }
@@ -2585,14 +3043,14 @@ inode_find_directory_name(inode_t *inode, const char **name)
     if (!IA_ISDIR(inode->ia_type))
         return;
 
-    pthread_mutex_lock(&inode->table->lock);
+    pthread_rwlock_rdlock(&inode->table->lock);
     {
         dentry = __dentry_search_arbit(inode);
         if (dentry) {
             *name = dentry->name;
         }
     }
-    pthread_mutex_unlock(&inode->table->lock);
+    pthread_rwlock_unlock(&inode->table->lock);
 out:
     return;
 }
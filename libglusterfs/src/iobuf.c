@@ -333,6 +333,13 @@ __iobuf_arena_prune(struct iobuf_pool *iobuf_pool,
         goto out;
     }
 
+    /* Pinned arenas are still referenced by the kernel, keep them around
+     * so that their address range is never reused. */
+    if (iobuf_arena->pinned) {
+        list_add_tail(&iobuf_arena->list, &iobuf_pool->purge[index]);
+        goto out;
+    }
+
     /* All cases matched, destroy */
     iobuf_pool->arena_cnt--;
 
@@ -522,6 +529,92 @@ post_unlock:
     return iobuf;
 }
 
+/* Like iobuf_get2(), but serve the sizes that iobuf_get2() takes from the
+ * arenas only from the ones already mapped when possible, so that the buffer
+ * can be one the kernel knows about (see iobuf_pool_pin_arenas()). Small
+ * sizes still use a plain allocation. */
+struct iobuf *
+iobuf_get_pinned(struct iobuf_pool *iobuf_pool, size_t page_size)
+{
+    struct iobuf *iobuf = NULL;
+    size_t rounded_size = 0;
+    int index = 0;
+
+    if (page_size == 0) {
+        page_size = iobuf_pool->default_page_size;
+    }
+
+    if (page_size <= USE_IOBUF_POOL_IF_SIZE_GREATER_THAN)
+        return iobuf_get2(iobuf_pool, page_size);
+
+    rounded_size = gf_iobuf_get_pagesize(page_size, &index);
+    if (rounded_size == -1)
+        return iobuf_get2(iobuf_pool, page_size);
+
+    pthread_mutex_lock(&iobuf_pool->mutex);
+    {
+        iobuf = __iobuf_get(iobuf_pool, rounded_size, index);
+        if (iobuf)
+            iobuf_ref(iobuf);
+    }
+    pthread_mutex_unlock(&iobuf_pool->mutex);
+
+    if (!iobuf)
+        gf_smsg(THIS->name, GF_LOG_WARNING, 0, LG_MSG_IOBUF_NOT_FOUND, NULL);
+
+    return iobuf;
+}
+
+static void
+__iobuf_arena_pin(struct iobuf_pool *iobuf_pool,
+                  struct iobuf_arena *iobuf_arena, struct iovec *iov, int max)
+{
+    if (!iobuf_arena->pinned) {
+        if (iobuf_pool->pinned_cnt >= max)
+            return;
+        iobuf_arena->pin_index = iobuf_pool->pinned_cnt++;
+        iobuf_arena->pinned = 1;
+    }
+
+    if (iobuf_arena->pin_index < max) {
+        iov[iobuf_arena->pin_index].iov_base = iobuf_arena->mem_base;
+        iov[iobuf_arena->pin_index].iov_len = iobuf_arena->arena_size;
+    }
+}
+
+/* Pin every arena currently mapped by the pool, so that it is never
+ * unmapped, and describe all the pinned arenas in @iov, indexed by their
+ * pin_index. Arenas pinned by an earlier call keep their index. Returns
+ * the number of entries of @iov that were filled. */
+int
+iobuf_pool_pin_arenas(struct iobuf_pool *iobuf_pool, struct iovec *iov,
+                      int max)
+{
+    struct iobuf_arena *iobuf_arena = NULL;
+    int count = 0;
+    int i = 0;
+
+    GF_VALIDATE_OR_GOTO("iobuf", iobuf_pool, out);
+    GF_VALIDATE_OR_GOTO("iobuf", iov, out);
+
+    pthread_mutex_lock(&iobuf_pool->mutex);
+    {
+        for (i = 0; i < IOBUF_ARENA_MAX_INDEX; i++) {
+            list_for_each_entry(iobuf_arena, &iobuf_pool->arenas[i], list)
+                __iobuf_arena_pin(iobuf_pool, iobuf_arena, iov, max);
+            list_for_each_entry(iobuf_arena, &iobuf_pool->filled[i], list)
+                __iobuf_arena_pin(iobuf_pool, iobuf_arena, iov, max);
+            list_for_each_entry(iobuf_arena, &iobuf_pool->purge[i], list)
+                __iobuf_arena_pin(iobuf_pool, iobuf_arena, iov, max);
+        }
+        count = min(iobuf_pool->pinned_cnt, max);
+    }
+    pthread_mutex_unlock(&iobuf_pool->mutex);
+
+out:
+    return count;
+}
+
 struct iobuf *
 iobuf_get_page_aligned(struct iobuf_pool *iobuf_pool, size_t page_size,
                        size_t align_size)
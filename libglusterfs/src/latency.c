@@ -13,9 +13,25 @@
  * latencies of FOPs broken down by subvolumes.
  */
 
+#include <urcu/uatomic.h>
+
 #include <glusterfs/logging.h>
 #include "glusterfs/statedump.h"
 
+const char *gf_latency_pct_names[GF_LATENCY_PCT_MAX] = {
+    [GF_LATENCY_P50] = "p50",
+    [GF_LATENCY_P90] = "p90",
+    [GF_LATENCY_P99] = "p99",
+    [GF_LATENCY_P999] = "p999",
+};
+
+static const double gf_latency_pct_values[GF_LATENCY_PCT_MAX] = {
+    [GF_LATENCY_P50] = 50.0,
+    [GF_LATENCY_P90] = 90.0,
+    [GF_LATENCY_P99] = 99.0,
+    [GF_LATENCY_P999] = 99.9,
+};
+
 gf_latency_t *
 gf_latency_new(size_t n)
 {
@@ -27,11 +43,127 @@ gf_latency_new(size_t n)
         return NULL;
 
     for (i = 0; i < n; i++) {
+        lat[i].hist = NULL;
         gf_latency_reset(lat + i);
     }
     return lat;
 }
 
+gf_latency_hist_t *
+gf_latency_hist_new(size_t n)
+{
+    return GF_CALLOC(n, sizeof(gf_latency_hist_t),
+                     gf_common_mt_latency_hist_t);
+}
+
+static int
+gf_latency_hist_index(uint64_t value)
+{
+    int shift = 0;
+
+    if (value < GF_LATENCY_HIST_SUB_BUCKETS)
+        return value;
+
+    if (value >= (1ULL << GF_LATENCY_HIST_MAX_BITS))
+        return GF_LATENCY_HIST_BUCKETS - 1;
+
+    /* position of the most significant bit, minus the bits kept for the
+     * linear sub-bucket */
+    shift = 63 - __builtin_clzll(value) - GF_LATENCY_HIST_SUB_BITS;
+
+    return ((shift + 1) << GF_LATENCY_HIST_SUB_BITS) +
+           ((value >> shift) & (GF_LATENCY_HIST_SUB_BUCKETS - 1));
+}
+
+/* Highest value that maps into bucket 'index' */
+static uint64_t
+gf_latency_hist_value(int index)
+{
+    int shift = 0;
+    uint64_t sub = 0;
+
+    if (index < GF_LATENCY_HIST_SUB_BUCKETS)
+        return index;
+
+    shift = (index >> GF_LATENCY_HIST_SUB_BITS) - 1;
+    sub = GF_LATENCY_HIST_SUB_BUCKETS +
+          (index & (GF_LATENCY_HIST_SUB_BUCKETS - 1));
+
+    return ((sub + 1) << shift) - 1;
+}
+
+void
+gf_latency_hist_record(gf_latency_hist_t *hist, uint64_t value)
+{
+    uatomic_inc(&hist->buckets[gf_latency_hist_index(value)]);
+}
+
+void
+gf_latency_hist_reset(gf_latency_hist_t *hist)
+{
+    int i;
+
+    if (!hist)
+        return;
+
+    for (i = 0; i < GF_LATENCY_HIST_BUCKETS; i++)
+        uatomic_set(&hist->buckets[i], 0);
+}
+
+/* Adds a snapshot of 'src' into 'dst', which must not be updated
+ * concurrently. Returns the number of samples merged. */
+uint64_t
+gf_latency_hist_merge(gf_latency_hist_t *dst, gf_latency_hist_t *src)
+{
+    uint64_t count = 0;
+    uint64_t total = 0;
+    int i;
+
+    for (i = 0; i < GF_LATENCY_HIST_BUCKETS; i++) {
+        count = uatomic_read(&src->buckets[i]);
+        dst->buckets[i] += count;
+        total += count;
+    }
+
+    return total;
+}
+
+void
+gf_latency_hist_percentiles(gf_latency_hist_t *hist,
+                            uint64_t pct[GF_LATENCY_PCT_MAX])
+{
+    gf_latency_hist_t snap = {
+        {0},
+    };
+    uint64_t total = 0;
+    uint64_t seen = 0;
+    uint64_t target = 0;
+    double rank = 0.0;
+    int i = 0;
+    int p = 0;
+
+    total = gf_latency_hist_merge(&snap, hist);
+
+    for (p = 0; p < GF_LATENCY_PCT_MAX; p++) {
+        pct[p] = 0;
+        if (!total)
+            continue;
+
+        rank = (total * gf_latency_pct_values[p]) / 100.0;
+        target = (uint64_t)rank;
+        if (target < rank || !target)
+            target++;
+
+        /* percentiles are ordered, so carry on from the previous bucket */
+        while (i < GF_LATENCY_HIST_BUCKETS - 1 &&
+               seen + snap.buckets[i] < target) {
+            seen += snap.buckets[i];
+            i++;
+        }
+        pct[p] = gf_latency_hist_value(i);
+    }
+}
+
 void
 gf_latency_update(gf_latency_t *lat, struct timespec *begin,
                   struct timespec *end)
@@ -51,14 +183,22 @@ gf_latency_update(gf_latency_t *lat, struct timespec *begin,
 
     lat->total += elapsed;
     lat->count++;
+
+    if (lat->hist)
+        gf_latency_hist_record(lat->hist, elapsed);
 }
 
 void
 gf_latency_reset(gf_latency_t *lat)
 {
+    gf_latency_hist_t *hist = NULL;
+
     if (!lat)
         return;
+    hist = lat->hist;
     memset(lat, 0, sizeof(*lat));
+    lat->hist = hist;
+    gf_latency_hist_reset(hist);
     lat->min = ULLONG_MAX;
     /* make sure 'min' is set to high value, so it would be
        properly set later */
@@ -68,6 +208,7 @@ void
 gf_frame_latency_update(call_frame_t *frame)
 {
     gf_latency_t *lat;
+    gf_latency_hist_t *hist;
     /* Can happen mostly at initiator xlator, as STACK_WIND/UNWIND macros
        set it right anyways for those frames */
     if (!frame->op)
@@ -80,5 +221,12 @@ gf_frame_latency_update(call_frame_t *frame)
     }
 
     lat = &frame->this->stats[frame->op].latencies;
+    if (!lat->hist) {
+        /* Only xlators that see traffic while latency measurement is on
+         * pay for a histogram. Freed in xlator_members_free(). */
+        hist = gf_latency_hist_new(1);
+        if (hist && uatomic_cmpxchg(&lat->hist, NULL, hist) != NULL)
+            GF_FREE(hist);
+    }
     gf_latency_update(lat, &frame->begin, &frame->end);
 }
@@ -53,6 +53,8 @@ dump_latency_and_count(xlator_t *xl, int fd)
     uint64_t cbk = 0;
     uint64_t total_fop_count = 0;
     uint64_t interval_fop_count = 0;
+    uint64_t pct[GF_LATENCY_PCT_MAX];
+    int p = 0;
 
     if (xl->winds) {
         dprintf(fd, "%s.total.pending-winds.count %" PRIu64 "\n", xl->name,
@@ -90,9 +92,16 @@ dump_latency_and_count(xlator_t *xl, int fd)
                     gf_fop_list[index], xl->stats[index].latencies.max);
             dprintf(fd, "%s.interval.%s.min %" PRIu64 "\n", xl->name,
                     gf_fop_list[index], xl->stats[index].latencies.min);
+            if (xl->stats[index].latencies.hist) {
+                gf_latency_hist_percentiles(xl->stats[index].latencies.hist,
+                                            pct);
+                for (p = 0; p < GF_LATENCY_PCT_MAX; p++)
+                    dprintf(fd, "%s.interval.%s.%s %" PRIu64 "\n", xl->name,
+                            gf_fop_list[index], gf_latency_pct_names[p],
+                            pct[p]);
+            }
         }
-        memset(&xl->stats[index].latencies, 0,
-               sizeof(xl->stats[index].latencies));
+        gf_latency_reset(&xl->stats[index].latencies);
     }
 
     dprintf(fd, "%s.total.fop-count %" PRIu64 "\n", xl->name, total_fop_count);
@@ -0,0 +1,233 @@
+/*
+  Copyright (c) 2026 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+#include <arpa/inet.h>
+#include <ctype.h>
+#include <limits.h>
+
+#include "glusterfs/mem-pool.h"
+#include "glusterfs/hashfn.h"
+#include "glusterfs/names-filter.h"
+
+/* Size of the bits of a filter asked for 'size' bytes */
+size_t
+gf_names_filter_round(size_t size)
+{
+    size_t bytes = GF_NAMES_FILTER_MIN_SIZE;
+
+    while ((bytes < size) && (bytes < GF_NAMES_FILTER_MAX_SIZE))
+        bytes <<= 1;
+
+    return bytes;
+}
+
+gf_names_filter_t *
+gf_names_filter_new(size_t size)
+{
+    gf_names_filter_t *filter = NULL;
+    size_t bytes = gf_names_filter_round(size);
+
+    filter = GF_CALLOC(1, sizeof(*filter) + bytes, gf_common_mt_names_filter_t);
+    if (!filter)
+        return NULL;
+
+    filter->size = htonl(bytes);
+    filter->sources = htonl(1);
+    filter->hashes = htonl(GF_NAMES_FILTER_HASHES);
+
+    return filter;
+}
+
+size_t
+gf_names_filter_len(gf_names_filter_t *filter)
+{
+    return sizeof(*filter) + ntohl(filter->size);
+}
+
+uint32_t
+gf_names_filter_sources(gf_names_filter_t *filter)
+{
+    return ntohl(filter->sources);
+}
+
+/* Double hashing: the bits of a name are h1 + i * h2, h2 being odd so
+ * that they are all different. */
+static void
+names_filter_hash(const char *name, uint32_t *h1, uint32_t *h2)
+{
+    int len = strlen(name);
+
+    *h1 = gf_dm_hashfn(name, len);
+    *h2 = SuperFastHash(name, len) | 1;
+}
+
+static void
+names_filter_set(gf_names_filter_t *filter, const char *name)
+{
+    uint32_t mask = ntohl(filter->size) * 8 - 1;
+    uint32_t hashes = ntohl(filter->hashes);
+    uint32_t h1 = 0;
+    uint32_t h2 = 0;
+    uint32_t bit = 0;
+    uint32_t i = 0;
+
+    names_filter_hash(name, &h1, &h2);
+
+    for (i = 0; i < hashes; i++) {
+        bit = (h1 + i * h2) & mask;
+        filter->bits[bit >> 3] |= 1 << (bit & 7);
+    }
+}
+
+/* Lower cases the ASCII letters of 'name' into 'lower'. Fails when the name
+ * has other bytes, which may be letters in another case for the reader. */
+static int
+names_filter_lower(const char *name, char *lower, size_t size)
+{
+    size_t i = 0;
+
+    for (i = 0; name[i]; i++) {
+        if ((i + 1 >= size) || ((unsigned char)name[i] >= 0x80))
+            return -1;
+        lower[i] = tolower(name[i]);
+    }
+    lower[i] = '\0';
+
+    return 0;
+}
+
+/* The lower case form of the name is added too, so that the filter can also
+ * tell when no name matches without regard to case. */
+void
+gf_names_filter_add(gf_names_filter_t *filter, const char *name)
+{
+    char lower[NAME_MAX + 1];
+
+    names_filter_set(filter, name);
+
+    if (!names_filter_lower(name, lower, sizeof(lower)) &&
+        strcmp(name, lower))
+        names_filter_set(filter, lower);
+
+    filter->count = htonl(ntohl(filter->count) + 1);
+}
+
+gf_boolean_t
+gf_names_filter_has(gf_names_filter_t *filter, const char *name)
+{
+    uint32_t mask = ntohl(filter->size) * 8 - 1;
+    uint32_t hashes = ntohl(filter->hashes);
+    uint32_t h1 = 0;
+    uint32_t h2 = 0;
+    uint32_t bit = 0;
+    uint32_t i = 0;
+
+    names_filter_hash(name, &h1, &h2);
+
+    for (i = 0; i < hashes; i++) {
+        bit = (h1 + i * h2) & mask;
+        if (!(filter->bits[bit >> 3] & (1 << (bit & 7))))
+            return _gf_false;
+    }
+
+    return _gf_true;
+}
+
+gf_boolean_t
+gf_names_filter_has_nocase(gf_names_filter_t *filter, const char *name)
+{
+    char lower[NAME_MAX + 1];
+
+    /* Names with non ASCII bytes were only added as they are */
+    if (names_filter_lower(name, lower, sizeof(lower)))
+        return _gf_true;
+
+    return gf_names_filter_has(filter, lower);
+}
+
+int
+gf_names_filter_merge(gf_names_filter_t *dst, gf_names_filter_t *src)
+{
+    uint32_t size = ntohl(dst->size);
+    uint32_t i = 0;
+
+    if ((src->size != dst->size) || (src->hashes != dst->hashes))
+        return -1;
+
+    for (i = 0; i < size; i++)
+        dst->bits[i] |= src->bits[i];
+
+    dst->sources = htonl(ntohl(dst->sources) + ntohl(src->sources));
+    dst->count = htonl(ntohl(dst->count) + ntohl(src->count));
+
+    return 0;
+}
+
+/* Like gf_names_filter_merge(), for the filters of copies of the same
+ * directory, which still count as one source. */
+int
+gf_names_filter_merge_copy(gf_names_filter_t *dst, gf_names_filter_t *src)
+{
+    uint32_t sources = dst->sources;
+    uint32_t count = max(ntohl(dst->count), ntohl(src->count));
+
+    if (gf_names_filter_merge(dst, src))
+        return -1;
+
+    dst->sources = sources;
+    dst->count = htonl(count);
+
+    return 0;
+}
+
+gf_names_filter_t *
+gf_names_filter_dup(gf_names_filter_t *filter)
+{
+    return gf_memdup(filter, gf_names_filter_len(filter));
+}
+
+gf_names_filter_t *
+gf_names_filter_from_data(data_t *data)
+{
+    gf_names_filter_t *filter = NULL;
+    uint32_t size = 0;
+
+    if (!data || (data->len < sizeof(*filter)))
+        return NULL;
+
+    filter = (gf_names_filter_t *)data->data;
+    size = ntohl(filter->size);
+    if ((size < GF_NAMES_FILTER_MIN_SIZE) ||
+        (size > GF_NAMES_FILTER_MAX_SIZE) || (size & (size - 1)) ||
+        (data->len != sizeof(*filter) + size) ||
+        (ntohl(filter->hashes) == 0) ||
+        (ntohl(filter->hashes) > GF_NAMES_FILTER_HASHES * 4))
+        return NULL;
+
+    return gf_names_filter_dup(filter);
+}
+
+int
+gf_names_filter_to_dict(dict_t *dict, gf_names_filter_t *filter)
+{
+    gf_names_filter_t *copy = NULL;
+    int ret = -1;
+
+    copy = gf_names_filter_dup(filter);
+    if (!copy)
+        return -1;
+
+    ret = dict_set_bin(dict, GF_NAMES_FILTER_KEY, copy,
+                       gf_names_filter_len(copy));
+    if (ret)
+        GF_FREE(copy);
+
+    return ret;
+}
@@ -0,0 +1,188 @@
+/*
+  Copyright (c) 2026 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+#include <string.h>
+
+#include "glusterfs/common-utils.h"
+#include "glusterfs/range-map.h"
+
+#define RANGE_MAP_NONE UINT64_MAX
+
+#define BIT_SET(bits, i) ((bits)[(i) >> 3] |= (1 << ((i)&7)))
+#define BIT_TEST(bits, i) ((bits)[(i) >> 3] & (1 << ((i)&7)))
+
+void
+gf_range_map_init(gf_range_map_t *map)
+{
+    memset(map, 0, sizeof(*map));
+    map->shift = htobe32(GF_RANGE_MAP_MIN_SHIFT);
+    map->nbits = htobe32(GF_RANGE_MAP_BITS);
+    map->tail = htobe64(RANGE_MAP_NONE);
+}
+
+gf_boolean_t
+gf_range_map_valid(const void *buf, size_t len)
+{
+    const gf_range_map_t *map = buf;
+    uint32_t shift = 0;
+
+    if (!buf || (len != sizeof(*map)))
+        return _gf_false;
+
+    shift = be32toh(map->shift);
+    if ((shift < GF_RANGE_MAP_MIN_SHIFT) || (shift > GF_RANGE_MAP_MAX_SHIFT))
+        return _gf_false;
+
+    return (be32toh(map->nbits) == GF_RANGE_MAP_BITS);
+}
+
+gf_boolean_t
+gf_range_map_empty(const gf_range_map_t *map)
+{
+    if (be64toh(map->tail) != RANGE_MAP_NONE)
+        return _gf_false;
+
+    return mem_0filled((const char *)map->bits, sizeof(map->bits)) == 0;
+}
+
+/* Halves the resolution of the map, bit i now covers old bits 2i and 2i+1 */
+static void
+range_map_coarsen(gf_range_map_t *map)
+{
+    unsigned char bits[GF_RANGE_MAP_BITS / 8] = {
+        0,
+    };
+    int i = 0;
+
+    for (i = 0; i < GF_RANGE_MAP_BITS; i++) {
+        if (BIT_TEST(map->bits, i))
+            BIT_SET(bits, i / 2);
+    }
+
+    memcpy(map->bits, bits, sizeof(bits));
+    map->shift = htobe32(be32toh(map->shift) + 1);
+}
+
+/* Marks [offset, offset + len), len 0 marking everything from offset on */
+void
+gf_range_map_mark(gf_range_map_t *map, uint64_t offset, uint64_t len)
+{
+    uint64_t last = 0;
+    uint64_t i = 0;
+    uint32_t shift = 0;
+
+    if (!len || (offset + len < offset)) {
+        if (offset < be64toh(map->tail))
+            map->tail = htobe64(offset);
+        return;
+    }
+
+    last = offset + len - 1;
+    while ((last >> be32toh(map->shift)) >= GF_RANGE_MAP_BITS) {
+        if (be32toh(map->shift) == GF_RANGE_MAP_MAX_SHIFT) {
+            gf_range_map_mark(map, offset, 0);
+            return;
+        }
+        range_map_coarsen(map);
+    }
+
+    shift = be32toh(map->shift);
+    for (i = offset >> shift; i <= (last >> shift); i++)
+        BIT_SET(map->bits, i);
+}
+
+/* Marks the range of one modification and counts it */
+void
+gf_range_map_record(gf_range_map_t *map, uint64_t offset, uint64_t len)
+{
+    gf_range_map_mark(map, offset, len);
+    map->marks = htobe64(be64toh(map->marks) + 1);
+}
+
+uint64_t
+gf_range_map_marks(const gf_range_map_t *map)
+{
+    return be64toh(map->marks);
+}
+
+/* Whether any of [offset, offset + len) is marked, len 0 meaning up to the
+ * end of the file */
+gf_boolean_t
+gf_range_map_test(const gf_range_map_t *map, uint64_t offset, uint64_t len)
+{
+    uint32_t shift = be32toh(map->shift);
+    uint64_t last = 0;
+    uint64_t i = 0;
+
+    if (!len || (offset + len < offset))
+        last = RANGE_MAP_NONE;
+    else
+        last = offset + len - 1;
+
+    if (last >= be64toh(map->tail))
+        return _gf_true;
+
+    last >>= shift;
+    if (last >= GF_RANGE_MAP_BITS)
+        last = GF_RANGE_MAP_BITS - 1;
+
+    for (i = offset >> shift; i <= last; i++) {
+        if (BIT_TEST(map->bits, i))
+            return _gf_true;
+    }
+
+    return _gf_false;
+}
+
+void
+gf_range_map_merge(gf_range_map_t *dst, const gf_range_map_t *src)
+{
+    uint32_t shift = be32toh(src->shift);
+    uint64_t i = 0;
+
+    for (i = 0; i < GF_RANGE_MAP_BITS; i++) {
+        if (((i << shift) >> shift) != i)
+            break;
+        if (BIT_TEST(src->bits, i))
+            gf_range_map_mark(dst, i << shift, 1ULL << shift);
+    }
+
+    if (be64toh(src->tail) != RANGE_MAP_NONE)
+        gf_range_map_mark(dst, be64toh(src->tail), 0);
+}
+
+/* Number of bytes of a file of 'size' bytes the map marks */
+uint64_t
+gf_range_map_bytes(const gf_range_map_t *map, uint64_t size)
+{
+    uint32_t shift = be32toh(map->shift);
+    uint64_t limit = be64toh(map->tail);
+    uint64_t bytes = 0;
+    uint64_t start = 0;
+    uint64_t end = 0;
+    uint64_t i = 0;
+
+    if (limit < size)
+        bytes = size - limit;
+    else
+        limit = size;
+
+    for (i = 0; i < GF_RANGE_MAP_BITS; i++) {
+        start = i << shift;
+        if (((start >> shift) != i) || (start >= limit))
+            break;
+        if (!BIT_TEST(map->bits, i))
+            continue;
+        end = start + (1ULL << shift);
+        bytes += ((end > limit) ? limit : end) - start;
+    }
+
+    return bytes;
+}
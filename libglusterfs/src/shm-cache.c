@@ -0,0 +1,465 @@
+/*
+  Copyright (c) 2026 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "glusterfs/common-utils.h"
+#include "glusterfs/iatt.h"
+#include "glusterfs/libglusterfs-messages.h"
+#include "glusterfs/mem-pool.h"
+#include "glusterfs/shm-cache.h"
+#include "glusterfs/statedump.h"
+#include "glusterfs/syscall.h"
+
+#define SHM_CACHE_MAGIC 0x676c7573746d6331ULL /* "glustmc1" */
+#define SHM_CACHE_VERSION 1
+#define SHM_CACHE_ALIGN(x, a) (((x) + (a)-1) & ~((uint64_t)(a)-1))
+
+typedef struct _gf_shm_cache_header {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t block_size;
+    uint32_t ways;
+    uint32_t nsets;
+    uint64_t size;
+} gf_shm_cache_header_t;
+
+typedef struct _gf_shm_cache_entry {
+    uuid_t gfid;
+    int64_t offset;
+    int64_t mtime;
+    uint32_t mtime_nsec;
+    uint32_t size; /* 0 when the entry is free */
+    uint64_t used;
+} gf_shm_cache_entry_t;
+
+typedef struct _gf_shm_cache_set {
+    pthread_mutex_t lock;
+    uint64_t clock;
+    gf_shm_cache_entry_t entries[GF_SHM_CACHE_WAYS];
+} __attribute__((aligned(64))) gf_shm_cache_set_t;
+
+static int
+shm_cache_set_init(gf_shm_cache_set_t *set)
+{
+    pthread_mutexattr_t attr;
+    int ret = 0;
+
+    memset(set, 0, sizeof(*set));
+
+    ret = pthread_mutexattr_init(&attr);
+    if (ret)
+        return ret;
+
+    ret = pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+    if (!ret)
+        ret = pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+    if (!ret)
+        ret = pthread_mutex_init(&set->lock, &attr);
+
+    pthread_mutexattr_destroy(&attr);
+    return ret;
+}
+
+/* A process which died holding the lock of a set may have left any of its
+ * entries half written, so they are all dropped. */
+static int
+shm_cache_set_lock(gf_shm_cache_set_t *set)
+{
+    int ret = 0;
+
+    ret = pthread_mutex_lock(&set->lock);
+    if (ret == EOWNERDEAD) {
+        memset(set->entries, 0, sizeof(set->entries));
+        ret = pthread_mutex_consistent(&set->lock);
+    }
+
+    return ret;
+}
+
+static void
+shm_cache_set_unlock(gf_shm_cache_set_t *set)
+{
+    pthread_mutex_unlock(&set->lock);
+}
+
+static uint32_t
+shm_cache_set_index(gf_shm_cache_t *cache, uuid_t gfid, off_t offset)
+{
+    uint64_t hash = 0;
+
+    memcpy(&hash, &gfid[8], sizeof(hash));
+    hash ^= (uint64_t)(offset / cache->block_size) * 0x9e3779b97f4a7c15ULL;
+
+    return hash % cache->nsets;
+}
+
+static char *
+shm_cache_block(gf_shm_cache_t *cache, uint32_t set, int way)
+{
+    return cache->blocks +
+           ((uint64_t)set * GF_SHM_CACHE_WAYS + way) * cache->block_size;
+}
+
+static uint64_t
+shm_cache_layout(uint32_t nsets, uint32_t block_size, uint64_t *sets_off,
+                 uint64_t *blocks_off)
+{
+    *sets_off = SHM_CACHE_ALIGN(sizeof(gf_shm_cache_header_t), 64);
+    *blocks_off = SHM_CACHE_ALIGN(
+        *sets_off + (uint64_t)nsets * sizeof(gf_shm_cache_set_t), 4096);
+
+    return *blocks_off + (uint64_t)nsets * GF_SHM_CACHE_WAYS * block_size;
+}
+
+gf_shm_cache_t *
+gf_shm_cache_open(const char *name, uint64_t size, uint32_t block_size)
+{
+    gf_shm_cache_t *cache = NULL;
+    gf_shm_cache_header_t header = {
+        0,
+    };
+    struct stat st = {
+        0,
+    };
+    char *path = NULL;
+    char *p = NULL;
+    void *map = MAP_FAILED;
+    uint64_t sets_off = 0;
+    uint64_t blocks_off = 0;
+    uint64_t map_size = 0;
+    uint32_t nsets = 0;
+    uint32_t i = 0;
+    int fd = -1;
+    int ret = -1;
+
+    if (!name || !block_size ||
+        (size < (uint64_t)block_size * GF_SHM_CACHE_WAYS)) {
+        gf_msg("glusterfs", GF_LOG_WARNING, EINVAL, LG_MSG_INVALID_ENTRY,
+               "shared cache of %" PRIu64 " bytes cannot hold %d blocks of "
+               "%u bytes",
+               size, GF_SHM_CACHE_WAYS, block_size);
+        return NULL;
+    }
+
+    ret = gf_asprintf(&path, GF_SHM_CACHE_DIR "/glusterfs-%s.cache", name);
+    if (ret < 0)
+        return NULL;
+
+    /* volfile ids may contain '/' */
+    for (p = path + SLEN(GF_SHM_CACHE_DIR "/"); *p; p++) {
+        if (*p == '/')
+            *p = '_';
+    }
+
+    /* the directory is world writable: never follow a link planted there,
+     * and only share a file this user created, the umask aside */
+    fd = sys_open(path, O_RDWR | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC,
+                  0600);
+    if (fd >= 0) {
+        if (sys_fchmod(fd, 0600) < 0)
+            goto err;
+    } else if (errno == EEXIST) {
+        fd = sys_open(path, O_RDWR | O_NOFOLLOW | O_CLOEXEC, 0);
+    }
+    if (fd < 0) {
+        gf_msg("glusterfs", GF_LOG_WARNING, errno, LG_MSG_FILE_OP_FAILED,
+               "cannot open shared cache %s", path);
+        goto out;
+    }
+
+    if (sys_fstat(fd, &st) < 0)
+        goto err;
+
+    if (!S_ISREG(st.st_mode) || (st.st_uid != geteuid()) ||
+        ((st.st_mode & 07777) != 0600) || (st.st_nlink != 1)) {
+        gf_msg("glusterfs", GF_LOG_WARNING, EPERM, LG_MSG_FILE_OP_FAILED,
+               "shared cache %s is not a file of uid %d with mode 0600, "
+               "not using it",
+               path, geteuid());
+        goto err;
+    }
+
+    /* the first process to come along lays out the cache, the others wait
+     * for it and take its geometry */
+    if (flock(fd, LOCK_EX) < 0)
+        goto err;
+
+    if (sys_fstat(fd, &st) < 0)
+        goto err;
+
+    if ((st.st_size >= sizeof(header)) &&
+        (sys_pread(fd, &header, sizeof(header), 0) == sizeof(header)) &&
+        (header.magic == SHM_CACHE_MAGIC)) {
+        if ((header.version != SHM_CACHE_VERSION) ||
+            (header.ways != GF_SHM_CACHE_WAYS) || !header.nsets ||
+            (header.block_size != block_size) || (header.size != st.st_size)) {
+            gf_msg("glusterfs", GF_LOG_WARNING, EINVAL, LG_MSG_INVALID_ENTRY,
+                   "shared cache %s has blocks of %u bytes, not %u", path,
+                   header.block_size, block_size);
+            goto err;
+        }
+        nsets = header.nsets;
+        map_size = shm_cache_layout(nsets, block_size, &sets_off, &blocks_off);
+        if (map_size != header.size)
+            goto err;
+    } else {
+        nsets = size / ((uint64_t)block_size * GF_SHM_CACHE_WAYS);
+        map_size = shm_cache_layout(nsets, block_size, &sets_off, &blocks_off);
+        if ((sys_ftruncate(fd, 0) < 0) ||
+            (sys_ftruncate(fd, map_size) < 0)) {
+            gf_msg("glusterfs", GF_LOG_WARNING, errno, LG_MSG_FILE_OP_FAILED,
+                   "cannot size shared cache %s", path);
+            goto err;
+        }
+    }
+
+    map = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        gf_msg("glusterfs", GF_LOG_WARNING, errno, LG_MSG_FILE_OP_FAILED,
+               "cannot map shared cache %s", path);
+        goto err;
+    }
+
+    if (header.magic != SHM_CACHE_MAGIC) {
+        for (i = 0; i < nsets; i++) {
+            if (shm_cache_set_init(
+                    (gf_shm_cache_set_t *)((char *)map + sets_off) + i))
+                goto err;
+        }
+
+        header.magic = 0;
+        header.version = SHM_CACHE_VERSION;
+        header.block_size = block_size;
+        header.ways = GF_SHM_CACHE_WAYS;
+        header.nsets = nsets;
+        header.size = map_size;
+        memcpy(map, &header, sizeof(header));
+        /* the magic goes last, a cache without it is laid out again */
+        __atomic_store_n(&((gf_shm_cache_header_t *)map)->magic,
+                         SHM_CACHE_MAGIC, __ATOMIC_RELEASE);
+    }
+
+    cache = GF_CALLOC(1, sizeof(*cache), gf_common_mt_shm_cache_t);
+    if (!cache)
+        goto err;
+
+    cache->path = path;
+    cache->map = map;
+    cache->map_size = map_size;
+    cache->header = map;
+    cache->sets = (gf_shm_cache_set_t *)((char *)map + sets_off);
+    cache->blocks = (char *)map + blocks_off;
+    cache->block_size = block_size;
+    cache->nsets = nsets;
+    GF_ATOMIC_INIT(cache->hits, 0);
+    GF_ATOMIC_INIT(cache->misses, 0);
+    GF_ATOMIC_INIT(cache->stale, 0);
+    GF_ATOMIC_INIT(cache->stores, 0);
+    GF_ATOMIC_INIT(cache->invalidations, 0);
+
+    flock(fd, LOCK_UN);
+    sys_close(fd);
+
+    return cache;
+
+err:
+    if (map != MAP_FAILED)
+        munmap(map, map_size);
+    flock(fd, LOCK_UN);
+    sys_close(fd);
+out:
+    GF_FREE(path);
+    return NULL;
+}
+
+void
+gf_shm_cache_close(gf_shm_cache_t *cache)
+{
+    if (!cache)
+        return;
+
+    munmap(cache->map, cache->map_size);
+    GF_FREE(cache->path);
+    GF_FREE(cache);
+}
+
+ssize_t
+gf_shm_cache_get(gf_shm_cache_t *cache, uuid_t gfid, off_t offset,
+                 struct iatt *stbuf, char *buf, size_t size)
+{
+    gf_shm_cache_set_t *set = NULL;
+    gf_shm_cache_entry_t *entry = NULL;
+    ssize_t ret = -1;
+    uint32_t index = 0;
+    int i = 0;
+
+    if (offset % cache->block_size)
+        goto out;
+
+    index = shm_cache_set_index(cache, gfid, offset);
+    set = &cache->sets[index];
+
+    if (shm_cache_set_lock(set))
+        goto out;
+
+    for (i = 0; i < GF_SHM_CACHE_WAYS; i++) {
+        entry = &set->entries[i];
+        if (!entry->size || (entry->offset != offset) ||
+            gf_uuid_compare(entry->gfid, gfid))
+            continue;
+
+        /* an older version of the file, it is replaced once read again */
+        if ((entry->mtime != stbuf->ia_mtime) ||
+            (entry->mtime_nsec != stbuf->ia_mtime_nsec)) {
+            GF_ATOMIC_INC(cache->stale);
+            break;
+        }
+
+        ret = min(size, entry->size);
+        memcpy(buf, shm_cache_block(cache, index, i), ret);
+        entry->used = ++set->clock;
+        break;
+    }
+
+    shm_cache_set_unlock(set);
+out:
+    if (ret < 0)
+        GF_ATOMIC_INC(cache->misses);
+    else
+        GF_ATOMIC_INC(cache->hits);
+
+    return ret;
+}
+
+void
+gf_shm_cache_put(gf_shm_cache_t *cache, uuid_t gfid, off_t offset,
+                 struct iatt *stbuf, struct iovec *vector, int count)
+{
+    gf_shm_cache_set_t *set = NULL;
+    gf_shm_cache_entry_t *entry = NULL;
+    gf_shm_cache_entry_t *victim = NULL;
+    size_t size = 0;
+    uint32_t index = 0;
+    int i = 0;
+
+    size = iov_length(vector, count);
+    if (!size || (size > cache->block_size) || (offset % cache->block_size))
+        return;
+
+    index = shm_cache_set_index(cache, gfid, offset);
+    set = &cache->sets[index];
+
+    if (shm_cache_set_lock(set))
+        return;
+
+    for (i = 0; i < GF_SHM_CACHE_WAYS; i++) {
+        entry = &set->entries[i];
+        if (entry->size && (entry->offset == offset) &&
+            !gf_uuid_compare(entry->gfid, gfid)) {
+            victim = entry;
+            break;
+        }
+
+        if (!victim || (victim->size && (!entry->size ||
+                                         (entry->used < victim->used))))
+            victim = entry;
+    }
+
+    i = victim - set->entries;
+    iov_unload(shm_cache_block(cache, index, i), vector, count);
+
+    gf_uuid_copy(victim->gfid, gfid);
+    victim->offset = offset;
+    victim->mtime = stbuf->ia_mtime;
+    victim->mtime_nsec = stbuf->ia_mtime_nsec;
+    victim->size = size;
+    victim->used = ++set->clock;
+
+    shm_cache_set_unlock(set);
+
+    GF_ATOMIC_INC(cache->stores);
+}
+
+static void
+shm_cache_set_invalidate(gf_shm_cache_t *cache, uint32_t index, uuid_t gfid,
+                         off_t offset, gf_boolean_t all)
+{
+    gf_shm_cache_set_t *set = NULL;
+    gf_shm_cache_entry_t *entry = NULL;
+    int i = 0;
+
+    set = &cache->sets[index];
+    if (shm_cache_set_lock(set))
+        return;
+
+    for (i = 0; i < GF_SHM_CACHE_WAYS; i++) {
+        entry = &set->entries[i];
+        if (entry->size && (all || (entry->offset == offset)) &&
+            !gf_uuid_compare(entry->gfid, gfid))
+            memset(entry, 0, sizeof(*entry));
+    }
+
+    shm_cache_set_unlock(set);
+}
+
+void
+gf_shm_cache_invalidate(gf_shm_cache_t *cache, uuid_t gfid, off_t offset,
+                        size_t size)
+{
+    uint32_t index = 0;
+    off_t end = 0;
+
+    GF_ATOMIC_INC(cache->invalidations);
+
+    if (!size) {
+        /* the blocks of a file can be in any set */
+        for (index = 0; index < cache->nsets; index++)
+            shm_cache_set_invalidate(cache, index, gfid, 0, _gf_true);
+        return;
+    }
+
+    end = offset + size;
+    offset -= offset % cache->block_size;
+    for (; offset < end; offset += cache->block_size) {
+        index = shm_cache_set_index(cache, gfid, offset);
+        shm_cache_set_invalidate(cache, index, gfid, offset, _gf_false);
+    }
+}
+
+void
+gf_shm_cache_dump(gf_shm_cache_t *cache, const char *prefix)
+{
+    char key[GF_DUMP_MAX_BUF_LEN];
+
+    gf_proc_dump_build_key(key, prefix, "path");
+    gf_proc_dump_write(key, "%s", cache->path);
+    gf_proc_dump_build_key(key, prefix, "size");
+    gf_proc_dump_write(key, "%zu", cache->map_size);
+    gf_proc_dump_build_key(key, prefix, "block-size");
+    gf_proc_dump_write(key, "%u", cache->block_size);
+    gf_proc_dump_build_key(key, prefix, "hits");
+    gf_proc_dump_write(key, "%" PRIu64, GF_ATOMIC_GET(cache->hits));
+    gf_proc_dump_build_key(key, prefix, "misses");
+    gf_proc_dump_write(key, "%" PRIu64, GF_ATOMIC_GET(cache->misses));
+    gf_proc_dump_build_key(key, prefix, "stale");
+    gf_proc_dump_write(key, "%" PRIu64, GF_ATOMIC_GET(cache->stale));
+    gf_proc_dump_build_key(key, prefix, "stores");
+    gf_proc_dump_write(key, "%" PRIu64, GF_ATOMIC_GET(cache->stores));
+    gf_proc_dump_build_key(key, prefix, "invalidations");
+    gf_proc_dump_write(key, "%" PRIu64, GF_ATOMIC_GET(cache->invalidations));
+}
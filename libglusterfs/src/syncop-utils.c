@@ -330,12 +330,14 @@ out:
 }
 
 int
-syncop_mt_dir_scan(call_frame_t *frame, xlator_t *subvol, loc_t *loc, int pid,
-                   void *data, syncop_dir_scan_fn_t fn, dict_t *xdata,
-                   uint32_t max_jobs, uint32_t max_qlen)
+syncop_mt_dir_scan_from(call_frame_t *frame, xlator_t *subvol, loc_t *loc,
+                        int pid, void *data, syncop_dir_scan_fn_t fn,
+                        dict_t *xdata, uint32_t max_jobs, uint32_t max_qlen,
+                        uint64_t offset, uint64_t end,
+                        syncop_dir_scan_progress_fn_t progress,
+                        void *progress_data)
 {
     fd_t *fd = NULL;
-    uint64_t offset = 0;
     gf_dirent_t *last = NULL;
     int ret = 0;
     int retval = 0;
@@ -348,6 +350,7 @@ syncop_mt_dir_scan(call_frame_t *frame, xlator_t *subvol, loc_t *loc, int pid,
     pthread_mutex_t mut = PTHREAD_MUTEX_INITIALIZER;
     gf_dirent_t entries;
     xlator_t *this = NULL;
+    gf_boolean_t done = _gf_false;
 
     if (frame) {
         this = frame->this;
@@ -395,6 +398,13 @@ syncop_mt_dir_scan(call_frame_t *frame, xlator_t *subvol, loc_t *loc, int pid,
             if (this && this->cleanup_starting)
                 goto out;
 
+            /* the directory offsets grow along the stream, the entries
+             * past @end are left to the scan which started there */
+            if (end && entry->d_off > end) {
+                done = _gf_true;
+                break;
+            }
+
             list_del_init(&entry->list);
             /* skip . and .. */
             if (inode_dir_or_parentdir(entry)) {
@@ -436,8 +446,18 @@ syncop_mt_dir_scan(call_frame_t *frame, xlator_t *subvol, loc_t *loc, int pid,
             if (ret)
                 goto out;
         }
+
+        if (progress)
+            progress(offset, progress_data);
+
+        if (done || (end && offset >= end))
+            break;
     }
 
+    /* the whole directory was read, a later scan starts over */
+    if (ret == 0 && !end && progress)
+        progress(0, progress_data);
+
 out:
     if (fd)
         fd_unref(fd);
@@ -455,6 +475,15 @@ out:
     return ret | retval;
 }
 
+int
+syncop_mt_dir_scan(call_frame_t *frame, xlator_t *subvol, loc_t *loc, int pid,
+                   void *data, syncop_dir_scan_fn_t fn, dict_t *xdata,
+                   uint32_t max_jobs, uint32_t max_qlen)
+{
+    return syncop_mt_dir_scan_from(frame, subvol, loc, pid, data, fn, xdata,
+                                   max_jobs, max_qlen, 0, 0, NULL, NULL);
+}
+
 int
 syncop_dir_scan(xlator_t *subvol, loc_t *loc, int pid, void *data,
                 int (*fn)(xlator_t *subvol, gf_dirent_t *entry, loc_t *parent,
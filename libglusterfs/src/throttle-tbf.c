@@ -68,7 +68,11 @@ _tbf_dispatch_queued(tbf_bucket_t *bucket)
     {
         pthread_mutex_lock(&throttle->mutex);
         {
-            if (bucket->tokens < throttle->tokens) {
+            /* no rate means no throttling, and a request larger than
+             * the bucket can go once the bucket is full.
+             */
+            if (bucket->tokenrate && (bucket->tokens < throttle->tokens) &&
+                (bucket->tokens < bucket->maxtokens)) {
                 xcont = _gf_true;
                 goto unblock;
             }
@@ -77,7 +81,10 @@ _tbf_dispatch_queued(tbf_bucket_t *bucket)
             throttle->done = 1;
             list_del_init(&throttle->list);
 
-            bucket->tokens -= throttle->tokens;
+            if (bucket->tokens < throttle->tokens)
+                bucket->tokens = 0;
+            else
+                bucket->tokens -= throttle->tokens;
             pthread_cond_signal(&throttle->cond);
         }
     unblock:
@@ -90,23 +97,25 @@ _tbf_dispatch_queued(tbf_bucket_t *bucket)
 void *
 tbf_tokengenerator(void *arg)
 {
-    unsigned long tokenrate = 0;
-    unsigned long maxtokens = 0;
     unsigned long token_gen_interval = 0;
     tbf_bucket_t *bucket = arg;
 
-    tokenrate = bucket->tokenrate;
-    maxtokens = bucket->maxtokens;
     token_gen_interval = bucket->token_gen_interval;
 
     while (1) {
         gf_nanosleep(token_gen_interval * GF_US_IN_NS);
 
+        /* rate and limit are read on every tick for tbf_mod() */
         LOCK(&bucket->lock);
         {
-            bucket->tokens += tokenrate;
-            if (bucket->tokens > maxtokens)
-                bucket->tokens = maxtokens;
+            if (bucket->stop) {
+                UNLOCK(&bucket->lock);
+                break;
+            }
+
+            bucket->tokens += bucket->tokenrate;
+            if (bucket->tokens > bucket->maxtokens)
+                bucket->tokens = bucket->maxtokens;
 
             if (!list_empty(&bucket->queued))
                 _tbf_dispatch_queued(bucket);
@@ -198,9 +207,47 @@ tbf_init(tbf_opspec_t *tbfspec, unsigned int count)
     return tbf;
 
 error_return:
+    tbf_fini(tbf);
     return NULL;
 }
 
+/**
+ * Stops the token generators and lets the queued requests go, the
+ * buckets must not be throttled on once this is called.
+ */
+void
+tbf_fini(tbf_t *tbf)
+{
+    int32_t i = 0;
+    tbf_bucket_t *bucket = NULL;
+
+    if (!tbf)
+        return;
+
+    for (i = 0; i < TBF_OP_MAX; i++) {
+        bucket = *(tbf->bucket + i);
+        if (!bucket)
+            continue;
+
+        LOCK(&bucket->lock);
+        {
+            bucket->stop = _gf_true;
+            bucket->tokenrate = 0;
+            if (!list_empty(&bucket->queued))
+                _tbf_dispatch_queued(bucket);
+        }
+        UNLOCK(&bucket->lock);
+
+        pthread_join(bucket->tokener, NULL);
+
+        LOCK_DESTROY(&bucket->lock);
+        GF_FREE(bucket);
+        *(tbf->bucket + i) = NULL;
+    }
+
+    GF_FREE(tbf);
+}
+
 static void
 tbf_mod_bucket(tbf_bucket_t *bucket, tbf_opspec_t *spec)
 {
@@ -261,7 +308,9 @@ tbf_throttle(tbf_t *tbf, tbf_ops_t op, unsigned long tokens_requested)
          * to throttle the request: therefore, consume the required
          * number of tokens and continue.
          */
-        if (tokens_requested <= bucket->tokens) {
+        if (!bucket->tokenrate) {
+            /* throttling was turned off by tbf_mod() */
+        } else if (tokens_requested <= bucket->tokens) {
             bucket->tokens -= tokens_requested;
         } else {
             throttle = tbf_init_throttle(tokens_requested);
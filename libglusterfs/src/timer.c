@@ -18,14 +18,142 @@
 static gf_timer_registry_t *
 gf_timer_registry_init(glusterfs_ctx_t *);
 
+static uint64_t
+gf_timer_now_tick(void)
+{
+    struct timespec now;
+
+    timespec_now(&now);
+    return TS(now) / GF_TIMER_TICK_NS;
+}
+
+/* Must be called with reg->lock held */
+static void
+__gf_timer_wheel_add(gf_timer_registry_t *reg, gf_timer_t *event)
+{
+    struct list_head *slot = NULL;
+    uint64_t expires = event->expires;
+    uint64_t idx = 0;
+    int level = 0;
+    int shift = 0;
+
+    if (expires < reg->tick)
+        expires = reg->tick;
+    idx = expires - reg->tick;
+
+    if (idx < GF_TIMER_WHEEL_L0_SIZE) {
+        slot = &reg->wheel0[expires & GF_TIMER_WHEEL_L0_MASK];
+        goto add;
+    }
+
+    for (level = 0; level < GF_TIMER_WHEEL_LEVELS; level++) {
+        shift = GF_TIMER_WHEEL_L0_BITS + level * GF_TIMER_WHEEL_LN_BITS;
+        if (idx < (1ULL << (shift + GF_TIMER_WHEEL_LN_BITS)))
+            break;
+    }
+
+    if (level == GF_TIMER_WHEEL_LEVELS) {
+        /* beyond the wheel, park it in the farthest slot. It is put
+         * back on the wheel when that slot comes due. */
+        level--;
+        shift = GF_TIMER_WHEEL_L0_BITS + level * GF_TIMER_WHEEL_LN_BITS;
+        expires = reg->tick + (1ULL << (shift + GF_TIMER_WHEEL_LN_BITS)) - 1;
+    }
+
+    slot = &reg->wheel[level][(expires >> shift) & GF_TIMER_WHEEL_LN_MASK];
+add:
+    list_add_tail(&event->list, slot);
+}
+
+/* Moves the timers of one slot of 'level' back to the levels below, and
+ * returns the index of that slot */
+static int
+__gf_timer_wheel_cascade(gf_timer_registry_t *reg, int level)
+{
+    gf_timer_t *event = NULL;
+    gf_timer_t *tmp = NULL;
+    struct list_head slot;
+    int index = 0;
+
+    index = (reg->tick >>
+             (GF_TIMER_WHEEL_L0_BITS + level * GF_TIMER_WHEEL_LN_BITS)) &
+            GF_TIMER_WHEEL_LN_MASK;
+
+    INIT_LIST_HEAD(&slot);
+    list_splice_init(&reg->wheel[level][index], &slot);
+    list_for_each_entry_safe(event, tmp, &slot, list)
+    {
+        list_del(&event->list);
+        __gf_timer_wheel_add(reg, event);
+    }
+
+    return index;
+}
+
+/* Processes every tick up to 'now', moving the timers that came due to
+ * reg->expired. Returns the number of timers moved. */
+static int
+__gf_timer_wheel_advance(gf_timer_registry_t *reg, uint64_t now)
+{
+    gf_timer_t *event = NULL;
+    gf_timer_t *tmp = NULL;
+    struct list_head *slot = NULL;
+    int level = 0;
+    int index = 0;
+    int due = 0;
+
+    while (reg->tick <= now) {
+        index = reg->tick & GF_TIMER_WHEEL_L0_MASK;
+        if (!index) {
+            for (level = 0; level < GF_TIMER_WHEEL_LEVELS; level++) {
+                if (__gf_timer_wheel_cascade(reg, level))
+                    break;
+            }
+        }
+
+        slot = &reg->wheel0[index];
+        list_for_each_entry_safe(event, tmp, slot, list)
+        {
+            list_del(&event->list);
+            if (event->expires > reg->tick) {
+                /* was parked beyond the end of the wheel */
+                __gf_timer_wheel_add(reg, event);
+                continue;
+            }
+            list_add_tail(&event->list, &reg->expired);
+            due++;
+        }
+
+        reg->tick++;
+    }
+
+    return due;
+}
+
+/* Returns the first tick at which something may come due: either a
+ * populated level 0 slot, or the end of the current turn of level 0, when
+ * the upper levels cascade. */
+static uint64_t
+__gf_timer_wheel_next(gf_timer_registry_t *reg)
+{
+    uint64_t tick = reg->tick;
+    uint64_t end = (reg->tick | GF_TIMER_WHEEL_L0_MASK) + 1;
+
+    for (; tick < end; tick++) {
+        if (!list_empty(&reg->wheel0[tick & GF_TIMER_WHEEL_L0_MASK]))
+            return tick;
+    }
+
+    return end;
+}
+
 gf_timer_t *
 gf_timer_call_after(glusterfs_ctx_t *ctx, struct timespec delta,
                     gf_timer_cbk_t callbk, void *data)
 {
     gf_timer_registry_t *reg = NULL;
     gf_timer_t *event = NULL;
-    gf_timer_t *trav = NULL;
-    uint64_t at = 0;
+    uint64_t now = 0;
 
     if ((ctx == NULL) || (ctx->cleanup_started)) {
         gf_msg_callingfn("timer", GF_LOG_ERROR, EINVAL, LG_MSG_INVALID_ARG,
@@ -48,19 +176,25 @@ gf_timer_call_after(glusterfs_ctx_t *ctx, struct timespec delta,
     }
     timespec_now(&event->at);
     timespec_adjust_delta(&event->at, delta);
-    at = TS(event->at);
+    /* round up, a timer never fires before its time */
+    event->expires = (TS(event->at) + GF_TIMER_TICK_NS - 1) /
+                     GF_TIMER_TICK_NS;
     event->callbk = callbk;
     event->data = data;
     event->xl = THIS;
     pthread_mutex_lock(&reg->lock);
     {
-        list_for_each_entry_reverse(trav, &reg->active, list)
-        {
-            if (TS(trav->at) < at)
-                break;
+        if (!reg->count) {
+            /* nothing armed, no need to walk the ticks of an idle wheel */
+            now = gf_timer_now_tick();
+            if (now > reg->tick)
+                reg->tick = now;
         }
-        list_add(&event->list, &trav->list);
-        if (&trav->list == &reg->active) {
+        __gf_timer_wheel_add(reg, event);
+        reg->count++;
+        if (event->expires < reg->wakeup) {
+            /* sooner than the idle threads planned to wake up */
+            reg->wakeup = event->expires;
             pthread_cond_signal(&reg->cond);
         }
     }
@@ -106,6 +240,7 @@ gf_timer_call_cancel(glusterfs_ctx_t *ctx, gf_timer_t *event)
         if (fired)
             goto unlock;
         list_del(&event->list);
+        reg->count--;
     }
 unlock:
     pthread_mutex_unlock(&reg->lock);
@@ -122,48 +257,68 @@ gf_timer_proc(void *data)
 {
     gf_timer_registry_t *reg = data;
     gf_timer_t *event = NULL;
-    gf_timer_t *tmp = NULL;
     xlator_t *old_THIS = NULL;
+    struct timespec wakeup;
+    uint64_t now = 0;
+    int due = 0;
 
     pthread_mutex_lock(&reg->lock);
 
     while (!reg->fin) {
-        if (list_empty(&reg->active)) {
+        if (!list_empty(&reg->expired)) {
+            event = list_first_entry(&reg->expired, gf_timer_t, list);
+            event->fired = _gf_true;
+            list_del_init(&event->list);
+            reg->count--;
+
+            pthread_mutex_unlock(&reg->lock);
+
+            old_THIS = NULL;
+            if (event->xl) {
+                old_THIS = THIS;
+                THIS = event->xl;
+            }
+            event->callbk(event->data);
+            GF_FREE(event);
+            if (old_THIS) {
+                THIS = old_THIS;
+            }
+
+            pthread_mutex_lock(&reg->lock);
+            continue;
+        }
+
+        now = gf_timer_now_tick();
+        if (reg->tick <= now) {
+            due = __gf_timer_wheel_advance(reg, now);
+            if (due > 1 && reg->threads > 1)
+                pthread_cond_broadcast(&reg->cond);
+            continue;
+        }
+
+        if (!reg->count) {
+            reg->wakeup = UINT64_MAX;
             pthread_cond_wait(&reg->cond, &reg->lock);
         } else {
-            struct timespec now;
-
-            timespec_now(&now);
-            event = list_first_entry(&reg->active, gf_timer_t, list);
-            if (TS(now) < TS(event->at)) {
-                now = event->at;
-                pthread_cond_timedwait(&reg->cond, &reg->lock, &now);
-            } else {
-                event->fired = _gf_true;
-                list_del_init(&event->list);
-
-                pthread_mutex_unlock(&reg->lock);
-
-                old_THIS = NULL;
-                if (event->xl) {
-                    old_THIS = THIS;
-                    THIS = event->xl;
-                }
-                event->callbk(event->data);
-                GF_FREE(event);
-                if (old_THIS) {
-                    THIS = old_THIS;
-                }
-
-                pthread_mutex_lock(&reg->lock);
-            }
+            reg->wakeup = __gf_timer_wheel_next(reg);
+            wakeup.tv_sec = (reg->wakeup * GF_TIMER_TICK_NS) / GF_SEC_IN_NS;
+            wakeup.tv_nsec = (reg->wakeup * GF_TIMER_TICK_NS) % GF_SEC_IN_NS;
+            pthread_cond_timedwait(&reg->cond, &reg->lock, &wakeup);
         }
     }
 
-    /* Do not call gf_timer_call_cancel(),
-     * it will lead to deadlock
-     */
-    list_for_each_entry_safe(event, tmp, &reg->active, list)
+    pthread_mutex_unlock(&reg->lock);
+
+    return NULL;
+}
+
+static void
+gf_timer_list_free(struct list_head *head)
+{
+    gf_timer_t *event = NULL;
+    gf_timer_t *tmp = NULL;
+
+    list_for_each_entry_safe(event, tmp, head, list)
     {
         list_del(&event->list);
         /* TODO Possible resource leak
@@ -175,10 +330,6 @@ gf_timer_proc(void *data)
          */
         GF_FREE(event);
     }
-
-    pthread_mutex_unlock(&reg->lock);
-
-    return NULL;
 }
 
 static gf_timer_registry_t *
@@ -186,6 +337,8 @@ gf_timer_registry_init(glusterfs_ctx_t *ctx)
 {
     gf_timer_registry_t *reg = NULL;
     int ret = -1;
+    int i = 0;
+    int j = 0;
     pthread_condattr_t attr;
 
     LOCK(&ctx->lock);
@@ -205,14 +358,39 @@ gf_timer_registry_init(glusterfs_ctx_t *ctx)
         pthread_condattr_init(&attr);
         pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
         pthread_cond_init(&reg->cond, &attr);
-        INIT_LIST_HEAD(&reg->active);
+        for (i = 0; i < GF_TIMER_WHEEL_L0_SIZE; i++)
+            INIT_LIST_HEAD(&reg->wheel0[i]);
+        for (i = 0; i < GF_TIMER_WHEEL_LEVELS; i++) {
+            for (j = 0; j < GF_TIMER_WHEEL_LN_SIZE; j++)
+                INIT_LIST_HEAD(&reg->wheel[i][j]);
+        }
+        INIT_LIST_HEAD(&reg->expired);
+        reg->tick = gf_timer_now_tick();
+        reg->wakeup = UINT64_MAX;
+
+        reg->threads = ctx->cmd_args.timer_threads;
+        if (reg->threads < 1)
+            reg->threads = 1;
+        else if (reg->threads > GF_TIMER_MAX_THREADS)
+            reg->threads = GF_TIMER_MAX_THREADS;
     }
     UNLOCK(&ctx->lock);
-    ret = gf_thread_create(&reg->th, NULL, gf_timer_proc, reg, "timer");
-    if (ret) {
-        gf_msg(THIS->name, GF_LOG_ERROR, ret, LG_MSG_PTHREAD_FAILED,
-               "Thread creation failed");
+    for (i = 0; i < reg->threads; i++) {
+        if (reg->threads == 1)
+            ret = gf_thread_create(&reg->th[i], NULL, gf_timer_proc, reg,
+                                   "timer");
+        else
+            ret = gf_thread_create(&reg->th[i], NULL, gf_timer_proc, reg,
+                                   "timer%d", i);
+        if (ret) {
+            gf_msg(THIS->name, GF_LOG_ERROR, ret, LG_MSG_PTHREAD_FAILED,
+                   "Thread creation failed");
+            break;
+        }
     }
+    /* keep going with whatever threads could be started */
+    if (i && i < reg->threads)
+        reg->threads = i;
 
 out:
     return reg;
@@ -221,8 +399,9 @@ out:
 void
 gf_timer_registry_destroy(glusterfs_ctx_t *ctx)
 {
-    pthread_t thr_id;
     gf_timer_registry_t *reg = NULL;
+    int i = 0;
+    int j = 0;
 
     if (ctx == NULL)
         return;
@@ -237,16 +416,26 @@ gf_timer_registry_destroy(glusterfs_ctx_t *ctx)
     if (!reg)
         return;
 
-    thr_id = reg->th;
-
     pthread_mutex_lock(&reg->lock);
 
     reg->fin = 1;
-    pthread_cond_signal(&reg->cond);
+    pthread_cond_broadcast(&reg->cond);
 
     pthread_mutex_unlock(&reg->lock);
 
-    pthread_join(thr_id, NULL);
+    for (i = 0; i < reg->threads; i++)
+        pthread_join(reg->th[i], NULL);
+
+    /* Do not call gf_timer_call_cancel(),
+     * it will lead to deadlock
+     */
+    for (i = 0; i < GF_TIMER_WHEEL_L0_SIZE; i++)
+        gf_timer_list_free(&reg->wheel0[i]);
+    for (i = 0; i < GF_TIMER_WHEEL_LEVELS; i++) {
+        for (j = 0; j < GF_TIMER_WHEEL_LN_SIZE; j++)
+            gf_timer_list_free(&reg->wheel[i][j]);
+    }
+    gf_timer_list_free(&reg->expired);
 
     pthread_cond_destroy(&reg->cond);
     pthread_mutex_destroy(&reg->lock);
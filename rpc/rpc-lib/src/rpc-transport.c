@@ -63,6 +63,15 @@ rpc_transport_throttle(rpc_transport_t *this, gf_boolean_t onoff)
     return this->ops->throttle(this, onoff);
 }
 
+int
+rpc_transport_dump(rpc_transport_t *this, const char *prefix)
+{
+    if (!this->ops->dump)
+        return -ENOSYS;
+
+    return this->ops->dump(this, prefix);
+}
+
 int32_t
 rpc_transport_get_peeraddr(rpc_transport_t *this, char *peeraddr, int addrlen,
                            struct sockaddr_storage *sa, size_t salen)
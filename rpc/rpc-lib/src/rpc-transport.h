@@ -223,6 +223,7 @@ struct rpc_transport_ops {
     int32_t (*get_myaddr)(rpc_transport_t *this, char *peeraddr, int addrlen,
                           struct sockaddr_storage *sa, socklen_t sasize);
     int32_t (*throttle)(rpc_transport_t *this, gf_boolean_t onoff);
+    int32_t (*dump)(rpc_transport_t *this, const char *prefix);
 };
 
 int32_t
@@ -270,6 +271,9 @@ rpc_transport_get_peeraddr(rpc_transport_t *this, char *peeraddr, int addrlen,
 int
 rpc_transport_throttle(rpc_transport_t *this, gf_boolean_t onoff);
 
+int
+rpc_transport_dump(rpc_transport_t *this, const char *prefix);
+
 rpc_transport_pollin_t *
 rpc_transport_pollin_alloc(rpc_transport_t *this, struct iovec *vector,
                            int count, struct iobuf *hdr_iobuf,
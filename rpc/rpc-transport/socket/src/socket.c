@@ -13,6 +13,8 @@
 #include <glusterfs/dict.h>
 #include <glusterfs/syscall.h>
 #include <glusterfs/compat-errno.h>
+#include <glusterfs/statedump.h>
+#include <glusterfs/gf-io.h>
 #include "socket-mem-types.h"
 
 /* ugly #includes below */
@@ -43,6 +45,7 @@
 #define SSL_EC_CURVE_OPT "transport.socket.ssl-ec-curve"
 #define SSL_CRL_PATH_OPT "transport.socket.ssl-crl-path"
 #define OWN_THREAD_OPT "transport.socket.own-thread"
+#define IO_URING_OPT "transport.socket.io-uring"
 
 #if !defined(DEFAULT_CERT_PATH)
 #define DEFAULT_CERT_PATH SSL_CERT_PATH "/glusterfs.pem"
@@ -1155,7 +1158,16 @@ __socket_reset(rpc_transport_t *this)
 
     memset(&priv->incoming, 0, sizeof(priv->incoming));
 
-    gf_event_unregister_close(this->ctx->event_pool, priv->sock, priv->idx);
+    if (priv->uring.inflight && (priv->uring.closing < 0)) {
+        /* The kernel may still be using the socket for the in-flight
+         * request. Its close is deferred until the request completes to
+         * prevent the descriptor from being reused in the meantime. */
+        gf_event_unregister(this->ctx->event_pool, priv->sock, priv->idx);
+        priv->uring.closing = priv->sock;
+    } else {
+        gf_event_unregister_close(this->ctx->event_pool, priv->sock,
+                                  priv->idx);
+    }
     if (priv->use_ssl && priv->ssl_ssl) {
         SSL_clear(priv->ssl_ssl);
         SSL_free(priv->ssl_ssl);
@@ -1337,6 +1349,199 @@ __socket_ioq_churn(rpc_transport_t *this)
     return ret;
 }
 
+static gf_boolean_t
+__socket_uses_io_uring(socket_private_t *priv)
+{
+    /* SSL needs to do its own I/O, so it can't use the I/O framework. */
+    return priv->uring.enabled && !priv->use_ssl &&
+           (gf_io_mode() == GF_IO_MODE_IO_URING);
+}
+
+/* Mark 'bytes' bytes of the entry as sent. Returns the number of bytes
+ * actually consumed by this entry. */
+static size_t
+__socket_ioq_entry_advance(struct ioq *entry, size_t bytes)
+{
+    struct iovec *iov = NULL;
+    size_t done = 0;
+    size_t len = 0;
+
+    while ((entry->pending_count > 0) &&
+           ((done < bytes) || (entry->pending_vector->iov_len == 0))) {
+        iov = entry->pending_vector;
+        len = min(iov->iov_len, bytes - done);
+
+        iov->iov_base += len;
+        iov->iov_len -= len;
+        done += len;
+
+        if (iov->iov_len == 0) {
+            entry->pending_vector++;
+            entry->pending_count--;
+        }
+    }
+
+    return done;
+}
+
+static void
+__socket_ioq_sending_flush(socket_private_t *priv)
+{
+    struct ioq *entry = NULL;
+    struct ioq *tmp = NULL;
+
+    list_for_each_entry_safe(entry, tmp, &priv->uring.sending, list)
+    {
+        __socket_ioq_entry_free(entry);
+    }
+}
+
+static void
+__socket_ioq_submit(rpc_transport_t *this);
+
+GF_IO_CBK(socket_io_uring_sent, op, res, static)
+{
+    rpc_transport_t *this = NULL;
+    socket_private_t *priv = NULL;
+    struct ioq *entry = NULL;
+    struct ioq *tmp = NULL;
+    size_t bytes = 0;
+    int32_t closing = -1;
+    gf_boolean_t sent = _gf_false;
+    gf_boolean_t submitted = _gf_false;
+
+    this = op->data;
+    priv = this->private;
+
+    pthread_mutex_lock(&priv->out_lock);
+    {
+        priv->uring.inflight = _gf_false;
+
+        /* If the socket has been reset while the request was in flight,
+         * whatever was being sent belongs to a connection that is gone. */
+        closing = priv->uring.closing;
+        priv->uring.closing = -1;
+
+        if ((res > 0) && (closing < 0)) {
+            this->total_bytes_write += res;
+            priv->uring.bytes += res;
+
+            bytes = res;
+            list_for_each_entry_safe(entry, tmp, &priv->uring.sending, list)
+            {
+                bytes -= __socket_ioq_entry_advance(entry, bytes);
+                if (entry->pending_count != 0)
+                    break;
+
+                __socket_ioq_entry_free(entry);
+                priv->uring.msgs++;
+                sent = _gf_true;
+            }
+        }
+
+        if ((closing >= 0) || (priv->connected != 1)) {
+            __socket_ioq_sending_flush(priv);
+        } else {
+            /* Whatever has not been sent yet goes back to the head of
+             * the queue. */
+            list_splice_init(&priv->uring.sending, &priv->ioq);
+
+            if (res == -EAGAIN) {
+                /* Socket buffers are full. Continue on POLLOUT. */
+                priv->uring.eagain++;
+                priv->idx = gf_event_select_on(this->ctx->event_pool,
+                                               priv->sock, priv->idx, -1, 1);
+            } else if (res <= 0) {
+                /* As on the poll path, a send that fails or makes no
+                 * progress fails the connection and drops what was queued
+                 * on it, the callers being unwound on disconnect. */
+                GF_LOG_OCCASIONALLY(priv->log_ctr, this->name, GF_LOG_WARNING,
+                                    "sendmsg on %s failed (%s)",
+                                    this->peerinfo.identifier,
+                                    res ? strerror(-res) : "no progress");
+                __socket_ioq_flush(priv);
+                __socket_disconnect(this);
+            }
+        }
+
+        if ((priv->connected == 1) && (res > 0) && !list_empty(&priv->ioq)) {
+            __socket_ioq_submit(this);
+            submitted = _gf_true;
+        }
+    }
+    pthread_mutex_unlock(&priv->out_lock);
+
+    if (closing >= 0)
+        sys_close(closing);
+
+    if (submitted)
+        gf_io.engine.flush();
+
+    if (sent)
+        rpc_transport_notify(this, RPC_TRANSPORT_MSG_SENT, NULL);
+
+    rpc_transport_unref(this);
+}
+
+/* Send as many queued entries as possible in a single request. The caller
+ * must call gf_io.engine.flush() once out_lock has been released. */
+static void
+__socket_ioq_submit(rpc_transport_t *this)
+{
+    socket_private_t *priv = NULL;
+    struct ioq *entry = NULL;
+    struct ioq *tmp = NULL;
+    int count = 0;
+
+    priv = this->private;
+
+    list_for_each_entry_safe(entry, tmp, &priv->ioq, list)
+    {
+        if (count + entry->pending_count > GF_SOCKET_IO_URING_IOV)
+            break;
+
+        memcpy(&priv->uring.iov[count], entry->pending_vector,
+               sizeof(struct iovec) * entry->pending_count);
+        count += entry->pending_count;
+
+        list_move_tail(&entry->list, &priv->uring.sending);
+    }
+
+    memset(&priv->uring.msg, 0, sizeof(priv->uring.msg));
+    priv->uring.msg.msg_iov = priv->uring.iov;
+    priv->uring.msg.msg_iovlen = count;
+
+    priv->uring.inflight = _gf_true;
+    priv->uring.sends++;
+
+    /* The transport can't be destroyed while the kernel owns the request. */
+    rpc_transport_ref(this);
+
+    gf_io_sendmsg(socket_io_uring_sent, priv->sock, &priv->uring.msg,
+                  MSG_NOSIGNAL, this);
+}
+
+/* Equivalent of __socket_ioq_churn() when the gf_io engine is used. Returns
+ * true if a new request has been submitted. */
+static gf_boolean_t
+__socket_ioq_churn_io_uring(rpc_transport_t *this)
+{
+    socket_private_t *priv = NULL;
+
+    priv = this->private;
+
+    /* Progress is driven by request completions, not by POLLOUT. */
+    priv->idx = gf_event_select_on(this->ctx->event_pool, priv->sock,
+                                   priv->idx, -1, 0);
+
+    if (priv->uring.inflight || list_empty(&priv->ioq))
+        return _gf_false;
+
+    __socket_ioq_submit(this);
+
+    return _gf_true;
+}
+
 static gf_boolean_t
 socket_event_poll_err(rpc_transport_t *this, int gen, int idx)
 {
@@ -1374,13 +1579,20 @@ socket_event_poll_out(rpc_transport_t *this)
 {
     socket_private_t *priv = NULL;
     int ret = -1;
+    gf_boolean_t submitted = _gf_false;
 
     priv = this->private;
 
     pthread_mutex_lock(&priv->out_lock);
     {
         if (priv->connected == 1) {
-            ret = __socket_ioq_churn(this);
+            if (__socket_uses_io_uring(priv)) {
+                submitted = __socket_ioq_churn_io_uring(this);
+                /* Completion of the request will notify MSG_SENT. */
+                ret = 1;
+            } else {
+                ret = __socket_ioq_churn(this);
+            }
 
             if (ret < 0) {
                 gf_log(this->name, GF_LOG_TRACE,
@@ -1392,6 +1604,9 @@ socket_event_poll_out(rpc_transport_t *this)
     }
     pthread_mutex_unlock(&priv->out_lock);
 
+    if (submitted)
+        gf_io.engine.flush();
+
     if (ret == 0)
         rpc_transport_notify(this, RPC_TRANSPORT_MSG_SENT, NULL);
 
@@ -2455,6 +2670,7 @@ socket_connect_finish(rpc_transport_t *this)
 
             priv->connected = 1;
             priv->connect_finish_log = 0;
+            priv->connect_time = gf_time();
             event = RPC_TRANSPORT_CONNECT;
         }
     }
@@ -3026,6 +3242,7 @@ socket_server_event_handler(int fd, int idx, int gen, void *data, int poll_in,
 
         new_priv->ssl_enabled = priv->ssl_enabled;
         new_priv->connected = 1;
+        new_priv->connect_time = gf_time();
         new_priv->is_server = _gf_true;
 
         /*
@@ -3642,6 +3859,7 @@ socket_submit_outgoing_msg(rpc_transport_t *this, rpc_transport_msg_t *msg)
     int ret = -1;
     gf_boolean_t need_poll_out = _gf_false;
     gf_boolean_t free_entry = _gf_false;
+    gf_boolean_t submitted = _gf_false;
     struct ioq *entry = NULL;
     socket_private_t *priv = NULL;
 
@@ -3667,6 +3885,16 @@ socket_submit_outgoing_msg(rpc_transport_t *this, rpc_transport_msg_t *msg)
 
         priv->submit_log = 0;
 
+        if (__socket_uses_io_uring(priv)) {
+            list_add_tail(&entry->list, &priv->ioq);
+            if (!priv->uring.inflight) {
+                __socket_ioq_submit(this);
+                submitted = _gf_true;
+            }
+            ret = 0;
+            goto unlock;
+        }
+
         if (list_empty(&priv->ioq)) {
             ret = __socket_ioq_churn_entry(this, entry, _gf_false);
 
@@ -3690,6 +3918,9 @@ socket_submit_outgoing_msg(rpc_transport_t *this, rpc_transport_msg_t *msg)
 unlock:
     pthread_mutex_unlock(&priv->out_lock);
 
+    if (submitted)
+        gf_io.engine.flush();
+
 out:
     if (free_entry)
         __socket_ioq_entry_free(entry);
@@ -3810,6 +4041,59 @@ socket_throttle(rpc_transport_t *this, gf_boolean_t onoff)
     return 0;
 }
 
+static int32_t
+socket_dump(rpc_transport_t *this, const char *prefix)
+{
+    socket_private_t *priv = NULL;
+    char key[GF_DUMP_MAX_BUF_LEN];
+    time_t uptime = 0;
+
+    priv = this->private;
+    if (!priv)
+        return -1;
+
+    if (priv->connect_time != 0)
+        uptime = gf_time() - priv->connect_time;
+
+    gf_proc_dump_build_key(key, prefix, "peer");
+    gf_proc_dump_write(key, "%s", this->peerinfo.identifier);
+    gf_proc_dump_build_key(key, prefix, "connected");
+    gf_proc_dump_write(key, "%d", priv->connected);
+    gf_proc_dump_build_key(key, prefix, "uptime");
+    gf_proc_dump_write(key, "%ld", (long)uptime);
+    gf_proc_dump_build_key(key, prefix, "bytes_read");
+    gf_proc_dump_write(key, "%" PRIu64, this->total_bytes_read);
+    gf_proc_dump_build_key(key, prefix, "bytes_written");
+    gf_proc_dump_write(key, "%" PRIu64, this->total_bytes_write);
+
+    /* Average throughput (bytes/s) since the connection was established. */
+    if (uptime > 0) {
+        gf_proc_dump_build_key(key, prefix, "read_throughput");
+        gf_proc_dump_write(key, "%" PRIu64,
+                           this->total_bytes_read / (uint64_t)uptime);
+        gf_proc_dump_build_key(key, prefix, "write_throughput");
+        gf_proc_dump_write(key, "%" PRIu64,
+                           this->total_bytes_write / (uint64_t)uptime);
+    }
+
+    gf_proc_dump_build_key(key, prefix, "io_engine");
+    gf_proc_dump_write(key, "%s",
+                       __socket_uses_io_uring(priv) ? "io_uring" : "legacy");
+
+    if (priv->uring.sends != 0) {
+        gf_proc_dump_build_key(key, prefix, "io_uring.sends");
+        gf_proc_dump_write(key, "%" PRIu64, priv->uring.sends);
+        gf_proc_dump_build_key(key, prefix, "io_uring.msgs");
+        gf_proc_dump_write(key, "%" PRIu64, priv->uring.msgs);
+        gf_proc_dump_build_key(key, prefix, "io_uring.bytes");
+        gf_proc_dump_write(key, "%" PRIu64, priv->uring.bytes);
+        gf_proc_dump_build_key(key, prefix, "io_uring.eagain");
+        gf_proc_dump_write(key, "%" PRIu64, priv->uring.eagain);
+    }
+
+    return 0;
+}
+
 struct rpc_transport_ops tops = {
     .listen = socket_listen,
     .connect = socket_connect,
@@ -3821,6 +4105,7 @@ struct rpc_transport_ops tops = {
     .get_myname = socket_getmyname,
     .get_myaddr = socket_getmyaddr,
     .throttle = socket_throttle,
+    .dump = socket_dump,
 };
 
 int
@@ -4315,6 +4600,8 @@ socket_init(rpc_transport_t *this)
     priv->ssl_connected = _gf_false;
     priv->windowsize = GF_DEFAULT_SOCKET_WINDOW_SIZE;
     INIT_LIST_HEAD(&priv->ioq);
+    INIT_LIST_HEAD(&priv->uring.sending);
+    priv->uring.closing = -1;
     pthread_mutex_init(&priv->notify.lock, NULL);
     pthread_cond_init(&priv->notify.cond, NULL);
 
@@ -4448,6 +4735,16 @@ socket_init(rpc_transport_t *this)
     priv->mgmt_ssl = this->ctx->secure_mgmt;
     priv->srvr_ssl = this->ctx->secure_srvr;
 
+    /* Only takes effect if the process is running the io_uring engine.
+     * Otherwise the regular epoll based path is used. */
+    priv->uring.enabled = _gf_false;
+    if (dict_get_str_sizen(this->options, IO_URING_OPT, &optstr) == 0) {
+        if (gf_string2boolean(optstr, &priv->uring.enabled) != 0) {
+            gf_log(this->name, GF_LOG_ERROR,
+                   "invalid value given for io-uring boolean");
+        }
+    }
+
     ssl_setup_connection_params(this);
 out:
     this->private = priv;
@@ -4591,6 +4888,13 @@ struct volume_options options[] = {
     {.key = {SSL_EC_CURVE_OPT}, .type = GF_OPTION_TYPE_STR},
     {.key = {SSL_CRL_PATH_OPT}, .type = GF_OPTION_TYPE_STR},
     {.key = {OWN_THREAD_OPT}, .type = GF_OPTION_TYPE_BOOL},
+    {.key = {IO_URING_OPT},
+     .type = GF_OPTION_TYPE_BOOL,
+     .op_version = {GD_OP_VERSION_11_0},
+     .default_value = "off",
+     .description = "Send messages through the io_uring I/O engine when "
+                    "the process is using it. Applies to new connections. "
+                    "Ignored for SSL connections."},
     {.key = {"ssl-own-cert"},
      .op_version = {GD_OP_VERSION_3_7_4},
      .flags = OPT_FLAG_SETTABLE,
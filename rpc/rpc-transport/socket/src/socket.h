@@ -160,6 +160,28 @@ struct gf_sock_incoming_frag {
 
 #define GF_SOCKET_RA_MAX 1024
 
+/* Maximum number of iovecs that will be sent in a single request through
+ * the gf_io engine. Several queued messages are coalesced into a single
+ * sendmsg() as long as their vectors fit. */
+#define GF_SOCKET_IO_URING_IOV (4 * MAX_IOVEC)
+
+struct gf_sock_io_uring {
+    /* ioq entries currently owned by the in-flight request. */
+    struct list_head sending;
+    struct msghdr msg;
+    struct iovec iov[GF_SOCKET_IO_URING_IOV];
+    /* Socket whose close has been deferred until the in-flight request
+     * completes, or -1. */
+    int32_t closing;
+    /* Statistics. */
+    uint64_t sends;
+    uint64_t msgs;
+    uint64_t bytes;
+    uint64_t eagain;
+    gf_boolean_t enabled;
+    gf_boolean_t inflight;
+};
+
 struct gf_sock_incoming {
     char *proghdr_base_addr;
     struct iobuf *iobuf;
@@ -223,6 +245,8 @@ typedef struct {
     char *ssl_ca_list;
     char *crl_path;
     struct gf_sock_incoming incoming;
+    struct gf_sock_io_uring uring;
+    time_t connect_time;
     mgmt_ssl_t srvr_ssl;
     /* -1 = not connected. 0 = in progress. 1 = connected */
     char connected;
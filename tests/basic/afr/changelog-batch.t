@@ -0,0 +1,62 @@
+#!/bin/bash
+
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+. $(dirname $0)/../../afr.rc
+
+# With cluster.changelog-batch-size the pre-op/post-op xattrops of different
+# files which are issued together reach a brick in one request. Files must
+# end up identical on all bricks with nothing left to heal.
+
+function xattrops_saved {
+        local fpath=$(generate_mount_statedump $V0 $M0)
+        grep -a "^xattrops-saved=" $fpath | head -1 | cut -f2 -d'='
+        rm -f $fpath
+}
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 replica 3 $H0:$B0/${V0}{0,1,2}
+TEST $CLI volume set $V0 cluster.changelog-batch-size 16
+TEST $CLI volume set $V0 performance.write-behind off
+TEST $CLI volume set $V0 performance.flush-behind off
+TEST $CLI volume start $V0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status $V0 0
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status $V0 1
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status $V0 2
+
+TEST mkdir $M0/dir
+for i in {1..200}; do
+        echo "data-$i" > $M0/dir/file-$i &
+done
+wait
+
+for i in {1..200}; do
+        EXPECT "data-$i" cat $M0/dir/file-$i
+done
+
+EXPECT_WITHIN $HEAL_TIMEOUT "^0$" get_pending_heal_count $V0
+for i in 1 100 200; do
+        EXPECT "data-$i" cat $B0/${V0}0/dir/file-$i
+        EXPECT "data-$i" cat $B0/${V0}1/dir/file-$i
+        EXPECT "data-$i" cat $B0/${V0}2/dir/file-$i
+        EXPECT_WITHIN $HEAL_TIMEOUT "000000000000000000000000" get_hex_xattr trusted.afr.dirty $B0/${V0}0/dir/file-$i
+done
+TEST [ $(xattrops_saved) -gt 0 ]
+
+# a brick going down while xattrops are queued marks the others as pending
+TEST kill_brick $V0 $H0 $B0/${V0}2
+for i in {1..50}; do
+        echo "new-$i" > $M0/dir/file-$i &
+done
+wait
+TEST $CLI volume start $V0 force
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status $V0 2
+TEST $CLI volume heal $V0
+EXPECT_WITHIN $HEAL_TIMEOUT "^0$" get_pending_heal_count $V0
+EXPECT "new-25" cat $B0/${V0}2/dir/file-25
+
+cleanup;
@@ -0,0 +1,64 @@
+#!/bin/bash
+
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+. $(dirname $0)/../../afr.rc
+
+# With data-self-heal-algorithm delta the bricks record the ranges of the
+# writes a brick missed and the heal copies only those. The file must end up
+# identical on all bricks and the range maps must be gone after the heal.
+
+function range_map_present {
+        getfattr -d -m "trusted.afr.$V0-client-2.ranges" -e hex $1 2>/dev/null | grep -c "ranges="
+}
+
+function healed_bytes {
+        $CLI volume heal $V0 statistics | \
+                awk -F': ' '/^No. of bytes healed/ {n += $2} END {print n + 0}'
+}
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 replica 3 $H0:$B0/${V0}{0,1,2}
+TEST $CLI volume set $V0 cluster.data-self-heal-algorithm delta
+TEST $CLI volume set $V0 cluster.self-heal-daemon off
+TEST $CLI volume set $V0 cluster.data-self-heal off
+TEST $CLI volume set $V0 performance.write-behind off
+TEST $CLI volume start $V0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status $V0 2
+
+TEST dd if=/dev/urandom of=$M0/file bs=1M count=32
+TEST kill_brick $V0 $H0 $B0/${V0}2
+
+# two small writes far apart, and one past the end
+TEST dd if=/dev/urandom of=$M0/file bs=4k count=1 seek=100 conv=notrunc
+TEST dd if=/dev/urandom of=$M0/file bs=4k count=2 seek=6000 conv=notrunc
+TEST dd if=/dev/urandom of=$M0/file bs=4k count=1 seek=8500 conv=notrunc
+
+EXPECT "1" range_map_present $B0/${V0}0/file
+EXPECT "1" range_map_present $B0/${V0}1/file
+TEST ! cmp -s $B0/${V0}0/file $B0/${V0}2/file
+
+TEST $CLI volume set $V0 cluster.self-heal-daemon on
+TEST $CLI volume start $V0 force
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status $V0 2
+EXPECT_WITHIN $PROCESS_UP_TIMEOUT "Y" glustershd_up_status
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status_in_shd $V0 2
+TEST $CLI volume heal $V0
+EXPECT_WITHIN $HEAL_TIMEOUT "^0$" get_pending_heal_count $V0
+
+TEST cmp $B0/${V0}0/file $B0/${V0}2/file
+TEST cmp $B0/${V0}1/file $B0/${V0}2/file
+EXPECT "0" range_map_present $B0/${V0}0/file
+EXPECT "0" range_map_present $B0/${V0}1/file
+TEST grep -q "bytes (delta)" $(gluster --print-logdir)/glustershd.log
+
+# only the blocks around the missed writes were copied, not the 32MB file
+bytes=$(healed_bytes)
+TEST [ $bytes -gt 0 ]
+TEST [ $bytes -lt $((32 * 1024 * 1024 / 8)) ]
+
+cleanup;
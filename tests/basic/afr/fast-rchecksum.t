@@ -0,0 +1,39 @@
+#!/bin/bash
+
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+. $(dirname $0)/../../afr.rc
+
+# The diff data self-heal compares blocks with the fast checksum, or with
+# SHA256 when the bricks are in FIPS mode. Both must heal the file.
+
+function heal_file_with {
+        TEST $CLI volume set $V0 cluster.data-self-heal-checksum $1
+        TEST dd if=/dev/urandom of=$M0/$1 bs=128k count=16
+        TEST kill_brick $V0 $H0 $B0/${V0}1
+        TEST dd if=/dev/urandom of=$M0/$1 bs=128k count=2 seek=7 conv=notrunc
+        TEST $CLI volume start $V0 force
+        EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status_in_shd $V0 1
+        TEST $CLI volume heal $V0
+        EXPECT_WITHIN $HEAL_TIMEOUT "^0$" get_pending_heal_count $V0
+        TEST cmp $B0/${V0}0/$1 $B0/${V0}1/$1
+}
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 replica 2 $H0:$B0/${V0}{0,1}
+TEST $CLI volume set $V0 cluster.data-self-heal-algorithm diff
+TEST $CLI volume set $V0 performance.write-behind off
+TEST $CLI volume start $V0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0
+EXPECT_WITHIN $PROCESS_UP_TIMEOUT "Y" glustershd_up_status
+
+heal_file_with fast
+heal_file_with strong
+
+TEST $CLI volume set $V0 storage.fips-mode-rchecksum on
+heal_file_with fast
+
+cleanup;
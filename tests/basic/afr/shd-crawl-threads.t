@@ -0,0 +1,47 @@
+#!/bin/bash
+
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+. $(dirname $0)/../../afr.rc
+
+# With cluster.shd-crawl-threads above 1 the index of a brick is crawled by
+# several threads, each of them reading the gfids of its shard only. All the
+# pending entries must still get healed, and no cursor must be left behind
+# once the sweeps reached the end of the index.
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 replica 3 $H0:$B0/${V0}{0,1,2}
+TEST $CLI volume set $V0 cluster.shd-crawl-threads 4
+TEST $CLI volume set $V0 cluster.self-heal-daemon off
+TEST $CLI volume set $V0 cluster.data-self-heal off
+TEST $CLI volume set $V0 cluster.metadata-self-heal off
+TEST $CLI volume set $V0 cluster.entry-self-heal off
+TEST $CLI volume start $V0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status $V0 2
+
+TEST mkdir $M0/dir
+TEST touch $M0/dir/file-{1..100}
+TEST kill_brick $V0 $H0 $B0/${V0}2
+for i in {1..100}; do
+        echo $i > $M0/dir/file-$i
+done
+
+TEST $CLI volume set $V0 cluster.self-heal-daemon on
+TEST $CLI volume start $V0 force
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status $V0 2
+EXPECT_WITHIN $PROCESS_UP_TIMEOUT "Y" glustershd_up_status
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status_in_shd $V0 2
+TEST $CLI volume heal $V0
+EXPECT_WITHIN $HEAL_TIMEOUT "^0$" get_pending_heal_count $V0
+
+for i in 1 50 100; do
+        EXPECT "^$i$" cat $B0/${V0}2/dir/file-$i
+done
+TEST grep -q "index sweep on $V0-client-0 healed" $(gluster --print-logdir)/glustershd.log
+EXPECT "0" echo $(ls $(gluster --print-statedumpdir)/shd-$V0-replicate-0-* 2>/dev/null | wc -l)
+
+cleanup;
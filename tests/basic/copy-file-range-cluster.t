@@ -0,0 +1,74 @@
+#!/bin/bash
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+cleanup;
+
+case $OSTYPE in
+Linux)
+        ;;
+*)
+        echo "Skip test: copy_file_range(2) is specific to Linux" >&2
+        SKIP_TESTS
+        exit 0
+        ;;
+esac
+
+grep -q copy_file_range /proc/kallsyms
+if [ $? -ne 0 ]; then
+    echo "Skip test: copy_file_range(2) is not supported by current kernel" >&2
+    SKIP_TESTS
+    exit 0
+fi
+
+TESTER=$(dirname $0)/gfapi/glfs-copy-file-range
+logdir=`gluster --print-logdir`
+
+TEST glusterd
+TEST pidof glusterd
+
+TEST build_tester $(dirname $0)/gfapi/glfs-copy-file-range.c -lgfapi
+
+# replicate: both files are on the same subvolume, the copy is done by
+# the bricks and all the replicas end up with the same data
+TEST $CLI volume create $V0 replica 3 $H0:$B0/${V0}{0,1,2}
+TEST $CLI volume set $V0 performance.write-behind off
+TEST $CLI volume start $V0
+TEST glusterfs --volfile-id=/$V0 --volfile-server=$H0 $M0
+
+TEST dd if=/dev/urandom of=$M0/file bs=1M count=20
+TEST ./$TESTER $H0 $V0 $logdir/copy-file-range-cluster.log /file /new
+TEST cmp $M0/file $M0/new
+for i in {0..2}; do
+    TEST cmp $M0/file $B0/${V0}$i/new
+done
+EXPECT "^0$" get_pending_heal_count $V0
+
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+# sharded replicate: the copy is split at the shard boundaries and the
+# aggregated size of the destination is updated
+TEST $CLI volume create $V0 replica 3 $H0:$B0/${V0}_s{0,1,2}
+TEST $CLI volume set $V0 features.shard on
+TEST $CLI volume set $V0 features.shard-block-size 4MB
+TEST $CLI volume set $V0 performance.write-behind off
+TEST $CLI volume start $V0
+TEST glusterfs --volfile-id=/$V0 --volfile-server=$H0 $M0
+
+TEST dd if=/dev/urandom of=$M0/file bs=1M count=21
+TEST ./$TESTER $H0 $V0 $logdir/copy-file-range-cluster.log /file /new
+EXPECT "22020096" stat -c %s $M0/new
+TEST cmp $M0/file $M0/new
+gfid_new=$(get_gfid_string $M0/new)
+TEST stat $B0/${V0}_s0/.shard/$gfid_new.5
+
+cleanup_tester $TESTER
+
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup;
@@ -0,0 +1,60 @@
+#!/bin/bash
+
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+. $(dirname $0)/../../dht.rc
+
+# With cluster.layout-type set to jump, adding a brick must only move files
+# to the new brick and never between the bricks which were already there.
+
+function layout_type {
+        get_layout $1 | cut -c11-18
+}
+
+function brick_files {
+        (cd $1 && find . -type f ! -path './.glusterfs/*' | sort)
+}
+
+cleanup
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}{0,1,2}
+TEST $CLI volume set $V0 cluster.layout-type jump
+TEST $CLI volume set $V0 cluster.weighted-rebalance off
+TEST $CLI volume start $V0
+TEST glusterfs -s $H0 --volfile-id $V0 $M0
+
+TEST mkdir $M0/dir
+for i in {0..2}; do
+        EXPECT "00000002" layout_type $B0/${V0}$i/dir
+done
+
+TEST touch $M0/dir/file-{1..300}
+for i in {0..2}; do
+        brick_files $B0/${V0}$i > $B0/before-$i
+        TEST [ -s $B0/before-$i ]
+done
+
+TEST $CLI volume add-brick $V0 $H0:$B0/${V0}3
+TEST $CLI volume rebalance $V0 start force
+EXPECT_WITHIN $REBALANCE_TIMEOUT "0" rebalance_completed
+
+EXPECT "00000002" layout_type $B0/${V0}3/dir
+EXPECT "300" echo $(ls $M0/dir | wc -l)
+
+# the old bricks only lost files, and the new one got some of them
+for i in {0..2}; do
+        brick_files $B0/${V0}$i > $B0/after-$i
+        EXPECT "0" echo $(comm -13 $B0/before-$i $B0/after-$i | wc -l)
+done
+moved=$(brick_files $B0/${V0}3 | wc -l)
+TEST [ $moved -gt 0 -a $moved -lt 150 ]
+
+logdir=$(gluster --print-logdir)
+TEST grep -q "Rebalance is expected to move" $logdir/$V0-rebalance.log
+
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST rm -f $B0/before-* $B0/after-*
+
+cleanup
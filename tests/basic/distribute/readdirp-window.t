@@ -0,0 +1,46 @@
+#!/bin/bash
+
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+
+# A listing which reads the bricks ahead with cluster.readdirp-window must
+# return the same entries as one which reads them one after the other.
+
+function list_dir {
+        ls -a $1 | sort > $2
+        cat $2 | wc -l
+}
+
+cleanup
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}{0,1,2,3}
+TEST $CLI volume set $V0 performance.readdir-ahead off
+TEST $CLI volume set $V0 performance.parallel-readdir off
+TEST $CLI volume start $V0
+TEST glusterfs -s $H0 --volfile-id $V0 $M0
+
+TEST mkdir $M0/dir
+TEST mkdir $M0/dir/subdir-{1..20}
+TEST touch $M0/dir/file-{1..2000}
+
+EXPECT "2022" list_dir $M0/dir $B0/sequential
+
+TEST $CLI volume set $V0 cluster.readdirp-window 4
+EXPECT "2022" list_dir $M0/dir $B0/window
+TEST cmp $B0/sequential $B0/window
+
+EXPECT "2022" echo $(find $M0/dir -mindepth 1 -maxdepth 1 | wc -l)
+TEST rm -f $M0/dir/file-{1..1000}
+EXPECT "1022" list_dir $M0/dir $B0/window
+
+TEST $CLI volume set $V0 cluster.readdir-optimize on
+EXPECT "1022" list_dir $M0/dir $B0/window
+TEST rm -rf $M0/dir
+EXPECT "0" echo $(ls $M0 | wc -l)
+
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST rm -f $B0/sequential $B0/window
+
+cleanup
@@ -0,0 +1,53 @@
+#!/bin/bash
+
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+
+# With disperse.hedged-reads on, reads are sent to one brick more than
+# needed and decoded from the first matching answers. Half of the fragment
+# reads are delayed by delay-gen, so the extra brick must often answer before
+# one of the bricks picked first, and the data must still be right.
+
+function ec_read_stat {
+        local fpath=$(generate_mount_statedump $V0 $M0)
+        grep -a "^$1=" $fpath | head -1 | cut -f2 -d'='
+        rm -f $fpath
+}
+
+cleanup
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 disperse 6 redundancy 2 $H0:$B0/${V0}{0..5}
+TEST $CLI volume set $V0 performance.quick-read off
+TEST $CLI volume set $V0 performance.io-cache off
+TEST $CLI volume set $V0 performance.stat-prefetch off
+TEST $CLI volume set $V0 performance.read-ahead off
+TEST $CLI volume set $V0 delay-gen posix
+TEST $CLI volume set $V0 delay-gen.delay-duration 100000
+TEST $CLI volume set $V0 delay-gen.delay-percentage 50
+TEST $CLI volume set $V0 delay-gen.enable read
+TEST $CLI volume start $V0
+
+TEST glusterfs --direct-io-mode=yes --entry-timeout=0 --attribute-timeout=0 -s $H0 --volfile-id $V0 $M0
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "6" ec_child_up_count $V0 0
+
+TEST dd if=/dev/urandom of=$B0/data bs=128k count=32
+TEST cp $B0/data $M0/data
+
+TEST $CLI volume set $V0 disperse.read-policy least-latency
+TEST $CLI volume set $V0 disperse.hedged-reads on
+EXPECT_WITHIN $CONFIG_UPDATE_TIMEOUT "least-latency" mount_get_option_value $M0 $V0-disperse-0 read-policy
+EXPECT_WITHIN $CONFIG_UPDATE_TIMEOUT "1" mount_get_option_value $M0 $V0-disperse-0 hedged-reads
+
+TEST cmp $B0/data $M0/data
+TEST [ $(ec_read_stat reads-hedged) -ge 32 ]
+TEST [ $(ec_read_stat reads-hedge-won) -gt 0 ]
+
+# without hedging the result is the same, only slower
+TEST $CLI volume set $V0 disperse.hedged-reads off
+EXPECT_WITHIN $CONFIG_UPDATE_TIMEOUT "0" mount_get_option_value $M0 $V0-disperse-0 hedged-reads
+TEST cmp $B0/data $M0/data
+
+TEST rm -f $B0/data
+cleanup;
@@ -0,0 +1,54 @@
+#!/bin/bash
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+function get_mount_itable_value {
+        local statedump=$(generate_mount_statedump $V0 $M0)
+        local val=$(grep "itable.$1=" $statedump | cut -f2 -d'=' | tail -1)
+        rm -f $statedump
+        echo $val
+}
+
+cleanup
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}{0,1}
+TEST $CLI volume start $V0
+TEST glusterfs -s $H0 --volfile-id $V0 --lru-limit 500 $M0
+EXPECT_WITHIN ${PROCESS_UP_TIMEOUT} "2" online_brick_count
+
+EXPECT "32" get_mount_itable_value shards
+EXPECT "1" get_mount_active_size_value $V0 $M0
+EXPECT "0" get_mount_lru_size_value $V0 $M0
+
+# concurrent lookups, creates and renames spread over all the shards
+for i in {1..8}; do
+    (mkdir $M0/dir-$i;
+     for j in {1..200}; do
+         echo "Test file" > $M0/dir-$i/file-$j;
+         mv $M0/dir-$i/file-$j $M0/dir-$i/moved-$j;
+         stat $M0/dir-$i/moved-$j > /dev/null;
+     done) &
+done
+wait
+
+EXPECT "1600" echo $(find $M0 -type f | wc -l)
+
+# most of the per-fop ref churn doesn't need a lock
+fast=$(get_mount_itable_value ref_fast)
+slow=$(get_mount_itable_value ref_slow)
+TEST [ $fast -gt $slow ]
+
+# the lru limit is split between the shards, each of which may go a small
+# batch over its share before it is pruned
+lc=$(get_mount_lru_size_value $V0 $M0)
+TEST [ $lc -le $((500 + 32 * (500 / 32 / 8 + 1))) ]
+
+TEST rm -rf $M0/*
+
+EXPECT "1" get_mount_active_size_value $V0 $M0
+EXPECT "0" get_mount_lru_size_value $V0 $M0
+
+cleanup
@@ -0,0 +1,45 @@
+#!/bin/bash
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+function get_profile_column {
+        $CLI volume profile $V0 info cumulative | grep -w $1 | \
+                awk "{print \$$2}" | sort -n | tail -1
+}
+
+cleanup
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}{0,1}
+TEST $CLI volume start $V0
+TEST $CLI volume profile $V0 start
+TEST $GFS -s $H0 --volfile-id $V0 $M0
+EXPECT_WITHIN ${PROCESS_UP_TIMEOUT} "2" online_brick_count
+
+for i in {1..20}; do
+    TEST dd if=/dev/zero of=$M0/file-$i bs=4k count=16 conv=fsync
+done
+
+# percentile columns follow the Fop column
+EXPECT "P99.9-Latency" echo $($CLI volume profile $V0 info | grep -m1 -o "P99.9-Latency")
+
+p50=$(get_profile_column WRITE 10)
+p90=$(get_profile_column WRITE 12)
+p99=$(get_profile_column WRITE 14)
+p999=$(get_profile_column WRITE 16)
+TEST [ $p50 -gt 0 ]
+TEST [ $p90 -ge $p50 ]
+TEST [ $p99 -ge $p90 ]
+TEST [ $p999 -ge $p99 ]
+
+# clearing the stats clears the histograms too
+TEST $CLI volume profile $V0 info clear
+TEST touch $M0/file-new
+EXPECT "" get_profile_column WRITE 10
+
+TEST $CLI volume profile $V0 stop
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+
+cleanup
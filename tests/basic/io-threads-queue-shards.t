@@ -0,0 +1,35 @@
+#!/bin/bash
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+cleanup
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}0
+TEST $CLI volume set $V0 performance.io-thread-count 8
+TEST $CLI volume set $V0 performance.iot-queue-shards 4
+TEST $CLI volume start $V0
+TEST $GFS -s $H0 --volfile-id $V0 $M0
+
+EXPECT "4" get_value_from_brick_statedump $V0 $H0 $B0/${V0}0 "^queue_shards"
+
+# requests of several clients spread over the shards, all of them complete
+for i in {1..8}; do
+    (for j in {1..100}; do
+         echo "data-$i-$j" > $M0/file-$i-$j;
+     done) &
+done
+wait
+
+EXPECT "800" echo $(ls $M0 | wc -l)
+EXPECT "data-5-42" cat $M0/file-5-42
+
+# 0 picks one shard per 4 threads
+TEST $CLI volume set $V0 performance.iot-queue-shards 0
+TEST $CLI volume stop $V0
+TEST $CLI volume start $V0
+EXPECT "2" get_value_from_brick_statedump $V0 $H0 $B0/${V0}0 "^queue_shards"
+
+cleanup
@@ -0,0 +1,61 @@
+#!/bin/bash
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+function files_intact {
+        for i in {1..8}; do
+                if ! cmp -s $1 $M0/file$i; then
+                        echo "N"
+                        return
+                fi
+        done
+        echo "Y"
+}
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+
+TEST $CLI volume create $V0 $H0:$B0/${V0}{0,1}
+TEST $CLI volume set $V0 server.io-uring on
+TEST $CLI volume set $V0 client.io-uring on
+EXPECT 'on' volume_option $V0 server.io-uring
+EXPECT 'on' volume_option $V0 client.io-uring
+TEST ! $CLI volume set $V0 server.io-uring foo
+
+TEST $CLI volume start $V0
+TEST $GFS -s $H0 --volfile-id $V0 $M0
+
+# Data must go through intact whichever path the transport ends up using.
+TEST dd if=/dev/urandom of=$B0/src bs=1M count=16
+TEST cp $B0/src $M0/file
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST $GFS -s $H0 --volfile-id $V0 $M0
+TEST cmp $B0/src $M0/file
+
+# Traffic keeps flowing across a restart of a brick: the connection to it is
+# failed, the client reconnects and both reads and writes go through again.
+for i in {1..8}; do
+        TEST cp $B0/src $M0/file$i
+done
+TEST kill_brick $V0 $H0 $B0/${V0}0
+TEST $CLI volume start $V0 force
+EXPECT_WITHIN $PROCESS_UP_TIMEOUT "1" brick_up_status $V0 $H0 $B0/${V0}0
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "Y" files_intact $B0/src
+TEST dd if=/dev/urandom of=$B0/src2 bs=1M count=16
+for i in {1..8}; do
+        TEST cp $B0/src2 $M0/file$i
+done
+EXPECT "Y" files_intact $B0/src2
+
+# Per-connection statistics must be present in the brick statedump.
+statedump=$(generate_brick_statedump $V0 $H0 $B0/${V0}0)
+TEST grep -E "conn\.[0-9]+\.io_engine=" $statedump
+TEST grep -E "conn\.[0-9]+\.bytes_written=" $statedump
+cleanup_statedump $(get_brick_pid $V0 $H0 $B0/${V0}0)
+
+rm -f $B0/src $B0/src2
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+cleanup;
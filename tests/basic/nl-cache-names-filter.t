@@ -0,0 +1,81 @@
+#!/bin/bash
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+# With performance.nl-cache-filter-size set, lookups of names which are not
+# in a directory are answered from the filter of its names, and names
+# created from this client or from another one must stay visible.
+
+cleanup;
+
+TEST glusterd
+
+TEST $CLI volume create $V0 $H0:$B0/${V0}{0..2}
+TEST $CLI volume set $V0 group nl-cache
+TEST $CLI volume set $V0 nl-cache-filter-size 4096
+EXPECT '4096' volinfo_field $V0 'performance.nl-cache-filter-size'
+
+TEST $CLI volume start $V0;
+EXPECT 'Started' volinfo_field $V0 'Status';
+
+TEST glusterfs --volfile-id=/$V0 --volfile-server=$H0 $M0
+TEST glusterfs --volfile-id=/$V0 --volfile-server=$H0 $M1
+
+TEST mkdir $M0/dir
+TEST touch $M0/dir/file{1..100}
+
+# revalidating the directory fetches its filter
+TEST stat $M0/dir
+TEST stat $M0/dir
+for i in {1..20}; do
+        TEST ! stat $M0/dir/missing$i
+done
+TEST stat $M0/dir/file50
+
+TEST touch $M0/dir/new1
+TEST stat $M0/dir/new1
+TEST mkdir $M0/dir/newdir
+TEST stat $M0/dir/newdir
+
+TEST ! stat $M0/dir/remote1
+TEST touch $M1/dir/remote1
+TEST stat $M0/dir/remote1
+
+TEST mv $M0/dir/file1 $M0/dir/renamed1
+TEST stat $M0/dir/renamed1
+TEST ! stat $M0/dir/file1
+
+TEST rm -rf $M0/dir
+
+TEST force_umount $M0
+TEST force_umount $M1
+
+# On a replica, a brick which still waits for an entry heal is missing the
+# names created while it was down, they must stay visible all the same.
+TEST $CLI volume create $V1 replica 2 $H0:$B0/${V1}{0,1}
+TEST $CLI volume set $V1 group nl-cache
+TEST $CLI volume set $V1 nl-cache-filter-size 4096
+TEST $CLI volume set $V1 cluster.self-heal-daemon off
+TEST $CLI volume set $V1 cluster.entry-self-heal off
+TEST $CLI volume start $V1
+
+TEST glusterfs --volfile-id=/$V1 --volfile-server=$H0 $M0
+TEST glusterfs --volfile-id=/$V1 --volfile-server=$H0 $M1
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status_meta $M1 $V1-replicate-0 1
+
+TEST mkdir $M0/dir
+TEST kill_brick $V1 $H0 $B0/${V1}0
+TEST touch $M0/dir/file{1..10}
+TEST $CLI volume start $V1 force
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status_meta $M1 $V1-replicate-0 0
+
+TEST stat $M1/dir
+TEST stat $M1/dir
+for i in {1..10}; do
+        TEST stat $M1/dir/file$i
+done
+
+TEST force_umount $M0
+TEST force_umount $M1
+cleanup;
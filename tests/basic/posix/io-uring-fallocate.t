@@ -0,0 +1,48 @@
+#!/bin/bash
+
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+
+cleanup;
+
+TEST glusterd;
+TEST pidof glusterd;
+
+TEST $CLI volume create $V0 $H0:$B0/${V0}0
+TEST $CLI volume set $V0 storage.linux-io_uring on
+TEST $CLI volume start $V0;
+
+TEST $GFS -s $H0 --volfile-id=$V0 $M0
+
+# fallocate, discard and zerofill are served by the io_uring path when the
+# brick supports it and fall back to the synchronous one otherwise; either
+# way the results must be the same.
+TEST fallocate -l 1M $M0/file
+EXPECT "1048576" stat -c %s $B0/${V0}0/file
+
+TEST fallocate -n -o 1M -l 1M $M0/file
+EXPECT "1048576" stat -c %s $M0/file
+
+TEST dd if=/dev/urandom of=$M0/file bs=128k count=8 conv=notrunc
+TEST fallocate -p -o 0 -l 128k $M0/file
+EXPECT "0" echo $(dd if=$M0/file bs=128k count=1 2>/dev/null | tr -d '\0' | wc -c)
+
+TEST fallocate -z -o 128k -l 128k $M0/file
+EXPECT "0" echo $(dd if=$M0/file bs=128k skip=1 count=1 2>/dev/null | tr -d '\0' | wc -c)
+EXPECT "1048576" stat -c %s $M0/file
+
+# Large reads and writes land in the registered iobuf arenas when the brick
+# could set them up, the data has to match either way.
+TEST dd if=/dev/urandom of=$B0/pattern bs=1M count=4
+TEST dd if=$B0/pattern of=$M0/big bs=1M count=4 oflag=direct
+EXPECT "$(md5sum < $B0/pattern)" echo "$(md5sum < $B0/${V0}0/big)"
+TEST force_umount $M0
+TEST $GFS -s $H0 --volfile-id=$V0 $M0
+EXPECT "$(md5sum < $B0/pattern)" echo "$(dd if=$M0/big bs=1M iflag=direct 2>/dev/null | md5sum)"
+rm -f $B0/pattern
+
+TEST force_umount $M0
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup;
@@ -0,0 +1,38 @@
+#!/bin/bash
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+function timer_thread_count {
+        local pid=$(get_mount_process_pid $V0 $M0)
+        cat /proc/$pid/task/*/comm | grep -c "^glfs_timer"
+}
+
+cleanup
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 replica 3 $H0:$B0/${V0}{0,1,2}
+TEST $CLI volume start $V0
+TEST $GFS -s $H0 --volfile-id $V0 --timer-threads=4 $M0
+EXPECT_WITHIN ${PROCESS_UP_TIMEOUT} "3" online_brick_count
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status $V0 1
+
+EXPECT "4" timer_thread_count
+
+TEST mkdir $M0/dir
+for i in {1..50}; do
+    echo "data" > $M0/dir/file-$i
+done
+
+# the client has to reconnect through a timer once the brick is back
+TEST kill_brick $V0 $H0 $B0/${V0}1
+EXPECT_WITHIN ${PROCESS_DOWN_TIMEOUT} "0" afr_child_up_status $V0 1
+TEST $CLI volume start $V0 force
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status $V0 1
+
+EXPECT "50" echo $(ls $M0/dir | wc -l)
+
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+
+cleanup
@@ -0,0 +1,63 @@
+#!/bin/bash
+
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+
+# Several threads delete the shards of removed files in the background, at
+# the rate shard-deletion-bandwidth allows.
+
+function shard_count {
+        ls $B0/${V0}0/.shard | grep -v remove_me | wc -l
+}
+
+function marker_count {
+        ls $B0/${V0}0/.shard/.remove_me | wc -l
+}
+
+function deletion_stat {
+        local statedump=$(generate_mount_statedump $V0 $M0)
+        grep "^$1=" $statedump | cut -f2 -d'=' | tail -1
+        rm -f $statedump
+}
+
+cleanup
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 replica 3 $H0:$B0/${V0}{0,1,2}
+TEST $CLI volume set $V0 features.shard on
+TEST $CLI volume set $V0 features.shard-block-size 4MB
+TEST $CLI volume set $V0 features.shard-deletion-threads 4
+TEST $CLI volume set $V0 features.shard-deletion-bandwidth 16MB
+TEST $CLI volume set $V0 performance.write-behind off
+TEST $CLI volume start $V0
+
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0
+
+# 4 files of 5 shards each, 4 of which are under .shard
+for i in {1..4}; do
+        TEST dd if=/dev/zero of=$M0/file$i bs=1M count=20
+done
+EXPECT "16" shard_count
+
+TEST rm -f $M0/file{1..4}
+EXPECT_WITHIN 60 "0" shard_count
+EXPECT_WITHIN 60 "0" marker_count
+
+EXPECT "4" deletion_stat deletion-threads
+EXPECT "16" deletion_stat deletion-shards-done
+EXPECT "0" deletion_stat deletion-shards-pending
+EXPECT "0" deletion_stat deletion-files-active
+
+# unlimited again
+TEST $CLI volume set $V0 features.shard-deletion-bandwidth 0
+TEST dd if=/dev/zero of=$M0/file5 bs=1M count=20
+TEST rm -f $M0/file5
+EXPECT_WITHIN 30 "0" shard_count
+EXPECT_WITHIN 30 "20" deletion_stat deletion-shards-done
+
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup
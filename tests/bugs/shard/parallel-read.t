@@ -0,0 +1,57 @@
+#!/bin/bash
+
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+
+# Reads spanning many shards look up the shards not in memory and read them
+# in one go, and must return zeroes for the holes without creating shards.
+
+function shard_count {
+        ls $B0/${V0}0/.shard | wc -l
+}
+
+cleanup
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 replica 3 $H0:$B0/${V0}{0,1,2}
+TEST $CLI volume set $V0 features.shard on
+TEST $CLI volume set $V0 features.shard-block-size 4MB
+TEST $CLI volume set $V0 performance.write-behind off
+TEST $CLI volume set $V0 performance.quick-read off
+TEST $CLI volume set $V0 performance.io-cache off
+TEST $CLI volume set $V0 performance.read-ahead off
+TEST $CLI volume start $V0
+
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0
+
+# shards 0, 1, 5, 6 and 9, the others are holes
+TEST dd if=/dev/urandom of=$B0/data bs=1M count=40
+TEST dd if=$B0/data of=$M0/foo bs=1M count=6 conv=notrunc
+TEST dd if=$B0/data of=$M0/foo bs=1M count=6 skip=21 seek=21 conv=notrunc
+TEST dd if=$B0/data of=$M0/foo bs=1M count=4 skip=36 seek=36 conv=notrunc
+TEST dd if=/dev/zero of=$B0/data bs=1M count=15 seek=6 conv=notrunc
+TEST dd if=/dev/zero of=$B0/data bs=1M count=9 seek=27 conv=notrunc
+EXPECT "4" shard_count
+
+# read it from a fresh mount with none of the shards in memory
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0
+TEST cmp $B0/data $M0/foo
+EXPECT "4" shard_count
+
+# and from the middle of a shard into a hole
+EXPECT "$(dd if=$B0/data bs=1M skip=22 count=10 2>/dev/null | md5sum)" \
+       echo "$(dd if=$M0/foo bs=1M skip=22 count=10 2>/dev/null | md5sum)"
+
+statedump=$(generate_mount_statedump $V0 $M0)
+TEST grep -q "read-fanout-1=" $statedump
+TEST grep -q "lru-misses=" $statedump
+rm -f $statedump
+
+TEST rm -f $B0/data
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup
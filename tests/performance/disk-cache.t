@@ -0,0 +1,88 @@
+#!/bin/bash
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+# The blocks a mount reads are kept in a cache file on a local disk, which
+# the next mount of the volume finds them in.
+
+function dc_stat {
+        local statedump=$(generate_mount_statedump $V0 $1)
+        sed -n '/^\[performance\/disk-cache/,/^\[/p' $statedump | \
+                grep "^$2=" | cut -f2 -d'='
+        rm -f $statedump
+}
+
+function dc_checkpointed {
+        [ "$(dc_stat $1 checkpoints)" -gt "$2" ] && echo "Y" || echo "N"
+}
+
+function file_md5 {
+        md5sum $1 | cut -f1 -d' '
+}
+
+cleanup
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}0
+TEST $CLI volume set $V0 performance.disk-cache on
+TEST $CLI volume set $V0 performance.disk-cache-dir $B0/dcache
+TEST $CLI volume set $V0 performance.disk-cache-size 16MB
+TEST $CLI volume set $V0 performance.io-cache off
+TEST $CLI volume set $V0 performance.read-ahead off
+TEST $CLI volume set $V0 performance.quick-read off
+TEST $CLI volume set $V0 performance.open-behind off
+TEST $CLI volume start $V0
+
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 --direct-io-mode=enable $M0
+TEST [ -f $B0/dcache/$V0-disk-cache.cache ]
+
+TEST dd if=/dev/urandom of=$B0/data bs=128k count=8
+TEST cp $B0/data $M0/file
+
+# the first read goes to the brick, the blocks are written behind it
+TEST cmp $B0/data $M0/file
+EXPECT_WITHIN 10 "8" dc_stat $M0 stores
+TEST cmp $B0/data $M0/file
+TEST [ "$(dc_stat $M0 hits)" -gt 0 ]
+
+# the blocks outlive the mount which read them, once the index describing
+# them is checkpointed, even if the client goes away without running fini
+CHECKPOINTS=$(dc_stat $M0 checkpoints)
+EXPECT_WITHIN 10 "Y" dc_checkpointed $M0 $CHECKPOINTS
+TEST kill -9 $(get_mount_process_pid $V0 $M0)
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 --direct-io-mode=enable $M0
+EXPECT "8" dc_stat $M0 blocks_cached
+TEST cmp $B0/data $M0/file
+TEST [ "$(dc_stat $M0 hits)" -gt 0 ]
+EXPECT "0" dc_stat $M0 stores
+
+# a new graph of the volume shares the cache file of the old one
+TEST $CLI volume set $V0 performance.stat-prefetch off
+EXPECT_WITHIN $GRAPH_SWITCH_TIMEOUT "0" dc_stat $M0 hits
+TEST cmp $B0/data $M0/file
+TEST [ "$(dc_stat $M0 hits)" -gt 0 ]
+EXPECT "0" dc_stat $M0 stores
+
+# a write through the mount replaces the blocks it covers
+TEST dd if=/dev/urandom of=$B0/data bs=128k count=8
+TEST dd if=$B0/data of=$M0/file bs=128k count=2 conv=notrunc
+TEST dd if=$B0/data of=$M0/file bs=128k count=6 skip=2 seek=2 conv=notrunc
+EXPECT "$(file_md5 $B0/data)" file_md5 $M0/file
+
+# a second mount cannot share the cache file and goes to the bricks, its
+# writes are seen by the first once it checks the file again
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 --direct-io-mode=enable $M1
+TEST dd if=/dev/urandom of=$B0/data bs=128k count=8
+TEST dd if=$B0/data of=$M1/file bs=128k conv=notrunc
+EXPECT_WITHIN 10 "$(file_md5 $B0/data)" file_md5 $M0/file
+
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M1
+TEST rm -rf $B0/data $B0/dcache
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup
@@ -0,0 +1,69 @@
+#!/bin/bash
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+# With the arc cache-policy a file read twice stays in io-cache while many
+# other files are read through once.
+
+function ioc_stat {
+        local statedump=$(generate_mount_statedump $V0 $M0)
+        grep "^$1=" $statedump | cut -f2 -d'=' | tail -1
+        rm -f $statedump
+}
+
+cleanup
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}0
+TEST $CLI volume set $V0 performance.io-cache on
+TEST $CLI volume set $V0 performance.io-cache-size 4MB
+TEST $CLI volume set $V0 performance.io-cache-policy arc
+TEST $CLI volume set $V0 performance.read-ahead off
+TEST $CLI volume set $V0 performance.quick-read off
+TEST $CLI volume set $V0 performance.open-behind off
+TEST ! $CLI volume set $V0 performance.io-cache-policy mru
+TEST $CLI volume start $V0
+
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 --direct-io-mode=enable $M0
+
+TEST dd if=/dev/urandom of=$M0/hot bs=128k count=8
+for i in {1..16}; do
+        TEST dd if=/dev/urandom of=$M0/cold$i bs=128k count=8
+done
+
+# small reads in a row are one reference, a read once the pages have aged
+# moves them to the frequent list
+TEST dd if=$M0/hot of=/dev/null bs=4k
+TEST dd if=$M0/hot of=/dev/null bs=128k
+EXPECT "0" ioc_stat policy.frequent.pages
+sleep 2
+TEST dd if=$M0/hot of=/dev/null bs=128k
+EXPECT "arc" ioc_stat policy
+EXPECT "8" ioc_stat policy.frequent.pages
+
+# 16MB read once in small reads through a 4MB cache evicts only recently
+# read pages
+for i in {1..16}; do
+        TEST dd if=$M0/cold$i of=/dev/null bs=4k
+done
+EXPECT "8" ioc_stat policy.frequent.pages
+EXPECT "0" ioc_stat policy.frequent.evictions
+TEST [ "$(ioc_stat policy.recent.evictions)" -gt 0 ]
+TEST [ "$(ioc_stat policy.recent-ghost.pages)" -gt 0 ]
+
+hits=$(ioc_stat policy.frequent.hits)
+sleep 2
+TEST dd if=$M0/hot of=/dev/null bs=128k
+EXPECT "$((hits + 8))" ioc_stat policy.frequent.hits
+
+TEST $CLI volume set $V0 performance.io-cache-policy 2q
+EXPECT_WITHIN $CONFIG_UPDATE_TIMEOUT "2q" ioc_stat policy
+EXPECT "0" ioc_stat policy.recent-ghost.pages
+
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup
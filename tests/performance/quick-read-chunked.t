@@ -0,0 +1,63 @@
+#!/bin/bash
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+# Files larger than max-file-size are cached in chunks, fetched as the reads
+# need them.
+
+function qr_stat {
+        local statedump=$(generate_mount_statedump $V0 $M0)
+        sed -n '/^\[xlator.performance.quick-read.priv\]/,/^\[/p' \
+                $statedump | grep "^$1=" | cut -f2 -d'='
+        rm -f $statedump
+}
+
+function file_md5 {
+        md5sum $1 | cut -f1 -d' '
+}
+
+cleanup
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}0
+TEST $CLI volume set $V0 performance.quick-read-max-chunked-file-size 4MB
+TEST $CLI volume set $V0 performance.quick-read-chunk-size 128KB
+TEST $CLI volume set $V0 performance.quick-read-cache-timeout 60
+TEST $CLI volume set $V0 performance.io-cache off
+TEST $CLI volume set $V0 performance.read-ahead off
+TEST $CLI volume set $V0 performance.open-behind off
+TEST $CLI volume start $V0
+
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 --direct-io-mode=enable $M0
+TEST dd if=/dev/urandom of=$B0/data bs=128k count=16
+TEST cp $B0/data $M0/file
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 --direct-io-mode=enable $M0
+
+# a partial read only fetches the chunk it falls in
+TEST dd if=$M0/file of=/dev/null bs=4k skip=256 count=1
+EXPECT "1" qr_stat chunks-fetched
+
+# the others are fetched by the first full read, the next one is served
+# from the cache
+TEST cmp $B0/data $M0/file
+EXPECT "16" qr_stat chunks-fetched
+hits=$(qr_stat cache-hit)
+TEST cmp $B0/data $M0/file
+EXPECT "16" qr_stat chunks-fetched
+TEST [ "$(qr_stat cache-hit)" -gt "$hits" ]
+
+# a write drops the chunks
+TEST dd if=/dev/urandom of=$B0/data bs=128k count=16
+TEST dd if=$B0/data of=$M0/file bs=128k conv=notrunc
+EXPECT "$(file_md5 $B0/data)" file_md5 $M0/file
+
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST rm -f $B0/data
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup
@@ -0,0 +1,62 @@
+#!/bin/bash
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+# read-ahead follows backward scans and strided reads on an fd, and serves
+# them the right data from the pages it read ahead.
+
+function ra_stat {
+        grep "^$1=" $statedump | cut -f2 -d'=' | head -1
+}
+
+cleanup
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}0
+TEST $CLI volume set $V0 performance.read-ahead on
+TEST $CLI volume set $V0 performance.read-ahead-page-count 8
+TEST $CLI volume set $V0 performance.io-cache off
+TEST $CLI volume set $V0 performance.quick-read off
+TEST $CLI volume set $V0 performance.open-behind off
+TEST $CLI volume start $V0
+
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 --direct-io-mode=enable $M0
+
+TEST dd if=/dev/urandom of=$B0/data bs=1M count=16
+TEST cp $B0/data $M0/file
+
+# 128KB reads from the end of the file to its start, then every fourth
+# 64KB block, all through one fd which stays open for the statedump
+$PYTHON -c "
+import os, time
+fd = os.open('$M0/file', os.O_RDONLY)
+data = open('$B0/data', 'rb').read()
+ok = True
+for i in range(127, -1, -1):
+    ok = ok and os.pread(fd, 131072, i * 131072) == data[i * 131072:(i + 1) * 131072]
+for i in range(0, 256, 4):
+    ok = ok and os.pread(fd, 65536, i * 65536) == data[i * 65536:(i + 1) * 65536]
+open('$B0/result', 'w').write(ok and 'ok' or 'bad')
+time.sleep(60)
+os.close(fd)
+" &
+reader=$!
+
+EXPECT_WITHIN 60 "ok" cat $B0/result
+
+statedump=$(generate_mount_statedump $V0 $M0)
+TEST grep -q "^stream=.*stride=-131072" $statedump
+TEST grep -q "^stream=.*stride=262144" $statedump
+TEST [ "$(ra_stat prefetch-used)" -gt 50 ]
+TEST grep -q "^prefetch-accuracy=" $statedump
+rm -f $statedump
+
+kill $reader
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST rm -f $B0/data $B0/result
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup
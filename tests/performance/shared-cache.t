@@ -0,0 +1,79 @@
+#!/bin/bash
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+# Two mounts of a volume on one host share the pages io-cache reads, and a
+# write through one of them is seen by the other.
+
+function shm_stat {
+        local statedump=$(generate_mount_statedump $V0 $1)
+        grep "^shared-cache.$2=" $statedump | cut -f2 -d'=' | tail -1
+        rm -f $statedump
+}
+
+function file_md5 {
+        md5sum $1 | cut -f1 -d' '
+}
+
+cleanup
+rm -f /dev/shm/glusterfs-$V0-*.cache
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}0
+TEST $CLI volume set $V0 performance.io-cache on
+TEST $CLI volume set $V0 performance.io-cache-shared-size 16MB
+TEST $CLI volume set $V0 performance.read-ahead off
+TEST $CLI volume set $V0 performance.quick-read off
+TEST $CLI volume set $V0 performance.open-behind off
+TEST $CLI volume start $V0
+
+# a link planted at the cache path is not followed, nor is a file another
+# mode than 0600 used
+TEST ln -s $B0/target /dev/shm/glusterfs-$V0-io-cache.cache
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 --direct-io-mode=enable $M0
+TEST [ ! -e $B0/target ]
+EXPECT "" shm_stat $M0 hits
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST rm -f /dev/shm/glusterfs-$V0-io-cache.cache
+TEST touch /dev/shm/glusterfs-$V0-io-cache.cache
+TEST chmod 0666 /dev/shm/glusterfs-$V0-io-cache.cache
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 --direct-io-mode=enable $M0
+EXPECT "" shm_stat $M0 hits
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST rm -f /dev/shm/glusterfs-$V0-io-cache.cache
+
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 --direct-io-mode=enable $M0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 --direct-io-mode=enable $M1
+TEST [ -f /dev/shm/glusterfs-$V0-io-cache.cache ]
+
+TEST dd if=/dev/urandom of=$B0/data bs=128k count=8
+TEST cp $B0/data $M0/file
+
+# the first mount reads from the brick, the second from the shared cache
+TEST cmp $B0/data $M0/file
+TEST [ "$(shm_stat $M0 stores)" -ge 8 ]
+TEST cmp $B0/data $M1/file
+EXPECT "8" shm_stat $M1 hits
+
+# a write through the first mount replaces the pages in both
+TEST dd if=/dev/urandom of=$B0/data bs=128k count=8
+TEST dd if=$B0/data of=$M0/file bs=128k conv=notrunc
+EXPECT_WITHIN 10 "$(file_md5 $B0/data)" file_md5 $M1/file
+EXPECT "$(file_md5 $B0/data)" file_md5 $M0/file
+
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M1
+
+# the pages outlive the processes which read them
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 --direct-io-mode=enable $M0
+TEST cmp $B0/data $M0/file
+TEST [ "$(shm_stat $M0 hits)" -gt 0 ]
+
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST rm -f $B0/data /dev/shm/glusterfs-$V0-*.cache
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup
@@ -24,6 +24,7 @@
 #include <glusterfs/statedump.h>
 #include <glusterfs/events.h>
 #include <glusterfs/upcall-utils.h>
+#include <glusterfs/names-filter.h>
 
 #include "afr-inode-read.h"
 #include "afr-inode-write.h"
@@ -2679,6 +2680,11 @@ afr_local_cleanup(afr_local_t *local, xlator_t *this)
             fd_unref(local->cont.open.fd);
     }
 
+    { /* copy_file_range */
+        if (local->cont.copy_file_range.fd_in)
+            fd_unref(local->cont.copy_file_range.fd_in);
+    }
+
     { /* readdirp */
         if (local->cont.readdir.dict)
             dict_unref(local->cont.readdir.dict);
@@ -2895,6 +2901,53 @@ afr_attempt_readsubvol_set(call_frame_t *frame, xlator_t *this,
         dict_del_sizen(local->replies[*read_subvol].xdata, GF_CONTENT_KEY);
 }
 
+/* The names of a directory are the ones of any of its copies, and one
+ * which still waits for an entry heal may be missing some. Send up the
+ * union of the filters of all the bricks which answered, or none if one
+ * of them didn't return a filter. */
+static void
+afr_names_filter_combine(xlator_t *this, afr_local_t *local, dict_t *xdata)
+{
+    afr_private_t *priv = this->private;
+    struct afr_reply *replies = local->replies;
+    gf_names_filter_t *filter = NULL;
+    gf_names_filter_t *src = NULL;
+    data_t *data = NULL;
+    int ret = 0;
+    int i = 0;
+
+    if (!xdata || !dict_get_sizen(xdata, GF_NAMES_FILTER_KEY))
+        return;
+
+    for (i = 0; i < priv->child_count; i++) {
+        if (!replies[i].valid || (replies[i].op_ret == -1))
+            continue;
+
+        data = NULL;
+        if (replies[i].xdata)
+            data = dict_get_sizen(replies[i].xdata, GF_NAMES_FILTER_KEY);
+        src = gf_names_filter_from_data(data);
+        if (!src)
+            goto drop;
+
+        if (!filter) {
+            filter = src;
+            continue;
+        }
+        ret = gf_names_filter_merge_copy(filter, src);
+        GF_FREE(src);
+        if (ret)
+            goto drop;
+    }
+
+    if (filter && !gf_names_filter_to_dict(xdata, filter))
+        goto out;
+drop:
+    dict_del_sizen(xdata, GF_NAMES_FILTER_KEY);
+out:
+    GF_FREE(filter);
+}
+
 static void
 afr_lookup_done(call_frame_t *frame, xlator_t *this)
 {
@@ -3073,6 +3126,7 @@ afr_lookup_done(call_frame_t *frame, xlator_t *this)
         }
     }
 
+    afr_names_filter_combine(this, local, local->replies[read_subvol].xdata);
     AFR_STACK_UNWIND(lookup, frame, local->op_ret, local->op_errno,
                      local->inode, &local->replies[read_subvol].poststat,
                      local->replies[read_subvol].xdata,
@@ -3640,6 +3694,7 @@ unwind:
                      local->loc.path);
     }
 
+    afr_names_filter_combine(this, local, local->replies[read_subvol].xdata);
     AFR_STACK_UNWIND(lookup, frame, local->op_ret, local->op_errno,
                      local->inode, &local->replies[read_subvol].poststat,
                      local->replies[read_subvol].xdata,
@@ -5649,6 +5704,14 @@ afr_priv_dump(xlator_t *this)
         gf_proc_dump_write(key, "%" PRId64, priv->child_latency[i]);
         sprintf(key, "halo_child_up[%d]", i);
         gf_proc_dump_write(key, "%d", priv->halo_child_up[i]);
+        if (priv->shd.index_healers) {
+            sprintf(key, "shd_backlog[%d]", i);
+            gf_proc_dump_write(key, "%" PRIu64,
+                               priv->shd.index_healers[i].backlog);
+            sprintf(key, "shd_heal_rate[%d]", i);
+            gf_proc_dump_write(key, "%.1f",
+                               priv->shd.index_healers[i].heal_rate);
+        }
     }
     gf_proc_dump_write("data_self_heal", "%d", priv->data_self_heal);
     gf_proc_dump_write("metadata_self_heal", "%d", priv->metadata_self_heal);
@@ -5662,6 +5725,10 @@ afr_priv_dump(xlator_t *this)
     gf_proc_dump_write("healers", "%d", priv->healers);
     gf_proc_dump_write("read-hash-mode", "%d", priv->hash_mode);
     gf_proc_dump_write("use-anonymous-inode", "%d", priv->use_anon_inode);
+    gf_proc_dump_write("changelog-batch-size", "%u",
+                       priv->changelog_batch_size);
+    gf_proc_dump_write("xattrops-saved", "%" PRId64,
+                       GF_ATOMIC_GET(priv->xattrops_saved));
     if (priv->quorum_count == AFR_QUORUM_AUTO) {
         gf_proc_dump_write("quorum-type", "auto");
     } else if (priv->quorum_count == 0) {
@@ -6645,9 +6712,21 @@ afr_priv_destroy(afr_private_t *priv)
             GF_FREE(priv->pending_key[i]);
     }
 
+    if (priv->range_key) {
+        for (i = 0; i < priv->child_count; i++)
+            GF_FREE(priv->range_key[i]);
+    }
+
+    if (priv->xattrop_batch) {
+        for (i = 0; i < priv->child_count; i++)
+            LOCK_DESTROY(&priv->xattrop_batch[i].lock);
+    }
+
+    GF_FREE(priv->xattrop_batch);
     GF_FREE(priv->pending_reads);
     GF_FREE(priv->local);
     GF_FREE(priv->pending_key);
+    GF_FREE(priv->range_key);
     GF_FREE(priv->children);
     GF_FREE(priv->anon_inode);
     GF_FREE(priv->child_up);
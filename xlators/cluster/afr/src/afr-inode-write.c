@@ -2259,6 +2259,205 @@ out:
 
 /* }}} */
 
+/* {{{ copy_file_range */
+
+static int
+afr_copy_file_range_unwind(call_frame_t *frame, xlator_t *this)
+{
+    afr_local_t *local = NULL;
+    call_frame_t *main_frame = NULL;
+
+    local = frame->local;
+
+    main_frame = afr_transaction_detach_fop_frame(frame);
+    if (!main_frame)
+        return 0;
+
+    AFR_STACK_UNWIND(copy_file_range, main_frame, local->op_ret,
+                     local->op_errno, &local->cont.copy_file_range.stbuf,
+                     &local->cont.inode_wfop.prebuf,
+                     &local->cont.inode_wfop.postbuf, local->xdata_rsp);
+    return 0;
+}
+
+static int
+afr_copy_file_range_wind_cbk(call_frame_t *frame, void *cookie,
+                             xlator_t *this, int32_t op_ret, int32_t op_errno,
+                             struct iatt *stbuf, struct iatt *prebuf_dst,
+                             struct iatt *postbuf_dst, dict_t *xdata)
+{
+    afr_local_t *local = NULL;
+    afr_private_t *priv = NULL;
+    int child_index = (long)cookie;
+    int call_count = -1;
+    int i = 0;
+
+    priv = this->private;
+    local = frame->local;
+
+    LOCK(&frame->lock);
+    {
+        __afr_inode_write_fill(local, priv, child_index, op_ret, op_errno,
+                               prebuf_dst, postbuf_dst, NULL, xdata);
+        if ((op_ret >= 0) && stbuf && !AFR_IS_ARBITER_BRICK(priv, child_index))
+            local->cont.copy_file_range.stbuf = *stbuf;
+        call_count = --local->call_count;
+    }
+    UNLOCK(&frame->lock);
+
+    if (call_count == 0) {
+        __afr_inode_write_finalize(frame, this);
+
+        /* Like short writes, a data brick that copied less than the best
+         * case is out of sync. The arbiter copies nothing. */
+        for (i = 0; i < priv->child_count; i++) {
+            if ((!local->replies[i].valid) ||
+                (local->replies[i].op_ret == -1) ||
+                AFR_IS_ARBITER_BRICK(priv, i))
+                continue;
+
+            if (local->replies[i].op_ret < local->op_ret)
+                afr_transaction_fop_failed(local, i);
+        }
+
+        if (afr_txn_nothing_failed(frame, this)) {
+            if (priv->consistent_metadata && afr_needs_changelog_update(local))
+                afr_zero_fill_stat(local);
+            local->transaction.unwind(frame, this);
+        }
+
+        afr_transaction_resume(frame, this);
+    }
+
+    return 0;
+}
+
+static int
+afr_copy_file_range_wind(call_frame_t *frame, xlator_t *this, int subvol)
+{
+    afr_local_t *local = NULL;
+    afr_private_t *priv = NULL;
+
+    local = frame->local;
+    priv = this->private;
+
+    STACK_WIND_COOKIE(frame, afr_copy_file_range_wind_cbk, (void *)(long)subvol,
+                      priv->children[subvol],
+                      priv->children[subvol]->fops->copy_file_range,
+                      local->cont.copy_file_range.fd_in,
+                      local->cont.copy_file_range.off_in, local->fd,
+                      local->cont.copy_file_range.off_out,
+                      local->cont.copy_file_range.len,
+                      local->cont.copy_file_range.flags, local->xdata_req);
+    return 0;
+}
+
+/* Every brick copies from its own replica of the source, so the copy can
+ * only be offloaded when the source data is good on all data bricks that
+ * are up. */
+static gf_boolean_t
+afr_copy_file_range_source_readable(xlator_t *this, inode_t *inode)
+{
+    afr_private_t *priv = NULL;
+    unsigned char *data = NULL;
+    int i = 0;
+
+    priv = this->private;
+    data = alloca0(priv->child_count);
+
+    if (afr_inode_read_subvol_get(inode, this, data, NULL, NULL) < 0)
+        return _gf_false;
+
+    for (i = 0; i < priv->child_count; i++) {
+        if (!priv->child_up[i] || AFR_IS_ARBITER_BRICK(priv, i))
+            continue;
+        if (!data[i])
+            return _gf_false;
+    }
+
+    return _gf_true;
+}
+
+int
+afr_copy_file_range(call_frame_t *frame, xlator_t *this, fd_t *fd_in,
+                    off64_t off_in, fd_t *fd_out, off64_t off_out, size_t len,
+                    uint32_t flags, dict_t *xdata)
+{
+    call_frame_t *transaction_frame = NULL;
+    afr_local_t *local = NULL;
+    int ret = -1;
+    int op_errno = ENOMEM;
+
+    AFR_ERROR_OUT_IF_FDCTX_INVALID(fd_in, this, op_errno, out);
+    AFR_ERROR_OUT_IF_FDCTX_INVALID(fd_out, this, op_errno, out);
+
+    if (!afr_copy_file_range_source_readable(this, fd_in->inode)) {
+        gf_msg_debug(this->name, 0,
+                     "source %s is not readable on all bricks, "
+                     "not offloading copy_file_range",
+                     uuid_utoa(fd_in->inode->gfid));
+        op_errno = EXDEV;
+        goto out;
+    }
+
+    transaction_frame = copy_frame(frame);
+    if (!transaction_frame)
+        goto out;
+
+    local = AFR_FRAME_INIT(transaction_frame, op_errno);
+    if (!local)
+        goto out;
+
+    local->cont.copy_file_range.fd_in = fd_ref(fd_in);
+    local->cont.copy_file_range.off_in = off_in;
+    local->cont.copy_file_range.off_out = off_out;
+    local->cont.copy_file_range.len = len;
+    local->cont.copy_file_range.flags = flags;
+
+    local->fd = fd_ref(fd_out);
+    ret = afr_set_inode_local(this, local, fd_out->inode);
+    if (ret)
+        goto out;
+
+    if (xdata)
+        local->xdata_req = dict_copy_with_ref(xdata, NULL);
+    else
+        local->xdata_req = dict_new();
+
+    if (!local->xdata_req)
+        goto out;
+
+    local->op = GF_FOP_COPY_FILE_RANGE;
+
+    local->transaction.wind = afr_copy_file_range_wind;
+    local->transaction.unwind = afr_copy_file_range_unwind;
+
+    local->transaction.main_frame = frame;
+
+    local->transaction.start = off_out;
+    local->transaction.len = len;
+
+    afr_fix_open(fd_in, this);
+    afr_fix_open(fd_out, this);
+
+    ret = afr_transaction(transaction_frame, this, AFR_DATA_TRANSACTION);
+    if (ret < 0) {
+        op_errno = -ret;
+        goto out;
+    }
+
+    return 0;
+out:
+    if (transaction_frame)
+        AFR_STACK_DESTROY(transaction_frame);
+
+    AFR_STACK_UNWIND(copy_file_range, frame, -1, op_errno, NULL, NULL, NULL,
+                     NULL);
+    return 0;
+}
+
+/* }}} */
+
 static int32_t
 afr_xattrop_wind_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
                      int32_t op_ret, int32_t op_errno, dict_t *xattr,
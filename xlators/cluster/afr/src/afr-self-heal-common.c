@@ -13,6 +13,7 @@
 #include "protocol-common.h"
 #include "afr-messages.h"
 #include <glusterfs/events.h>
+#include <glusterfs/checksum.h>
 #include <openssl/md5.h>
 
 void
@@ -719,13 +720,16 @@ afr_reply_copy(struct afr_reply *dst, struct afr_reply *src)
     if (dst->xdata)
         dict_unref(dst->xdata);
     dst->xdata = xdata;
-    if (xdata && dict_get_str_boolean(xdata, "fips-mode-rchecksum",
-                                      _gf_false) == _gf_true) {
+    if (src->checksum_algo[0]) {
+        memcpy(dst->checksum, src->checksum, GF_XXH128_DIGEST_LENGTH);
+    } else if (xdata && dict_get_str_boolean(xdata, "fips-mode-rchecksum",
+                                             _gf_false) == _gf_true) {
         memcpy(dst->checksum, src->checksum, SHA256_DIGEST_LENGTH);
     } else {
         memcpy(dst->checksum, src->checksum, MD5_DIGEST_LENGTH);
     }
     dst->fips_mode_rchecksum = src->fips_mode_rchecksum;
+    memcpy(dst->checksum_algo, src->checksum_algo, sizeof(dst->checksum_algo));
 }
 
 void
@@ -2589,6 +2593,18 @@ out:
 
 int
 afr_selfheal(xlator_t *this, uuid_t gfid)
+{
+    return afr_selfheal_measured(this, gfid, NULL, NULL);
+}
+
+/*
+ * Same as afr_selfheal(), and also returns the bytes copied by the data
+ * self-heal and the time it took, when @healed_bytes and @heal_usecs are set.
+ */
+
+int
+afr_selfheal_measured(xlator_t *this, uuid_t gfid, uint64_t *healed_bytes,
+                      uint64_t *heal_usecs)
 {
     int ret = -1;
     call_frame_t *frame = NULL;
@@ -2603,6 +2619,11 @@ afr_selfheal(xlator_t *this, uuid_t gfid)
 
     ret = afr_selfheal_do(frame, this, gfid);
 
+    if (healed_bytes)
+        *healed_bytes = local->healed_bytes;
+    if (heal_usecs)
+        *heal_usecs = local->heal_usecs;
+
     if (frame)
         AFR_STACK_DESTROY(frame);
 
@@ -13,6 +13,8 @@
 #include "protocol-common.h"
 #include "afr-messages.h"
 #include <glusterfs/events.h>
+#include <glusterfs/checksum.h>
+#include <glusterfs/range-map.h>
 #include <openssl/md5.h>
 
 #define HAS_HOLES(i) ((i->ia_blocks * 512) < (i->ia_size))
@@ -23,6 +25,7 @@ __checksum_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int op_ret,
     afr_local_t *local = NULL;
     struct afr_reply *replies = NULL;
     int i = (long)cookie;
+    char *algo = NULL;
 
     local = frame->local;
     replies = local->replies;
@@ -30,14 +33,21 @@ __checksum_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int op_ret,
     replies[i].valid = 1;
     replies[i].op_ret = op_ret;
     replies[i].op_errno = op_errno;
+    replies[i].checksum_algo[0] = '\0';
     if (xdata) {
         replies[i].buf_has_zeroes = dict_get_str_boolean(
             xdata, "buf-has-zeroes", _gf_false);
         replies[i].fips_mode_rchecksum = dict_get_str_boolean(
             xdata, "fips-mode-rchecksum", _gf_false);
+        if (dict_get_str_sizen(xdata, GF_RCHECKSUM_ALGO_KEY, &algo) == 0)
+            snprintf(replies[i].checksum_algo,
+                     sizeof(replies[i].checksum_algo), "%s", algo);
     }
     if (strong) {
-        if (replies[i].fips_mode_rchecksum) {
+        if (replies[i].checksum_algo[0]) {
+            memcpy(local->replies[i].checksum, strong,
+                   GF_XXH128_DIGEST_LENGTH);
+        } else if (replies[i].fips_mode_rchecksum) {
             memcpy(local->replies[i].checksum, strong, SHA256_DIGEST_LENGTH);
         } else {
             memcpy(local->replies[i].checksum, strong, MD5_DIGEST_LENGTH);
@@ -48,6 +58,16 @@ __checksum_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int op_ret,
     return 0;
 }
 
+static size_t
+afr_checksum_len(struct afr_reply *reply)
+{
+    if (reply->checksum_algo[0])
+        return GF_XXH128_DIGEST_LENGTH;
+    if (reply->fips_mode_rchecksum)
+        return SHA256_DIGEST_LENGTH;
+    return MD5_DIGEST_LENGTH;
+}
+
 static gf_boolean_t
 __afr_can_skip_data_block_heal(call_frame_t *frame, xlator_t *this, fd_t *fd,
                                int source, unsigned char *healed_sinks,
@@ -59,26 +79,31 @@ __afr_can_skip_data_block_heal(call_frame_t *frame, xlator_t *this, fd_t *fd,
     gf_boolean_t checksum_match = _gf_true;
     struct afr_reply *replies = NULL;
     dict_t *xdata = NULL;
+    gf_boolean_t fast = _gf_false;
     int i = 0;
 
     priv = this->private;
     local = frame->local;
     replies = local->replies;
+    fast = priv->fast_rchecksum;
+
+    wind_subvols = alloca0(priv->child_count);
+    for (i = 0; i < priv->child_count; i++) {
+        if (i == source || healed_sinks[i])
+            wind_subvols[i] = 1;
+    }
 
+retry:
     xdata = dict_new();
     if (!xdata)
         goto out;
-    if (dict_set_int32_sizen(xdata, "check-zero-filled", 1)) {
+    if (dict_set_int32_sizen(xdata, "check-zero-filled", 1) ||
+        (fast && dict_set_str_sizen(xdata, GF_RCHECKSUM_ALGO_KEY,
+                                    GF_RCHECKSUM_ALGO_FAST))) {
         dict_unref(xdata);
         goto out;
     }
 
-    wind_subvols = alloca0(priv->child_count);
-    for (i = 0; i < priv->child_count; i++) {
-        if (i == source || healed_sinks[i])
-            wind_subvols[i] = 1;
-    }
-
     AFR_ONLIST(wind_subvols, frame, __checksum_cbk, rchecksum, fd, offset, size,
                xdata);
     if (xdata)
@@ -88,16 +113,24 @@ __afr_can_skip_data_block_heal(call_frame_t *frame, xlator_t *this, fd_t *fd,
         return _gf_false;
 
     for (i = 0; i < priv->child_count; i++) {
-        if (i == source)
+        if (i == source || !replies[i].valid)
             continue;
-        if (replies[i].valid) {
-            if (memcmp(replies[source].checksum, replies[i].checksum,
-                       replies[source].fips_mode_rchecksum
-                           ? SHA256_DIGEST_LENGTH
-                           : MD5_DIGEST_LENGTH)) {
-                checksum_match = _gf_false;
-                break;
+        if (strcmp(replies[source].checksum_algo, replies[i].checksum_algo) ||
+            (replies[source].fips_mode_rchecksum !=
+             replies[i].fips_mode_rchecksum)) {
+            /* bricks which do not all know the fast checksum fall back
+             * to the one they share */
+            if (fast) {
+                fast = _gf_false;
+                goto retry;
             }
+            checksum_match = _gf_false;
+            break;
+        }
+        if (memcmp(replies[source].checksum, replies[i].checksum,
+                   afr_checksum_len(&replies[source]))) {
+            checksum_match = _gf_false;
+            break;
         }
     }
 
@@ -315,7 +348,9 @@ afr_data_self_heal_type_get(afr_private_t *priv, unsigned char *healed_sinks,
     int type = AFR_SELFHEAL_DATA_FULL;
     int i = 0;
 
-    if (priv->data_self_heal_algorithm == AFR_SELFHEAL_DATA_DYNAMIC) {
+    /* delta heals the blocks it picks like dynamic would */
+    if (priv->data_self_heal_algorithm == AFR_SELFHEAL_DATA_DYNAMIC ||
+        priv->data_self_heal_algorithm == AFR_SELFHEAL_DATA_DELTA) {
         type = AFR_SELFHEAL_DATA_FULL;
         for (i = 0; i < priv->child_count; i++) {
             if (!healed_sinks[i] && i != source)
@@ -331,17 +366,114 @@ afr_data_self_heal_type_get(afr_private_t *priv, unsigned char *healed_sinks,
     return type;
 }
 
+/* The ranges the delta algorithm heals: the union of the range maps every
+ * child keeps of the writes each healed sink missed. They are trusted only
+ * when each map counts as many writes as its child blames the sink for and
+ * no write is in flight anywhere, otherwise the whole file is healed. */
+static gf_boolean_t
+afr_selfheal_data_delta_map(xlator_t *this, unsigned char *healed_sinks,
+                            struct afr_reply *replies, gf_range_map_t *map)
+{
+    afr_private_t *priv = NULL;
+    gf_range_map_t child_map;
+    unsigned char *blamed = NULL;
+    int *dirty = NULL;
+    int **matrix = NULL;
+    data_t *data = NULL;
+    int i = 0;
+    int j = 0;
+
+    priv = this->private;
+    if ((priv->data_self_heal_algorithm != AFR_SELFHEAL_DATA_DELTA) ||
+        priv->thin_arbiter_count)
+        return _gf_false;
+
+    blamed = alloca0(priv->child_count);
+    dirty = alloca0(priv->child_count * sizeof(int));
+    matrix = ALLOC_MATRIX(priv->child_count, int);
+    afr_selfheal_extract_xattr(this, replies, AFR_DATA_TRANSACTION, dirty,
+                               matrix);
+
+    gf_range_map_init(map);
+    for (i = 0; i < priv->child_count; i++) {
+        if (!replies[i].valid || (replies[i].op_ret < 0) ||
+            !replies[i].xdata || dirty[i])
+            return _gf_false;
+
+        for (j = 0; j < priv->child_count; j++) {
+            if (!healed_sinks[j] || !matrix[i][j])
+                continue;
+
+            data = dict_get(replies[i].xdata, priv->range_key[j]);
+            if (!data || !gf_range_map_valid(data->data, data->len))
+                return _gf_false;
+            memcpy(&child_map, data->data, sizeof(child_map));
+            if ((matrix[i][j] < 0) ||
+                (gf_range_map_marks(&child_map) != matrix[i][j]))
+                return _gf_false;
+
+            gf_range_map_merge(map, &child_map);
+            blamed[j] = 1;
+        }
+    }
+
+    /* sinks nobody blames (e.g. of a size mismatch) are healed in full */
+    for (j = 0; j < priv->child_count; j++) {
+        if (healed_sinks[j] && !blamed[j] && !AFR_IS_ARBITER_BRICK(priv, j))
+            return _gf_false;
+    }
+
+    return _gf_true;
+}
+
+/* Drops the range maps of the healed sinks before the changelog blaming
+ * them is reset, so that no map outlives the count it is checked against. */
+static int
+afr_selfheal_data_clear_ranges(xlator_t *this, fd_t *fd,
+                               unsigned char *healed_sinks,
+                               struct afr_reply *replies)
+{
+    afr_private_t *priv = NULL;
+    int ret = 0;
+    int i = 0;
+    int j = 0;
+
+    priv = this->private;
+    for (i = 0; i < priv->child_count; i++) {
+        if (!replies[i].xdata)
+            continue;
+        for (j = 0; j < priv->child_count; j++) {
+            if (!healed_sinks[j] ||
+                !dict_get(replies[i].xdata, priv->range_key[j]))
+                continue;
+            ret = syncop_fremovexattr(priv->children[i], fd,
+                                      priv->range_key[j], NULL, NULL);
+            if ((ret < 0) && (ret != -ENODATA) && (ret != -ENOATTR))
+                return ret;
+        }
+    }
+
+    return 0;
+}
+
 static int
 afr_selfheal_data_do(call_frame_t *frame, xlator_t *this, fd_t *fd, int source,
-                     unsigned char *healed_sinks, struct afr_reply *replies)
+                     unsigned char *healed_sinks, struct afr_reply *replies,
+                     gf_range_map_t *map)
 {
     afr_private_t *priv = NULL;
+    afr_local_t *local = NULL;
     off_t off = 0;
     size_t block = 0;
     int type = AFR_SELFHEAL_DATA_FULL;
     int ret = -1;
     call_frame_t *iter_frame = NULL;
     unsigned char arbiter_sink_status = 0;
+    uint64_t size = replies[source].poststat.ia_size;
+    uint64_t healed = 0;
+    struct timespec start;
+    struct timespec end;
+    double secs = 0;
 
     gf_msg(this->name, GF_LOG_INFO, 0, AFR_MSG_SELF_HEAL_INFO,
            "performing data selfheal on %s", uuid_utoa(fd->inode->gfid));
@@ -368,16 +500,21 @@ afr_selfheal_data_do(call_frame_t *frame, xlator_t *this, fd_t *fd, int source,
         goto out;
     }
 
-    for (off = 0; off < replies[source].poststat.ia_size; off += block) {
+    timespec_now(&start);
+    for (off = 0; off < size; off += block) {
         if (AFR_COUNT(healed_sinks, priv->child_count) == 0) {
             ret = -ENOTCONN;
             goto out;
         }
 
+        if (map && !gf_range_map_test(map, off, block))
+            continue;
+
         ret = afr_selfheal_data_block(iter_frame, this, fd, source,
                                       healed_sinks, off, block, type, replies);
         if (ret < 0)
             goto out;
+        healed += ((size - off) < block) ? (size - off) : block;
 
         AFR_STACK_RESET(iter_frame);
         if (iter_frame->local == NULL) {
@@ -388,6 +525,19 @@ afr_selfheal_data_do(call_frame_t *frame, xlator_t *this, fd_t *fd, int source,
 
     ret = afr_selfheal_data_fsync(frame, this, fd, healed_sinks);
 
+    timespec_now(&end);
+    secs = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    gf_msg(this->name, GF_LOG_INFO, 0, AFR_MSG_SELF_HEAL_INFO,
+           "data selfheal on %s went through %" PRIu64 " of %" PRIu64
+           " bytes%s in %.3f secs (%.2f MB/s)",
+           uuid_utoa(fd->inode->gfid), healed, size,
+           map ? " (delta)" : "", secs,
+           (secs > 0) ? (healed / secs) / (1024 * 1024) : 0.0);
+
+    local = frame->local;
+    local->healed_bytes += healed;
+    local->heal_usecs += (uint64_t)(secs * 1000000);
+
 out:
     if (arbiter_sink_status)
         healed_sinks[ARBITER_BRICK_INDEX] = arbiter_sink_status;
@@ -674,6 +824,8 @@ __afr_selfheal_data(call_frame_t *frame, xlator_t *this, fd_t *fd,
     gf_boolean_t did_sh = _gf_true;
     gf_boolean_t is_arbiter_the_only_sink = _gf_false;
     gf_boolean_t empty_file = _gf_false;
+    gf_boolean_t delta = _gf_false;
+    gf_range_map_t map;
 
     priv = this->private;
 
@@ -722,6 +874,9 @@ __afr_selfheal_data(call_frame_t *frame, xlator_t *this, fd_t *fd,
             goto unlock;
         }
 
+        delta = afr_selfheal_data_delta_map(this, healed_sinks,
+                                            locked_replies, &map);
+
         ret = __afr_selfheal_truncate_sinks(
             frame, this, fd, healed_sinks,
             locked_replies[source].poststat.ia_size);
@@ -745,7 +900,7 @@ unlock:
         goto out;
 
     ret = afr_selfheal_data_do(frame, this, fd, source, healed_sinks,
-                               locked_replies);
+                               locked_replies, delta ? &map : NULL);
     if (ret)
         goto out;
 restore_time:
@@ -761,6 +916,10 @@ restore_time:
             goto skip_undo_pending;
         }
     }
+    ret = afr_selfheal_data_clear_ranges(this, fd, healed_sinks,
+                                         locked_replies);
+    if (ret < 0)
+        goto skip_undo_pending;
     ret = afr_selfheal_undo_pending(
         frame, this, fd->inode, sources, sinks, healed_sinks, undid_pending,
         AFR_DATA_TRANSACTION, locked_replies, data_lock);
@@ -129,6 +129,10 @@ typedef struct afr_granular_esh_args {
 int
 afr_selfheal(xlator_t *this, uuid_t gfid);
 
+int
+afr_selfheal_measured(xlator_t *this, uuid_t gfid, uint64_t *healed_bytes,
+                      uint64_t *heal_usecs);
+
 gf_boolean_t
 afr_throttled_selfheal(call_frame_t *frame, xlator_t *this);
 
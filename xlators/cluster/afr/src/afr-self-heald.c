@@ -13,6 +13,7 @@
 #include "afr-self-heald.h"
 #include "protocol-common.h"
 #include <glusterfs/syncop-utils.h>
+#include <glusterfs/syscall.h>
 #include "afr-messages.h"
 
 #define AFR_EH_SPLIT_BRAIN_LIMIT 1024
@@ -311,6 +312,8 @@ afr_shd_selfheal(struct subvol_healer *healer, int child, uuid_t gfid)
     xlator_t *subvol = NULL;
     xlator_t *this = NULL;
     crawl_event_t *crawl_event = NULL;
+    uint64_t healed_bytes = 0;
+    uint64_t heal_usecs = 0;
 
     this = healer->this;
     priv = this->private;
@@ -324,10 +327,12 @@ afr_shd_selfheal(struct subvol_healer *healer, int child, uuid_t gfid)
     if (ret < 0)
         return ret;
 
-    ret = afr_selfheal(this, gfid);
+    ret = afr_selfheal_measured(this, gfid, &healed_bytes, &heal_usecs);
 
     LOCK(&priv->lock);
     {
+        crawl_event->healed_bytes += healed_bytes;
+        crawl_event->heal_usecs += heal_usecs;
         if (ret == -EIO) {
             eh = shd->split_brain;
             crawl_event->split_brain_count++;
@@ -369,6 +374,8 @@ afr_shd_sweep_prepare(struct subvol_healer *healer)
     event->healed_count = 0;
     event->split_brain_count = 0;
     event->heal_failed_count = 0;
+    event->healed_bytes = 0;
+    event->heal_usecs = 0;
 
     event->start_time = gf_time();
     event->end_time = 0;
@@ -436,15 +443,101 @@ afr_shd_index_heal(xlator_t *subvol, gf_dirent_t *entry, loc_t *parent,
     return 0;
 }
 
+/* One of the threads sweeping an index directory of a brick. With
+ * shd-crawl-threads above 1 each of them gets the entries of its shard of
+ * the gfids from the index xlator, and heals them with its share of
+ * shd-max-threads. */
+typedef struct {
+    struct subvol_healer *healer;
+    char *vgfid;
+    pthread_t thread;
+    int shard;
+    int shards;
+    int ret;
+    gf_boolean_t spawned;
+} afr_shd_crawler_t;
+
+/* Where a crawler records how far it got through its index directory, so
+ * that a restarted shd resumes the sweep instead of reading the entries it
+ * already went through again. */
+static void
+afr_shd_cursor_path(afr_shd_crawler_t *crawler, char *path, size_t len)
+{
+    snprintf(path, len, DEFAULT_VAR_RUN_DIRECTORY "/shd-%s-%d-%s-%d-of-%d.cursor",
+             crawler->healer->this->name, crawler->healer->subvol,
+             crawler->vgfid, crawler->shard, crawler->shards);
+}
+
+static uint64_t
+afr_shd_cursor_load(afr_shd_crawler_t *crawler)
+{
+    char path[PATH_MAX];
+    char buf[32] = {0};
+    ssize_t len = 0;
+    int fd = -1;
+
+    afr_shd_cursor_path(crawler, path, sizeof(path));
+
+    fd = sys_open(path, O_RDONLY, 0);
+    if (fd < 0)
+        return 0;
+
+    len = sys_read(fd, buf, sizeof(buf) - 1);
+    sys_close(fd);
+    if (len <= 0)
+        return 0;
+
+    return strtoull(buf, NULL, 10);
+}
+
+static void
+afr_shd_cursor_save(uint64_t offset, void *data)
+{
+    afr_shd_crawler_t *crawler = data;
+    char path[PATH_MAX];
+    char tmp[PATH_MAX];
+    char buf[32];
+    int len = 0;
+    int fd = -1;
+
+    afr_shd_cursor_path(crawler, path, sizeof(path));
+
+    if (!offset) {
+        sys_unlink(path);
+        return;
+    }
+
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    fd = sys_open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0)
+        return;
+
+    len = snprintf(buf, sizeof(buf), "%" PRIu64 "\n", offset);
+    if (sys_write(fd, buf, len) != len) {
+        sys_close(fd);
+        sys_unlink(tmp);
+        return;
+    }
+    sys_close(fd);
+
+    if (sys_rename(tmp, path))
+        sys_unlink(tmp);
+}
+
 static int
-afr_shd_index_sweep(struct subvol_healer *healer, char *vgfid)
+afr_shd_index_crawl(afr_shd_crawler_t *crawler)
 {
+    struct subvol_healer *healer = crawler->healer;
     loc_t loc = {0};
     afr_private_t *priv = NULL;
     int ret = 0;
     xlator_t *subvol = NULL;
     dict_t *xdata = NULL;
     call_frame_t *frame = NULL;
+    char shard[32];
+    uint32_t max_jobs = 0;
+    uint32_t max_qlen = 0;
+    uint64_t offset = 0;
 
     priv = healer->this->private;
     subvol = priv->children[healer->subvol];
@@ -455,7 +548,7 @@ afr_shd_index_sweep(struct subvol_healer *healer, char *vgfid)
         goto out;
     }
 
-    loc.inode = afr_shd_index_inode(healer->this, subvol, vgfid);
+    loc.inode = afr_shd_index_inode(healer->this, subvol, crawler->vgfid);
     if (!loc.inode) {
         gf_msg(healer->this->name, GF_LOG_WARNING, 0,
                AFR_MSG_INDEX_DIR_GET_FAILED, "unable to get index-dir on %s",
@@ -470,12 +563,37 @@ afr_shd_index_sweep(struct subvol_healer *healer, char *vgfid)
         goto out;
     }
 
-    ret = syncop_mt_dir_scan(frame, subvol, &loc, GF_CLIENT_PID_SELF_HEALD,
-                             healer, afr_shd_index_heal, xdata,
-                             priv->shd.max_threads, priv->shd.wait_qlength);
+    if (crawler->shards > 1) {
+        snprintf(shard, sizeof(shard), "%d/%d", crawler->shard,
+                 crawler->shards);
+        if (dict_set_dynstr_with_alloc(xdata, GF_INDEX_SHARD_KEY, shard)) {
+            ret = -ENOMEM;
+            goto out;
+        }
+    }
 
-    if (ret == 0)
-        ret = healer->crawl_event.healed_count;
+    max_jobs = max(priv->shd.max_threads / crawler->shards, 1);
+    max_qlen = max(priv->shd.wait_qlength / crawler->shards, 1);
+
+    offset = afr_shd_cursor_load(crawler);
+    if (offset)
+        gf_msg_debug(healer->this->name, 0,
+                     "resuming sweep of %s shard %d on %s at %" PRIu64,
+                     crawler->vgfid, crawler->shard, subvol->name, offset);
+
+    ret = syncop_mt_dir_scan_from(frame, subvol, &loc, GF_CLIENT_PID_SELF_HEALD,
+                                  healer, afr_shd_index_heal, xdata, max_jobs,
+                                  max_qlen, offset, 0, afr_shd_cursor_save,
+                                  crawler);
+
+    /* The entries before the cursor were not looked at, go over them now
+     * rather than leaving them to the next sweep. The cursor was dropped at
+     * the end of the directory, a restart during this pass sweeps it all. */
+    if (ret == 0 && offset)
+        ret = syncop_mt_dir_scan_from(
+            frame, subvol, &loc, GF_CLIENT_PID_SELF_HEALD, healer,
+            afr_shd_index_heal, xdata, max_jobs, max_qlen, 0, offset, NULL,
+            NULL);
 
 out:
     loc_wipe(&loc);
@@ -487,6 +605,160 @@ out:
     return ret;
 }
 
+static void *
+afr_shd_index_crawler(void *data)
+{
+    afr_shd_crawler_t *crawler = data;
+    gf_lkowner_t lkowner;
+    pid_t pid = GF_CLIENT_PID_SELF_HEALD;
+
+    THIS = crawler->healer->this;
+
+    syncopctx_setfspid(&pid);
+    set_lk_owner_from_ptr(&lkowner, &lkowner);
+    syncopctx_setfslkowner(&lkowner);
+
+    crawler->ret = afr_shd_index_crawl(crawler);
+
+    return NULL;
+}
+
+/* Bricks older than the index shards ignore GF_INDEX_SHARD_KEY and give every
+ * crawler all the entries, which would then be healed once per crawler. The
+ * index xlator returns the key when it filtered the entries, ask for one
+ * shard and see whether it did. */
+static gf_boolean_t
+afr_shd_index_shards_supported(struct subvol_healer *healer, char *vgfid,
+                               int shards)
+{
+    afr_private_t *priv = healer->this->private;
+    xlator_t *subvol = priv->children[healer->subvol];
+    loc_t loc = {0};
+    fd_t *fd = NULL;
+    dict_t *xdata = NULL;
+    dict_t *rsp_xdata = NULL;
+    gf_dirent_t entries;
+    char shard[32];
+    gf_boolean_t supported = _gf_false;
+    int ret = 0;
+
+    INIT_LIST_HEAD(&entries.list);
+
+    loc.inode = afr_shd_index_inode(healer->this, subvol, vgfid);
+    if (!loc.inode)
+        goto out;
+
+    xdata = dict_new();
+    snprintf(shard, sizeof(shard), "0/%d", shards);
+    if (!xdata || dict_set_dynstr_with_alloc(xdata, GF_INDEX_SHARD_KEY, shard))
+        goto out;
+
+    ret = syncop_dirfd(subvol, &loc, &fd, GF_CLIENT_PID_SELF_HEALD);
+    if (ret)
+        goto out;
+
+    ret = syncop_readdir(subvol, fd, 4096, 0, &entries, xdata, &rsp_xdata);
+    if (ret >= 0 && rsp_xdata && dict_get_sizen(rsp_xdata, GF_INDEX_SHARD_KEY))
+        supported = _gf_true;
+
+out:
+    if (!supported)
+        gf_msg(healer->this->name, GF_LOG_INFO, 0, AFR_MSG_SELF_HEAL_INFO,
+               "%s does not shard its index, crawling %s with one thread",
+               subvol->name, vgfid);
+    gf_dirent_free(&entries);
+    if (fd)
+        fd_unref(fd);
+    if (rsp_xdata)
+        dict_unref(rsp_xdata);
+    if (xdata)
+        dict_unref(xdata);
+    loc_wipe(&loc);
+    return supported;
+}
+
+static int
+afr_shd_index_sweep(struct subvol_healer *healer, char *vgfid)
+{
+    afr_private_t *priv = NULL;
+    afr_shd_crawler_t *crawlers = NULL;
+    int shards = 0;
+    int ret = 0;
+    int i = 0;
+
+    priv = healer->this->private;
+    shards = priv->shd.crawl_threads;
+    if (shards > 1 && !afr_shd_index_shards_supported(healer, vgfid, shards))
+        shards = 1;
+
+    crawlers = alloca0(shards * sizeof(*crawlers));
+    for (i = 0; i < shards; i++) {
+        crawlers[i].healer = healer;
+        crawlers[i].vgfid = vgfid;
+        crawlers[i].shard = i;
+        crawlers[i].shards = shards;
+    }
+
+    /* The healer crawls the first shard itself, and the shards no thread
+     * could be started for after it. */
+    for (i = 1; i < shards; i++) {
+        if (!gf_thread_create(&crawlers[i].thread, NULL, afr_shd_index_crawler,
+                              &crawlers[i], "shdcrawl"))
+            crawlers[i].spawned = _gf_true;
+    }
+
+    crawlers[0].ret = afr_shd_index_crawl(&crawlers[0]);
+
+    for (i = 1; i < shards; i++) {
+        if (crawlers[i].spawned)
+            pthread_join(crawlers[i].thread, NULL);
+        else
+            crawlers[i].ret = afr_shd_index_crawl(&crawlers[i]);
+    }
+
+    for (i = 0; i < shards; i++) {
+        if (crawlers[i].ret < 0) {
+            ret = crawlers[i].ret;
+            break;
+        }
+    }
+
+    if (ret == 0)
+        ret = healer->crawl_event.healed_count;
+
+    return ret;
+}
+
+static int
+afr_shd_get_index_count(xlator_t *this, int i, uint64_t *count);
+
+/* Keeps the heal rate of the sweep and the entries it left in the index for
+ * the statedump. */
+static void
+afr_shd_index_sweep_stats(struct subvol_healer *healer)
+{
+    xlator_t *this = healer->this;
+    crawl_event_t *event = &healer->crawl_event;
+    uint64_t backlog = 0;
+    time_t secs = 0;
+    gf_loglevel_t loglevel = GF_LOG_DEBUG;
+
+    secs = max(gf_time() - event->start_time, 1);
+    healer->heal_rate = (double)event->healed_count / secs;
+
+    if (afr_shd_get_index_count(this, healer->subvol, &backlog) == 0)
+        healer->backlog = backlog;
+
+    if (event->healed_count || healer->backlog)
+        loglevel = GF_LOG_INFO;
+
+    gf_msg(this->name, loglevel, 0, AFR_MSG_SELF_HEAL_INFO,
+           "index sweep on %s healed %" PRIu64 " entries in %ld secs "
+           "(%.1f/s), %" PRIu64 " left",
+           afr_subvol_name(this, healer->subvol), event->healed_count,
+           (long)secs, healer->heal_rate, healer->backlog);
+}
+
 static int
 afr_shd_index_sweep_all(struct subvol_healer *healer)
 {
@@ -1052,6 +1324,8 @@ afr_shd_index_healer(void *data)
 
             ret = afr_shd_index_sweep_all(healer);
 
+            afr_shd_index_sweep_stats(healer);
+
             afr_shd_sweep_done(healer);
             /*
               As long as at least one gfid was
@@ -1206,6 +1480,8 @@ afr_shd_dict_add_crawl_event(xlator_t *this, dict_t *output,
     uint64_t healed_count = 0;
     uint64_t split_brain_count = 0;
     uint64_t heal_failed_count = 0;
+    uint64_t healed_bytes = 0;
+    uint64_t heal_usecs = 0;
     char *start_time_str = 0;
     char *end_time_str = NULL;
     char *crawl_type = NULL;
@@ -1216,6 +1492,8 @@ afr_shd_dict_add_crawl_event(xlator_t *this, dict_t *output,
     healed_count = crawl_event->healed_count;
     split_brain_count = crawl_event->split_brain_count;
     heal_failed_count = crawl_event->heal_failed_count;
+    healed_bytes = crawl_event->healed_bytes;
+    heal_usecs = crawl_event->heal_usecs;
     crawl_type = crawl_event->crawl_type;
 
     if (!crawl_event->start_time)
@@ -1269,6 +1547,22 @@ afr_shd_dict_add_crawl_event(xlator_t *this, dict_t *output,
         goto out;
     }
 
+    snprintf(key, sizeof(key), "statistics_healed_bytes-%s", suffix);
+    ret = dict_set_uint64(output, key, healed_bytes);
+    if (ret) {
+        gf_msg(this->name, GF_LOG_ERROR, -ret, AFR_MSG_DICT_SET_FAILED,
+               "Could not add statistics_healed_bytes to output");
+        goto out;
+    }
+
+    snprintf(key, sizeof(key), "statistics_heal_usecs-%s", suffix);
+    ret = dict_set_uint64(output, key, heal_usecs);
+    if (ret) {
+        gf_msg(this->name, GF_LOG_ERROR, -ret, AFR_MSG_DICT_SET_FAILED,
+               "Could not add statistics_heal_usecs to output");
+        goto out;
+    }
+
     keylen = snprintf(key, sizeof(key), "statistics_strt_time-%s", suffix);
     ret = dict_set_dynstrn(output, key, keylen, start_time_str);
     if (ret) {
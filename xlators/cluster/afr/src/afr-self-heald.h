@@ -22,6 +22,10 @@ typedef struct {
     uint64_t healed_count;
     uint64_t split_brain_count;
     uint64_t heal_failed_count;
+    /* Data copied by the data self-heals of this crawl, and the time
+       they took. */
+    uint64_t healed_bytes;
+    uint64_t heal_usecs;
 
     /* If start_time is 0, it means crawler is not in progress
        and stats are not valid */
@@ -43,6 +47,9 @@ struct subvol_healer {
     gf_boolean_t local;
     gf_boolean_t running;
     gf_boolean_t rerun;
+    /* outcome of the last index sweep, for the statedump */
+    uint64_t backlog;
+    double heal_rate;
 };
 
 typedef struct {
@@ -54,6 +61,7 @@ typedef struct {
     time_t timeout;
     uint32_t max_threads;
     uint32_t wait_qlength;
+    uint32_t crawl_threads;
     uint32_t halo_max_latency_msec;
     gf_boolean_t iamshd;
     gf_boolean_t enabled;
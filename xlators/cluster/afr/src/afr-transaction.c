@@ -1679,6 +1679,111 @@ afr_changelog_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int op_ret,
     return 0;
 }
 
+/* The byte range a data transaction modified, len 0 meaning up to the end
+ * of the file. Those which modify no data get an offset of UINT64_MAX. */
+static void
+afr_txn_data_range(afr_local_t *local, uint64_t *offset, uint64_t *len)
+{
+    *offset = 0;
+    *len = 0;
+
+    switch (local->op) {
+        case GF_FOP_WRITE:
+            if (local->fd && (local->fd->flags & O_APPEND)) {
+                *offset = local->cont.inode_wfop.prebuf.ia_size;
+                break;
+            }
+            *offset = local->cont.writev.offset;
+            *len = iov_length(local->cont.writev.vector,
+                              local->cont.writev.count);
+            if (!*len)
+                *offset = UINT64_MAX;
+            break;
+        case GF_FOP_TRUNCATE:
+            *offset = local->cont.truncate.offset;
+            break;
+        case GF_FOP_FTRUNCATE:
+            *offset = local->cont.ftruncate.offset;
+            break;
+        case GF_FOP_FALLOCATE:
+            *offset = local->cont.fallocate.offset;
+            *len = local->cont.fallocate.len;
+            break;
+        case GF_FOP_DISCARD:
+            *offset = local->cont.discard.offset;
+            *len = local->cont.discard.len;
+            break;
+        case GF_FOP_ZEROFILL:
+            *offset = local->cont.zerofill.offset;
+            *len = local->cont.zerofill.len;
+            break;
+        case GF_FOP_COPY_FILE_RANGE:
+            *offset = local->cont.copy_file_range.off_out;
+            *len = local->cont.copy_file_range.len;
+            break;
+        case GF_FOP_FSYNC:
+        case GF_FOP_XATTROP:
+        case GF_FOP_FXATTROP:
+            *offset = UINT64_MAX;
+            break;
+        default:
+            /* unknown, all of the file */
+            break;
+    }
+}
+
+/* With the delta data self-heal algorithm the post-op which blames children
+ * for a write has the bricks record its range in the range map of each of
+ * them, for the heal to copy only what they missed. */
+static dict_t *
+afr_changelog_range_xdata(afr_local_t *local, xlator_t *this)
+{
+    afr_private_t *priv = this->private;
+    dict_t *xdata = NULL;
+    uint64_t offset = 0;
+    uint64_t len = 0;
+    char *range = NULL;
+    size_t size = 0;
+    int idx = afr_index_for_transaction_type(AFR_DATA_TRANSACTION);
+    int count = 0;
+    int n = 0;
+    int i = 0;
+
+    if ((priv->data_self_heal_algorithm != AFR_SELFHEAL_DATA_DELTA) ||
+        priv->thin_arbiter_count)
+        return NULL;
+
+    /* two numbers of up to 20 digits, a space and the terminator */
+    size = 2 * 21;
+    for (i = 0; i < priv->child_count; i++) {
+        if (!local->pending[i][idx])
+            continue;
+        size += strlen(priv->range_key[i]) + 1;
+        count++;
+    }
+    if (!count)
+        return NULL;
+
+    afr_txn_data_range(local, &offset, &len);
+
+    range = alloca(size);
+    n = snprintf(range, size, "%" PRIu64 " %" PRIu64, offset, len);
+    for (i = 0; i < priv->child_count; i++) {
+        if (local->pending[i][idx])
+            n += snprintf(range + n, size - n, " %s", priv->range_key[i]);
+    }
+
+    xdata = dict_new();
+    if (!xdata)
+        return NULL;
+    if (dict_set_dynstr_with_alloc(xdata, GF_XATTROP_DIRTY_RANGE, range)) {
+        dict_unref(xdata);
+        return NULL;
+    }
+
+    return xdata;
+}
+
 static void
 afr_changelog_populate_xdata(call_frame_t *frame, afr_xattrop_type_t op,
                              dict_t **xdata, dict_t **newloc_xdata)
@@ -1699,8 +1804,13 @@ afr_changelog_populate_xdata(call_frame_t *frame, afr_xattrop_type_t op,
     this = THIS;
     priv = this->private;
 
-    if (local->transaction.type == AFR_DATA_TRANSACTION ||
-        local->transaction.type == AFR_METADATA_TRANSACTION)
+    if (local->transaction.type == AFR_DATA_TRANSACTION) {
+        if (op == AFR_TRANSACTION_POST_OP)
+            *xdata = afr_changelog_range_xdata(local, this);
+        goto out;
+    }
+
+    if (local->transaction.type == AFR_METADATA_TRANSACTION)
         goto out;
 
     if (!priv->esh_granular)
@@ -1803,6 +1913,320 @@ afr_changelog_prepare(xlator_t *this, call_frame_t *frame, int *call_count,
     return 0;
 }
 
+typedef struct {
+    struct list_head list;
+    call_frame_t *frame; /* of the transaction, waits in afr_changelog_cbk */
+    dict_t *xattr;
+} afr_xattrop_req_t;
+
+typedef struct {
+    struct list_head reqs;
+    int child;
+    int count;
+} afr_xattrop_batch_local_t;
+
+static void
+afr_xattrop_batch_send(xlator_t *this, int child, struct list_head *reqs,
+                       int count);
+
+static void
+afr_changelog_xattrop_wind(call_frame_t *frame, xlator_t *this, int child,
+                           dict_t *xattr, dict_t *xdata)
+{
+    afr_local_t *local = frame->local;
+    afr_private_t *priv = this->private;
+
+    if (!local->fd) {
+        STACK_WIND_COOKIE(frame, afr_changelog_cbk, (void *)(long)child,
+                          priv->children[child],
+                          priv->children[child]->fops->xattrop, &local->loc,
+                          GF_XATTROP_ADD_ARRAY, xattr, xdata);
+    } else {
+        STACK_WIND_COOKIE(frame, afr_changelog_cbk, (void *)(long)child,
+                          priv->children[child],
+                          priv->children[child]->fops->fxattrop, local->fd,
+                          GF_XATTROP_ADD_ARRAY, xattr, xdata);
+    }
+}
+
+static void
+afr_xattrop_req_free(afr_xattrop_req_t *req)
+{
+    dict_unref(req->xattr);
+    GF_FREE(req);
+}
+
+/* The brick does all the xattrops of a batch with the credentials of its
+ * first request, so only the ones from the same caller can go with it. */
+static gf_boolean_t
+afr_xattrop_same_creds(call_frame_t *frame1, call_frame_t *frame2)
+{
+    call_stack_t *root1 = frame1->root;
+    call_stack_t *root2 = frame2->root;
+
+    return (root1->uid == root2->uid) && (root1->gid == root2->gid) &&
+           (root1->pid == root2->pid) && (root1->ngrps == root2->ngrps) &&
+           !memcmp(root1->groups, root2->groups,
+                   root1->ngrps * sizeof(*root1->groups));
+}
+
+/* Sends what queued up for @child while the last batch was on the wire.
+ * Requests of other callers than the first one wait for a later batch. */
+static void
+afr_xattrop_batch_next(xlator_t *this, int child)
+{
+    afr_private_t *priv = this->private;
+    afr_xattrop_batch_t *batch = &priv->xattrop_batch[child];
+    afr_xattrop_req_t *first = NULL;
+    afr_xattrop_req_t *req = NULL;
+    afr_xattrop_req_t *tmp = NULL;
+    struct list_head reqs;
+    int count = 0;
+
+    INIT_LIST_HEAD(&reqs);
+
+    LOCK(&batch->lock);
+    {
+        list_for_each_entry_safe(req, tmp, &batch->queue, list)
+        {
+            if (count && (count >= (int)priv->changelog_batch_size))
+                break;
+            if (!first)
+                first = req;
+            else if (!afr_xattrop_same_creds(first->frame, req->frame))
+                continue;
+            list_move_tail(&req->list, &reqs);
+            count++;
+        }
+        if (!count)
+            batch->busy = _gf_false;
+    }
+    UNLOCK(&batch->lock);
+
+    if (count)
+        afr_xattrop_batch_send(this, child, &reqs, count);
+}
+
+static int
+afr_xattrop_batch_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
+                      int32_t op_ret, int32_t op_errno, dict_t *xattr,
+                      dict_t *xdata)
+{
+    afr_private_t *priv = this->private;
+    afr_xattrop_batch_local_t *blocal = frame->local;
+    afr_xattrop_req_t *req = NULL;
+    afr_xattrop_req_t *tmp = NULL;
+    dict_t *rsp = NULL;
+    data_t *data = NULL;
+    uint32_t acked = 0;
+    int32_t error = 0;
+    char key[64];
+    int idx = 0;
+
+    frame->local = NULL;
+
+    /* Without the acknowledgement the brick did not look at the other
+     * inodes, their xattrops are sent again one by one. */
+    if ((blocal->count > 1) && xdata &&
+        !dict_get_uint32(xdata, GF_XATTROP_BATCH_KEY, &acked) &&
+        (acked == blocal->count - 1))
+        GF_ATOMIC_ADD(priv->xattrops_saved, acked);
+    else
+        acked = 0;
+
+    /* before answering the transactions, which may queue more */
+    afr_xattrop_batch_next(this, blocal->child);
+
+    list_for_each_entry_safe(req, tmp, &blocal->reqs, list)
+    {
+        list_del_init(&req->list);
+
+        if (idx++ == 0) {
+            afr_changelog_cbk(req->frame, (void *)(long)blocal->child, this,
+                              op_ret, op_errno, xattr, xdata);
+            goto next;
+        }
+
+        if (!acked)
+            goto resend;
+
+        snprintf(key, sizeof(key), GF_XATTROP_BATCH_ERRNO_FMT, idx - 1);
+        if (dict_get_int32(xdata, key, &error))
+            error = EIO;
+        else
+            error = gf_error_to_errno(error);
+
+        /* the brick did not find the inode, try through the fd */
+        if ((error == ESTALE) || (error == ENOENT))
+            goto resend;
+
+        snprintf(key, sizeof(key), GF_XATTROP_BATCH_FMT, idx - 1);
+        data = dict_get(xdata, key);
+        if (!error && data) {
+            rsp = dict_new();
+            if (rsp && dict_unserialize(data->data, data->len, &rsp)) {
+                dict_unref(rsp);
+                rsp = NULL;
+            }
+            if (!rsp)
+                error = ENOMEM;
+        }
+
+        afr_changelog_cbk(req->frame, (void *)(long)blocal->child, this,
+                          error ? -1 : 0, error, rsp, NULL);
+        if (rsp)
+            dict_unref(rsp);
+        rsp = NULL;
+        goto next;
+    resend:
+        afr_changelog_xattrop_wind(req->frame, this, blocal->child,
+                                   req->xattr, NULL);
+    next:
+        afr_xattrop_req_free(req);
+    }
+
+    GF_FREE(blocal);
+    STACK_DESTROY(frame->root);
+    return 0;
+}
+
+/* The first request goes out as usual, the others ride in its xdata and are
+ * done by the brick on their gfids (see server4_xattrop_batch_wind()). */
+static void
+afr_xattrop_batch_send(xlator_t *this, int child, struct list_head *reqs,
+                       int count)
+{
+    afr_private_t *priv = this->private;
+    afr_xattrop_batch_local_t *blocal = NULL;
+    afr_xattrop_req_t *first = NULL;
+    afr_xattrop_req_t *req = NULL;
+    afr_xattrop_req_t *tmp = NULL;
+    afr_local_t *local = NULL;
+    call_frame_t *bframe = NULL;
+    dict_t *xdata = NULL;
+    char *buf = NULL;
+    u_int len = 0;
+    char key[64];
+    int idx = 0;
+
+    first = list_first_entry(reqs, afr_xattrop_req_t, list);
+
+    blocal = GF_CALLOC(1, sizeof(*blocal), gf_afr_mt_xattrop_batch_t);
+    if (!blocal)
+        goto fail;
+    INIT_LIST_HEAD(&blocal->reqs);
+    blocal->child = child;
+    blocal->count = count;
+
+    if (count > 1) {
+        xdata = dict_new();
+        if (!xdata || dict_set_uint32(xdata, GF_XATTROP_BATCH_KEY, count - 1))
+            goto fail;
+
+        list_for_each_entry(req, reqs, list)
+        {
+            if (req == first)
+                continue;
+            idx++;
+            local = req->frame->local;
+
+            snprintf(key, sizeof(key), GF_XATTROP_BATCH_GFID_FMT, idx);
+            if (dict_set_gfuuid(xdata, key, local->inode->gfid, false))
+                goto fail;
+
+            if (dict_allocate_and_serialize(req->xattr, &buf, &len))
+                goto fail;
+            snprintf(key, sizeof(key), GF_XATTROP_BATCH_FMT, idx);
+            if (dict_set_dynptr(xdata, key, buf, len)) {
+                GF_FREE(buf);
+                goto fail;
+            }
+        }
+    }
+
+    bframe = copy_frame(first->frame);
+    if (!bframe)
+        goto fail;
+
+    list_splice_init(reqs, &blocal->reqs);
+    bframe->local = blocal;
+
+    local = first->frame->local;
+    if (!local->fd) {
+        STACK_WIND(bframe, afr_xattrop_batch_cbk, priv->children[child],
+                   priv->children[child]->fops->xattrop, &local->loc,
+                   GF_XATTROP_ADD_ARRAY, first->xattr, xdata);
+    } else {
+        STACK_WIND(bframe, afr_xattrop_batch_cbk, priv->children[child],
+                   priv->children[child]->fops->fxattrop, local->fd,
+                   GF_XATTROP_ADD_ARRAY, first->xattr, xdata);
+    }
+
+    if (xdata)
+        dict_unref(xdata);
+    return;
+fail:
+    GF_FREE(blocal);
+    if (xdata)
+        dict_unref(xdata);
+
+    list_for_each_entry_safe(req, tmp, reqs, list)
+    {
+        list_del_init(&req->list);
+        afr_changelog_xattrop_wind(req->frame, this, child, req->xattr, NULL);
+        afr_xattrop_req_free(req);
+    }
+    afr_xattrop_batch_next(this, child);
+}
+
+/* xattrop of a data or metadata transaction. With changelog-batch-size > 1
+ * only one of them is on the wire to a child at a time, the ones which come
+ * in meanwhile are coalesced into the next request. Those carrying xdata are
+ * sent on their own. */
+static void
+afr_changelog_xattrop(call_frame_t *frame, xlator_t *this, int child,
+                      dict_t *xattr, dict_t *xdata)
+{
+    afr_private_t *priv = this->private;
+    afr_local_t *local = frame->local;
+    afr_xattrop_batch_t *batch = NULL;
+    afr_xattrop_req_t *req = NULL;
+    struct list_head reqs;
+    gf_boolean_t send = _gf_false;
+
+    if ((priv->changelog_batch_size < 2) || xdata || !local->inode ||
+        gf_uuid_is_null(local->inode->gfid))
+        goto wind;
+
+    req = GF_CALLOC(1, sizeof(*req), gf_afr_mt_xattrop_req_t);
+    if (!req)
+        goto wind;
+    INIT_LIST_HEAD(&req->list);
+    req->frame = frame;
+    req->xattr = dict_ref(xattr);
+
+    batch = &priv->xattrop_batch[child];
+    LOCK(&batch->lock);
+    {
+        if (batch->busy) {
+            list_add_tail(&req->list, &batch->queue);
+        } else {
+            batch->busy = _gf_true;
+            send = _gf_true;
+        }
+    }
+    UNLOCK(&batch->lock);
+
+    if (send) {
+        INIT_LIST_HEAD(&reqs);
+        list_add_tail(&req->list, &reqs);
+        afr_xattrop_batch_send(this, child, &reqs, 1);
+    }
+    return;
+wind:
+    afr_changelog_xattrop_wind(frame, this, child, xattr, xdata);
+}
+
 static int
 afr_changelog_do(call_frame_t *frame, xlator_t *this, dict_t *xattr,
                  afr_changelog_resume_t changelog_resume, afr_xattrop_type_t op)
@@ -1839,17 +2263,7 @@ afr_changelog_do(call_frame_t *frame, xlator_t *this, dict_t *xattr,
         switch (local->transaction.type) {
             case AFR_DATA_TRANSACTION:
             case AFR_METADATA_TRANSACTION:
-                if (!local->fd) {
-                    STACK_WIND_COOKIE(
-                        frame, afr_changelog_cbk, (void *)(long)i,
-                        priv->children[i], priv->children[i]->fops->xattrop,
-                        &local->loc, GF_XATTROP_ADD_ARRAY, xattr, xdata);
-                } else {
-                    STACK_WIND_COOKIE(
-                        frame, afr_changelog_cbk, (void *)(long)i,
-                        priv->children[i], priv->children[i]->fops->fxattrop,
-                        local->fd, GF_XATTROP_ADD_ARRAY, xattr, xdata);
-                }
+                afr_changelog_xattrop(frame, this, i, xattr, xdata);
                 break;
             case AFR_ENTRY_RENAME_TRANSACTION:
 
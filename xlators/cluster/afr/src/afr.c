@@ -130,6 +130,8 @@ set_data_self_heal_algorithm(afr_private_t *priv, char *algo)
         priv->data_self_heal_algorithm = AFR_SELFHEAL_DATA_FULL;
     } else if (strcmp(algo, "diff") == 0) {
         priv->data_self_heal_algorithm = AFR_SELFHEAL_DATA_DIFF;
+    } else if (strcmp(algo, "delta") == 0) {
+        priv->data_self_heal_algorithm = AFR_SELFHEAL_DATA_DELTA;
     } else {
         priv->data_self_heal_algorithm = AFR_SELFHEAL_DATA_DYNAMIC;
     }
@@ -171,6 +173,7 @@ reconfigure(xlator_t *this, dict_t *options)
     char *fav_child_policy = NULL;
     char *data_self_heal = NULL;
     char *data_self_heal_algorithm = NULL;
+    char *data_self_heal_checksum = NULL;
     char *locking_scheme = NULL;
     gf_boolean_t consistent_io = _gf_false;
     gf_boolean_t choose_local_old = _gf_false;
@@ -204,6 +207,10 @@ reconfigure(xlator_t *this, dict_t *options)
                      options, str, out);
     set_data_self_heal_algorithm(priv, data_self_heal_algorithm);
 
+    GF_OPTION_RECONF("data-self-heal-checksum", data_self_heal_checksum,
+                     options, str, out);
+    priv->fast_rchecksum = (strcmp(data_self_heal_checksum, "fast") == 0);
+
     GF_OPTION_RECONF("halo-enabled", priv->halo_enabled, options, bool, out);
 
     GF_OPTION_RECONF("halo-shd-max-latency", priv->shd.halo_max_latency_msec,
@@ -276,6 +283,8 @@ reconfigure(xlator_t *this, dict_t *options)
 
     GF_OPTION_RECONF("post-op-delay-secs", priv->post_op_delay_secs, options,
                      uint32, out);
+    GF_OPTION_RECONF("changelog-batch-size", priv->changelog_batch_size,
+                     options, uint32, out);
 
     /* Reset this so we re-discover in case the topology changed.  */
     GF_OPTION_RECONF("ensure-durability", priv->ensure_durability, options,
@@ -299,6 +308,9 @@ reconfigure(xlator_t *this, dict_t *options)
     GF_OPTION_RECONF("shd-wait-qlength", priv->shd.wait_qlength, options,
                      uint32, out);
 
+    GF_OPTION_RECONF("shd-crawl-threads", priv->shd.crawl_threads, options,
+                     uint32, out);
+
     GF_OPTION_RECONF("favorite-child-policy", fav_child_policy, options, str,
                      out);
     if (afr_set_favorite_child_policy(priv, fav_child_policy) == -1)
@@ -426,6 +438,7 @@ init(xlator_t *this)
     char *data_self_heal = NULL;
     char *locking_scheme = NULL;
     char *data_self_heal_algorithm = NULL;
+    char *data_self_heal_checksum = NULL;
 
     if (!this->children) {
         gf_msg(this->name, GF_LOG_ERROR, 0, AFR_MSG_CHILD_MISCONFIGURED,
@@ -505,6 +518,8 @@ init(xlator_t *this)
 
     GF_OPTION_INIT("shd-wait-qlength", priv->shd.wait_qlength, uint32, out);
 
+    GF_OPTION_INIT("shd-crawl-threads", priv->shd.crawl_threads, uint32, out);
+
     GF_OPTION_INIT("background-self-heal-count",
                    priv->background_self_heal_count, uint32, out);
 
@@ -518,6 +533,10 @@ init(xlator_t *this)
                    out);
     set_data_self_heal_algorithm(priv, data_self_heal_algorithm);
 
+    GF_OPTION_INIT("data-self-heal-checksum", data_self_heal_checksum, str,
+                   out);
+    priv->fast_rchecksum = (strcmp(data_self_heal_checksum, "fast") == 0);
+
     GF_OPTION_INIT("data-self-heal-window-size",
                    priv->data_self_heal_window_size, uint32, out);
 
@@ -555,6 +574,8 @@ init(xlator_t *this)
     fix_quorum_options(this, priv, qtype, this->options);
 
     GF_OPTION_INIT("post-op-delay-secs", priv->post_op_delay_secs, uint32, out);
+    GF_OPTION_INIT("changelog-batch-size", priv->changelog_batch_size, uint32,
+                   out);
     GF_OPTION_INIT("ensure-durability", priv->ensure_durability, bool, out);
 
     GF_OPTION_INIT("self-heal-daemon", priv->shd.enabled, bool, out);
@@ -599,6 +620,18 @@ init(xlator_t *this)
     for (i = 0; i < child_count; i++)
         priv->child_latency[i] = -1;
 
+    priv->xattrop_batch = GF_CALLOC(sizeof(*priv->xattrop_batch), child_count,
+                                    gf_afr_mt_xattrop_batch_t);
+    if (!priv->xattrop_batch) {
+        ret = -ENOMEM;
+        goto out;
+    }
+    for (i = 0; i < child_count; i++) {
+        LOCK_INIT(&priv->xattrop_batch[i].lock);
+        INIT_LIST_HEAD(&priv->xattrop_batch[i].queue);
+    }
+    GF_ATOMIC_INIT(priv->xattrops_saved, 0);
+
     priv->children = GF_CALLOC(sizeof(xlator_t *), child_count,
                                gf_afr_mt_xlator_t);
     if (!priv->children) {
@@ -610,6 +643,21 @@ init(xlator_t *this)
     if (ret)
         goto out;
 
+    priv->range_key = GF_CALLOC(sizeof(*priv->range_key), priv->child_count,
+                                gf_afr_mt_char);
+    if (!priv->range_key) {
+        ret = -ENOMEM;
+        goto out;
+    }
+    for (i = 0; i < priv->child_count; i++) {
+        ret = gf_asprintf(&priv->range_key[i], "%s" AFR_RANGES_SUFFIX,
+                          priv->pending_key[i]);
+        if (ret == -1) {
+            ret = -ENOMEM;
+            goto out;
+        }
+    }
+
     trav = this->children;
     i = 0;
     while (i < child_count) {
@@ -787,6 +835,7 @@ struct xlator_fops fops = {
     .fallocate = afr_fallocate,
     .discard = afr_discard,
     .zerofill = afr_zerofill,
+    .copy_file_range = afr_copy_file_range,
     .xattrop = afr_xattrop,
     .fxattrop = afr_fxattrop,
     .fsync = afr_fsync,
@@ -984,8 +1033,24 @@ struct volume_options options[] = {
                     "or empty file exists or if the source file size is "
                     "about the same as page size the entire file will "
                     "be read and written i.e \"full\" algo, "
-                    "otherwise \"diff\" algo is chosen.",
-     .value = {"diff", "full"}},
+                    "otherwise \"diff\" algo is chosen. The \"delta\" "
+                    "algorithm has the bricks record the ranges of the "
+                    "writes which a sink missed and copies only those, "
+                    "falling back to \"diff\" when the record is not "
+                    "complete.",
+     .value = {"diff", "full", "delta"}},
+    {.key = {"data-self-heal-checksum"},
+     .type = GF_OPTION_TYPE_STR,
+     .default_value = "fast",
+     .op_version = {GD_OP_VERSION_11_0},
+     .flags = OPT_FLAG_CLIENT_OPT | OPT_FLAG_SETTABLE | OPT_FLAG_DOC,
+     .tags = {"replicate"},
+     .description = "Checksum the \"diff\" algorithm compares blocks "
+                    "with. \"fast\" uses a 128 bit xxhash when all the "
+                    "bricks support it and are not in FIPS mode, and "
+                    "otherwise falls back to \"strong\", the MD5 or "
+                    "SHA256 (storage.fips-mode-rchecksum) of the bricks.",
+     .value = {"strong", "fast"}},
     {.key = {"data-self-heal-window-size"},
      .type = GF_OPTION_TYPE_INT,
      .min = 1,
@@ -1173,6 +1238,23 @@ struct volume_options options[] = {
                        "post-operation phase of the transaction to "
                        "enhance overlap of adjacent write operations.",
     },
+    {
+        .key = {"changelog-batch-size"},
+        .type = GF_OPTION_TYPE_INT,
+        .min = 1,
+        .max = GF_XATTROP_BATCH_MAX + 1,
+        .default_value = "1",
+        .op_version = {GD_OP_VERSION_11_0},
+        .flags = OPT_FLAG_CLIENT_OPT | OPT_FLAG_SETTABLE | OPT_FLAG_DOC |
+                 OPT_FLAG_RANGE,
+        .tags = {"replicate"},
+        .description = "Maximum number of pre-op/post-op xattrops of "
+                       "different files which are sent to a brick as a "
+                       "single request. Xattrops issued while another one "
+                       "is on the wire to that brick wait for it and are "
+                       "then sent together. 1 sends each of them on its "
+                       "own.",
+    },
     {
         .key = {"self-heal-readdir-size"},
         .type = GF_OPTION_TYPE_SIZET,
@@ -1275,6 +1357,21 @@ struct volume_options options[] = {
         .description = "This option can be used to control number of heals"
                        " that can wait in SHD per subvolume.",
     },
+    {
+        .key = {"shd-crawl-threads"},
+        .type = GF_OPTION_TYPE_INT,
+        .min = 1,
+        .max = 16,
+        .default_value = "1",
+        .op_version = {GD_OP_VERSION_11_0},
+        .flags = OPT_FLAG_CLIENT_OPT | OPT_FLAG_SETTABLE | OPT_FLAG_DOC |
+                 OPT_FLAG_RANGE,
+        .tags = {"replicate"},
+        .description = "Number of threads crawling the index of a brick in "
+                       "SHD. Each of them reads the entries of a disjoint "
+                       "set of gfids and heals them with its share of "
+                       "shd-max-threads.",
+    },
     {
         .key = {"locking-scheme"},
         .type = GF_OPTION_TYPE_STR,
@@ -126,6 +126,7 @@ typedef enum {
     AFR_SELFHEAL_DATA_FULL = 0,
     AFR_SELFHEAL_DATA_DIFF,
     AFR_SELFHEAL_DATA_DYNAMIC,
+    AFR_SELFHEAL_DATA_DELTA,
 } afr_data_self_heal_type_t;
 
 typedef enum {
@@ -165,6 +166,14 @@ typedef struct _afr_lk_heal_info {
     int32_t *child_down_event_gen;
 } afr_lk_heal_info_t;
 
+/* Changelog xattrops for one child which wait for the one on the wire to
+ * come back, they are then sent together as a single xattrop. */
+typedef struct _afr_xattrop_batch {
+    gf_lock_t lock;
+    struct list_head queue;
+    gf_boolean_t busy;
+} afr_xattrop_batch_t;
+
 typedef struct _afr_private {
     gf_lock_t lock;             /* to guard access to child_count, etc */
     unsigned int child_count;   /* total number of children   */
@@ -192,8 +201,10 @@ typedef struct _afr_private {
     unsigned char *local;
 
     char **pending_key;
+    char **range_key; /* range map of the writes each child missed */
 
     afr_data_self_heal_type_t data_self_heal_algorithm;
+    gf_boolean_t fast_rchecksum; /* data-self-heal-checksum is fast */
     unsigned int data_self_heal_window_size; /* max number of pipelined
                                                 read/writes */
 
@@ -226,6 +237,9 @@ typedef struct _afr_private {
     gf_boolean_t eager_lock;
     gf_boolean_t pre_op_compat; /* on/off */
     uint32_t post_op_delay_secs;
+    uint32_t changelog_batch_size; /* max xattrops sent as one */
+    afr_xattrop_batch_t *xattrop_batch;
+    gf_atomic_t xattrops_saved;
     unsigned int quorum_count;
 
     off_t ta_notify_dom_lock_offset;
@@ -372,6 +386,7 @@ struct afr_reply {
     uint8_t checksum[SHA256_DIGEST_LENGTH];
     gf_boolean_t buf_has_zeroes;
     gf_boolean_t fips_mode_rchecksum;
+    char checksum_algo[16]; /* of the fast checksum, empty if not one */
     /* For lookup */
     int8_t need_heal;
 };
@@ -738,6 +753,15 @@ typedef struct _afr_local {
             off_t len;
         } zerofill;
 
+        struct {
+            fd_t *fd_in;
+            off64_t off_in;
+            off64_t off_out;
+            size_t len;
+            uint32_t flags;
+            struct iatt stbuf;
+        } copy_file_range;
+
         struct {
             char *volume;
             int32_t cmd;
@@ -889,6 +913,10 @@ typedef struct _afr_local {
     struct list_head healer;
     call_frame_t *heal_frame;
 
+    /* Data copied by a data self-heal, reported by the shd statistics. */
+    uint64_t healed_bytes;
+    uint64_t heal_usecs;
+
     afr_inode_ctx_t *inode_ctx;
 
     /*For thin-arbiter transactions.*/
@@ -14,6 +14,7 @@
 #include "dht-common.h"
 #include "dht-lock.h"
 #include <glusterfs/quota-common-utils.h>
+#include <glusterfs/names-filter.h>
 #include <glusterfs/upcall-utils.h>
 #include "glusterfs/compat-errno.h"  // for ENODATA on BSD
 
@@ -321,6 +322,58 @@ out:
     return ret;
 }
 
+/* Each subvolume returns the filter of the names it has in the directory,
+ * the names of the volume are in the union of them. */
+static int
+dht_aggregate_names_filter(dict_t *dst, char *key, data_t *value)
+{
+    gf_names_filter_t *filter = NULL;
+    gf_names_filter_t *src = NULL;
+    data_t *data = NULL;
+    int ret = -1;
+
+    data = dict_get(dst, key);
+    if (!data)
+        return dict_set(dst, key, value);
+
+    filter = gf_names_filter_from_data(data);
+    src = gf_names_filter_from_data(value);
+    if (filter && src && !gf_names_filter_merge(filter, src))
+        ret = gf_names_filter_to_dict(dst, filter);
+
+    /* Can't be merged, better no filter than a wrong one */
+    if (ret)
+        dict_del(dst, key);
+
+    GF_FREE(filter);
+    GF_FREE(src);
+
+    return 0;
+}
+
+/* A filter which misses the names of a subvolume would make its names look
+ * absent, only pass it up when every subvolume contributed to it. */
+static void
+dht_names_filter_check(xlator_t *this, dict_t *xattr)
+{
+    dht_conf_t *conf = this->private;
+    gf_names_filter_t *filter = NULL;
+    data_t *data = NULL;
+
+    if (!xattr)
+        return;
+
+    data = dict_get(xattr, GF_NAMES_FILTER_KEY);
+    if (!data)
+        return;
+
+    filter = gf_names_filter_from_data(data);
+    if (!filter || (gf_names_filter_sources(filter) != conf->subvolume_cnt))
+        dict_del(xattr, GF_NAMES_FILTER_KEY);
+
+    GF_FREE(filter);
+}
+
 static int
 dht_aggregate(dict_t *this, char *key, data_t *value, void *data)
 {
@@ -346,6 +399,9 @@ dht_aggregate(dict_t *this, char *key, data_t *value, void *data)
     } else if (fnmatch(GF_XATTR_STIME_PATTERN, key, FNM_NOESCAPE) == 0) {
         ret = gf_get_min_stime(THIS, dst, key, value);
         goto out;
+    } else if (strcmp(key, GF_NAMES_FILTER_KEY) == 0) {
+        ret = dht_aggregate_names_filter(dst, key, value);
+        goto out;
     } else {
         /* compare user xattrs only */
         if (!strncmp(key, "user.", SLEN("user."))) {
@@ -485,6 +541,7 @@ dht_lookup_selfheal_cbk(call_frame_t *frame, void *cookie, int op_ret,
     dht_set_fixed_dir_stat(&local->postparent);
     /* Delete mds xattr at the time of STACK UNWIND */
     GF_REMOVE_INTERNAL_XATTR(conf->mds_xattr_key, local->xattr);
+    dht_names_filter_check(this, local->xattr);
 
     DHT_STACK_UNWIND(lookup, frame, ret, local->op_errno, local->inode,
                      &local->stbuf, local->xattr, &local->postparent);
@@ -670,6 +727,7 @@ done:
     /* Delete mds xattr at the time of STACK UNWIND */
     if (local->xattr)
         GF_REMOVE_INTERNAL_XATTR(conf->mds_xattr_key, local->xattr);
+    dht_names_filter_check(this, local->xattr);
 
     DHT_STACK_UNWIND(lookup, main_frame, local->op_ret, local->op_errno,
                      local->inode, &local->stbuf, local->xattr,
@@ -1567,6 +1625,7 @@ unlock:
         /* Delete mds xattr at the time of STACK UNWIND */
         if (local->xattr)
             GF_REMOVE_INTERNAL_XATTR(conf->mds_xattr_key, local->xattr);
+        dht_names_filter_check(this, local->xattr);
 
         DHT_STACK_UNWIND(lookup, frame, local->op_ret, local->op_errno,
                          local->inode, &local->stbuf, local->xattr,
@@ -1972,6 +2031,7 @@ unlock:
         /* Delete mds xattr at the time of STACK UNWIND */
         if (local->xattr)
             GF_REMOVE_INTERNAL_XATTR(conf->mds_xattr_key, local->xattr);
+        dht_names_filter_check(this, local->xattr);
 
         DHT_STACK_UNWIND(lookup, frame, local->op_ret, local->op_errno,
                          local->inode, &local->stbuf, local->xattr,
@@ -6696,6 +6756,407 @@ out:
     return;
 }
 
+/* Read-ahead of readdirp on all the subvolumes of a directory.
+ *
+ * Without it, listing a directory waits for one readdirp round trip per
+ * batch of every subvolume, one subvolume after the other. With
+ * readdirp-window set, the readdirp of subvolume 'i' also starts reading
+ * the first batch of the next subvolumes of the window, and each subvolume
+ * being read keeps one batch ahead of the reader.
+ *
+ * The entries are still returned one subvolume after the other, so d_off
+ * keeps its meaning (subvolume and offset in it) and a listing can resume
+ * from any of them. A request for an offset which doesn't match what was
+ * read ahead just drops it and reads again. At most one batch per
+ * subvolume is kept, and only for DHT_READDIR_AHEAD_EXPIRY seconds, so that
+ * the attributes of readdirp are not served stale. */
+
+#define DHT_READDIR_AHEAD_EXPIRY 1
+
+#define DHT_READDIR_MAX_WINDOW 64
+
+typedef struct dht_readdir_slot {
+    gf_dirent_t entries; /* batch read ahead, not consumed yet */
+    xlator_t *xl;
+    call_frame_t *waiter; /* readdirp waiting for the batch in flight */
+    off_t offset;         /* where the batch ready or in flight starts */
+    time_t when;          /* when the ready batch arrived */
+    uint64_t gen;         /* bumped to drop what is in flight */
+    int32_t op_ret;
+    int32_t op_errno;
+    gf_boolean_t started;
+    gf_boolean_t in_flight;
+    gf_boolean_t ready;
+} dht_readdir_slot_t;
+
+struct dht_readdir_stream {
+    gf_lock_t lock;
+    dict_t *xattr; /* of the last readdirp */
+    size_t size;
+    int current; /* subvolume being read */
+    int cnt;
+    dht_readdir_slot_t slots[];
+};
+
+typedef struct dht_readdir_req {
+    struct dht_readdir_stream *stream;
+    dht_readdir_slot_t *slot;
+    fd_t *fd;
+    uint64_t gen;
+    off_t offset;
+} dht_readdir_req_t;
+
+static int
+dht_readdirp_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int op_ret,
+                 int op_errno, gf_dirent_t *orig_entries, dict_t *xdata);
+
+struct dht_readdir_stream *
+dht_readdir_stream_new(xlator_t *this)
+{
+    dht_conf_t *conf = this->private;
+    struct dht_readdir_stream *stream = NULL;
+    int i = 0;
+
+    stream = GF_CALLOC(1,
+                       sizeof(*stream) +
+                           conf->subvolume_cnt * sizeof(stream->slots[0]),
+                       gf_dht_mt_readdir_stream_t);
+    if (!stream)
+        return NULL;
+
+    LOCK_INIT(&stream->lock);
+    stream->current = -1;
+    stream->cnt = conf->subvolume_cnt;
+    for (i = 0; i < stream->cnt; i++) {
+        INIT_LIST_HEAD(&stream->slots[i].entries.list);
+        stream->slots[i].xl = conf->subvolumes[i];
+    }
+
+    return stream;
+}
+
+void
+dht_readdir_stream_destroy(struct dht_readdir_stream *stream)
+{
+    int i = 0;
+
+    for (i = 0; i < stream->cnt; i++)
+        gf_dirent_free(&stream->slots[i].entries);
+
+    if (stream->xattr)
+        dict_unref(stream->xattr);
+
+    LOCK_DESTROY(&stream->lock);
+    GF_FREE(stream);
+}
+
+static void
+__dht_readdir_slot_reset(dht_readdir_slot_t *slot)
+{
+    slot->gen++;
+    gf_dirent_free(&slot->entries);
+    slot->started = _gf_false;
+    slot->in_flight = _gf_false;
+    slot->ready = _gf_false;
+}
+
+static dict_t *
+dht_readdirp_ahead_xattr(xlator_t *this, struct dht_readdir_stream *stream,
+                         xlator_t *xl)
+{
+    dht_conf_t *conf = this->private;
+    dict_t *xattr = NULL;
+
+    LOCK(&stream->lock);
+    {
+        if (stream->xattr)
+            xattr = dict_ref(stream->xattr);
+    }
+    UNLOCK(&stream->lock);
+
+    if (!xattr || !conf->readdir_optimize)
+        return xattr;
+
+    /* Only the first up subvolume lists the directories, and the reader
+     * may be on another subvolume, so don't share its dictionary. */
+    xattr = dict_copy_with_ref(xattr, NULL);
+    if (xattr) {
+        if (xl != dht_first_up_subvol(this))
+            dict_set_int32(xattr, GF_READDIR_SKIP_DIRS, 1);
+        else
+            dict_del(xattr, GF_READDIR_SKIP_DIRS);
+    }
+
+    return xattr;
+}
+
+static int
+dht_readdirp_ahead_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
+                       int op_ret, int op_errno, gf_dirent_t *entries,
+                       dict_t *xdata);
+
+/* Sends the readdirp of 'slot' the stream marked in flight with 'gen'.
+ * 'tmpl' gives the credentials of the request. */
+static void
+dht_readdirp_ahead(call_frame_t *tmpl, xlator_t *this, fd_t *fd,
+                   struct dht_readdir_stream *stream, dht_readdir_slot_t *slot,
+                   uint64_t gen, off_t offset)
+{
+    dht_readdir_req_t *req = NULL;
+    call_frame_t *frame = NULL;
+    call_frame_t *waiter = NULL;
+    dht_local_t *local = NULL;
+    dict_t *xattr = NULL;
+
+    req = GF_MALLOC(sizeof(*req), gf_dht_mt_readdir_req_t);
+    frame = copy_frame(tmpl);
+    if (!req || !frame)
+        goto err;
+
+    req->stream = stream;
+    req->slot = slot;
+    req->fd = fd_ref(fd);
+    req->gen = gen;
+    req->offset = offset;
+
+    xattr = dht_readdirp_ahead_xattr(this, stream, slot->xl);
+
+    STACK_WIND_COOKIE(frame, dht_readdirp_ahead_cbk, req, slot->xl,
+                      slot->xl->fops->readdirp, fd, stream->size, offset,
+                      xattr);
+
+    if (xattr)
+        dict_unref(xattr);
+
+    return;
+
+err:
+    GF_FREE(req);
+    if (frame)
+        STACK_DESTROY(frame->root);
+
+    LOCK(&stream->lock);
+    {
+        if (slot->gen == gen) {
+            waiter = slot->waiter;
+            slot->waiter = NULL;
+            __dht_readdir_slot_reset(slot);
+        }
+    }
+    UNLOCK(&stream->lock);
+
+    if (waiter) {
+        local = waiter->local;
+        STACK_WIND_COOKIE(waiter, dht_readdirp_cbk, slot->xl, slot->xl,
+                          slot->xl->fops->readdirp, local->fd, local->size,
+                          offset, local->xattr);
+    }
+}
+
+static int
+dht_readdirp_ahead_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
+                       int op_ret, int op_errno, gf_dirent_t *entries,
+                       dict_t *xdata)
+{
+    dht_readdir_req_t *req = cookie;
+    struct dht_readdir_stream *stream = req->stream;
+    dht_readdir_slot_t *slot = req->slot;
+    call_frame_t *waiter = NULL;
+    off_t next = 0;
+    uint64_t gen = 0;
+    gf_boolean_t more = _gf_false;
+
+    if (op_ret > 0)
+        next = list_last_entry(&entries->list, gf_dirent_t, list)->d_off;
+
+    LOCK(&stream->lock);
+    {
+        /* The reader went somewhere else meanwhile */
+        if (req->gen != slot->gen)
+            goto unlock;
+
+        slot->in_flight = _gf_false;
+        waiter = slot->waiter;
+        slot->waiter = NULL;
+
+        if (!waiter) {
+            if (op_ret > 0)
+                list_splice_init(&entries->list, &slot->entries.list);
+            slot->op_ret = op_ret;
+            slot->op_errno = op_errno;
+            slot->offset = req->offset;
+            slot->when = gf_time();
+            slot->ready = _gf_true;
+        } else if ((op_ret > 0) && (op_errno != ENOENT) && next) {
+            /* Keep one batch ahead of the reader */
+            slot->in_flight = _gf_true;
+            slot->offset = next;
+            gen = slot->gen;
+            more = _gf_true;
+        }
+    }
+unlock:
+    UNLOCK(&stream->lock);
+
+    if (more)
+        dht_readdirp_ahead(frame, this, req->fd, stream, slot, gen, next);
+
+    if (waiter)
+        dht_readdirp_cbk(waiter, slot->xl, this, op_ret, op_errno, entries,
+                         xdata);
+
+    fd_unref(req->fd);
+    GF_FREE(req);
+    STACK_DESTROY(frame->root);
+
+    return 0;
+}
+
+/* Serves the readdirp of 'frame' on 'xl' at 'offset' from what was read
+ * ahead, or waits for it, or reads it. Called instead of winding the
+ * readdirp when the fd has a stream. */
+static void
+dht_readdirp_fetch(call_frame_t *frame, xlator_t *this, xlator_t *xl,
+                   off_t offset)
+{
+    dht_conf_t *conf = this->private;
+    dht_local_t *local = frame->local;
+    struct dht_readdir_stream *stream = local->readdir_stream;
+    dht_readdir_slot_t *slot = NULL;
+    call_frame_t *tmpl = NULL;
+    gf_dirent_t entries;
+    fd_t *fd = local->fd;
+    int ahead[DHT_READDIR_MAX_WINDOW];
+    uint64_t ahead_gen[DHT_READDIR_MAX_WINDOW];
+    int ahead_cnt = 0;
+    int32_t op_ret = 0;
+    int32_t op_errno = 0;
+    uint64_t gen = 0;
+    off_t next = 0;
+    time_t now = gf_time();
+    int idx = -1;
+    int i = 0;
+    enum {
+        DHT_FETCH_WIND,
+        DHT_FETCH_READY,
+        DHT_FETCH_WAIT,
+        DHT_FETCH_READ,
+    } action = DHT_FETCH_WIND;
+
+    INIT_LIST_HEAD(&entries.list);
+
+    for (i = 0; i < stream->cnt; i++) {
+        if (stream->slots[i].xl == xl) {
+            idx = i;
+            break;
+        }
+    }
+
+    /* The reader may be gone as soon as it is set as a waiter, so the
+     * requests read ahead copy their credentials from a frame of ours. */
+    tmpl = copy_frame(frame);
+    if ((idx < 0) || !tmpl)
+        goto wind;
+
+    LOCK(&stream->lock);
+    {
+        if (stream->xattr != local->xattr) {
+            if (stream->xattr)
+                dict_unref(stream->xattr);
+            stream->xattr = local->xattr ? dict_ref(local->xattr) : NULL;
+        }
+        stream->size = local->size;
+
+        /* Listing again from an earlier subvolume, start over */
+        if (idx < stream->current) {
+            for (i = 0; i < stream->cnt; i++) {
+                if (!stream->slots[i].waiter)
+                    __dht_readdir_slot_reset(&stream->slots[i]);
+            }
+        }
+        stream->current = idx;
+        slot = &stream->slots[idx];
+
+        if (slot->waiter) {
+            /* another reader of the same fd, let it be */
+            action = DHT_FETCH_WIND;
+        } else if (slot->ready && (slot->offset == offset) &&
+                   (now - slot->when <= DHT_READDIR_AHEAD_EXPIRY)) {
+            list_splice_init(&slot->entries.list, &entries.list);
+            op_ret = slot->op_ret;
+            op_errno = slot->op_errno;
+            slot->ready = _gf_false;
+            action = DHT_FETCH_READY;
+
+            if ((op_ret > 0) && (op_errno != ENOENT)) {
+                next = list_last_entry(&entries.list, gf_dirent_t, list)->d_off;
+                if (next) {
+                    slot->in_flight = _gf_true;
+                    slot->offset = next;
+                    gen = slot->gen;
+                }
+            }
+        } else if (slot->in_flight && (slot->offset == offset)) {
+            slot->waiter = frame;
+            action = DHT_FETCH_WAIT;
+        } else {
+            __dht_readdir_slot_reset(slot);
+            slot->in_flight = _gf_true;
+            slot->offset = offset;
+            slot->waiter = frame;
+            gen = slot->gen;
+            action = DHT_FETCH_READ;
+        }
+        slot->started = _gf_true;
+
+        for (i = idx + 1; (i < stream->cnt) &&
+                          (i < idx + conf->readdirp_window) &&
+                          (ahead_cnt < DHT_READDIR_MAX_WINDOW);
+             i++) {
+            if (stream->slots[i].started || !conf->subvolume_status[i])
+                continue;
+            stream->slots[i].started = _gf_true;
+            stream->slots[i].in_flight = _gf_true;
+            stream->slots[i].offset = 0;
+            ahead[ahead_cnt] = i;
+            ahead_gen[ahead_cnt] = stream->slots[i].gen;
+            ahead_cnt++;
+        }
+    }
+    UNLOCK(&stream->lock);
+
+    for (i = 0; i < ahead_cnt; i++) {
+        dht_readdirp_ahead(tmpl, this, fd, stream, &stream->slots[ahead[i]],
+                           ahead_gen[i], 0);
+    }
+
+    switch (action) {
+        case DHT_FETCH_READY:
+            if (next)
+                dht_readdirp_ahead(tmpl, this, fd, stream, slot, gen, next);
+            STACK_DESTROY(tmpl->root);
+            dht_readdirp_cbk(frame, xl, this, op_ret, op_errno, &entries,
+                             NULL);
+            gf_dirent_free(&entries);
+            return;
+        case DHT_FETCH_READ:
+            dht_readdirp_ahead(tmpl, this, fd, stream, slot, gen, offset);
+            /* Fall through. */
+        case DHT_FETCH_WAIT:
+            STACK_DESTROY(tmpl->root);
+            return;
+        case DHT_FETCH_WIND:
+            break;
+    }
+
+wind:
+    if (tmpl)
+        STACK_DESTROY(tmpl->root);
+
+    STACK_WIND_COOKIE(frame, dht_readdirp_cbk, xl, xl, xl->fops->readdirp,
+                      local->fd, local->size, offset, local->xattr);
+}
+
 /* Execute a READDIR request if no other request is in progress. Otherwise
  * queue it to be executed when the current one finishes.
  *
@@ -6766,6 +7227,11 @@ dht_queue_readdirp(call_frame_t *frame, xlator_t *xl, off_t offset,
     /* Check dht_queue_readdir() comments for an explanation of this. */
     if (uatomic_add_return(&local->queue, 1) == 1) {
         do {
+            if (local->readdir_stream) {
+                dht_readdirp_fetch(frame, frame->this, local->queue_xl,
+                                   local->queue_offset);
+                continue;
+            }
             STACK_WIND_COOKIE(frame, cbk, local->queue_xl, local->queue_xl,
                               local->queue_xl->fops->readdirp, local->fd,
                               local->size, local->queue_offset, local->xattr);
@@ -7014,6 +7480,14 @@ done:
      *
      */
 
+    /* The subvolume is read ahead from the last offset it returned, make
+     * sure the next readdirp asks for it even if the last entries were
+     * stripped out. */
+    if (local->readdir_stream && (count > 0) && next_offset) {
+        entry = list_last_entry(&entries.list, gf_dirent_t, list);
+        entry->d_off = next_offset;
+    }
+
     op_ret = count;
     if (count == 0) {
         /* non-zero next_offset means that
@@ -7235,6 +7709,7 @@ dht_do_readdir(call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
     xlator_t *xvol = NULL;
     int ret = 0;
     dht_conf_t *conf = NULL;
+    dht_fd_ctx_t *fd_ctx = NULL;
 
     VALIDATE_OR_GOTO(frame, err);
     VALIDATE_OR_GOTO(this, err);
@@ -7299,6 +7774,14 @@ dht_do_readdir(call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
             }
         }
 
+        if ((conf->readdirp_window > 0) && (conf->subvolume_cnt > 1)) {
+            fd_ctx = dht_fd_ctx_readdir_get(this, fd);
+            if (fd_ctx) {
+                local->readdir_stream = fd_ctx->readdir;
+                GF_REF_PUT(fd_ctx);
+            }
+        }
+
         dht_queue_readdirp(frame, xvol, yoff, dht_readdirp_cbk);
     } else {
         dht_queue_readdir(frame, xvol, yoff, dht_readdir_cbk);
@@ -11432,6 +11915,12 @@ dht_release(xlator_t *this, fd_t *fd)
     return dht_fd_ctx_destroy(this, fd);
 }
 
+int32_t
+dht_releasedir(xlator_t *this, fd_t *fd)
+{
+    return dht_fd_ctx_destroy(this, fd);
+}
+
 static int
 dht_pt_mkdir_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int op_ret,
                  int op_errno, inode_t *inode, struct iatt *stbuf,
@@ -99,6 +99,7 @@ struct dht_layout {
     int type;
     gf_atomic_t ref; /* use with dht_conf_t->layout_lock */
     uint32_t search_unhashed;
+    uint32_t buckets; /* bucket count of a DHT_HASH_TYPE_JUMP layout */
     dht_layout_entry_t list[];
 };
 typedef struct dht_layout dht_layout_t;
@@ -126,8 +127,18 @@ typedef struct dht_inode_ctx dht_inode_ctx_t;
 typedef enum {
     DHT_HASH_TYPE_DM,
     DHT_HASH_TYPE_DM_USER,
+    /* Jump consistent hashing: the name hash picks one of 'buckets'
+     * buckets, and each subvolume owns the run [start, stop) of them. */
+    DHT_HASH_TYPE_JUMP,
 } dht_hashfn_type_t;
 
+/* Upper bound of the bucket count of a jump layout. It only guards against
+ * treating a range layout as a jump one. */
+#define DHT_JUMP_MAX_BUCKETS (1 << 16)
+
+/* Most buckets a single subvolume is given when weighting by size. */
+#define DHT_JUMP_MAX_WEIGHT 64
+
 typedef enum {
     DHT_INODELK,
     DHT_ENTRYLK,
@@ -345,6 +356,9 @@ struct dht_local {
     off_t queue_offset;
     int32_t queue;
 
+    /* readdirp read-ahead of the fd, when enabled */
+    struct dht_readdir_stream *readdir_stream;
+
     int32_t mds_heal_fresh_lookup;
 
     /* inodelks during filerename for backward compatibility */
@@ -437,6 +451,9 @@ struct gf_defrag_info_ {
     uint64_t num_dirs_processed;
     uint64_t size_processed;
     uint64_t total_size;
+    /* Bytes the rebalance is expected to move, estimated before it
+     * starts by comparing the layout of '/' with the one it will get. */
+    uint64_t total_to_move;
     gf_lock_t lock;
     pthread_t th;
     struct rpc_clnt *rpc;
@@ -577,6 +594,10 @@ struct dht_conf {
 
     gf_boolean_t use_readdirp;
 
+    /* Number of subvolumes a readdirp reads at the same time, 0 to read
+     * them one after the other. */
+    uint32_t readdirp_window;
+
     /* Request to filter directory entries in readdir request */
     gf_boolean_t readdir_optimize;
 
@@ -590,6 +611,9 @@ struct dht_conf {
     gf_boolean_t randomize_by_gfid;
 
     gf_boolean_t ensure_durability;
+
+    /* Layout type given to new directories and by fix-layout. */
+    dht_hashfn_type_t layout_type;
 };
 typedef struct dht_conf dht_conf_t;
 
@@ -626,8 +650,12 @@ typedef struct dht_migrate_info {
     GF_REF_DECL;
 } dht_migrate_info_t;
 
+struct dht_readdir_stream;
+
 typedef struct dht_fd_ctx {
     uint64_t opened_on_dst;
+    /* directories: read-ahead of readdirp on all the subvolumes */
+    struct dht_readdir_stream *readdir;
     GF_REF_DECL;
 } dht_fd_ctx_t;
 
@@ -786,6 +814,8 @@ dht_subvol_cnt(xlator_t *this, xlator_t *subvol);
 
 int
 dht_hash_compute(xlator_t *this, int type, const char *name, uint32_t *hash_p);
+uint32_t
+dht_jump_hash(uint32_t hash, uint32_t buckets);
 
 int
 dht_linkfile_create(call_frame_t *frame, fop_mknod_cbk_t linkfile_cbk,
@@ -1041,6 +1071,10 @@ int32_t
 dht_discard(call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
             size_t len, dict_t *xdata);
 int32_t
+dht_copy_file_range(call_frame_t *frame, xlator_t *this, fd_t *fd_in,
+                    off64_t off_in, fd_t *fd_out, off64_t off_out, size_t len,
+                    uint32_t flags, dict_t *xdata);
+int32_t
 dht_zerofill(call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
              off_t len, dict_t *xdata);
 int32_t
@@ -1166,6 +1200,12 @@ dht_log_new_layout_for_dir_selfheal(xlator_t *this, loc_t *loc,
 void
 dht_layout_sort(dht_layout_t *layout);
 
+double
+dht_layout_moved_fraction(dht_layout_t *old, dht_layout_t *new);
+
+dht_layout_t *
+dht_layout_fix_compute(xlator_t *this, loc_t *loc, dht_layout_t *layout);
+
 int
 dht_heal_full_path(void *data);
 
@@ -1198,6 +1238,18 @@ dht_fd_ctx_destroy(xlator_t *this, fd_t *fd);
 int32_t
 dht_release(xlator_t *this, fd_t *fd);
 
+int32_t
+dht_releasedir(xlator_t *this, fd_t *fd);
+
+struct dht_readdir_stream *
+dht_readdir_stream_new(xlator_t *this);
+
+void
+dht_readdir_stream_destroy(struct dht_readdir_stream *stream);
+
+dht_fd_ctx_t *
+dht_fd_ctx_readdir_get(xlator_t *this, fd_t *fd);
+
 int32_t
 dht_set_fixed_dir_stat(struct iatt *stat);
 
@@ -1245,6 +1297,12 @@ dht_fallocate_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int op_ret,
                   int op_errno, struct iatt *prebuf, struct iatt *postbuf,
                   dict_t *xdata);
 
+int
+dht_copy_file_range_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
+                        int op_ret, int op_errno, struct iatt *stbuf,
+                        struct iatt *prebuf_dst, struct iatt *postbuf_dst,
+                        dict_t *xdata);
+
 int
 dht_truncate_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int op_ret,
                  int op_errno, struct iatt *prebuf, struct iatt *postbuf,
@@ -21,6 +21,7 @@ dht_hash_compute_internal(int type, const char *name, const int len,
     switch (type) {
         case DHT_HASH_TYPE_DM:
         case DHT_HASH_TYPE_DM_USER:
+        case DHT_HASH_TYPE_JUMP:
             hash = gf_dm_hashfn(name, len);
             break;
         default:
@@ -35,6 +36,26 @@ dht_hash_compute_internal(int type, const char *name, const int len,
     return ret;
 }
 
+/* Jump consistent hash (Lamping & Veach). Maps 'hash' to a bucket in
+ * [0, buckets) in O(log(buckets)) steps. When the bucket count grows from
+ * n to n + 1, only 1/(n + 1) of the keys change bucket, and all of them go
+ * to the new one. */
+uint32_t
+dht_jump_hash(uint32_t hash, uint32_t buckets)
+{
+    uint64_t key = ((uint64_t)hash << 32) | hash;
+    int64_t b = -1;
+    int64_t j = 0;
+
+    while (j < buckets) {
+        b = j;
+        key = key * 2862933555777941757ULL + 1;
+        j = (b + 1) * ((double)(1LL << 31) / (double)((key >> 33) + 1));
+    }
+
+    return (b < 0) ? 0 : b;
+}
+
 /* The function returns:
  * 0  : in case no munge took place
  * >0 : the length (inc. terminating NULL!) of the newly modified string,
@@ -15,6 +15,8 @@
 static void
 dht_free_fd_ctx(dht_fd_ctx_t *fd_ctx)
 {
+    if (fd_ctx->readdir)
+        dht_readdir_stream_destroy(fd_ctx->readdir);
     GF_FREE(fd_ctx);
 }
 
@@ -125,6 +127,47 @@ out:
     return fd_ctx;
 }
 
+/* Returns a ref on the context of a directory fd, with its readdirp
+ * stream, creating both when needed. */
+dht_fd_ctx_t *
+dht_fd_ctx_readdir_get(xlator_t *this, fd_t *fd)
+{
+    dht_fd_ctx_t *fd_ctx = NULL;
+    int ret = -1;
+
+    LOCK(&fd->lock);
+    {
+        fd_ctx = __fd_ctx_get_ptr(fd, this);
+        if (!fd_ctx) {
+            fd_ctx = GF_CALLOC(1, sizeof(*fd_ctx), gf_dht_mt_fd_ctx_t);
+            if (!fd_ctx)
+                goto unlock;
+            GF_REF_INIT(fd_ctx, dht_free_fd_ctx);
+
+            ret = __fd_ctx_set(fd, this, (uint64_t)(uintptr_t)fd_ctx);
+            if (ret < 0) {
+                GF_REF_PUT(fd_ctx);
+                fd_ctx = NULL;
+                goto unlock;
+            }
+        }
+
+        if (!fd_ctx->readdir) {
+            fd_ctx->readdir = dht_readdir_stream_new(this);
+            if (!fd_ctx->readdir) {
+                fd_ctx = NULL;
+                goto unlock;
+            }
+        }
+
+        GF_REF_GET(fd_ctx);
+    }
+unlock:
+    UNLOCK(&fd->lock);
+
+    return fd_ctx;
+}
+
 gf_boolean_t
 dht_fd_open_on_dst(xlator_t *this, fd_t *fd, xlator_t *dst)
 {
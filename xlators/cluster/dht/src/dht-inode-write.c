@@ -1407,3 +1407,114 @@ err:
 
     return 0;
 }
+
+int
+dht_copy_file_range_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
+                        int op_ret, int op_errno, struct iatt *stbuf,
+                        struct iatt *prebuf_dst, struct iatt *postbuf_dst,
+                        dict_t *xdata)
+{
+    xlator_t *prev = NULL;
+
+    GF_VALIDATE_OR_GOTO("dht", frame, err);
+    GF_VALIDATE_OR_GOTO("dht", cookie, out);
+
+    prev = cookie;
+
+    if (op_ret == -1) {
+        gf_msg_debug(this->name, op_errno, "subvolume %s returned -1",
+                     prev->name);
+
+        /* The fd may not be open on the subvolume the file was migrated
+         * to, or the file may have been moved away altogether. Let the
+         * caller fall back to read/write, which handles migration. */
+        if ((op_errno == EBADF) || dht_inode_missing(op_errno))
+            op_errno = EXDEV;
+        goto out;
+    }
+
+    /* A copy only lands on the cached subvolume. If either file is being
+     * migrated the data may not reach the new location, so report EXDEV.
+     * Rewriting the same range through writev is idempotent and goes
+     * through the regular migration checks. */
+    if (IS_DHT_MIGRATION_PHASE1(postbuf_dst) ||
+        IS_DHT_MIGRATION_PHASE2(postbuf_dst) || IS_DHT_MIGRATION_PHASE2(stbuf)) {
+        gf_msg_debug(this->name, 0,
+                     "copy_file_range on %s raced with file migration",
+                     prev->name);
+        op_ret = -1;
+        op_errno = EXDEV;
+        goto out;
+    }
+
+out:
+    DHT_STRIP_PHASE1_FLAGS(stbuf);
+    DHT_STRIP_PHASE1_FLAGS(prebuf_dst);
+    DHT_STRIP_PHASE1_FLAGS(postbuf_dst);
+
+    DHT_STACK_UNWIND(copy_file_range, frame, op_ret, op_errno, stbuf,
+                     prebuf_dst, postbuf_dst, xdata);
+err:
+    return 0;
+}
+
+int
+dht_copy_file_range(call_frame_t *frame, xlator_t *this, fd_t *fd_in,
+                    off64_t off_in, fd_t *fd_out, off64_t off_out, size_t len,
+                    uint32_t flags, dict_t *xdata)
+{
+    xlator_t *subvol = NULL;
+    xlator_t *dst_subvol = NULL;
+    int op_errno = -1;
+    dht_local_t *local = NULL;
+
+    VALIDATE_OR_GOTO(frame, err);
+    VALIDATE_OR_GOTO(this, err);
+    VALIDATE_OR_GOTO(fd_in, err);
+    VALIDATE_OR_GOTO(fd_out, err);
+
+    local = dht_local_init(frame, NULL, fd_out, GF_FOP_COPY_FILE_RANGE);
+    if (!local) {
+        op_errno = ENOMEM;
+        goto err;
+    }
+
+    dst_subvol = local->cached_subvol;
+    if (!dst_subvol) {
+        gf_msg_debug(this->name, 0, "no cached subvolume for fd=%p", fd_out);
+        op_errno = EINVAL;
+        goto err;
+    }
+
+    subvol = dht_subvol_get_cached(this, fd_in->inode);
+    if (!subvol) {
+        gf_msg_debug(this->name, 0, "no cached subvolume for fd=%p", fd_in);
+        op_errno = EINVAL;
+        goto err;
+    }
+
+    /* The copy can only be offloaded when both files live on the same
+     * subvolume. Otherwise EXDEV tells the caller to copy the data
+     * itself. */
+    if (subvol != dst_subvol) {
+        gf_msg_debug(this->name, 0,
+                     "source (%s) and destination (%s) are on different "
+                     "subvolumes",
+                     subvol->name, dst_subvol->name);
+        op_errno = EXDEV;
+        goto err;
+    }
+
+    STACK_WIND_COOKIE(frame, dht_copy_file_range_cbk, subvol, subvol,
+                      subvol->fops->copy_file_range, fd_in, off_in, fd_out,
+                      off_out, len, flags, xdata);
+
+    return 0;
+
+err:
+    op_errno = (op_errno == -1) ? errno : op_errno;
+    DHT_STACK_UNWIND(copy_file_range, frame, -1, op_errno, NULL, NULL, NULL,
+                     NULL);
+
+    return 0;
+}
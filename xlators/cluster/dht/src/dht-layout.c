@@ -102,6 +102,52 @@ dht_layout_ref(dht_layout_t *layout)
     return layout;
 }
 
+static gf_boolean_t
+dht_layout_entry_has(dht_layout_t *layout, int i, uint32_t point)
+{
+    /* Jump layouts own the buckets [start, stop), range layouts own the
+     * hashes [start, stop]. */
+    if (layout->type == DHT_HASH_TYPE_JUMP) {
+        return (layout->list[i].start <= point) &&
+               (point < layout->list[i].stop);
+    }
+
+    return (layout->list[i].start <= point) && (point <= layout->list[i].stop);
+}
+
+/* Layouts are sorted by start once normalized, so look for the last entry
+ * starting at or before 'point' first, and fall back to a linear scan for
+ * the layouts which are in some other order. */
+static int
+dht_layout_entry_search(dht_layout_t *layout, uint32_t point)
+{
+    int low = 0;
+    int high = layout->cnt - 1;
+    int mid = 0;
+    int i = 0;
+
+    while (low < high) {
+        mid = low + (high - low + 1) / 2;
+        if (layout->list[mid].start <= point) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+
+    if ((layout->cnt > 0) && dht_layout_entry_has(layout, low, point)) {
+        return low;
+    }
+
+    for (i = 0; i < layout->cnt; i++) {
+        if (dht_layout_entry_has(layout, i, point)) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
 xlator_t *
 dht_layout_search(xlator_t *this, dht_layout_t *layout, const char *name)
 {
@@ -117,11 +163,16 @@ dht_layout_search(xlator_t *this, dht_layout_t *layout, const char *name)
         goto out;
     }
 
-    for (i = 0; i < layout->cnt; i++) {
-        if (layout->list[i].start <= hash && layout->list[i].stop >= hash) {
-            subvol = layout->list[i].xlator;
-            break;
+    if (layout->type == DHT_HASH_TYPE_JUMP) {
+        if (!layout->buckets) {
+            goto out;
         }
+        hash = dht_jump_hash(hash, layout->buckets);
+    }
+
+    i = dht_layout_entry_search(layout, hash);
+    if (i >= 0) {
+        subvol = layout->list[i].xlator;
     }
 
     if (!subvol) {
@@ -263,6 +314,11 @@ dht_disk_layout_merge(xlator_t *this, dht_layout_t *layout, int pos,
             /* Fall through. */
         case DHT_HASH_TYPE_DM:
             break;
+        case DHT_HASH_TYPE_JUMP:
+            if (layout->type != DHT_HASH_TYPE_DM_USER) {
+                layout->type = type;
+            }
+            break;
         default:
             gf_smsg(this->name, GF_LOG_CRITICAL, 0, DHT_MSG_INVALID_DISK_LAYOUT,
                     "layout=%d", disk_layout[1], NULL);
@@ -277,6 +333,10 @@ dht_disk_layout_merge(xlator_t *this, dht_layout_t *layout, int pos,
     layout->list[pos].start = start_off;
     layout->list[pos].stop = stop_off;
 
+    if ((type == DHT_HASH_TYPE_JUMP) && (stop_off > layout->buckets)) {
+        layout->buckets = stop_off;
+    }
+
     gf_msg_trace(this->name, 0,
                  "merged to layout: 0x%x - 0x%x (hash 0x%x, type %d) from %s",
                  start_off, stop_off, commit_hash, type,
@@ -419,6 +479,100 @@ dht_layout_sort_volname(dht_layout_t *layout)
           dht_layout_entry_cmp_volname);
 }
 
+/* Share of the names of a directory that entry i of layout hashes to. */
+static double
+dht_layout_entry_share(dht_layout_t *layout, int i)
+{
+    dht_layout_entry_t *entry = &layout->list[i];
+
+    if (layout->type == DHT_HASH_TYPE_JUMP) {
+        if (!layout->buckets || (entry->start >= entry->stop))
+            return 0;
+        return (double)(entry->stop - entry->start) / layout->buckets;
+    }
+
+    if (entry->start >= entry->stop)
+        return 0;
+
+    return ((double)entry->stop - entry->start + 1) / 4294967296.0;
+}
+
+static double
+dht_overlap_share(uint64_t start1, uint64_t stop1, uint64_t start2,
+                  uint64_t stop2)
+{
+    uint64_t start = max(start1, start2);
+    uint64_t stop = min(stop1, stop2);
+
+    return (stop > start) ? (double)(stop - start) : 0;
+}
+
+/* Fraction of the names of a directory that change subvolume when its
+ * layout goes from 'old' to 'new'. It is exact when both layouts are of the
+ * same type, and it assumes the two hashes are independent otherwise. */
+double
+dht_layout_moved_fraction(dht_layout_t *old, dht_layout_t *new)
+{
+    dht_layout_t *small = NULL;
+    dht_layout_t *large = NULL;
+    dht_layout_entry_t *o = NULL;
+    dht_layout_entry_t *n = NULL;
+    double kept = 0;
+    uint32_t m = 0;
+    uint32_t M = 0;
+    int i = 0;
+    int j = 0;
+
+    if ((old->type == DHT_HASH_TYPE_JUMP) &&
+        (new->type == DHT_HASH_TYPE_JUMP)) {
+        small = (old->buckets <= new->buckets) ? old : new;
+        large = (small == old) ? new : old;
+        m = small->buckets;
+        M = large->buckets;
+        if (!m)
+            return 1;
+    }
+
+    for (i = 0; i < new->cnt; i++) {
+        for (j = 0; j < old->cnt; j++) {
+            if (old->list[j].xlator == new->list[i].xlator)
+                break;
+        }
+        if (j == old->cnt)
+            continue;
+
+        o = &old->list[j];
+        n = &new->list[i];
+
+        if (M) {
+            /* A name hashes to the same bucket with both counts when that
+             * bucket is below the smaller count. The names in the buckets
+             * above it come from any of the buckets of the smaller layout
+             * with the same probability. */
+            kept += dht_overlap_share(max(o->start, n->start),
+                                      min(o->stop, n->stop), 0, m);
+            kept += dht_overlap_share((small == old) ? n->start : o->start,
+                                      (small == old) ? n->stop : o->stop, m,
+                                      M) *
+                    dht_layout_entry_share(small, (small == old) ? j : i);
+        } else if ((old->type != DHT_HASH_TYPE_JUMP) &&
+                   (new->type != DHT_HASH_TYPE_JUMP)) {
+            if ((o->start < o->stop) && (n->start < n->stop))
+                kept += dht_overlap_share(o->start, (uint64_t)o->stop + 1,
+                                          n->start, (uint64_t)n->stop + 1) /
+                        4294967296.0;
+        } else {
+            kept += dht_layout_entry_share(old, j) *
+                    dht_layout_entry_share(new, i);
+        }
+    }
+
+    if (M)
+        kept /= M;
+
+    return (kept >= 1) ? 0 : 1 - kept;
+}
+
 void
 dht_layout_anomalies(xlator_t *this, loc_t *loc, dht_layout_t *layout,
                      uint32_t *holes_p, uint32_t *overlaps_p,
@@ -453,6 +607,12 @@ dht_layout_anomalies(xlator_t *this, loc_t *loc, dht_layout_t *layout,
     last_stop = layout->list[0].start - 1;
     prev_stop = last_stop;
 
+    /* The bucket runs of a jump layout are [start, stop) and have to cover
+       [0, buckets) without wrapping around. Keep prev_stop as the last
+       bucket of the previous run so that the checks below apply as is. */
+    if (layout->type == DHT_HASH_TYPE_JUMP)
+        prev_stop = -1;
+
     for (i = 0; i < layout->cnt; i++) {
         switch (layout->list[i].err) {
             case -1:
@@ -482,6 +642,11 @@ dht_layout_anomalies(xlator_t *this, loc_t *loc, dht_layout_t *layout,
 
         is_virgin = 0;
 
+        if ((layout->type == DHT_HASH_TYPE_JUMP) &&
+            (layout->list[i].start > layout->list[i].stop)) {
+            overlap_cnt++;
+        }
+
         if ((prev_stop + 1) < layout->list[i].start) {
             hole_cnt++;
         }
@@ -490,10 +655,18 @@ dht_layout_anomalies(xlator_t *this, loc_t *loc, dht_layout_t *layout,
             overlap_cnt++;
         }
         prev_stop = layout->list[i].stop;
+        if (layout->type == DHT_HASH_TYPE_JUMP)
+            prev_stop--;
     }
 
-    if ((last_stop - prev_stop) || is_virgin)
+    if (layout->type == DHT_HASH_TYPE_JUMP) {
+        if (is_virgin)
+            hole_cnt++;
+        else if (prev_stop >= DHT_JUMP_MAX_BUCKETS)
+            overlap_cnt++;
+    } else if ((last_stop - prev_stop) || is_virgin) {
         hole_cnt++;
+    }
 
     if (holes_p)
         *holes_p = hole_cnt;
@@ -33,6 +33,8 @@ enum gf_dht_mem_types_ {
     gf_dht_mt_fd_ctx_t,
     gf_dht_ret_cache_t,
     gf_dht_nodeuuids_t,
+    gf_dht_mt_readdir_stream_t,
+    gf_dht_mt_readdir_req_t,
     gf_dht_mt_end
 };
 #endif
@@ -4060,6 +4060,51 @@ gf_defrag_estimates_cleanup(xlator_t *this, gf_defrag_info_t *defrag,
     return ret;
 }
 
+/* Estimates how much of the data the rebalance will move, assuming that
+ * all the directories change like '/' will. */
+static void
+gf_defrag_estimate_data_to_move(xlator_t *this, gf_defrag_info_t *defrag,
+                                loc_t *loc)
+{
+    dht_layout_t *layout = NULL;
+    dht_layout_t *old = NULL;
+    dht_layout_t *new = NULL;
+    double fraction = 0;
+
+    layout = dht_layout_get(this, loc->inode);
+    if (!layout || (layout->type == DHT_HASH_TYPE_DM_USER))
+        goto out;
+
+    /* Computing the new layout sorts the old one */
+    old = dht_layout_new(this, layout->cnt);
+    if (!old)
+        goto out;
+    old->type = layout->type;
+    old->buckets = layout->buckets;
+    old->commit_hash = layout->commit_hash;
+    memcpy(old->list, layout->list, layout->cnt * sizeof(layout->list[0]));
+
+    new = dht_layout_fix_compute(this, loc, old);
+    if (!new)
+        goto out;
+
+    fraction = dht_layout_moved_fraction(old, new);
+    defrag->total_to_move = defrag->total_size * fraction;
+
+    gf_msg(this->name, GF_LOG_INFO, 0, 0,
+           "Rebalance is expected to move %" PRIu64 " of %" PRIu64
+           " bytes (%.1f%%, %s layout)",
+           defrag->total_to_move, defrag->total_size, fraction * 100,
+           (new->type == DHT_HASH_TYPE_JUMP) ? "jump" : "range");
+out:
+    if (new)
+        dht_layout_unref(new);
+    if (old)
+        dht_layout_unref(old);
+    if (layout)
+        dht_layout_unref(layout);
+}
+
 int
 gf_defrag_estimates_init(xlator_t *this, loc_t *loc, pthread_t *filecnt_thread)
 {
@@ -4079,6 +4124,8 @@ gf_defrag_estimates_init(xlator_t *this, loc_t *loc, pthread_t *filecnt_thread)
         goto out;
     }
 
+    gf_defrag_estimate_data_to_move(this, defrag, loc);
+
     ret = gf_thread_create(filecnt_thread, NULL, dht_file_counter_thread,
                            (void *)defrag, "dhtfcnt");
 
@@ -4489,6 +4536,13 @@ gf_defrag_get_estimates_based_on_size(dht_conf_t *conf)
     if (!defrag->total_size)
         goto out;
 
+    if (defrag->total_to_move) {
+        gf_msg(THIS->name, GF_LOG_INFO, 0, 0,
+               "Rebalance expects to move %" PRIu64 " bytes, %" PRIu64
+               " bytes moved so far",
+               defrag->total_to_move, defrag->total_data);
+    }
+
     elapsed = gf_time() - defrag->start_time;
 
     /* Don't calculate the estimates for the first 10 minutes.
@@ -24,6 +24,20 @@
                      layout->list[i].xlator->name, path);                      \
     } while (0)
 
+#define DHT_SET_LAYOUT_BUCKETS(layout, i, srt, count, path)                    \
+    do {                                                                       \
+        layout->list[i].start = srt;                                           \
+        layout->list[i].stop = srt + count;                                    \
+        layout->list[i].commit_hash = layout->commit_hash;                     \
+                                                                               \
+        gf_msg_trace(this->name, 0,                                            \
+                     "gave buckets: [%u, %u), with commit-hash 0x%x"           \
+                     " on %s for %s",                                          \
+                     layout->list[i].start, layout->list[i].stop,              \
+                     layout->list[i].commit_hash,                              \
+                     layout->list[i].xlator->name, path);                      \
+    } while (0)
+
 #define DHT_RESET_LAYOUT_RANGE(layout)                                         \
     do {                                                                       \
         int cnt = 0;                                                           \
@@ -490,6 +504,11 @@ dht_should_fix_layout(call_frame_t *frame, dht_layout_t **inmem,
     if ((*inmem)->commit_hash != (*ondisk)->commit_hash)
         goto out;
 
+    /* Same when the directory has to change to the configured layout type */
+    if (((*ondisk)->type != DHT_HASH_TYPE_DM_USER) &&
+        ((*ondisk)->type != conf->layout_type))
+        goto out;
+
     layout_span = dht_layout_span(*ondisk);
 
     decommissioned_bricks = dht_decommissioned_bricks_in_layout(frame->this,
@@ -1520,6 +1539,13 @@ void
 dht_selfheal_layout_new_directory(call_frame_t *frame, loc_t *loc,
                                   dht_layout_t *new_layout);
 
+static void
+dht_selfheal_layout_assign(xlator_t *this, loc_t *loc, dht_layout_t *layout);
+
+static void
+dht_selfheal_layout_jump(xlator_t *this, loc_t *loc, dht_layout_t *layout,
+                         dht_layout_t *old);
+
 void
 dht_layout_range_swap(dht_layout_t *layout, int i, int j);
 
@@ -1530,8 +1556,7 @@ dht_layout_range_swap(dht_layout_t *layout, int i, int j);
 #define OV_ENTRY(x, y) table[x * new->cnt + y]
 
 static void
-dht_selfheal_layout_maximize_overlap(call_frame_t *frame, loc_t *loc,
-                                     dht_layout_t *new, dht_layout_t *old)
+dht_selfheal_layout_maximize_overlap(dht_layout_t *new, dht_layout_t *old)
 {
     int i = 0;
     int j = 0;
@@ -1606,46 +1631,25 @@ dht_selfheal_layout_maximize_overlap(call_frame_t *frame, loc_t *loc,
     }
 }
 
-static dht_layout_t *
-dht_fix_layout_of_directory(call_frame_t *frame, loc_t *loc,
-                            dht_layout_t *layout)
+/* Computes the layout fix-layout gives to a directory which has 'layout'
+ * now. It doesn't need a frame, so the rebalance can also use it to
+ * estimate how much data will move. */
+dht_layout_t *
+dht_layout_fix_compute(xlator_t *this, loc_t *loc, dht_layout_t *layout)
 {
     int i = 0;
-    xlator_t *this = NULL;
     dht_layout_t *new_layout = NULL;
     dht_conf_t *priv = NULL;
-    dht_local_t *local = NULL;
-    uint32_t subvol_down = 0;
     gf_boolean_t maximize_overlap = _gf_true;
     char gfid[GF_UUID_BUF_SIZE] = {0};
 
-    this = frame->this;
     priv = this->private;
-    local = frame->local;
-
-    if (layout->type == DHT_HASH_TYPE_DM_USER) {
-        gf_msg_debug(THIS->name, 0, "leaving %s alone", loc->path);
-        goto done;
-    }
 
     new_layout = dht_layout_new(this, priv->subvolume_cnt);
     if (!new_layout) {
         gf_uuid_unparse(loc->gfid, gfid);
         gf_smsg(this->name, GF_LOG_ERROR, ENOMEM, DHT_MSG_MEM_ALLOC_FAILED,
                 "new_layout, path=%s", loc->path, "gfid=%s", gfid, NULL);
-        goto done;
-    }
-
-    /* If a subvolume is down, do not re-write the layout. */
-    dht_layout_anomalies(this, loc, layout, NULL, NULL, NULL, &subvol_down,
-                         NULL, NULL);
-
-    if (subvol_down) {
-        gf_uuid_unparse(loc->gfid, gfid);
-        gf_smsg(this->name, GF_LOG_WARNING, 0, DHT_MSG_LAYOUT_FIX_FAILED,
-                "subvol-down=%u", subvol_down, "Skipping-fix-layout", "path=%s",
-                loc->path, "gfid=%s", gfid, NULL);
-        GF_FREE(new_layout);
         return NULL;
     }
 
@@ -1681,19 +1685,67 @@ dht_fix_layout_of_directory(call_frame_t *frame, loc_t *loc,
                 NULL);
     }
 
+    dht_layout_sort_volname(new_layout);
+
+    /* A jump layout keeps its buckets and only appends new ones, which
+       already moves as little as possible */
+    if ((priv->layout_type == DHT_HASH_TYPE_JUMP) &&
+        (layout->type == DHT_HASH_TYPE_JUMP)) {
+        dht_selfheal_layout_jump(this, loc, new_layout, layout);
+        return new_layout;
+    }
+
     /* First give it a layout as though it is a new directory. This
        ensures rotation to kick in */
-    dht_layout_sort_volname(new_layout);
-    dht_selfheal_layout_new_directory(frame, loc, new_layout);
+    dht_selfheal_layout_assign(this, loc, new_layout);
 
     /* Maximize overlap if weighted-rebalance is disabled */
     if (!priv->do_weighting)
         maximize_overlap = _gf_true;
 
+    /* Overlaps mean nothing between layouts of different types */
+    if (layout->type != new_layout->type)
+        maximize_overlap = _gf_false;
+
     /* Now selectively re-assign ranges only when it helps */
     if (maximize_overlap) {
-        dht_selfheal_layout_maximize_overlap(frame, loc, new_layout, layout);
+        dht_selfheal_layout_maximize_overlap(new_layout, layout);
+    }
+
+    return new_layout;
+}
+
+static dht_layout_t *
+dht_fix_layout_of_directory(call_frame_t *frame, loc_t *loc,
+                            dht_layout_t *layout)
+{
+    xlator_t *this = NULL;
+    dht_layout_t *new_layout = NULL;
+    dht_local_t *local = NULL;
+    uint32_t subvol_down = 0;
+    char gfid[GF_UUID_BUF_SIZE] = {0};
+
+    this = frame->this;
+    local = frame->local;
+
+    if (layout->type == DHT_HASH_TYPE_DM_USER) {
+        gf_msg_debug(THIS->name, 0, "leaving %s alone", loc->path);
+        goto done;
+    }
+
+    /* If a subvolume is down, do not re-write the layout. */
+    dht_layout_anomalies(this, loc, layout, NULL, NULL, NULL, &subvol_down,
+                         NULL, NULL);
+
+    if (subvol_down) {
+        gf_uuid_unparse(loc->gfid, gfid);
+        gf_smsg(this->name, GF_LOG_WARNING, 0, DHT_MSG_LAYOUT_FIX_FAILED,
+                "subvol-down=%u", subvol_down, "Skipping-fix-layout", "path=%s",
+                loc->path, "gfid=%s", gfid, NULL);
+        return NULL;
     }
+
+    new_layout = dht_layout_fix_compute(this, loc, layout);
 done:
     if (new_layout) {
         /* Make sure the extra 'ref' for existing layout is removed */
@@ -1730,11 +1782,157 @@ dht_get_chunks_from_xl(xlator_t *parent, xlator_t *child)
     return 0;
 }
 
+/* Number of buckets of a subvolume, 'unit' being the chunks of a bucket,
+ * or 0 when not weighting by size. */
+static uint32_t
+dht_selfheal_layout_jump_weight(xlator_t *this, xlator_t *subvol, double unit)
+{
+    uint32_t chunks = 0;
+    double weight = 0;
+
+    if (!unit)
+        return 1;
+
+    chunks = dht_get_chunks_from_xl(this, subvol);
+    weight = chunks / unit + 0.5;
+
+    if (weight < 1)
+        return 1;
+    if (weight > DHT_JUMP_MAX_WEIGHT)
+        return DHT_JUMP_MAX_WEIGHT;
+
+    return weight;
+}
+
+/*
+ * Gives each subvolume a run of buckets of a jump layout. With 'old', the
+ * subvolumes which were already in it keep the size and the order of their
+ * runs, and the new ones get appended, so only the names hashing to the
+ * new buckets move. The runs of the removed subvolumes are dropped and the
+ * ones after them shift down, which moves more than the minimum in that
+ * case.
+ */
+static void
+dht_selfheal_layout_jump(xlator_t *this, loc_t *loc, dht_layout_t *layout,
+                         dht_layout_t *old)
+{
+    dht_conf_t *priv = NULL;
+    int bricks_to_use = 0;
+    int bricks_used = 0;
+    int start_subvol = 0;
+    int real_i = 0;
+    int i = 0;
+    int j = 0;
+    int err = 0;
+    uint32_t next = 0;
+    uint32_t count = 0;
+    uint32_t chunks = 0;
+    uint64_t total_chunks = 0;
+    uint64_t total_buckets = 0;
+    double unit = 0;
+    gf_boolean_t weight_by_size;
+
+    priv = this->private;
+    weight_by_size = priv->do_weighting;
+
+    layout->type = DHT_HASH_TYPE_JUMP;
+
+    bricks_to_use = dht_get_layout_count(this, layout, 1);
+    GF_ASSERT(bricks_to_use > 0);
+
+    /* clear out the range, as we are re-computing here */
+    DHT_RESET_LAYOUT_RANGE(layout);
+
+    if (old) {
+        dht_layout_sort(old);
+        for (j = 0; j < old->cnt; j++) {
+            if (old->list[j].start >= old->list[j].stop) {
+                continue;
+            }
+            i = dht_layout_index_for_subvol(layout, old->list[j].xlator);
+            if (i < 0) {
+                continue;
+            }
+            err = layout->list[i].err;
+            if ((err != -1) && (err != ENOENT)) {
+                continue;
+            }
+            if (bricks_used >= bricks_to_use) {
+                break;
+            }
+            count = min(old->list[j].stop - old->list[j].start,
+                        DHT_JUMP_MAX_WEIGHT);
+            DHT_SET_LAYOUT_BUCKETS(layout, i, next, count, loc->path);
+            next += count;
+            bricks_used++;
+
+            chunks = dht_get_chunks_from_xl(this, layout->list[i].xlator);
+            if (!chunks) {
+                weight_by_size = _gf_false;
+            }
+            total_chunks += chunks;
+            total_buckets += count;
+        }
+    }
+
+    /* A bucket holds as many chunks as the existing ones do on average,
+     * or as the smallest subvolume for a new directory. */
+    if (weight_by_size && total_buckets) {
+        unit = (double)total_chunks / total_buckets;
+    } else if (weight_by_size) {
+        for (i = 0; i < layout->cnt; i++) {
+            err = layout->list[i].err;
+            if ((err != -1) && (err != ENOENT)) {
+                continue;
+            }
+            chunks = dht_get_chunks_from_xl(this, layout->list[i].xlator);
+            if (!chunks) {
+                unit = 0;
+                break;
+            }
+            if (!unit || (chunks < unit)) {
+                unit = chunks;
+            }
+        }
+    }
+
+    start_subvol = dht_selfheal_layout_alloc_start(this, loc, layout);
+
+    for (real_i = 0; real_i < layout->cnt; real_i++) {
+        if (bricks_used >= bricks_to_use) {
+            break;
+        }
+        i = (real_i + start_subvol) % layout->cnt;
+        err = layout->list[i].err;
+        if ((err != -1) && (err != ENOENT)) {
+            continue;
+        }
+        if (layout->list[i].stop) {
+            /* kept its run from the old layout */
+            continue;
+        }
+        count = dht_selfheal_layout_jump_weight(this, layout->list[i].xlator,
+                                                unit);
+        gf_msg_debug(this->name, 0, "assigning %u buckets to %s", count,
+                     layout->list[i].xlator->name);
+        DHT_SET_LAYOUT_BUCKETS(layout, i, next, count, loc->path);
+        next += count;
+        bricks_used++;
+    }
+
+    layout->buckets = next;
+}
+
 void
 dht_selfheal_layout_new_directory(call_frame_t *frame, loc_t *loc,
                                   dht_layout_t *layout)
 {
-    xlator_t *this = NULL;
+    dht_selfheal_layout_assign(frame->this, loc, layout);
+}
+
+static void
+dht_selfheal_layout_assign(xlator_t *this, loc_t *loc, dht_layout_t *layout)
+{
     double chunk = 0;
     int i = 0;
     uint32_t start = 0;
@@ -1749,10 +1947,17 @@ dht_selfheal_layout_new_directory(call_frame_t *frame, loc_t *loc,
     gf_boolean_t weight_by_size;
     int bricks_used = 0;
 
-    this = frame->this;
     priv = this->private;
     weight_by_size = priv->do_weighting;
 
+    if (layout->type != DHT_HASH_TYPE_DM_USER) {
+        if (priv->layout_type == DHT_HASH_TYPE_JUMP) {
+            dht_selfheal_layout_jump(this, loc, layout, NULL);
+            return;
+        }
+        layout->type = DHT_HASH_TYPE_DM;
+    }
+
     bricks_to_use = dht_get_layout_count(this, layout, 1);
     GF_ASSERT(bricks_to_use > 0);
 
@@ -357,6 +357,15 @@ out:
     return ret;
 }
 
+static void
+dht_configure_layout_type(dht_conf_t *conf, char *temp_str)
+{
+    if (temp_str && !strcmp(temp_str, "jump"))
+        conf->layout_type = DHT_HASH_TYPE_JUMP;
+    else
+        conf->layout_type = DHT_HASH_TYPE_DM;
+}
+
 static int
 dht_configure_throttle(xlator_t *this, dht_conf_t *conf, char *temp_str)
 {
@@ -487,7 +496,13 @@ dht_reconfigure(xlator_t *this, dict_t *options)
     GF_OPTION_RECONF("weighted-rebalance", conf->do_weighting, options, bool,
                      out);
 
+    GF_OPTION_RECONF("layout-type", temp_str, options, str, out);
+    dht_configure_layout_type(conf, temp_str);
+
     GF_OPTION_RECONF("use-readdirp", conf->use_readdirp, options, bool, out);
+
+    GF_OPTION_RECONF("readdirp-window", conf->readdirp_window, options, uint32,
+                     out);
     ret = 0;
 out:
     return ret;
@@ -697,6 +712,8 @@ dht_init(xlator_t *this)
 
     GF_OPTION_INIT("use-readdirp", conf->use_readdirp, bool, err);
 
+    GF_OPTION_INIT("readdirp-window", conf->readdirp_window, uint32, err);
+
     GF_OPTION_INIT("min-free-disk", conf->min_free_disk, percent_or_size, err);
 
     GF_OPTION_INIT("min-free-inodes", conf->min_free_inodes, percent, err);
@@ -803,6 +820,9 @@ dht_init(xlator_t *this)
 
     GF_OPTION_INIT("weighted-rebalance", conf->do_weighting, bool, err);
 
+    GF_OPTION_INIT("layout-type", temp_str, str, err);
+    dht_configure_layout_type(conf, temp_str);
+
     conf->lock_pool = mem_pool_new(dht_lock_t, 512);
     if (!conf->lock_pool) {
         gf_msg(this->name, GF_LOG_ERROR, 0, DHT_MSG_INIT_FAILED,
@@ -918,6 +938,19 @@ struct volume_options dht_options[] = {
                     "readdirp, and hence also displays the stats of the files.",
      .level = OPT_STATUS_ADVANCED,
      .flags = OPT_FLAG_CLIENT_OPT | OPT_FLAG_SETTABLE | OPT_FLAG_DOC},
+    {.key = {"readdirp-window"},
+     .type = GF_OPTION_TYPE_INT,
+     .min = 0,
+     .max = 64,
+     .default_value = "0",
+     .description =
+         "Number of subvolumes a directory listing reads at the same time. "
+         "Each of them keeps one batch of entries ahead of the reader, "
+         "entries are still returned one subvolume after the other. 0 "
+         "reads the subvolumes one after the other.",
+     .op_version = {GD_OP_VERSION_11_0},
+     .level = OPT_STATUS_ADVANCED,
+     .flags = OPT_FLAG_CLIENT_OPT | OPT_FLAG_SETTABLE | OPT_FLAG_DOC},
     {.key = {"assert-no-child-down"},
      .type = GF_OPTION_TYPE_BOOL,
      .default_value = "off",
@@ -1023,6 +1056,20 @@ struct volume_options dht_options[] = {
      .level = OPT_STATUS_BASIC,
      .flags = OPT_FLAG_CLIENT_OPT | OPT_FLAG_SETTABLE | OPT_FLAG_DOC},
 
+    {.key = {"layout-type"},
+     .type = GF_OPTION_TYPE_STR,
+     .default_value = "range",
+     .value = {"range", "jump"},
+     .description =
+         "Layout given to new directories and by fix-layout. \"range\" "
+         "splits the hash space into one range per brick. \"jump\" uses "
+         "jump consistent hashing over per-brick buckets, so that adding "
+         "a brick only moves the files which go to it. Existing "
+         "directories are converted by a rebalance.",
+     .op_version = {GD_OP_VERSION_11_0},
+     .level = OPT_STATUS_ADVANCED,
+     .flags = OPT_FLAG_CLIENT_OPT | OPT_FLAG_SETTABLE | OPT_FLAG_DOC},
+
     /* NUFA option */
     {.key = {"local-volume-name"}, .type = GF_OPTION_TYPE_XLATOR},
 
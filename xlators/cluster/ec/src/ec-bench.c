@@ -0,0 +1,271 @@
+/*
+  Copyright (c) 2015 DataLab, s.l. <http://www.datalab.es>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/* Standalone encode/decode benchmark for the code generators of the EC
+ * xlator. All the generators are run on the same matrices and the same
+ * input, and their fragments are compared with the ones of the first
+ * generator, so a broken generator is reported instead of just being fast.
+ *
+ *     ec-bench [-f fragments] [-r redundancy] [-s size] [-i iterations]
+ *              [-g gen1,gen2,...]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include <glusterfs/globals.h>
+#include <glusterfs/glusterfs.h>
+#include <glusterfs/xlator.h>
+
+#include "ec-method.h"
+#include "ec-code.h"
+
+#define EC_BENCH_DEFAULT_GENS "none,x64,sse,avx,avx512"
+
+typedef struct _ec_bench {
+    uint32_t fragments;
+    uint32_t redundancy;
+    uint64_t size;
+    uint32_t iterations;
+    uint8_t *input;
+    uint8_t *output;
+    uint8_t *reference;
+    uint8_t *decoded;
+} ec_bench_t;
+
+static double
+ec_bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void *
+ec_bench_alloc(uint64_t size)
+{
+    void *ptr = NULL;
+
+    if (posix_memalign(&ptr, EC_METHOD_WORD_SIZE, size) != 0) {
+        fprintf(stderr, "unable to allocate %" PRIu64 " bytes\n", size);
+        exit(1);
+    }
+
+    return ptr;
+}
+
+static void
+ec_bench_encode(ec_matrix_list_t *list, ec_bench_t *bench, uint8_t *out)
+{
+    void *blocks[bench->fragments + bench->redundancy];
+    uint64_t fsize = bench->size / bench->fragments;
+    uint32_t i;
+
+    for (i = 0; i < bench->fragments + bench->redundancy; i++) {
+        blocks[i] = out + i * fsize;
+    }
+    ec_method_encode(list, bench->size, bench->input, blocks);
+}
+
+static int32_t
+ec_bench_decode(ec_matrix_list_t *list, ec_bench_t *bench)
+{
+    uint32_t nodes = bench->fragments + bench->redundancy;
+    uint64_t fsize = bench->size / bench->fragments;
+    void *blocks[bench->fragments];
+    uint32_t values[bench->fragments];
+    uintptr_t mask = 0;
+    uint32_t i, idx;
+
+    /* Use the last fragments so that all the redundancy rows take part in
+     * the reconstruction. This is the most expensive matrix. */
+    for (i = 0; i < bench->fragments; i++) {
+        idx = nodes - bench->fragments + i;
+        mask |= 1ULL << idx;
+        values[i] = idx + 1;
+        blocks[i] = bench->output + idx * fsize;
+    }
+
+    return ec_method_decode(list, fsize, mask, values, blocks, bench->decoded);
+}
+
+static int32_t
+ec_bench_run(ec_bench_t *bench, const char *gen)
+{
+    ec_matrix_list_t list;
+    uint64_t fsize = bench->size / bench->fragments;
+    uint64_t total;
+    const char *used;
+    double start, encode, decode;
+    uint32_t i;
+    int32_t err;
+
+    memset(&list, 0, sizeof(list));
+    err = ec_method_init(THIS, &list, bench->fragments,
+                         bench->fragments + bench->redundancy,
+                         bench->fragments * 2, gen);
+    if (err != 0) {
+        fprintf(stderr, "%s: ec_method_init() failed: %s\n", gen,
+                strerror(-err));
+        return err;
+    }
+    used = (list.code->gen != NULL) ? list.code->gen->name : "none";
+
+    /* Warm up: this builds the decoding matrix and its dynamic code. */
+    ec_bench_encode(&list, bench, bench->output);
+    err = ec_bench_decode(&list, bench);
+    if (err != 0) {
+        fprintf(stderr, "%s: decode failed: %s\n", gen, strerror(-err));
+        goto out;
+    }
+
+    start = ec_bench_now();
+    for (i = 0; i < bench->iterations; i++) {
+        ec_bench_encode(&list, bench, bench->output);
+    }
+    encode = ec_bench_now() - start;
+
+    start = ec_bench_now();
+    for (i = 0; i < bench->iterations; i++) {
+        ec_bench_decode(&list, bench);
+    }
+    decode = ec_bench_now() - start;
+
+    err = 0;
+    if (memcmp(bench->decoded, bench->input, bench->size) != 0) {
+        fprintf(stderr, "%s: decoded data doesn't match the input\n", gen);
+        err = -EIO;
+    }
+    total = fsize * (bench->fragments + bench->redundancy);
+    if (bench->reference == NULL) {
+        bench->reference = ec_bench_alloc(total);
+        memcpy(bench->reference, bench->output, total);
+    } else if (memcmp(bench->reference, bench->output, total) != 0) {
+        fprintf(stderr, "%s: fragments differ from the first generator\n",
+                gen);
+        err = -EIO;
+    }
+
+    total = bench->size * (uint64_t)bench->iterations;
+    fprintf(stdout, "%-8s (%-6s) encode: %9.1f MiB/s  decode: %9.1f MiB/s%s\n",
+            gen, used, total / encode / 1048576.0, total / decode / 1048576.0,
+            (err != 0) ? "  FAILED" : "");
+
+out:
+    ec_method_fini(&list);
+
+    return err;
+}
+
+static void
+ec_bench_usage(const char *name)
+{
+    fprintf(stderr,
+            "Usage: %s [-f fragments] [-r redundancy] [-s size] "
+            "[-i iterations] [-g gen1,gen2,...]\n"
+            "Known generators: " EC_BENCH_DEFAULT_GENS "\n",
+            name);
+}
+
+int
+main(int argc, char *argv[])
+{
+    ec_bench_t bench = {
+        .fragments = 4,
+        .redundancy = 2,
+        .size = 1024 * 1024,
+        .iterations = 256,
+    };
+    glusterfs_ctx_t *ctx;
+    char *gens = NULL;
+    char *gen, *saveptr = NULL;
+    uint64_t stripe, i;
+    int failed = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "f:r:s:i:g:h")) != -1) {
+        switch (opt) {
+            case 'f':
+                bench.fragments = strtoul(optarg, NULL, 0);
+                break;
+            case 'r':
+                bench.redundancy = strtoul(optarg, NULL, 0);
+                break;
+            case 's':
+                bench.size = strtoull(optarg, NULL, 0);
+                break;
+            case 'i':
+                bench.iterations = strtoul(optarg, NULL, 0);
+                break;
+            case 'g':
+                gens = strdup(optarg);
+                break;
+            default:
+                ec_bench_usage(argv[0]);
+                return 1;
+        }
+    }
+
+    /* Same limits as the disperse xlator itself. */
+    if ((bench.redundancy == 0) || (bench.redundancy >= bench.fragments) ||
+        (bench.fragments > EC_METHOD_MAX_FRAGMENTS) ||
+        (bench.iterations == 0)) {
+        ec_bench_usage(argv[0]);
+        return 1;
+    }
+    if (gens == NULL) {
+        gens = strdup(EC_BENCH_DEFAULT_GENS);
+    }
+
+    ctx = glusterfs_ctx_new();
+    if ((ctx == NULL) || (glusterfs_globals_init(ctx) != 0)) {
+        fprintf(stderr, "unable to initialize the glusterfs context\n");
+        return 1;
+    }
+    THIS->ctx = ctx;
+    xlator_mem_acct_init(THIS, gf_common_mt_end);
+    gf_log_set_loglevel(ctx, GF_LOG_WARNING);
+
+    stripe = EC_METHOD_CHUNK_SIZE * bench.fragments;
+    bench.size = (bench.size + stripe - 1) / stripe * stripe;
+
+    bench.input = ec_bench_alloc(bench.size);
+    bench.decoded = ec_bench_alloc(bench.size);
+    bench.output = ec_bench_alloc(bench.size / bench.fragments *
+                                  (bench.fragments + bench.redundancy));
+    srandom(1);
+    for (i = 0; i < bench.size; i++) {
+        bench.input[i] = random();
+    }
+
+    fprintf(stdout,
+            "%u+%u, %" PRIu64 " bytes per iteration, %u iterations\n",
+            bench.fragments, bench.redundancy, bench.size, bench.iterations);
+
+    for (gen = strtok_r(gens, ",", &saveptr); gen != NULL;
+         gen = strtok_r(NULL, ",", &saveptr)) {
+        if (ec_bench_run(&bench, gen) != 0) {
+            failed = 1;
+        }
+    }
+
+    free(bench.input);
+    free(bench.decoded);
+    free(bench.output);
+    free(bench.reference);
+    free(gens);
+
+    return failed;
+}
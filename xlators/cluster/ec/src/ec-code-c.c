@@ -14,7 +14,18 @@
 #include "ec-method.h"
 #include "ec-code-c.h"
 
-#define WIDTH (EC_METHOD_WORD_SIZE / sizeof(uint64_t))
+/* The fallback code works on bit planes, so it only needs xor. Using the
+ * generic vector extensions of the compiler lets it use whatever vector
+ * unit the target has (SSE2, NEON, AltiVec, ...) without any architecture
+ * specific code. The alignment is kept at 8 bytes so that buffers are
+ * accessed with the same requirements as the plain 64 bits version. */
+#if defined(__GNUC__) && !defined(EC_CODE_C_NO_VECTOR)
+typedef uint64_t ec_word_t __attribute__((vector_size(16), aligned(8)));
+#else
+typedef uint64_t ec_word_t;
+#endif
+
+#define WIDTH (EC_METHOD_WORD_SIZE / sizeof(ec_word_t))
 
 static void
 gf8_muladd_00(void *out, void *in)
@@ -26,8 +37,8 @@ static void
 gf8_muladd_01(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
         out_ptr[0] ^= in_ptr[0];
@@ -48,20 +59,20 @@ static void
 gf8_muladd_02(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in7;
         out1 = in0;
@@ -90,21 +101,21 @@ static void
 gf8_muladd_03(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in0 ^ in7;
         tmp0 = in2 ^ in7;
@@ -134,21 +145,21 @@ static void
 gf8_muladd_04(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in6;
         out1 = in7;
@@ -178,20 +189,20 @@ static void
 gf8_muladd_05(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in0 ^ in6;
         out1 = in1 ^ in7;
@@ -220,21 +231,21 @@ static void
 gf8_muladd_06(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in6 ^ in7;
         tmp0 = in1 ^ in6;
@@ -264,21 +275,21 @@ static void
 gf8_muladd_07(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in6;
         tmp1 = in5 ^ in6;
@@ -311,20 +322,20 @@ static void
 gf8_muladd_08(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in5;
         out1 = in6;
@@ -353,21 +364,21 @@ static void
 gf8_muladd_09(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in0 ^ in5;
         tmp0 = in3 ^ in6;
@@ -397,20 +408,20 @@ static void
 gf8_muladd_0A(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in5 ^ in7;
         out1 = in0 ^ in6;
@@ -439,21 +450,21 @@ static void
 gf8_muladd_0B(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in5;
         tmp1 = in0 ^ in6;
@@ -485,21 +496,21 @@ static void
 gf8_muladd_0C(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in5 ^ in6;
         out1 = in6 ^ in7;
@@ -530,21 +541,21 @@ static void
 gf8_muladd_0D(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in4 ^ in5;
         tmp1 = in5 ^ in6;
@@ -576,21 +587,21 @@ static void
 gf8_muladd_0E(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = in2 ^ in5;
@@ -623,21 +634,21 @@ static void
 gf8_muladd_0F(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in6 ^ in7;
         tmp1 = tmp0 ^ in1;
@@ -670,21 +681,21 @@ static void
 gf8_muladd_10(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in4;
         out1 = in5;
@@ -715,20 +726,20 @@ static void
 gf8_muladd_11(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out7 = in3;
         out0 = in0 ^ in4;
@@ -757,21 +768,21 @@ static void
 gf8_muladd_12(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in4 ^ in7;
         out1 = in0 ^ in5;
@@ -802,21 +813,21 @@ static void
 gf8_muladd_13(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out7 = in3 ^ in6;
         tmp0 = in0 ^ in5;
@@ -847,21 +858,21 @@ static void
 gf8_muladd_14(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in4 ^ in6;
         out1 = in5 ^ in7;
@@ -892,21 +903,21 @@ static void
 gf8_muladd_15(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out7 = in3 ^ in5;
         tmp0 = in0 ^ in4;
@@ -936,21 +947,21 @@ static void
 gf8_muladd_16(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in5;
         tmp1 = in4 ^ in7;
@@ -983,21 +994,21 @@ static void
 gf8_muladd_17(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in5;
         tmp1 = in3 ^ in6;
@@ -1030,21 +1041,21 @@ static void
 gf8_muladd_18(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in4 ^ in5;
         out1 = in5 ^ in6;
@@ -1075,21 +1086,21 @@ static void
 gf8_muladd_19(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out5 = in1 ^ in2;
         out7 = in3 ^ in4;
@@ -1120,21 +1131,21 @@ static void
 gf8_muladd_1A(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in4 ^ in5;
         tmp1 = in5 ^ in6;
@@ -1167,21 +1178,21 @@ static void
 gf8_muladd_1B(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in4;
         tmp1 = in2 ^ in5;
@@ -1215,21 +1226,21 @@ static void
 gf8_muladd_1C(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in3;
         tmp1 = in4 ^ in6;
@@ -1263,21 +1274,21 @@ static void
 gf8_muladd_1D(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in3;
         tmp1 = in0 ^ in4;
@@ -1311,21 +1322,21 @@ static void
 gf8_muladd_1E(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in4;
         tmp1 = in2 ^ in7;
@@ -1358,21 +1369,21 @@ static void
 gf8_muladd_1F(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in4 ^ in6;
         tmp1 = tmp0 ^ in5;
@@ -1403,21 +1414,21 @@ static void
 gf8_muladd_20(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out1 = in4;
         out0 = in3 ^ in7;
@@ -1448,21 +1459,21 @@ static void
 gf8_muladd_21(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out1 = in1 ^ in4;
         tmp0 = in4 ^ in6;
@@ -1492,20 +1503,20 @@ static void
 gf8_muladd_22(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in3;
         out1 = in0 ^ in4;
@@ -1534,20 +1545,20 @@ static void
 gf8_muladd_23(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out7 = in2;
         out0 = in0 ^ in3;
@@ -1576,21 +1587,21 @@ static void
 gf8_muladd_24(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out1 = in4 ^ in7;
         tmp0 = in3 ^ in4;
@@ -1621,21 +1632,21 @@ static void
 gf8_muladd_25(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in1 ^ in4;
         tmp0 = in2 ^ in5;
@@ -1665,21 +1676,21 @@ static void
 gf8_muladd_26(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in3 ^ in6;
         tmp0 = in4 ^ in7;
@@ -1711,20 +1722,20 @@ static void
 gf8_muladd_27(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out7 = in2 ^ in5;
         out0 = in0 ^ in3 ^ in6;
@@ -1753,21 +1764,21 @@ static void
 gf8_muladd_28(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in3;
         out1 = in4 ^ in6;
@@ -1799,21 +1810,21 @@ static void
 gf8_muladd_29(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in2 ^ in3;
         tmp0 = in1 ^ in3;
@@ -1845,21 +1856,21 @@ static void
 gf8_muladd_2A(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in3 ^ in5;
         tmp0 = in1 ^ in3;
@@ -1890,21 +1901,21 @@ static void
 gf8_muladd_2B(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in1 ^ in6;
         out7 = in2 ^ in4;
@@ -1935,21 +1946,21 @@ static void
 gf8_muladd_2C(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in5;
         tmp1 = in2 ^ in3 ^ in4;
@@ -1982,21 +1993,21 @@ static void
 gf8_muladd_2D(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in3;
         out4 = tmp0 ^ in1;
@@ -2029,21 +2040,21 @@ static void
 gf8_muladd_2E(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in4 ^ in7;
         out0 = in3 ^ in5 ^ in6;
@@ -2075,21 +2086,21 @@ static void
 gf8_muladd_2F(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in3;
         tmp1 = in2 ^ in5;
@@ -2121,21 +2132,21 @@ static void
 gf8_muladd_30(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out1 = in4 ^ in5;
         tmp0 = in3 ^ in6;
@@ -2166,21 +2177,21 @@ static void
 gf8_muladd_31(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in5 ^ in6;
         tmp0 = in4 ^ in5;
@@ -2212,21 +2223,21 @@ static void
 gf8_muladd_32(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in3 ^ in4;
         out7 = in2 ^ in3;
@@ -2257,21 +2268,21 @@ static void
 gf8_muladd_33(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in3;
         tmp1 = in0 ^ in4;
@@ -2305,21 +2316,21 @@ static void
 gf8_muladd_34(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in3 ^ in4;
         tmp1 = in4 ^ in5;
@@ -2353,21 +2364,21 @@ static void
 gf8_muladd_35(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in6;
         tmp1 = in5 ^ in7;
@@ -2399,21 +2410,21 @@ static void
 gf8_muladd_36(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in0 ^ in2;
         tmp0 = in1 ^ in3;
@@ -2444,21 +2455,21 @@ static void
 gf8_muladd_37(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in2;
         tmp1 = in2 ^ in4;
@@ -2491,21 +2502,21 @@ static void
 gf8_muladd_38(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in0 ^ in3;
         tmp0 = in3 ^ in4;
@@ -2537,21 +2548,21 @@ static void
 gf8_muladd_39(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in0;
         tmp0 = in1 ^ in5;
@@ -2583,21 +2594,21 @@ static void
 gf8_muladd_3A(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4, tmp5;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4, tmp5;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = in0 ^ in2;
@@ -2632,21 +2643,21 @@ static void
 gf8_muladd_3B(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in6;
         tmp1 = in2 ^ in7;
@@ -2678,21 +2689,21 @@ static void
 gf8_muladd_3C(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in3;
         tmp1 = in2 ^ in7;
@@ -2724,21 +2735,21 @@ static void
 gf8_muladd_3D(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in2;
         tmp1 = tmp0 ^ in3;
@@ -2770,21 +2781,21 @@ static void
 gf8_muladd_3E(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in3 ^ in5;
         tmp1 = tmp0 ^ in4;
@@ -2815,21 +2826,21 @@ static void
 gf8_muladd_3F(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in1;
         out3 = tmp0 ^ in2 ^ in6;
@@ -2861,21 +2872,21 @@ static void
 gf8_muladd_40(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out1 = in3 ^ in7;
         tmp0 = in3 ^ in4;
@@ -2906,21 +2917,21 @@ static void
 gf8_muladd_41(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in2 ^ in3;
         tmp0 = in5 ^ in6;
@@ -2951,20 +2962,20 @@ static void
 gf8_muladd_42(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in2 ^ in6;
         out5 = in3 ^ in5;
@@ -2993,20 +3004,20 @@ static void
 gf8_muladd_43(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out5 = in3;
         out7 = in1 ^ in5;
@@ -3035,21 +3046,21 @@ static void
 gf8_muladd_44(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out1 = in3;
         out0 = in2 ^ in7;
@@ -3079,20 +3090,20 @@ static void
 gf8_muladd_45(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out1 = in1 ^ in3;
         out7 = in1 ^ in6;
@@ -3121,20 +3132,20 @@ static void
 gf8_muladd_46(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in2;
         out1 = in0 ^ in3;
@@ -3163,21 +3174,21 @@ static void
 gf8_muladd_47(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in6;
         out7 = in1;
@@ -3207,21 +3218,21 @@ static void
 gf8_muladd_48(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in3;
         out1 = in3 ^ in6 ^ in7;
@@ -3252,21 +3263,21 @@ static void
 gf8_muladd_49(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in0 ^ in2;
         tmp0 = in2 ^ in5;
@@ -3297,21 +3308,21 @@ static void
 gf8_muladd_4A(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in6;
         tmp1 = in3 ^ in7;
@@ -3342,21 +3353,21 @@ static void
 gf8_muladd_4B(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in0 ^ in7;
         tmp0 = in1 ^ in5;
@@ -3389,21 +3400,21 @@ static void
 gf8_muladd_4C(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out1 = in3 ^ in6;
         tmp0 = in2 ^ in5;
@@ -3435,21 +3446,21 @@ static void
 gf8_muladd_4D(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in5;
         tmp1 = in1 ^ in6;
@@ -3481,20 +3492,20 @@ static void
 gf8_muladd_4E(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in2 ^ in5;
         out7 = in1 ^ in4 ^ in7;
@@ -3523,20 +3534,20 @@ static void
 gf8_muladd_4F(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out5 = in2 ^ in6;
         out7 = in1 ^ in4;
@@ -3565,21 +3576,21 @@ static void
 gf8_muladd_50(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in2 ^ in7;
         tmp0 = in3 ^ in5;
@@ -3611,20 +3622,20 @@ static void
 gf8_muladd_51(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in7;
         out3 = in2 ^ in4 ^ in6 ^ in7;
@@ -3653,21 +3664,21 @@ static void
 gf8_muladd_52(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in1 ^ in2;
         tmp0 = in2 ^ in4;
@@ -3700,20 +3711,20 @@ static void
 gf8_muladd_53(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in1;
         out3 = in4 ^ in6;
@@ -3742,21 +3753,21 @@ static void
 gf8_muladd_54(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out1 = in3 ^ in5;
         tmp0 = in1 ^ in3;
@@ -3789,21 +3800,21 @@ static void
 gf8_muladd_55(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in3;
         tmp1 = in1 ^ in4;
@@ -3835,21 +3846,21 @@ static void
 gf8_muladd_56(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in2 ^ in4;
         tmp0 = in0 ^ in2;
@@ -3879,21 +3890,21 @@ static void
 gf8_muladd_57(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in5;
         tmp1 = in1 ^ in7;
@@ -3924,21 +3935,21 @@ static void
 gf8_muladd_58(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in2 ^ in5;
         tmp0 = in2 ^ in3 ^ in4;
@@ -3969,21 +3980,21 @@ static void
 gf8_muladd_59(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in5;
         tmp0 = in0 ^ in5 ^ in7;
@@ -4014,21 +4025,21 @@ static void
 gf8_muladd_5A(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in2;
         tmp1 = in2 ^ in5;
@@ -4060,21 +4071,21 @@ static void
 gf8_muladd_5B(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in3;
         tmp1 = in0 ^ in4;
@@ -4108,21 +4119,21 @@ static void
 gf8_muladd_5C(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in3 ^ in6;
         tmp1 = in0 ^ in2 ^ in5;
@@ -4154,21 +4165,21 @@ static void
 gf8_muladd_5D(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = in0 ^ in6;
@@ -4202,21 +4213,21 @@ static void
 gf8_muladd_5E(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in5;
         tmp1 = in3 ^ in5;
@@ -4250,21 +4261,21 @@ static void
 gf8_muladd_5F(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in5;
         tmp1 = in0 ^ in6;
@@ -4297,21 +4308,21 @@ static void
 gf8_muladd_60(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in2 ^ in5;
         tmp0 = in3 ^ in6;
@@ -4342,21 +4353,21 @@ static void
 gf8_muladd_61(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in5;
         out4 = tmp0 ^ in4;
@@ -4387,21 +4398,21 @@ static void
 gf8_muladd_62(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in4 ^ in5;
         tmp0 = in0 ^ in3 ^ in4;
@@ -4434,21 +4445,21 @@ static void
 gf8_muladd_63(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in3 ^ in4;
         tmp1 = in1 ^ in7;
@@ -4482,21 +4493,21 @@ static void
 gf8_muladd_64(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in2 ^ in3;
         out1 = in3 ^ in4;
@@ -4527,21 +4538,21 @@ static void
 gf8_muladd_65(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in3;
         tmp1 = in4 ^ in5;
@@ -4574,21 +4585,21 @@ static void
 gf8_muladd_66(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in2;
         tmp1 = in2 ^ in3;
@@ -4622,21 +4633,21 @@ static void
 gf8_muladd_67(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in3;
         tmp1 = tmp0 ^ in1;
@@ -4669,21 +4680,21 @@ static void
 gf8_muladd_68(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in3 ^ in4;
         tmp1 = in2 ^ in3 ^ in5;
@@ -4716,21 +4727,21 @@ static void
 gf8_muladd_69(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in6 ^ in7;
         out2 = tmp0 ^ in3 ^ in4;
@@ -4760,21 +4771,21 @@ static void
 gf8_muladd_6A(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in6;
         out3 = in0 ^ in4 ^ in6;
@@ -4806,21 +4817,21 @@ static void
 gf8_muladd_6B(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in4 ^ in6;
         out2 = tmp0 ^ in1 ^ in3;
@@ -4851,21 +4862,21 @@ static void
 gf8_muladd_6C(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in1;
         tmp0 = in2 ^ in3;
@@ -4896,21 +4907,21 @@ static void
 gf8_muladd_6D(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in1 ^ in4;
         tmp0 = in0 ^ in2;
@@ -4941,21 +4952,21 @@ static void
 gf8_muladd_6E(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in3;
         tmp1 = in0 ^ in4;
@@ -4987,21 +4998,21 @@ static void
 gf8_muladd_6F(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in3 ^ in7;
         tmp1 = tmp0 ^ in4;
@@ -5033,21 +5044,21 @@ static void
 gf8_muladd_70(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in2;
         tmp0 = in2 ^ in4;
@@ -5079,21 +5090,21 @@ static void
 gf8_muladd_71(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in3 ^ in5;
         out3 = in2 ^ in3;
@@ -5125,21 +5136,21 @@ static void
 gf8_muladd_72(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in7;
         tmp0 = in0 ^ in4;
@@ -5171,20 +5182,20 @@ static void
 gf8_muladd_73(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in3 ^ in7;
         out2 = out3 ^ in1 ^ in5;
@@ -5213,21 +5224,21 @@ static void
 gf8_muladd_74(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in3 ^ in4;
         tmp1 = in1 ^ in2 ^ in6;
@@ -5258,21 +5269,21 @@ static void
 gf8_muladd_75(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in0 ^ in7;
         tmp0 = in1 ^ in3;
@@ -5304,21 +5315,21 @@ static void
 gf8_muladd_76(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in1 ^ in6;
         tmp0 = in0 ^ in5;
@@ -5351,21 +5362,21 @@ static void
 gf8_muladd_77(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in0 ^ in3;
         tmp0 = in1 ^ in4;
@@ -5398,21 +5409,21 @@ static void
 gf8_muladd_78(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in3;
         tmp1 = in2 ^ in7;
@@ -5444,21 +5455,21 @@ static void
 gf8_muladd_79(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in3 ^ in7;
         tmp0 = in3 ^ in4;
@@ -5491,21 +5502,21 @@ static void
 gf8_muladd_7A(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in2;
         out2 = tmp0 ^ in3;
@@ -5536,21 +5547,21 @@ static void
 gf8_muladd_7B(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in1 ^ in3;
         tmp0 = in0 ^ in5;
@@ -5582,21 +5593,21 @@ static void
 gf8_muladd_7C(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in3 ^ in5;
         tmp1 = tmp0 ^ in4;
@@ -5627,21 +5638,21 @@ static void
 gf8_muladd_7D(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in2;
         tmp1 = tmp0 ^ in3;
@@ -5674,21 +5685,21 @@ static void
 gf8_muladd_7E(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in3 ^ in4;
         tmp1 = in0 ^ in5;
@@ -5720,21 +5731,21 @@ static void
 gf8_muladd_7F(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in7;
         tmp1 = tmp0 ^ in3 ^ in5;
@@ -5767,21 +5778,21 @@ static void
 gf8_muladd_80(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in3;
         tmp1 = in4 ^ in5;
@@ -5813,21 +5824,21 @@ static void
 gf8_muladd_81(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in4 ^ in6;
         tmp1 = tmp0 ^ in3;
@@ -5858,21 +5869,21 @@ static void
 gf8_muladd_82(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in1 ^ in2;
         tmp0 = in6 ^ in7;
@@ -5902,21 +5913,21 @@ static void
 gf8_muladd_83(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = in2 ^ in5;
@@ -5950,20 +5961,20 @@ static void
 gf8_muladd_84(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out1 = in2 ^ in6;
         out6 = in3 ^ in5;
@@ -5992,21 +6003,21 @@ static void
 gf8_muladd_85(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in6;
         tmp1 = in3 ^ in6;
@@ -6039,20 +6050,20 @@ static void
 gf8_muladd_86(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out6 = in3;
         out7 = in0 ^ in4;
@@ -6081,21 +6092,21 @@ static void
 gf8_muladd_87(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out6 = in3 ^ in6;
         tmp0 = in0 ^ in1;
@@ -6126,21 +6137,21 @@ static void
 gf8_muladd_88(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out1 = in2 ^ in7;
         tmp0 = in5 ^ in6;
@@ -6171,21 +6182,21 @@ static void
 gf8_muladd_89(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in7;
         tmp1 = in2 ^ in7;
@@ -6217,20 +6228,20 @@ static void
 gf8_muladd_8A(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in1 ^ in6;
         out7 = in0 ^ in5;
@@ -6259,21 +6270,21 @@ static void
 gf8_muladd_8B(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = in3 ^ in6;
@@ -6307,20 +6318,20 @@ static void
 gf8_muladd_8C(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out1 = in2;
         out0 = in1 ^ in7;
@@ -6349,21 +6360,21 @@ static void
 gf8_muladd_8D(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out1 = in1 ^ in2;
         tmp0 = in6 ^ in7;
@@ -6393,20 +6404,20 @@ static void
 gf8_muladd_8E(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in1;
         out4 = in5;
@@ -6435,21 +6446,21 @@ static void
 gf8_muladd_8F(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in0 ^ in1;
         tmp0 = in0 ^ in3;
@@ -6479,21 +6490,21 @@ static void
 gf8_muladd_90(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in2;
         tmp1 = in2 ^ in6 ^ in7;
@@ -6525,21 +6536,21 @@ static void
 gf8_muladd_91(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in4;
         tmp1 = tmp0 ^ in3 ^ in5;
@@ -6572,21 +6583,21 @@ static void
 gf8_muladd_92(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in1;
         tmp0 = in4 ^ in5;
@@ -6617,21 +6628,21 @@ static void
 gf8_muladd_93(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in1 ^ in3;
         tmp0 = in2 ^ in7;
@@ -6663,21 +6674,21 @@ static void
 gf8_muladd_94(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in2 ^ in6;
         tmp0 = in1 ^ in4 ^ in5;
@@ -6707,21 +6718,21 @@ static void
 gf8_muladd_95(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4, tmp5;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4, tmp5;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in3;
         out3 = tmp0 ^ in6;
@@ -6756,21 +6767,21 @@ static void
 gf8_muladd_96(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in6 ^ in7;
         tmp0 = in1 ^ in5;
@@ -6802,21 +6813,21 @@ static void
 gf8_muladd_97(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in4;
         tmp1 = in2 ^ in6;
@@ -6849,21 +6860,21 @@ static void
 gf8_muladd_98(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in5 ^ in7;
         tmp1 = in1 ^ in4 ^ in7;
@@ -6894,21 +6905,21 @@ static void
 gf8_muladd_99(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in3;
         out5 = in1 ^ in3 ^ in4;
@@ -6940,21 +6951,21 @@ static void
 gf8_muladd_9A(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in3 ^ in4;
         tmp0 = in0 ^ in5;
@@ -6986,21 +6997,21 @@ static void
 gf8_muladd_9B(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out5 = in1 ^ in3;
         tmp0 = in3 ^ in5;
@@ -7030,21 +7041,21 @@ static void
 gf8_muladd_9C(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out1 = in2 ^ in5;
         tmp0 = in0 ^ in3 ^ in6;
@@ -7074,21 +7085,21 @@ static void
 gf8_muladd_9D(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out6 = in2 ^ in5;
         tmp0 = in0 ^ in3;
@@ -7118,21 +7129,21 @@ static void
 gf8_muladd_9E(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in1 ^ in4;
         tmp0 = in0 ^ in5;
@@ -7162,21 +7173,21 @@ static void
 gf8_muladd_9F(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out6 = in2;
         out7 = in0 ^ in3;
@@ -7206,21 +7217,21 @@ static void
 gf8_muladd_A0(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in6;
         out2 = tmp0 ^ in7;
@@ -7253,21 +7264,21 @@ static void
 gf8_muladd_A1(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in5;
         tmp1 = tmp0 ^ in1;
@@ -7299,21 +7310,21 @@ static void
 gf8_muladd_A2(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in6;
         tmp0 = in1 ^ in3 ^ in5;
@@ -7343,21 +7354,21 @@ static void
 gf8_muladd_A3(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in2 ^ in6;
         out3 = in1 ^ in5 ^ in6;
@@ -7388,21 +7399,21 @@ static void
 gf8_muladd_A4(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in3;
         tmp1 = in2 ^ in4;
@@ -7436,21 +7447,21 @@ static void
 gf8_muladd_A5(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in2 ^ in5;
         tmp0 = in1 ^ in6;
@@ -7482,20 +7493,20 @@ static void
 gf8_muladd_A6(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in0;
         out3 = in3 ^ in5 ^ in7;
@@ -7524,20 +7535,20 @@ static void
 gf8_muladd_A7(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in0 ^ in2;
         out3 = in5 ^ in7;
@@ -7566,21 +7577,21 @@ static void
 gf8_muladd_A8(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in4;
         tmp1 = in1 ^ in6;
@@ -7612,20 +7623,20 @@ static void
 gf8_muladd_A9(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in2 ^ in6;
         out6 = in1 ^ in4;
@@ -7654,21 +7665,21 @@ static void
 gf8_muladd_AA(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in2;
         tmp1 = in1 ^ in3;
@@ -7700,21 +7711,21 @@ static void
 gf8_muladd_AB(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in0 ^ in1;
         tmp0 = in1 ^ in4;
@@ -7745,21 +7756,21 @@ static void
 gf8_muladd_AC(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in1 ^ in3;
         out1 = in2 ^ in4;
@@ -7789,20 +7800,20 @@ static void
 gf8_muladd_AD(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in7;
         out5 = in0;
@@ -7831,21 +7842,21 @@ static void
 gf8_muladd_AE(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in3 ^ in4;
         tmp0 = in0 ^ in4;
@@ -7877,21 +7888,21 @@ static void
 gf8_muladd_AF(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in3;
         tmp0 = in0 ^ in7;
@@ -7921,21 +7932,21 @@ static void
 gf8_muladd_B0(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in4;
         tmp1 = in3 ^ in6;
@@ -7968,21 +7979,21 @@ static void
 gf8_muladd_B1(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in4;
         out2 = tmp0 ^ in2 ^ in7;
@@ -8013,21 +8024,21 @@ static void
 gf8_muladd_B2(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in4;
         tmp0 = in4 ^ in7;
@@ -8061,21 +8072,21 @@ static void
 gf8_muladd_B3(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in2 ^ in4;
         tmp0 = in0 ^ in5;
@@ -8107,21 +8118,21 @@ static void
 gf8_muladd_B4(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in0 ^ in1;
         out5 = out4 ^ in2;
@@ -8151,21 +8162,21 @@ static void
 gf8_muladd_B5(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = in2 ^ in4;
@@ -8197,21 +8208,21 @@ static void
 gf8_muladd_B6(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in3 ^ in4;
         tmp0 = in1 ^ in2;
@@ -8244,21 +8255,21 @@ static void
 gf8_muladd_B7(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in4;
         tmp0 = in0 ^ in4;
@@ -8289,21 +8300,21 @@ static void
 gf8_muladd_B8(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in4;
         tmp1 = in2 ^ in5;
@@ -8335,21 +8346,21 @@ static void
 gf8_muladd_B9(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in2;
         tmp1 = in4 ^ in5;
@@ -8381,21 +8392,21 @@ static void
 gf8_muladd_BA(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in5 ^ in7;
         out2 = tmp0 ^ in4;
@@ -8427,21 +8438,21 @@ static void
 gf8_muladd_BB(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in2 ^ in4 ^ in5 ^ in7;
         tmp0 = out2 ^ in1;
@@ -8472,21 +8483,21 @@ static void
 gf8_muladd_BC(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in2;
         tmp1 = in2 ^ in4;
@@ -8518,21 +8529,21 @@ static void
 gf8_muladd_BD(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in3;
         tmp1 = in1 ^ in4;
@@ -8564,21 +8575,21 @@ static void
 gf8_muladd_BE(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in3 ^ in6;
         out4 = tmp0 ^ in5;
@@ -8608,21 +8619,21 @@ static void
 gf8_muladd_BF(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in4;
         out3 = tmp0 ^ in5 ^ in6;
@@ -8655,21 +8666,21 @@ static void
 gf8_muladd_C0(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out5 = in2 ^ in5;
         tmp0 = in1 ^ in4;
@@ -8700,21 +8711,21 @@ static void
 gf8_muladd_C1(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out5 = in2;
         tmp0 = in0 ^ in1;
@@ -8745,21 +8756,21 @@ static void
 gf8_muladd_C2(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in1 ^ in3 ^ in4;
         tmp0 = in0 ^ in3 ^ in6;
@@ -8790,21 +8801,21 @@ static void
 gf8_muladd_C3(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in1 ^ in3;
         tmp0 = in0 ^ in2;
@@ -8836,21 +8847,21 @@ static void
 gf8_muladd_C4(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in3 ^ in7;
         out3 = tmp0 ^ in4;
@@ -8881,21 +8892,21 @@ static void
 gf8_muladd_C5(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in4 ^ in7;
         tmp0 = in3 ^ in7;
@@ -8925,21 +8936,21 @@ static void
 gf8_muladd_C6(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4, tmp5;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4, tmp5;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in5 ^ in6;
         tmp1 = in1 ^ in7;
@@ -8974,21 +8985,21 @@ static void
 gf8_muladd_C7(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in2 ^ in4;
         tmp0 = in3 ^ in5;
@@ -9019,21 +9030,21 @@ static void
 gf8_muladd_C8(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out0 = in1 ^ in2;
         out1 = in2 ^ in3;
@@ -9064,21 +9075,21 @@ static void
 gf8_muladd_C9(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in5 ^ in6;
         out7 = in0 ^ in1;
@@ -9108,21 +9119,21 @@ static void
 gf8_muladd_CA(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in7;
         tmp1 = in2 ^ in7;
@@ -9155,21 +9166,21 @@ static void
 gf8_muladd_CB(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in4 ^ in7;
         tmp1 = in5 ^ in7;
@@ -9201,21 +9212,21 @@ static void
 gf8_muladd_CC(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in3 ^ in5;
         tmp1 = in1 ^ in6;
@@ -9248,21 +9259,21 @@ static void
 gf8_muladd_CD(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out5 = in3 ^ in6;
         tmp0 = in0 ^ in1;
@@ -9293,21 +9304,21 @@ static void
 gf8_muladd_CE(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in5;
         tmp1 = tmp0 ^ in3;
@@ -9339,21 +9350,21 @@ static void
 gf8_muladd_CF(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in3 ^ in6;
         tmp1 = in0 ^ in1 ^ in5;
@@ -9385,21 +9396,21 @@ static void
 gf8_muladd_D0(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in3;
         tmp1 = in1 ^ in4;
@@ -9433,21 +9444,21 @@ static void
 gf8_muladd_D1(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in3 ^ in5 ^ in6;
         tmp1 = tmp0 ^ in1;
@@ -9479,21 +9490,21 @@ static void
 gf8_muladd_D2(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in5 ^ in6;
         out2 = tmp0 ^ in2 ^ in3;
@@ -9523,21 +9534,21 @@ static void
 gf8_muladd_D3(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in3 ^ in5 ^ in6;
         tmp0 = out2 ^ in2;
@@ -9570,21 +9581,21 @@ static void
 gf8_muladd_D4(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in3 ^ in5;
         tmp0 = in1 ^ in5;
@@ -9616,21 +9627,21 @@ static void
 gf8_muladd_D5(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in5;
         tmp0 = in0 ^ in4;
@@ -9662,21 +9673,21 @@ static void
 gf8_muladd_D6(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in2 ^ in4 ^ in6;
         out5 = tmp0 ^ in3;
@@ -9707,21 +9718,21 @@ static void
 gf8_muladd_D7(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in3;
         out3 = in2 ^ in5 ^ in7;
@@ -9753,21 +9764,21 @@ static void
 gf8_muladd_D8(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in0;
         out5 = in1;
@@ -9798,20 +9809,20 @@ static void
 gf8_muladd_D9(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in0 ^ in4;
         out5 = in1 ^ in5;
@@ -9840,21 +9851,21 @@ static void
 gf8_muladd_DA(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out5 = in1 ^ in4;
         tmp0 = in2 ^ in7;
@@ -9885,21 +9896,21 @@ static void
 gf8_muladd_DB(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = in1 ^ in5;
@@ -9933,21 +9944,21 @@ static void
 gf8_muladd_DC(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in2;
         tmp1 = in0 ^ in3;
@@ -9980,20 +9991,20 @@ static void
 gf8_muladd_DD(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in0 ^ in6;
         out2 = in0 ^ in1 ^ in3;
@@ -10022,21 +10033,21 @@ static void
 gf8_muladd_DE(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in3 ^ in6;
         tmp1 = in3 ^ in4 ^ in7;
@@ -10067,21 +10078,21 @@ static void
 gf8_muladd_DF(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in0 ^ in3 ^ in7;
         tmp0 = out2 ^ in1 ^ in5;
@@ -10113,21 +10124,21 @@ static void
 gf8_muladd_E0(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in1 ^ in7;
         tmp0 = in2 ^ in4;
@@ -10158,21 +10169,21 @@ static void
 gf8_muladd_E1(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in1 ^ in4;
         tmp0 = in1 ^ in7;
@@ -10205,20 +10216,20 @@ static void
 gf8_muladd_E2(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in1 ^ in2;
         out4 = in1 ^ in5;
@@ -10247,21 +10258,21 @@ static void
 gf8_muladd_E3(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in4 ^ in7;
         tmp0 = in1 ^ in3;
@@ -10295,21 +10306,21 @@ static void
 gf8_muladd_E4(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in6;
         tmp0 = in0 ^ in4;
@@ -10341,21 +10352,21 @@ static void
 gf8_muladd_E5(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in3 ^ in6;
         tmp0 = in0 ^ in1;
@@ -10387,20 +10398,20 @@ static void
 gf8_muladd_E6(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in2 ^ in6 ^ in7;
         out2 = out3 ^ in0 ^ in4;
@@ -10429,21 +10440,21 @@ static void
 gf8_muladd_E7(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in3;
         out3 = tmp0 ^ in6 ^ in7;
@@ -10477,21 +10488,21 @@ static void
 gf8_muladd_E8(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in3 ^ in6;
         tmp0 = in4 ^ in7;
@@ -10524,21 +10535,21 @@ static void
 gf8_muladd_E9(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = in3 ^ in6;
@@ -10570,20 +10581,20 @@ static void
 gf8_muladd_EA(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in6 ^ in7;
         out5 = in0 ^ in7;
@@ -10612,21 +10623,21 @@ static void
 gf8_muladd_EB(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in4 ^ in5;
         tmp0 = in0 ^ in1;
@@ -10657,20 +10668,20 @@ static void
 gf8_muladd_EC(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out3 = in0 ^ in5;
         out4 = in2 ^ in3 ^ in7;
@@ -10699,21 +10710,21 @@ static void
 gf8_muladd_ED(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in2 ^ in4;
         tmp1 = in3 ^ in5;
@@ -10744,21 +10755,21 @@ static void
 gf8_muladd_EE(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in2;
         tmp0 = in0 ^ in1;
@@ -10791,21 +10802,21 @@ static void
 gf8_muladd_EF(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out4 = in2 ^ in4;
         tmp0 = in0 ^ in5;
@@ -10836,21 +10847,21 @@ static void
 gf8_muladd_F0(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in2;
         tmp1 = in4 ^ in5;
@@ -10883,21 +10894,21 @@ static void
 gf8_muladd_F1(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in1 ^ in6;
         tmp0 = in3 ^ in5;
@@ -10930,21 +10941,21 @@ static void
 gf8_muladd_F2(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in4 ^ in5;
         out2 = in2 ^ in6 ^ in7;
@@ -10977,21 +10988,21 @@ static void
 gf8_muladd_F3(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in6 ^ in7;
         tmp0 = in0 ^ in1;
@@ -11022,21 +11033,21 @@ static void
 gf8_muladd_F4(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in0 ^ in1 ^ in2;
         tmp0 = out2 ^ in3;
@@ -11066,21 +11077,21 @@ static void
 gf8_muladd_F5(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in0 ^ in1;
         tmp0 = out2 ^ in2;
@@ -11110,21 +11121,21 @@ static void
 gf8_muladd_F6(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in7;
         out2 = tmp0 ^ in2;
@@ -11155,21 +11166,21 @@ static void
 gf8_muladd_F7(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in0 ^ in7;
         tmp0 = out2 ^ in1;
@@ -11199,21 +11210,21 @@ static void
 gf8_muladd_F8(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in4;
         tmp1 = in3 ^ in5;
@@ -11245,21 +11256,21 @@ static void
 gf8_muladd_F9(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in3 ^ in5;
         tmp1 = in0 ^ in6;
@@ -11293,21 +11304,21 @@ static void
 gf8_muladd_FA(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = tmp0 ^ in2;
@@ -11340,21 +11351,21 @@ static void
 gf8_muladd_FB(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in5 ^ in6;
         tmp0 = in0 ^ in1;
@@ -11385,21 +11396,21 @@ static void
 gf8_muladd_FC(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in1 ^ in2;
         tmp1 = in0 ^ in7;
@@ -11432,21 +11443,21 @@ static void
 gf8_muladd_FD(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in5;
         tmp1 = in1 ^ in7;
@@ -11479,21 +11490,21 @@ static void
 gf8_muladd_FE(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         tmp0 = in0 ^ in2;
         out2 = tmp0 ^ in5;
@@ -11527,21 +11538,21 @@ static void
 gf8_muladd_FF(void *out, void *in)
 {
     unsigned int i;
-    uint64_t *in_ptr = (uint64_t *)in;
-    uint64_t *out_ptr = (uint64_t *)out;
+    ec_word_t *in_ptr = (ec_word_t *)in;
+    ec_word_t *out_ptr = (ec_word_t *)out;
 
     for (i = 0; i < WIDTH; i++) {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[WIDTH];
-        uint64_t in2 = out_ptr[WIDTH * 2];
-        uint64_t in3 = out_ptr[WIDTH * 3];
-        uint64_t in4 = out_ptr[WIDTH * 4];
-        uint64_t in5 = out_ptr[WIDTH * 5];
-        uint64_t in6 = out_ptr[WIDTH * 6];
-        uint64_t in7 = out_ptr[WIDTH * 7];
+        ec_word_t in0 = out_ptr[0];
+        ec_word_t in1 = out_ptr[WIDTH];
+        ec_word_t in2 = out_ptr[WIDTH * 2];
+        ec_word_t in3 = out_ptr[WIDTH * 3];
+        ec_word_t in4 = out_ptr[WIDTH * 4];
+        ec_word_t in5 = out_ptr[WIDTH * 5];
+        ec_word_t in6 = out_ptr[WIDTH * 6];
+        ec_word_t in7 = out_ptr[WIDTH * 7];
 
         out2 = in0 ^ in5;
         tmp0 = in4 ^ in7;
@@ -90,6 +90,55 @@ ec_code_intel_vex(ec_code_intel_t *intel, gf_boolean_t w, gf_boolean_t l,
     }
 }
 
+static void
+ec_code_intel_evex(ec_code_intel_t *intel, gf_boolean_t w,
+                   ec_code_vex_opcode_t opcode, ec_code_vex_prefix_t prefix,
+                   uint32_t reg)
+{
+    uint32_t r1 = 0, x1 = 0;
+    int32_t offset;
+
+    /* EVEX can address 32 vector registers. The fifth bit of the ModRM.reg
+     * field goes into R' and, for register operands, the fifth bit of the
+     * ModRM.rm field goes into X. */
+    if (intel->modrm.present) {
+        r1 = (intel->modrm.reg >> 4) & 1;
+        intel->modrm.reg &= 0x0F;
+        if (intel->modrm.mod == 3) {
+            x1 = (intel->modrm.rm >> 4) & 1;
+            intel->modrm.rm &= 0x0F;
+        }
+    }
+    ec_code_intel_rex(intel, w);
+    intel->rex.present = _gf_false;
+    if (x1 != 0) {
+        intel->rex.x = 1;
+    }
+
+    /* 8 bit displacements are scaled by the size of the memory operand
+     * (disp8*N). Offsets that are not a multiple of it need 32 bits. */
+    if (intel->offset.bytes == 1) {
+        offset = (int32_t)intel->offset.value;
+        if ((offset % 64) == 0) {
+            intel->offset.value = (uint32_t)(offset / 64);
+        } else {
+            intel->modrm.mod = 2;
+            intel->offset.bytes = 4;
+        }
+    }
+
+    intel->vex.bytes = 4;
+    intel->vex.data[0] = 0x62;
+    intel->vex.data[1] = (((intel->rex.r << 7) | (intel->rex.x << 6) |
+                           (intel->rex.b << 5) | (r1 << 4)) ^
+                          0xF0) |
+                         opcode;
+    intel->vex.data[2] = (intel->rex.w << 7) | ((~reg & 0x0F) << 3) | 0x04 |
+                         prefix;
+    /* 512 bits vector length, no masking. */
+    intel->vex.data[3] = 0x40 | ((~reg & 0x10) >> 1);
+}
+
 static void
 ec_code_intel_modrm_reg(ec_code_intel_t *intel, uint32_t rm, uint32_t reg)
 {
@@ -592,3 +641,98 @@ ec_code_intel_op_xor_m2avx(ec_code_builder_t *builder, ec_code_intel_reg_t base,
 
     ec_code_intel_emit(builder, &intel);
 }
+
+void
+ec_code_intel_op_vzeroupper(ec_code_builder_t *builder)
+{
+    ec_code_intel_t intel;
+
+    ec_code_intel_init(&intel);
+
+    ec_code_intel_op_1(&intel, 0x77, 0);
+    ec_code_intel_vex(&intel, _gf_false, _gf_false, VEX_OPCODE_0F,
+                      VEX_PREFIX_NONE, VEX_REG_NONE);
+
+    ec_code_intel_emit(builder, &intel);
+}
+
+void
+ec_code_intel_op_mov_zmm2zmm(ec_code_builder_t *builder, uint32_t src,
+                             uint32_t dst)
+{
+    ec_code_intel_t intel;
+
+    ec_code_intel_init(&intel);
+
+    ec_code_intel_modrm_reg(&intel, src, dst);
+    ec_code_intel_op_1(&intel, 0x6F, 0);
+    ec_code_intel_evex(&intel, _gf_true, VEX_OPCODE_0F, VEX_PREFIX_66,
+                       VEX_REG_NONE);
+
+    ec_code_intel_emit(builder, &intel);
+}
+
+void
+ec_code_intel_op_mov_zmm2m(ec_code_builder_t *builder, uint32_t src,
+                           ec_code_intel_reg_t base, ec_code_intel_reg_t index,
+                           uint32_t scale, int32_t offset)
+{
+    ec_code_intel_t intel;
+
+    ec_code_intel_init(&intel);
+
+    ec_code_intel_modrm_mem(&intel, src, base, index, scale, offset);
+    ec_code_intel_op_1(&intel, 0x7F, 0);
+    ec_code_intel_evex(&intel, _gf_true, VEX_OPCODE_0F, VEX_PREFIX_F3,
+                       VEX_REG_NONE);
+
+    ec_code_intel_emit(builder, &intel);
+}
+
+void
+ec_code_intel_op_mov_m2zmm(ec_code_builder_t *builder, ec_code_intel_reg_t base,
+                           ec_code_intel_reg_t index, uint32_t scale,
+                           int32_t offset, uint32_t dst)
+{
+    ec_code_intel_t intel;
+
+    ec_code_intel_init(&intel);
+
+    ec_code_intel_modrm_mem(&intel, dst, base, index, scale, offset);
+    ec_code_intel_op_1(&intel, 0x6F, 0);
+    ec_code_intel_evex(&intel, _gf_true, VEX_OPCODE_0F, VEX_PREFIX_F3,
+                       VEX_REG_NONE);
+
+    ec_code_intel_emit(builder, &intel);
+}
+
+void
+ec_code_intel_op_xor_zmm2zmm(ec_code_builder_t *builder, uint32_t src1,
+                             uint32_t src2, uint32_t dst)
+{
+    ec_code_intel_t intel;
+
+    ec_code_intel_init(&intel);
+
+    ec_code_intel_modrm_reg(&intel, src2, dst);
+    ec_code_intel_op_1(&intel, 0xEF, 0);
+    ec_code_intel_evex(&intel, _gf_true, VEX_OPCODE_0F, VEX_PREFIX_66, src1);
+
+    ec_code_intel_emit(builder, &intel);
+}
+
+void
+ec_code_intel_op_xor_m2zmm(ec_code_builder_t *builder, ec_code_intel_reg_t base,
+                           ec_code_intel_reg_t index, uint32_t scale,
+                           int32_t offset, uint32_t dst)
+{
+    ec_code_intel_t intel;
+
+    ec_code_intel_init(&intel);
+
+    ec_code_intel_modrm_mem(&intel, dst, base, index, scale, offset);
+    ec_code_intel_op_1(&intel, 0xEF, 0);
+    ec_code_intel_evex(&intel, _gf_true, VEX_OPCODE_0F, VEX_PREFIX_66, dst);
+
+    ec_code_intel_emit(builder, &intel);
+}
@@ -18,6 +18,7 @@
 #include "ec-combine.h"
 #include "ec-messages.h"
 #include <glusterfs/quota-common-utils.h>
+#include <glusterfs/names-filter.h>
 
 #define EC_QUOTA_PREFIX "trusted.glusterfs.quota."
 
@@ -73,6 +74,9 @@ ec_combine_write(ec_fop_data_t *fop, ec_cbk_data_t *dst, ec_cbk_data_t *src)
         case GF_FOP_ZEROFILL:
             valid = 2;
             break;
+        case GF_FOP_COPY_FILE_RANGE:
+            valid = 3;
+            break;
         case GF_FOP_RENAME:
             valid = 5;
             break;
@@ -246,6 +250,7 @@ ec_value_ignore(char *key)
         (strcmp(key, GLUSTERFS_ENTRYLK_COUNT) == 0) ||
         (strncmp(key, GF_XATTR_CLRLK_CMD, SLEN(GF_XATTR_CLRLK_CMD)) == 0) ||
         (strcmp(key, DHT_IATT_IN_XDATA_KEY) == 0) ||
+        (strcmp(key, GF_NAMES_FILTER_KEY) == 0) ||
         (strncmp(key, EC_QUOTA_PREFIX, SLEN(EC_QUOTA_PREFIX)) == 0) ||
         (fnmatch(MARKER_XATTR_PREFIX ".*." XTIME, key, 0) == 0) ||
         (fnmatch(GF_XATTR_MARKER_KEY ".*", key, 0) == 0) ||
@@ -721,6 +726,58 @@ ec_dict_data_stime(ec_cbk_data_t *cbk, int32_t which, char *key)
     return 0;
 }
 
+/* The names of a directory are the ones of any of its fragments, and a
+ * brick which still waits for an entry heal may be missing some. Send up
+ * the union of the filters of all the answers, or none if a brick of the
+ * accepted one didn't return a filter. */
+static int32_t
+ec_dict_data_names_filter(ec_cbk_data_t *cbk, int32_t which, char *key)
+{
+    ec_t *ec = cbk->fop->xl->private;
+    data_t *data[ec->nodes];
+    gf_names_filter_t *filter = NULL;
+    gf_names_filter_t *src = NULL;
+    dict_t *dict;
+    int32_t i, err;
+
+    ec_dict_list(data, cbk, which, key, _gf_true);
+
+    dict = (which == EC_COMBINE_XDATA) ? cbk->xdata : cbk->dict;
+    for (i = 0; i < ec->nodes; i++) {
+        if (data[i] == EC_MISSING_DATA) {
+            if ((cbk->mask & (1ULL << i)) != 0) {
+                goto drop;
+            }
+            continue;
+        }
+
+        src = gf_names_filter_from_data(data[i]);
+        if (src == NULL) {
+            goto drop;
+        }
+        if (filter == NULL) {
+            filter = src;
+            continue;
+        }
+        err = gf_names_filter_merge_copy(filter, src);
+        GF_FREE(src);
+        if (err != 0) {
+            goto drop;
+        }
+    }
+
+    if ((filter != NULL) && (gf_names_filter_to_dict(dict, filter) == 0)) {
+        GF_FREE(filter);
+        return 0;
+    }
+
+drop:
+    GF_FREE(filter);
+    dict_del(dict, key);
+
+    return 0;
+}
+
 int32_t
 ec_dict_data_combine(dict_t *dict, char *key, data_t *value, void *arg)
 {
@@ -785,6 +842,10 @@ ec_dict_data_combine(dict_t *dict, char *key, data_t *value, void *arg)
         return ec_dict_data_iatt(data->cbk, data->which, key);
     }
 
+    if (strcmp(key, GF_NAMES_FILTER_KEY) == 0) {
+        return ec_dict_data_names_filter(data->cbk, data->which, key);
+    }
+
     return 0;
 }
 
@@ -954,6 +1015,16 @@ ec_combine(ec_cbk_data_t *newcbk, ec_combine_f combine)
 
     fop->received |= newcbk->mask;
 
+    if ((fop->hedge != 0) && (fop->answer != NULL)) {
+        /* A late answer to a hedged read which already went on with the
+         * others. It must not touch the answer being processed. */
+        list_add_tail(&newcbk->list, &fop->cbk_list);
+
+        UNLOCK(&fop->lock);
+
+        return;
+    }
+
     item = fop->cbk_list.prev;
     list_for_each_entry(cbk, &fop->cbk_list, list)
     {
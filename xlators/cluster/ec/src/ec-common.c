@@ -192,7 +192,8 @@ ec_lock_conflict(ec_lock_link_t *l1, ec_lock_link_t *l2)
 static uint32_t
 ec_select_first_by_read_policy(ec_t *ec, ec_fop_data_t *fop)
 {
-    if (ec->read_policy == EC_ROUND_ROBIN) {
+    if ((ec->read_policy == EC_ROUND_ROBIN) ||
+        (ec->read_policy == EC_LEAST_LATENCY)) {
         return ec->idx;
     } else if (ec->read_policy == EC_GFID_HASH) {
         if (fop->use_fd) {
@@ -557,6 +558,25 @@ ec_complete(ec_fop_data_t *fop)
                 }
             }
 
+            resume = 1;
+        }
+    } else if ((fop->hedge != 0) && (fop->answer == NULL) &&
+               !list_empty(&fop->cbk_list)) {
+        /* A hedged read does not wait for the last brick once enough
+         * matching fragments arrived. The bricks still to answer are not
+         * bad, they are left out as if they had not been sent the read. */
+        cbk = list_entry(fop->cbk_list.next, ec_cbk_data_t, list);
+        healing_count = gf_bits_count(cbk->mask & fop->healing);
+        if ((cbk->op_ret >= 0) &&
+            ((cbk->count - healing_count) >= fop->minimum)) {
+            fop->answer = cbk;
+            fop->remaining |= (fop->mask ^ fop->remaining) & ~fop->received;
+            if ((cbk->mask & fop->hedge) != 0) {
+                GF_ATOMIC_INC(
+                    ((ec_t *)fop->xl->private)->stats.read.hedge_wins);
+            }
+
+            update = 1;
             resume = 1;
         }
     }
@@ -672,6 +692,7 @@ ec_is_data_fop(glusterfs_fop_t fop)
         case GF_FOP_FALLOCATE:
         case GF_FOP_DISCARD:
         case GF_FOP_ZEROFILL:
+        case GF_FOP_COPY_FILE_RANGE:
             return _gf_true;
         default:
             return _gf_false;
@@ -719,7 +740,8 @@ ec_child_select(ec_fop_data_t *fop)
             fop->minimum = 1;
     }
 
-    if (ec->read_policy == EC_ROUND_ROBIN) {
+    if ((ec->read_policy == EC_ROUND_ROBIN) ||
+        (ec->read_policy == EC_LEAST_LATENCY)) {
         first = ec->idx;
         if (++first >= ec->nodes) {
             first = 0;
@@ -814,6 +836,7 @@ ec_dispatch_start(ec_fop_data_t *fop)
 {
     fop->answer = NULL;
     fop->good = 0;
+    fop->hedge = 0;
 
     INIT_LIST_HEAD(&fop->cbk_list);
 
@@ -888,6 +911,65 @@ ec_dispatch_all(ec_fop_data_t *fop)
     }
 }
 
+/* Picks the 'count' bricks with the least (pending reads + 1) * latency,
+ * starting from fop->first so that equally good bricks share the load.
+ * Returns in 'last' the worst of them. The latency of the bricks left out
+ * decays, so that a brick which was slow once is tried again later. */
+static uintptr_t
+ec_select_fastest(ec_t *ec, ec_fop_data_t *fop, int32_t count, uint32_t *last)
+{
+    ec_child_reads_t *reads = NULL;
+    uintptr_t mask = 0;
+    uint64_t score, best_score = 0;
+    uint32_t idx, best, i;
+
+    while (count-- > 0) {
+        best = EC_INVALID_INDEX;
+        for (i = 0; i < ec->nodes; i++) {
+            idx = (fop->first + i) % ec->nodes;
+            if (!ec_child_valid(ec, fop, idx) || ((mask >> idx) & 1)) {
+                continue;
+            }
+            reads = &ec->child_reads[idx];
+            score = (GF_ATOMIC_GET(reads->pending) + 1) * (reads->latency + 1);
+            if ((best == EC_INVALID_INDEX) || (score < best_score)) {
+                best = idx;
+                best_score = score;
+            }
+        }
+        if (best == EC_INVALID_INDEX) {
+            break;
+        }
+        mask |= 1ULL << best;
+        *last = best;
+    }
+
+    for (idx = 0; idx < ec->nodes; idx++) {
+        if (ec_child_valid(ec, fop, idx) && !((mask >> idx) & 1)) {
+            ec->child_reads[idx].latency -= ec->child_reads[idx].latency >> 6;
+        }
+    }
+
+    return mask;
+}
+
+/* Accounts the answer of brick 'idx' to a read sent by ec_wind_readv(). */
+void
+ec_read_done(ec_fop_data_t *fop, int32_t idx)
+{
+    ec_t *ec = fop->xl->private;
+    ec_child_reads_t *reads = &ec->child_reads[idx];
+    struct timespec now;
+    uint64_t latency;
+
+    timespec_now(&now);
+    latency = gf_tsdiff(&fop->dispatched, &now) / 1000;
+
+    GF_ATOMIC_DEC(reads->pending);
+    /* Updates can race, losing one sample is harmless. */
+    reads->latency = (reads->latency * 7 + latency) / 8;
+}
+
 void
 ec_dispatch_min(ec_fop_data_t *fop)
 {
@@ -903,13 +985,27 @@ ec_dispatch_min(ec_fop_data_t *fop)
 
         fop->expected = count = ec->fragments;
         fop->first = ec_select_first_by_read_policy(fop->xl->private, fop);
+        if (ec->hedged_reads) {
+            count++;
+        }
         idx = fop->first - 1;
         mask = 0;
-        while (count-- > 0) {
-            idx = ec_child_next(ec, fop, idx + 1);
-            if (idx < EC_MAX_NODES)
-                mask |= 1ULL << idx;
+        if (ec->read_policy == EC_LEAST_LATENCY) {
+            mask = ec_select_fastest(ec, fop, count, &idx);
+        } else {
+            while (count-- > 0) {
+                idx = ec_child_next(ec, fop, idx + 1);
+                if ((idx < EC_MAX_NODES) && !((mask >> idx) & 1)) {
+                    mask |= 1ULL << idx;
+                }
+            }
         }
+        if (gf_bits_count(mask) > ec->fragments) {
+            fop->hedge = 1ULL << idx;
+            GF_ATOMIC_INC(ec->stats.read.hedged);
+        }
+
+        timespec_now(&fop->dispatched);
 
         ec_dispatch_mask(fop, mask);
     }
@@ -1777,7 +1873,14 @@ ec_lock_update_fd(ec_lock_t *lock, ec_fop_data_t *fop)
     /* If the fop has an fd available, attach it to the lock structure to be
      * able to do fxattrop calls instead of xattrop. */
     if (fop->use_fd && (lock->fd == NULL)) {
-        lock->fd = __fd_ref(fop->fd);
+        /* copy_file_range locks two files. Only attach the fd that
+         * belongs to the locked inode. */
+        if ((fop->fd_in != NULL) && (fop->fd_in->inode == lock->loc.inode) &&
+            (fop->fd->inode != lock->loc.inode)) {
+            lock->fd = __fd_ref(fop->fd_in);
+        } else {
+            lock->fd = __fd_ref(fop->fd);
+        }
     }
 }
 
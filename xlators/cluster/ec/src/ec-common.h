@@ -185,6 +185,9 @@ void
 ec_dispatch_inc(ec_fop_data_t *fop);
 void
 ec_dispatch_min(ec_fop_data_t *fop);
+
+void
+ec_read_done(ec_fop_data_t *fop, int32_t idx);
 void
 ec_dispatch_one(ec_fop_data_t *fop);
 
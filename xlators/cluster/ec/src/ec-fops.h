@@ -208,6 +208,12 @@ ec_discard(call_frame_t *frame, xlator_t *this, uintptr_t target,
            uint32_t fop_flags, fop_discard_cbk_t func, void *data, fd_t *fd,
            off_t offset, size_t len, dict_t *xdata);
 
+void
+ec_copy_file_range(call_frame_t *frame, xlator_t *this, uintptr_t target,
+                   uint32_t fop_flags, fop_copy_file_range_cbk_t func,
+                   void *data, fd_t *fd_in, off64_t off_in, fd_t *fd_out,
+                   off64_t off_out, size_t len, uint32_t flags, dict_t *xdata);
+
 void
 ec_truncate(call_frame_t *frame, xlator_t *this, uintptr_t target,
             uint32_t fop_flags, fop_truncate_cbk_t func, void *data, loc_t *loc,
@@ -1281,6 +1281,8 @@ ec_readv_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int32_t op_ret,
     ec_trace("CBK", fop, "idx=%d, frame=%p, op_ret=%d, op_errno=%d", idx, frame,
              op_ret, op_errno);
 
+    ec_read_done(fop, idx);
+
     cbk = ec_cbk_data_allocate(frame, this, fop, GF_FOP_READ, idx, op_ret,
                                op_errno);
     if (cbk != NULL) {
@@ -1343,6 +1345,8 @@ ec_wind_readv(ec_t *ec, ec_fop_data_t *fop, int32_t idx)
 {
     ec_trace("WIND", fop, "idx=%d", idx);
 
+    GF_ATOMIC_INC(ec->child_reads[idx].pending);
+
     STACK_WIND_COOKIE(fop->frame, ec_readv_cbk, (void *)(uintptr_t)idx,
                       ec->xl_list[idx], ec->xl_list[idx]->fops->readv, fop->fd,
                       fop->size, fop->offset, fop->uint32, fop->xdata);
@@ -1342,6 +1342,333 @@ out:
     }
 }
 
+/*********************************************************************
+ *
+ * File Operation : Copy file range
+ *
+ *********************************************************************/
+
+int32_t
+ec_copy_file_range_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
+                       int32_t op_ret, int32_t op_errno, struct iatt *stbuf,
+                       struct iatt *prebuf_dst, struct iatt *postbuf_dst,
+                       dict_t *xdata)
+{
+    ec_fop_data_t *fop = NULL;
+    ec_cbk_data_t *cbk = NULL;
+    int32_t idx = (int32_t)(uintptr_t)cookie;
+
+    VALIDATE_OR_GOTO(this, out);
+    GF_VALIDATE_OR_GOTO(this->name, frame, out);
+    GF_VALIDATE_OR_GOTO(this->name, frame->local, out);
+    GF_VALIDATE_OR_GOTO(this->name, this->private, out);
+
+    fop = frame->local;
+
+    ec_trace("CBK", fop, "idx=%d, frame=%p, op_ret=%d, op_errno=%d", idx, frame,
+             op_ret, op_errno);
+
+    cbk = ec_cbk_data_allocate(frame, this, fop, fop->id, idx, op_ret,
+                               op_errno);
+    if (!cbk)
+        goto out;
+
+    if (op_ret < 0)
+        goto out;
+
+    if (xdata)
+        cbk->xdata = dict_ref(xdata);
+
+    if (stbuf)
+        cbk->iatt[0] = *stbuf;
+    if (prebuf_dst)
+        cbk->iatt[1] = *prebuf_dst;
+    if (postbuf_dst)
+        cbk->iatt[2] = *postbuf_dst;
+
+out:
+    if (cbk)
+        ec_combine(cbk, ec_combine_write);
+
+    if (fop)
+        ec_complete(fop);
+    return 0;
+}
+
+void
+ec_wind_copy_file_range(ec_t *ec, ec_fop_data_t *fop, int32_t idx)
+{
+    ec_trace("WIND", fop, "idx=%d", idx);
+
+    STACK_WIND_COOKIE(fop->frame, ec_copy_file_range_cbk,
+                      (void *)(uintptr_t)idx, ec->xl_list[idx],
+                      ec->xl_list[idx]->fops->copy_file_range, fop->fd_in,
+                      fop->offset_in / ec->fragments, fop->fd,
+                      fop->offset / ec->fragments, fop->size, fop->uint32,
+                      fop->xdata);
+}
+
+/* Every brick copies its own fragments, so the source must be readable
+ * through the same fd on all bricks that take part in the copy. */
+static gf_boolean_t
+ec_copy_file_range_fd_ready(ec_fop_data_t *fop)
+{
+    ec_t *ec = fop->xl->private;
+    ec_fd_t *ctx = NULL;
+    gf_boolean_t ready = _gf_true;
+    int32_t i = 0;
+
+    if (fd_is_anonymous(fop->fd_in))
+        return _gf_true;
+
+    ctx = ec_fd_get(fop->fd_in, fop->xl);
+    if (ctx == NULL)
+        return _gf_false;
+
+    LOCK(&fop->fd_in->lock);
+    {
+        for (i = 0; i < ec->nodes; i++) {
+            if (((fop->mask & (1ULL << i)) != 0) &&
+                (ctx->fd_status[i] != EC_FD_OPENED)) {
+                ready = _gf_false;
+                break;
+            }
+        }
+    }
+    UNLOCK(&fop->fd_in->lock);
+
+    return ready;
+}
+
+/* Once both inodes are locked their real sizes are known. The copy is
+ * clamped to the end of the source and translated to fragment units. A
+ * partial last stripe can only be copied when it lands at or past the end
+ * of the destination, because the zero padding that comes with it would
+ * otherwise overwrite existing data. */
+static int32_t
+ec_copy_file_range_prepare(ec_fop_data_t *fop)
+{
+    ec_t *ec = fop->xl->private;
+    uint64_t size_in = 0;
+    uint64_t size_out = 0;
+    uint64_t len = 0;
+
+    if (fop->healing != 0) {
+        return EXDEV;
+    }
+
+    if (!ec_get_inode_size(fop, fop->fd_in->inode, &size_in) ||
+        !ec_get_inode_size(fop, fop->fd->inode, &size_out)) {
+        return EIO;
+    }
+
+    len = fop->user_size;
+    if (fop->offset_in >= size_in) {
+        len = 0;
+    } else if (len > size_in - fop->offset_in) {
+        len = size_in - fop->offset_in;
+    }
+
+    if (((len % ec->stripe_size) != 0) && (fop->offset + len < size_out)) {
+        return EXDEV;
+    }
+
+    if (!ec_copy_file_range_fd_ready(fop)) {
+        return EXDEV;
+    }
+
+    fop->user_size = len;
+    fop->size = len;
+    ec_adjust_size_up(ec, &fop->size, _gf_true);
+
+    fop->frag_range.first = fop->offset / ec->fragments;
+    fop->frag_range.last = fop->frag_range.first + fop->size;
+
+    return 0;
+}
+
+int32_t
+ec_manager_copy_file_range(ec_fop_data_t *fop, int32_t state)
+{
+    ec_t *ec = fop->xl->private;
+    ec_cbk_data_t *cbk = NULL;
+    uint64_t fl_size = 0;
+    uint64_t size = 0;
+    int32_t err = 0;
+
+    switch (state) {
+        case EC_STATE_INIT:
+            if ((fop->offset < 0) || (fop->offset_in < 0)) {
+                ec_fop_set_error(fop, EINVAL);
+                return EC_STATE_REPORT;
+            }
+            /* Bricks can only copy whole fragments between stripes at the
+             * same position. Anything else needs to be re-encoded, so let
+             * the caller fall back to read/write. */
+            if (((fop->offset % ec->stripe_size) != 0) ||
+                ((fop->offset_in % ec->stripe_size) != 0)) {
+                ec_fop_set_error(fop, EXDEV);
+                return EC_STATE_REPORT;
+            }
+            fop->user_size = fop->size;
+
+            /* Fall through */
+
+        case EC_STATE_LOCK:
+            fl_size = fop->user_size;
+            ec_adjust_size_up(ec, &fl_size, _gf_false);
+
+            ec_lock_prepare_fd(fop, fop->fd_in, EC_QUERY_INFO, fop->offset_in,
+                               fl_size);
+            ec_lock_prepare_fd(fop, fop->fd,
+                               EC_UPDATE_DATA | EC_UPDATE_META | EC_QUERY_INFO,
+                               fop->offset, fl_size);
+            ec_lock(fop);
+
+            return EC_STATE_DISPATCH;
+
+        case EC_STATE_DISPATCH:
+            err = ec_copy_file_range_prepare(fop);
+            if (err != 0) {
+                ec_fop_set_error(fop, err);
+                return EC_STATE_REPORT;
+            }
+
+            ec_dispatch_all(fop);
+
+            return EC_STATE_PREPARE_ANSWER;
+
+        case EC_STATE_PREPARE_ANSWER:
+            cbk = ec_fop_prepare_answer(fop, _gf_false);
+            if (cbk != NULL) {
+                ec_iatt_rebuild(ec, cbk->iatt, 3, cbk->count);
+
+                /* These shouldn't fail because we have the inodes locked. */
+                GF_ASSERT(ec_get_inode_size(fop, fop->fd_in->inode,
+                                            &cbk->iatt[0].ia_size));
+
+                if (fop->error == 0) {
+                    cbk->op_ret *= ec->fragments;
+                    if (cbk->op_ret > fop->user_size) {
+                        cbk->op_ret = fop->user_size;
+                    }
+                }
+
+                LOCK(&fop->fd->inode->lock);
+                {
+                    GF_ASSERT(__ec_get_inode_size(fop, fop->fd->inode,
+                                                  &cbk->iatt[1].ia_size));
+                    cbk->iatt[2].ia_size = cbk->iatt[1].ia_size;
+                    size = fop->offset + cbk->op_ret;
+                    if ((fop->error == 0) && (size > cbk->iatt[1].ia_size)) {
+                        GF_ASSERT(
+                            __ec_set_inode_size(fop, fop->fd->inode, size));
+                        cbk->iatt[2].ia_size = size;
+                    }
+                }
+                UNLOCK(&fop->fd->inode->lock);
+            }
+
+            return EC_STATE_REPORT;
+
+        case EC_STATE_REPORT:
+            cbk = fop->answer;
+
+            GF_ASSERT(cbk != NULL);
+
+            if (fop->cbks.copy_file_range != NULL) {
+                QUORUM_CBK(fop->cbks.copy_file_range, fop, fop->req_frame, fop,
+                           fop->xl, cbk->op_ret, cbk->op_errno, &cbk->iatt[0],
+                           &cbk->iatt[1], &cbk->iatt[2], cbk->xdata);
+            }
+
+            return EC_STATE_LOCK_REUSE;
+
+        case -EC_STATE_INIT:
+        case -EC_STATE_LOCK:
+        case -EC_STATE_DISPATCH:
+        case -EC_STATE_PREPARE_ANSWER:
+        case -EC_STATE_REPORT:
+            GF_ASSERT(fop->error != 0);
+
+            if (fop->cbks.copy_file_range != NULL) {
+                fop->cbks.copy_file_range(fop->req_frame, fop, fop->xl, -1,
+                                          fop->error, NULL, NULL, NULL, NULL);
+            }
+
+            return EC_STATE_LOCK_REUSE;
+
+        case -EC_STATE_LOCK_REUSE:
+        case EC_STATE_LOCK_REUSE:
+            ec_lock_reuse(fop);
+
+            return EC_STATE_UNLOCK;
+
+        case -EC_STATE_UNLOCK:
+        case EC_STATE_UNLOCK:
+            ec_unlock(fop);
+
+            return EC_STATE_END;
+
+        default:
+            gf_msg(fop->xl->name, GF_LOG_ERROR, EINVAL, EC_MSG_UNHANDLED_STATE,
+                   "Unhandled state %d for %s", state, ec_fop_name(fop->id));
+
+            return EC_STATE_END;
+    }
+}
+
+void
+ec_copy_file_range(call_frame_t *frame, xlator_t *this, uintptr_t target,
+                   uint32_t fop_flags, fop_copy_file_range_cbk_t func,
+                   void *data, fd_t *fd_in, off64_t off_in, fd_t *fd_out,
+                   off64_t off_out, size_t len, uint32_t flags, dict_t *xdata)
+{
+    ec_cbk_t callback = {.copy_file_range = func};
+    ec_fop_data_t *fop = NULL;
+    int32_t error = ENOMEM;
+
+    gf_msg_trace("ec", 0, "EC(COPY_FILE_RANGE) %p", frame);
+
+    VALIDATE_OR_GOTO(this, out);
+    GF_VALIDATE_OR_GOTO(this->name, frame, out);
+    GF_VALIDATE_OR_GOTO(this->name, this->private, out);
+
+    fop = ec_fop_data_allocate(frame, this, GF_FOP_COPY_FILE_RANGE, 0, target,
+                               fop_flags, ec_wind_copy_file_range,
+                               ec_manager_copy_file_range, callback, data);
+    if (fop == NULL) {
+        goto out;
+    }
+
+    fop->use_fd = 1;
+    fop->offset_in = off_in;
+    fop->offset = off_out;
+    fop->size = len;
+    fop->uint32 = flags;
+
+    if (fd_in != NULL) {
+        fop->fd_in = fd_ref(fd_in);
+    }
+
+    if (fd_out != NULL) {
+        fop->fd = fd_ref(fd_out);
+    }
+
+    if (xdata != NULL) {
+        fop->xdata = dict_ref(xdata);
+    }
+
+    error = 0;
+
+out:
+    if (fop != NULL) {
+        ec_manager(fop, error);
+    } else {
+        func(frame, NULL, this, -1, error, NULL, NULL, NULL, NULL);
+    }
+}
+
 /*********************************************************************
  *
  * File Operation : truncate
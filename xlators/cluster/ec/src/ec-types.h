@@ -121,6 +121,9 @@ typedef struct _ec_self_heald ec_self_heald_t;
 struct _ec_statistics;
 typedef struct _ec_statistics ec_statistics_t;
 
+struct _ec_child_reads;
+typedef struct _ec_child_reads ec_child_reads_t;
+
 struct _ec;
 typedef struct _ec ec_t;
 
@@ -128,7 +131,12 @@ typedef void (*ec_wind_f)(ec_t *, ec_fop_data_t *, int32_t);
 typedef int32_t (*ec_handler_f)(ec_fop_data_t *, int32_t);
 typedef void (*ec_resume_f)(ec_fop_data_t *, int32_t);
 
-enum _ec_read_policy { EC_ROUND_ROBIN, EC_GFID_HASH, EC_READ_POLICY_MAX };
+enum _ec_read_policy {
+    EC_ROUND_ROBIN,
+    EC_GFID_HASH,
+    EC_LEAST_LATENCY,
+    EC_READ_POLICY_MAX
+};
 
 enum _ec_heal_need {
     EC_HEAL_NONEED,
@@ -200,6 +208,7 @@ union _ec_cbk {
     fop_access_cbk_t access;
     fop_create_cbk_t create;
     fop_discard_cbk_t discard;
+    fop_copy_file_range_cbk_t copy_file_range;
     fop_entrylk_cbk_t entrylk;
     fop_fentrylk_cbk_t fentrylk;
     fop_fallocate_cbk_t fallocate;
@@ -347,6 +356,10 @@ struct _ec_fop_data {
     uintptr_t remaining;
     uintptr_t received; /* Mask of responses */
     uintptr_t good;
+    uintptr_t hedge; /* Extra brick a hedged read has been sent to. The read
+                        goes on as soon as enough matching answers arrived,
+                        without waiting for the last brick. */
+    struct timespec dispatched; /* When the reads were sent to the bricks */
 
     uid_t uid;
     gid_t gid;
@@ -371,6 +384,7 @@ struct _ec_fop_data {
     uint32_t uint32;
     uint64_t size;
     off_t offset;
+    off_t offset_in; /* Source offset of copy_file_range */
     mode_t mode[2];
     entrylk_cmd entrylk_cmd;
     entrylk_type entrylk_type;
@@ -379,6 +393,7 @@ struct _ec_fop_data {
     inode_t *inode;
     fd_t *fd; /* FD of the file on which FOP is
                  being carried upon */
+    fd_t *fd_in; /* Source FD of copy_file_range */
     struct iatt iatt;
     char *str[2];
     loc_t loc[2]; /* Holds the location details for
@@ -599,6 +614,13 @@ struct _ec_self_heald {
     struct subvol_healer *full_healers;
 };
 
+/* Reads in flight on a brick and a moving average of how long they take,
+ * used to send reads to the bricks which answer fastest. */
+struct _ec_child_reads {
+    gf_atomic_t pending;
+    uint64_t latency; /* In microseconds. */
+};
+
 struct _ec_statistics {
     struct {
         gf_atomic_t hits;    /* Cache hits. */
@@ -622,6 +644,12 @@ struct _ec_statistics {
                                 files/directories*/
         gf_atomic_t completed; /*Number of heals complted on files/directories*/
     } shd;
+    struct {
+        gf_atomic_t hedged;     /* Reads sent to one brick more than
+                                   needed. */
+        gf_atomic_t hedge_wins; /* Hedged reads the extra brick answered
+                                   before one of the others. */
+    } read;
 };
 
 struct _ec {
@@ -674,6 +702,8 @@ struct _ec {
     char vol_uuid[GF_UUID_BUF_SIZE];
     dict_t *leaf_to_subvolid;
     ec_read_policy_t read_policy;
+    gf_boolean_t hedged_reads;
+    ec_child_reads_t *child_reads;
     ec_matrix_list_t matrix;
     ec_statistics_t stats;
 };
@@ -27,6 +27,7 @@
 static char *ec_read_policies[EC_READ_POLICY_MAX + 1] = {
     [EC_ROUND_ROBIN] = "round-robin",
     [EC_GFID_HASH] = "gfid-hash",
+    [EC_LEAST_LATENCY] = "least-latency",
     [EC_READ_POLICY_MAX] = NULL};
 
 #define EC_INTERNAL_XATTR_OR_GOTO(name, xattr, op_errno, label)                \
@@ -107,11 +108,20 @@ ec_prepare_childs(xlator_t *this)
 
         return ENOMEM;
     }
+    ec->child_reads = GF_CALLOC(count, sizeof(ec->child_reads[0]),
+                                ec_mt_ec_child_reads_t);
+    if (ec->child_reads == NULL) {
+        gf_msg(this->name, GF_LOG_ERROR, ENOMEM, EC_MSG_NO_MEMORY,
+               "Allocation of read statistics failed");
+
+        return ENOMEM;
+    }
     ec->xl_up = 0;
     ec->xl_up_count = 0;
 
     count = 0;
     for (child = this->children; child != NULL; child = child->next) {
+        GF_ATOMIC_INIT(ec->child_reads[count].pending, 0);
         ec->xl_list[count++] = child->xlator;
     }
 
@@ -177,6 +187,7 @@ __ec_destroy_private(xlator_t *this)
             GF_FREE(ec->xl_list);
             ec->xl_list = NULL;
         }
+        GF_FREE(ec->child_reads);
 
         if (ec->fop_pool != NULL) {
             mem_pool_destroy(ec->fop_pool);
@@ -278,6 +289,7 @@ reconfigure(xlator_t *this, dict_t *options)
                      failed);
 
     GF_OPTION_RECONF("read-policy", read_policy, options, str, failed);
+    GF_OPTION_RECONF("hedged-reads", ec->hedged_reads, options, bool, failed);
 
     GF_OPTION_RECONF("optimistic-change-log", ec->optimistic_changelog, options,
                      bool, failed);
@@ -711,6 +723,8 @@ ec_statistics_init(ec_t *ec)
     GF_ATOMIC_INIT(ec->stats.stripe_cache.errors, 0);
     GF_ATOMIC_INIT(ec->stats.shd.attempted, 0);
     GF_ATOMIC_INIT(ec->stats.shd.completed, 0);
+    GF_ATOMIC_INIT(ec->stats.read.hedged, 0);
+    GF_ATOMIC_INIT(ec->stats.read.hedge_wins, 0);
 }
 
 static int
@@ -859,6 +873,7 @@ init(xlator_t *this)
     GF_OPTION_INIT("read-policy", read_policy, str, failed);
     if (ec_assign_read_policy(ec, read_policy))
         goto failed;
+    GF_OPTION_INIT("hedged-reads", ec->hedged_reads, bool, failed);
 
     GF_OPTION_INIT("heal-timeout", ec->shd.timeout, time, failed);
     GF_OPTION_INIT("shd-max-threads", ec->shd.max_threads, uint32, failed);
@@ -945,6 +960,18 @@ ec_gf_discard(call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
     return 0;
 }
 
+int32_t
+ec_gf_copy_file_range(call_frame_t *frame, xlator_t *this, fd_t *fd_in,
+                      off64_t off_in, fd_t *fd_out, off64_t off_out,
+                      size_t len, uint32_t flags, dict_t *xdata)
+{
+    ec_copy_file_range(frame, this, -1, EC_MINIMUM_MIN,
+                       default_copy_file_range_cbk, NULL, fd_in, off_in, fd_out,
+                       off_out, len, flags, xdata);
+
+    return 0;
+}
+
 int32_t
 ec_gf_entrylk(call_frame_t *frame, xlator_t *this, const char *volume,
               loc_t *loc, const char *basename, entrylk_cmd cmd,
@@ -1529,7 +1556,9 @@ ec_dump_private(xlator_t *this)
 {
     ec_t *ec = NULL;
     char key_prefix[GF_DUMP_MAX_BUF_LEN];
+    char key[GF_DUMP_MAX_BUF_LEN];
     char tmp[65];
+    int32_t i;
 
     GF_ASSERT(this);
 
@@ -1557,6 +1586,14 @@ ec_dump_private(xlator_t *this)
     gf_proc_dump_write("healers", "%d", ec->healers);
     gf_proc_dump_write("heal-waiters", "%d", ec->heal_waiters);
     gf_proc_dump_write("read-policy", "%s", ec_read_policies[ec->read_policy]);
+    gf_proc_dump_write("hedged-reads", "%d", ec->hedged_reads);
+    for (i = 0; i < ec->nodes; i++) {
+        sprintf(key, "pending_reads[%d]", i);
+        gf_proc_dump_write(key, "%" GF_PRI_ATOMIC,
+                           GF_ATOMIC_GET(ec->child_reads[i].pending));
+        sprintf(key, "read_latency[%d]", i);
+        gf_proc_dump_write(key, "%" PRIu64, ec->child_reads[i].latency);
+    }
     gf_proc_dump_write("parallel-writes", "%d", ec->parallel_writes);
     gf_proc_dump_write("quorum-count", "%u", ec->quorum_count);
 
@@ -1582,6 +1619,10 @@ ec_dump_private(xlator_t *this)
                        GF_ATOMIC_GET(ec->stats.shd.attempted));
     gf_proc_dump_write("heals-completed", "%" GF_PRI_ATOMIC,
                        GF_ATOMIC_GET(ec->stats.shd.completed));
+    gf_proc_dump_write("reads-hedged", "%" GF_PRI_ATOMIC,
+                       GF_ATOMIC_GET(ec->stats.read.hedged));
+    gf_proc_dump_write("reads-hedge-won", "%" GF_PRI_ATOMIC,
+                       GF_ATOMIC_GET(ec->stats.read.hedge_wins));
 
     return 0;
 }
@@ -1630,6 +1671,7 @@ struct xlator_fops fops = {.lookup = ec_gf_lookup,
                            .discard = ec_gf_discard,
                            .zerofill = ec_gf_zerofill,
                            .seek = ec_gf_seek,
+                           .copy_file_range = ec_gf_copy_file_range,
                            .ipc = ec_gf_ipc};
 
 struct xlator_cbks cbks = {.forget = ec_gf_forget,
@@ -1749,7 +1791,7 @@ struct volume_options options[] = {
     {
         .key = {"read-policy"},
         .type = GF_OPTION_TYPE_STR,
-        .value = {"round-robin", "gfid-hash"},
+        .value = {"round-robin", "gfid-hash", "least-latency"},
         .default_value = "gfid-hash",
         .op_version = {GD_OP_VERSION_3_7_6},
         .flags = OPT_FLAG_SETTABLE | OPT_FLAG_CLIENT_OPT | OPT_FLAG_DOC,
@@ -1758,7 +1800,22 @@ struct volume_options options[] = {
             "inode-read fops happen only on 'k' number of bricks in"
             " n=k+m disperse subvolume. 'round-robin' selects the read"
             " subvolume using round-robin algo. 'gfid-hash' selects read"
-            " subvolume based on hash of the gfid of that file/directory.",
+            " subvolume based on hash of the gfid of that file/directory."
+            " 'least-latency' reads from the bricks with the least"
+            " (pending reads + 1) * read latency.",
+    },
+    {
+        .key = {"hedged-reads"},
+        .type = GF_OPTION_TYPE_BOOL,
+        .default_value = "off",
+        .op_version = {GD_OP_VERSION_11_0},
+        .flags = OPT_FLAG_SETTABLE | OPT_FLAG_CLIENT_OPT | OPT_FLAG_DOC,
+        .tags = {"disperse"},
+        .description =
+            "Send reads to one brick more than needed and decode from the"
+            " first 'k' matching answers, so that a slow brick does not"
+            " delay them. Costs the bandwidth of one more fragment per"
+            " read.",
     },
     {.key = {"shd-max-threads"},
      .type = GF_OPTION_TYPE_INT,
@@ -1784,7 +1841,7 @@ struct volume_options options[] = {
                     " that can wait in SHD per subvolume."},
     {.key = {"cpu-extensions"},
      .type = GF_OPTION_TYPE_STR,
-     .value = {"none", "auto", "x64", "sse", "avx"},
+     .value = {"none", "auto", "x64", "sse", "avx", "avx512"},
      .default_value = "auto",
      .op_version = {GD_OP_VERSION_3_9_0},
      .flags = OPT_FLAG_SETTABLE | OPT_FLAG_CLIENT_OPT | OPT_FLAG_DOC,
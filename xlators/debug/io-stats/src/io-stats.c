@@ -135,6 +135,7 @@ struct ios_global_stats {
     gf_atomic_t upcall_hits[GF_UPCALL_FLAGS_MAXVALUE];
     time_t started_at;
     struct ios_lat latency[GF_FOP_MAXVALUE];
+    gf_latency_hist_t *hist; /* one per fop, updated without conf->lock */
     uint64_t nr_opens;
     uint64_t max_nr_opens;
     struct timeval max_openfd_time;
@@ -735,6 +736,21 @@ err:
     return ret;
 }
 
+static void
+ios_fop_percentiles(struct ios_global_stats *stats, int fop,
+                    uint64_t pct[GF_LATENCY_PCT_MAX])
+{
+    int p = 0;
+
+    if (stats->hist) {
+        gf_latency_hist_percentiles(&stats->hist[fop], pct);
+        return;
+    }
+
+    for (p = 0; p < GF_LATENCY_PCT_MAX; p++)
+        pct[p] = 0;
+}
+
 int
 io_stats_dump_global_to_json_logfp(xlator_t *this,
                                    struct ios_global_stats *stats, time_t now,
@@ -759,6 +775,8 @@ io_stats_dump_global_to_json_logfp(xlator_t *this,
     double weighted_fop_ave_usec = 0.0;
     double weighted_fop_ave_usec_sum = 0.0;
     long total_fop_hits = 0;
+    uint64_t pct[GF_LATENCY_PCT_MAX];
+    int p = 0;
     loc_t unused_loc = {
         0,
     };
@@ -852,6 +870,13 @@ io_stats_dump_global_to_json_logfp(xlator_t *this,
         ios_log(this, logfp, "\"%s.%s.fop.%s.latency_max_usec\": %0.2lf,",
                 key_prefix, str_prefix, lc_fop_name, fop_lat_max);
 
+        ios_fop_percentiles(stats, i, pct);
+        for (p = 0; p < GF_LATENCY_PCT_MAX; p++)
+            ios_log(this, logfp,
+                    "\"%s.%s.fop.%s.latency_%s_usec\": %" PRIu64 ",",
+                    key_prefix, str_prefix, lc_fop_name,
+                    gf_latency_pct_names[p], pct[p]);
+
         fop_ave_usec_sum += fop_lat_ave;
         weighted_fop_ave_usec_sum += fop_hits * fop_lat_ave;
         total_fop_hits += fop_hits;
@@ -1282,6 +1307,7 @@ io_stats_dump_global_to_logfp(xlator_t *this, struct ios_global_stats *stats,
     uint64_t fop_hits = 0;
     uint64_t block_count_read = 0;
     uint64_t block_count_write = 0;
+    uint64_t pct[GF_LATENCY_PCT_MAX];
     glusterfs_ctx_t *ctx;
 
     conf = this->private;
@@ -1348,10 +1374,12 @@ io_stats_dump_global_to_logfp(xlator_t *this, struct ios_global_stats *stats,
         ios_log(this, logfp, "%s\n", str_write);
     }
 
-    ios_log(this, logfp, "%-13s %10s %14s %14s %14s", "Fop", "Call Count",
-            "Avg-Latency", "Min-Latency", "Max-Latency");
-    ios_log(this, logfp, "%-13s %10s %14s %14s %14s", "---", "----------",
-            "-----------", "-----------", "-----------");
+    ios_log(this, logfp, "%-13s %10s %14s %14s %14s %14s %14s %14s %14s",
+            "Fop", "Call Count", "Avg-Latency", "Min-Latency", "Max-Latency",
+            "P50-Latency", "P90-Latency", "P99-Latency", "P99.9-Latency");
+    ios_log(this, logfp, "%-13s %10s %14s %14s %14s %14s %14s %14s %14s",
+            "---", "----------", "-----------", "-----------", "-----------",
+            "-----------", "-----------", "-----------", "-------------");
 
     for (i = 0; i < GF_FOP_MAXVALUE; i++) {
         fop_hits = GF_ATOMIC_GET(stats->fop_hits[i]);
@@ -1359,15 +1387,21 @@ io_stats_dump_global_to_logfp(xlator_t *this, struct ios_global_stats *stats,
             ios_log(this, logfp,
                     "%-13s %10" GF_PRI_ATOMIC
                     " %11s "
-                    "us %11s us %11s us",
-                    gf_fop_list[i], fop_hits, "0", "0", "0");
-        else if (fop_hits && stats->latency[i].avg)
+                    "us %11s us %11s us %11s us %11s us %11s us %11s us",
+                    gf_fop_list[i], fop_hits, "0", "0", "0", "0", "0", "0",
+                    "0");
+        else if (fop_hits && stats->latency[i].avg) {
+            ios_fop_percentiles(stats, i, pct);
             ios_log(this, logfp,
                     "%-13s %10" GF_PRI_ATOMIC
                     " "
-                    "%11.2lf us %11.2lf us %11.2lf us",
+                    "%11.2lf us %11.2lf us %11.2lf us %11" PRIu64
+                    " us %11" PRIu64 " us %11" PRIu64 " us %11" PRIu64 " us",
                     gf_fop_list[i], fop_hits, stats->latency[i].avg,
-                    stats->latency[i].min, stats->latency[i].max);
+                    stats->latency[i].min, stats->latency[i].max,
+                    pct[GF_LATENCY_P50], pct[GF_LATENCY_P90],
+                    pct[GF_LATENCY_P99], pct[GF_LATENCY_P999]);
+        }
     }
 
     for (i = 0; i < GF_UPCALL_FLAGS_MAXVALUE; i++) {
@@ -1448,6 +1482,8 @@ io_stats_dump_global_to_dict(xlator_t *this, struct ios_global_stats *stats,
     int i = 0;
     uint64_t count = 0;
     uint64_t fop_hits = 0;
+    uint64_t pct[GF_LATENCY_PCT_MAX];
+    int p = 0;
 
     GF_ASSERT(stats);
     GF_ASSERT(now);
@@ -1568,6 +1604,21 @@ io_stats_dump_global_to_dict(xlator_t *this, struct ios_global_stats *stats,
                    gf_fop_list[i], interval, stats->latency[i].max);
             goto out;
         }
+
+        ios_fop_percentiles(stats, i, pct);
+        for (p = 0; p < GF_LATENCY_PCT_MAX; p++) {
+            snprintf(key, sizeof(key), "%d-%d-%slatency", interval, i,
+                     gf_latency_pct_names[p]);
+            ret = dict_set_uint64(dict, key, pct[p]);
+            if (ret) {
+                gf_log(this->name, GF_LOG_ERROR,
+                       "failed to set %s "
+                       "%slatency(%d) with %" PRIu64,
+                       gf_fop_list[i], gf_latency_pct_names[p], interval,
+                       pct[p]);
+                goto out;
+            }
+        }
     }
     for (i = 0; i < GF_UPCALL_FLAGS_MAXVALUE; i++) {
         fop_hits = GF_ATOMIC_GET(stats->upcall_hits[i]);
@@ -1650,11 +1701,44 @@ ios_dump_args_init(struct ios_dump_args *args, ios_dump_type_t type,
 static void
 ios_global_stats_clear(struct ios_global_stats *stats, time_t now)
 {
+    gf_latency_hist_t *hist = NULL;
+    int i = 0;
+
     GF_ASSERT(stats);
     GF_ASSERT(now);
 
+    hist = stats->hist;
     memset(stats, 0, sizeof(*stats));
     stats->started_at = now;
+
+    /* fops in flight may still bump a bucket while we clear, which is no
+     * worse than what the plain latency counters already tolerate */
+    stats->hist = hist;
+    if (hist) {
+        for (i = 0; i < GF_FOP_MAXVALUE; i++)
+            gf_latency_hist_reset(&hist[i]);
+    }
+}
+
+/* Copies the histograms out of 'stats' so they can be dumped without
+ * holding conf->lock. The caller frees the result. */
+static gf_latency_hist_t *
+ios_global_stats_hist_snapshot(struct ios_global_stats *stats)
+{
+    gf_latency_hist_t *snap = NULL;
+    int i = 0;
+
+    if (!stats->hist)
+        return NULL;
+
+    snap = gf_latency_hist_new(GF_FOP_MAXVALUE);
+    if (!snap)
+        return NULL;
+
+    for (i = 0; i < GF_FOP_MAXVALUE; i++)
+        gf_latency_hist_merge(&snap[i], &stats->hist[i]);
+
+    return snap;
 }
 
 int
@@ -1677,11 +1761,16 @@ io_stats_dump(xlator_t *this, struct ios_dump_args *args, ios_info_op_t op,
 
     LOCK(&conf->lock);
     {
-        if (op == GF_IOS_INFO_ALL || op == GF_IOS_INFO_CUMULATIVE)
+        if (op == GF_IOS_INFO_ALL || op == GF_IOS_INFO_CUMULATIVE) {
             cumulative = conf->cumulative;
+            cumulative.hist = ios_global_stats_hist_snapshot(
+                &conf->cumulative);
+        }
 
         if (op == GF_IOS_INFO_ALL || op == GF_IOS_INFO_INCREMENTAL) {
             incremental = conf->incremental;
+            incremental.hist = ios_global_stats_hist_snapshot(
+                &conf->incremental);
             increment = conf->increment;
 
             if (!is_peek) {
@@ -1699,6 +1788,9 @@ io_stats_dump(xlator_t *this, struct ios_dump_args *args, ios_info_op_t op,
     if (op == GF_IOS_INFO_ALL || op == GF_IOS_INFO_INCREMENTAL)
         io_stats_dump_global(this, &incremental, now, increment, args);
 
+    GF_FREE(cumulative.hist);
+    GF_FREE(incremental.hist);
+
     return 0;
 }
 
@@ -1822,6 +1914,9 @@ update_ios_latency_stats(struct ios_global_stats *stats, int64_t elapsed,
 
     stats->latency[op].avg = avg + (elapsed - avg) /
                                        GF_ATOMIC_GET(stats->fop_hits[op]);
+
+    if (stats->hist)
+        gf_latency_hist_record(&stats->hist[op], elapsed);
 }
 
 int
@@ -3688,6 +3783,7 @@ io_priv(xlator_t *this)
     char key_prefix_incremental[GF_DUMP_MAX_BUF_LEN];
     double min, max, avg;
     uint64_t count, total;
+    uint64_t pct[GF_LATENCY_PCT_MAX];
     struct ios_conf *conf = NULL;
 
     conf = this->private;
@@ -3719,11 +3815,17 @@ io_priv(xlator_t *this)
         max = conf->cumulative.latency[i].max;
         avg = conf->cumulative.latency[i].avg;
 
+        ios_fop_percentiles(&conf->cumulative, i, pct);
+
         gf_proc_dump_build_key(key, key_prefix_cumulative, "%s",
                                (char *)gf_fop_list[i]);
 
-        gf_proc_dump_write(key, "%" PRId64 ",%" PRId64 ",%.03f,%.03f,%.03f",
-                           count, total, min, max, avg);
+        gf_proc_dump_write(key,
+                           "%" PRId64 ",%" PRId64 ",%.03f,%.03f,%.03f,%" PRIu64
+                           ",%" PRIu64 ",%" PRIu64 ",%" PRIu64,
+                           count, total, min, max, avg, pct[GF_LATENCY_P50],
+                           pct[GF_LATENCY_P90], pct[GF_LATENCY_P99],
+                           pct[GF_LATENCY_P999]);
 
         count = GF_ATOMIC_GET(conf->incremental.fop_hits[i]);
         total = conf->incremental.latency[i].total;
@@ -3731,11 +3833,17 @@ io_priv(xlator_t *this)
         max = conf->incremental.latency[i].max;
         avg = conf->incremental.latency[i].avg;
 
+        ios_fop_percentiles(&conf->incremental, i, pct);
+
         gf_proc_dump_build_key(key, key_prefix_incremental, "%s",
                                (char *)gf_fop_list[i]);
 
-        gf_proc_dump_write(key, "%" PRId64 ",%" PRId64 ",%.03f,%.03f,%.03f",
-                           count, total, min, max, avg);
+        gf_proc_dump_write(key,
+                           "%" PRId64 ",%" PRId64 ",%.03f,%.03f,%.03f,%" PRIu64
+                           ",%" PRIu64 ",%" PRIu64 ",%" PRIu64,
+                           count, total, min, max, avg, pct[GF_LATENCY_P50],
+                           pct[GF_LATENCY_P90], pct[GF_LATENCY_P99],
+                           pct[GF_LATENCY_P999]);
     }
 
     return 0;
@@ -3980,6 +4088,8 @@ ios_conf_destroy(struct ios_conf *conf)
     LOCK_DESTROY(&conf->lock);
     if (conf->dnscache)
         gf_dnscache_deinit(conf->dnscache);
+    GF_FREE(conf->cumulative.hist);
+    GF_FREE(conf->incremental.hist);
     GF_FREE(conf);
 }
 
@@ -4091,6 +4201,11 @@ init(xlator_t *this)
     ios_init_stats(&conf->cumulative);
     ios_init_stats(&conf->incremental);
 
+    /* Percentiles are a nice to have, carry on with averages only if
+     * the histograms can't be allocated */
+    conf->cumulative.hist = gf_latency_hist_new(GF_FOP_MAXVALUE);
+    conf->incremental.hist = gf_latency_hist_new(GF_FOP_MAXVALUE);
+
     ret = ios_init_top_stats(conf);
     if (ret)
         goto out;
@@ -261,6 +261,35 @@ unwind:
     return 0;
 }
 
+int32_t
+arbiter_copy_file_range(call_frame_t *frame, xlator_t *this, fd_t *fd_in,
+                        off64_t off_in, fd_t *fd_out, off64_t off_out,
+                        size_t len, uint32_t flags, dict_t *xdata)
+{
+    arbiter_inode_ctx_t *ctx_in = NULL;
+    arbiter_inode_ctx_t *ctx_out = NULL;
+    struct iatt *stbuf = NULL;
+    struct iatt *buf = NULL;
+    int op_ret = 0;
+    int op_errno = 0;
+
+    ctx_in = arbiter_inode_ctx_get(fd_in->inode, this);
+    ctx_out = arbiter_inode_ctx_get(fd_out->inode, this);
+    if (!ctx_in || !ctx_out) {
+        op_ret = -1;
+        op_errno = ENOMEM;
+        goto unwind;
+    }
+    stbuf = &ctx_in->iattbuf;
+    buf = &ctx_out->iattbuf;
+    /* No data is copied here; AFR takes the byte count from the data
+     * bricks. */
+unwind:
+    STACK_UNWIND_STRICT(copy_file_range, frame, op_ret, op_errno, stbuf, buf,
+                        buf, NULL);
+    return 0;
+}
+
 static int32_t
 arbiter_readv(call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
               off_t offset, uint32_t flags, dict_t *xdata)
@@ -342,6 +371,7 @@ struct xlator_fops fops = {
     .fallocate = arbiter_fallocate,
     .discard = arbiter_discard,
     .zerofill = arbiter_zerofill,
+    .copy_file_range = arbiter_copy_file_range,
 
     /* AFR is not expected to wind these inode read FOPS initiated by the
      * application to the arbiter brick. But in case a bug causes them
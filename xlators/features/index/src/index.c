@@ -460,9 +460,26 @@ index_get_subdir_from_vgfid(index_priv_t *priv, uuid_t vgfid)
     return index_get_subdir_from_type(index_get_type_from_vgfid(priv, vgfid));
 }
 
+/* Index entries are named after gfids, which are random, so the leading
+ * bits of the name spread them evenly over the shards. Entries with other
+ * names are in every shard. */
+static gf_boolean_t
+index_entry_in_shard(const char *name, size_t len, int shard, int shards)
+{
+    char prefix[9];
+
+    if (shards <= 1 || len != UUID_CANONICAL_FORM_LEN)
+        return _gf_true;
+
+    memcpy(prefix, name, 8);
+    prefix[8] = '\0';
+
+    return (strtoul(prefix, NULL, 16) % shards) == shard;
+}
+
 static int
 index_fill_readdir(fd_t *fd, index_fd_ctx_t *fctx, DIR *dir, off_t off,
-                   size_t size, gf_dirent_t *entries)
+                   size_t size, int shard, int shards, gf_dirent_t *entries)
 {
     off_t in_case = -1;
     off_t last_off = 0;
@@ -545,6 +562,14 @@ index_fill_readdir(fd_t *fd, index_fd_ctx_t *fctx, DIR *dir, off_t off,
             }
         }
 
+        /* entries of other shards do not take up space in the reply, so
+         * that a reply is only empty at the end of the directory */
+        if (!index_entry_in_shard(entry->d_name, entry_dname_len, shard,
+                                  shards)) {
+            last_off = (u_long)telldir(dir);
+            continue;
+        }
+
         this_size = max(sizeof(gf_dirent_t), sizeof(gfx_dirplist)) +
                     entry_dname_len + 1;
 
@@ -1750,8 +1775,12 @@ index_readdir_wrapper(call_frame_t *frame, xlator_t *this, fd_t *fd,
     int32_t op_ret = -1;
     int32_t op_errno = 0;
     int count = 0;
+    int shard = 0;
+    int shards = 1;
+    char *shard_spec = NULL;
     gf_dirent_t entries;
     struct index_syncop_args args = {0};
+    dict_t *rsp_xdata = NULL;
 
     priv = this->private;
     INIT_LIST_HEAD(&entries.list);
@@ -1772,7 +1801,27 @@ index_readdir_wrapper(call_frame_t *frame, xlator_t *this, fd_t *fd,
         goto done;
     }
 
-    count = index_fill_readdir(fd, fctx, dir, off, size, &entries);
+    if (xdata && !dict_get_str_sizen(xdata, GF_INDEX_SHARD_KEY, &shard_spec)) {
+        if (sscanf(shard_spec, "%d/%d", &shard, &shards) != 2 || shards < 1 ||
+            shard < 0 || shard >= shards) {
+            op_errno = EINVAL;
+            gf_msg(this->name, GF_LOG_WARNING, op_errno, INDEX_MSG_INVALID_ARGS,
+                   "invalid index shard %s", shard_spec);
+            goto done;
+        }
+        /* tells the shd that the entries were filtered, bricks which do
+         * not know the key return all of them */
+        rsp_xdata = dict_new();
+        if (rsp_xdata &&
+            dict_set_dynstr_with_alloc(rsp_xdata, GF_INDEX_SHARD_KEY,
+                                       shard_spec)) {
+            dict_unref(rsp_xdata);
+            rsp_xdata = NULL;
+        }
+    }
+
+    count = index_fill_readdir(fd, fctx, dir, off, size, shard, shards,
+                               &entries);
 
     /* pick ENOENT to indicate EOF */
     op_errno = errno;
@@ -1785,8 +1834,11 @@ index_readdir_wrapper(call_frame_t *frame, xlator_t *this, fd_t *fd,
                            &args);
     }
 done:
-    STACK_UNWIND_STRICT(readdir, frame, op_ret, op_errno, &entries, NULL);
+    STACK_UNWIND_STRICT(readdir, frame, op_ret, op_errno, &entries,
+                        rsp_xdata);
     gf_dirent_free(&entries);
+    if (rsp_xdata)
+        dict_unref(rsp_xdata);
     return 0;
 }
 
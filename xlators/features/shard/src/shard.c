@@ -525,6 +525,8 @@ shard_local_wipe(shard_local_t *local)
         GF_FREE(local->int_entrylk.basename);
     if (local->fd)
         fd_unref(local->fd);
+    if (local->fd_in)
+        fd_unref(local->fd_in);
 
     if (local->xattr_req)
         dict_unref(local->xattr_req);
@@ -705,6 +707,7 @@ __shard_update_shards_inode_list(inode_t *linked_inode, xlator_t *this,
             GF_ASSERT(lru_inode_ctx->block_num > 0);
             lru_base_inode = lru_inode_ctx->base_inode;
             list_del_init(&lru_inode_ctx->ilist);
+            GF_ATOMIC_INC(priv->lru_evictions);
             lru_inode = inode_find(linked_inode->table,
                                    lru_inode_ctx->stat.ia_gfid);
             /* If the lru inode was part of the pending-fsync list,
@@ -888,6 +891,35 @@ shard_common_failure_unwind(glusterfs_fop_t fop, call_frame_t *frame,
     return 0;
 }
 
+/* Accounts the latency of a read or write by the number of shards it was
+ * spread over.
+ */
+static void
+shard_fanout_account(xlator_t *this, shard_local_t *local)
+{
+    int bucket = 0;
+    uint64_t n = 0;
+    struct timespec now;
+    shard_priv_t *priv = this->private;
+    shard_fanout_stats_t *stats = NULL;
+
+    if (!local->num_blocks)
+        return;
+
+    for (n = local->num_blocks - 1; n && (bucket < SHARD_FANOUT_BUCKETS - 1);
+         n >>= 1)
+        bucket++;
+
+    if (local->fop == GF_FOP_READ)
+        stats = &priv->read_fanout[bucket];
+    else
+        stats = &priv->write_fanout[bucket];
+
+    timespec_now(&now);
+    GF_ATOMIC_INC(stats->count);
+    GF_ATOMIC_ADD(stats->total_us, gf_tsdiff(&local->fop_start, &now) / 1000);
+}
+
 static int
 shard_common_inode_write_success_unwind(glusterfs_fop_t fop,
                                         call_frame_t *frame, int32_t op_ret)
@@ -906,6 +938,8 @@ shard_common_inode_write_success_unwind(glusterfs_fop_t fop,
 
     switch (fop) {
         case GF_FOP_WRITE:
+            if (local)
+                shard_fanout_account(frame->this, local);
             SHARD_STACK_UNWIND(writev, frame, op_ret, 0, prebuf, postbuf,
                                xattr_rsp);
             break;
@@ -1060,6 +1094,22 @@ shard_common_resolve_shards(call_frame_t *frame, xlator_t *this,
                                    local->block_size);
     }
 
+    /* Shards past the end of the file were never written to, so a write
+     * extending the file can create them right away instead of first
+     * looking them up. Should one exist after all, its mknod fails with
+     * EEXIST and it is looked up then.
+     */
+    if (local->fop == GF_FOP_WRITE) {
+        uint64_t new_block = 1;
+
+        if (local->prebuf.ia_size)
+            new_block = (local->prebuf.ia_size - 1) / local->block_size + 1;
+        if (new_block < local->first_block)
+            new_block = local->first_block;
+        if (new_block <= local->last_block)
+            local->create_count = local->last_block - new_block + 1;
+    }
+
     resolve_count = local->last_block - local->create_count;
 
     if (res_inode)
@@ -1096,11 +1146,13 @@ shard_common_resolve_shards(call_frame_t *frame, xlator_t *this,
                     inode, this, res_inode, shard_idx_iter, gfid);
             }
             UNLOCK(&priv->lock);
+            GF_ATOMIC_INC(priv->lru_hits);
             shard_idx_iter++;
             if (fsync_inode)
                 shard_initiate_evicted_inode_fsync(this, fsync_inode);
             continue;
         } else {
+            GF_ATOMIC_INC(priv->lru_misses);
             local->call_count++;
             shard_idx_iter++;
         }
@@ -1503,11 +1555,47 @@ shard_inode_ctx_update(inode_t *inode, xlator_t *this, dict_t *xdata,
     }
 }
 
-int
-shard_delete_shards(void *opaque);
+static void *
+shard_delete_shards_thread(void *data);
 
-static int
-shard_delete_shards_cbk(int ret, call_frame_t *frame, void *data);
+/* The background deletion checks this between shards, fini sets it and
+ * waits for the deletion threads to be gone. */
+static gf_boolean_t
+shard_bg_deletion_stopped(shard_priv_t *priv)
+{
+    gf_boolean_t stop = _gf_false;
+
+    pthread_mutex_lock(&priv->bg_del_mutex);
+    {
+        stop = priv->bg_del_stop;
+    }
+    pthread_mutex_unlock(&priv->bg_del_mutex);
+
+    return stop;
+}
+
+static void
+shard_bg_deletion_exit(shard_priv_t *priv)
+{
+    pthread_mutex_lock(&priv->bg_del_mutex);
+    {
+        priv->bg_del_threads--;
+        pthread_cond_broadcast(&priv->bg_del_cond);
+    }
+    pthread_mutex_unlock(&priv->bg_del_mutex);
+}
+
+static void
+shard_bg_deletion_fini(shard_priv_t *priv)
+{
+    pthread_mutex_lock(&priv->bg_del_mutex);
+    {
+        priv->bg_del_stop = _gf_true;
+        while (priv->bg_del_threads)
+            pthread_cond_wait(&priv->bg_del_cond, &priv->bg_del_mutex);
+    }
+    pthread_mutex_unlock(&priv->bg_del_mutex);
+}
 
 int
 shard_start_background_deletion(xlator_t *this)
@@ -1516,6 +1604,7 @@ shard_start_background_deletion(xlator_t *this)
     gf_boolean_t i_cleanup = _gf_true;
     shard_priv_t *priv = NULL;
     call_frame_t *cleanup_frame = NULL;
+    pthread_t thread;
 
     priv = this->private;
 
@@ -1552,14 +1641,31 @@ shard_start_background_deletion(xlator_t *this)
 
     set_lk_owner_from_ptr(&cleanup_frame->root->lk_owner, cleanup_frame->root);
 
-    ret = synctask_new(this->ctx->env, shard_delete_shards,
-                       shard_delete_shards_cbk, cleanup_frame, cleanup_frame);
+    pthread_mutex_lock(&priv->bg_del_mutex);
+    {
+        if (priv->bg_del_stop)
+            ret = -ESHUTDOWN;
+        else
+            priv->bg_del_threads++;
+    }
+    pthread_mutex_unlock(&priv->bg_del_mutex);
+    if (ret) {
+        STACK_DESTROY(cleanup_frame->root);
+        goto err;
+    }
+
+    /* Not a synctask, since the deleters block on each other and on the
+     * deletion bandwidth.
+     */
+    ret = gf_thread_create_detached(&thread, shard_delete_shards_thread,
+                                    cleanup_frame, "shard_del");
     if (ret < 0) {
         gf_msg(this->name, GF_LOG_WARNING, errno,
                SHARD_MSG_SHARDS_DELETION_FAILED,
-               "failed to create task to do background "
+               "failed to create thread to do background "
                "cleanup of shards");
         STACK_DESTROY(cleanup_frame->root);
+        shard_bg_deletion_exit(priv);
         goto err;
     }
     return 0;
@@ -3337,6 +3443,37 @@ shard_regulated_shards_deletion(call_frame_t *cleanup_frame, xlator_t *this,
     return ret;
 }
 
+/* Waits until the deletion bandwidth allows to delete that many bytes. The
+ * bucket holds a second worth of tokens, so larger amounts are waited for
+ * in parts.
+ */
+static void
+shard_deletion_throttle(xlator_t *this, uint64_t bytes)
+{
+    uint64_t rate = 0;
+    uint64_t now = 0;
+    shard_priv_t *priv = this->private;
+
+    while (bytes && (rate = priv->deletion_bandwidth) &&
+           !shard_bg_deletion_stopped(priv)) {
+        now = min(bytes, rate);
+        TBF_THROTTLE_BEGIN(priv->deletion_tbf, TBF_OP_UNLINK, now);
+        bytes -= now;
+    }
+}
+
+static void
+shard_deletion_tbf_spec(shard_priv_t *priv, tbf_opspec_t *spec)
+{
+    /* Tokens are bytes, generated every 100ms */
+    spec->op = TBF_OP_UNLINK;
+    spec->token_gen_interval = 100000;
+    spec->rate = priv->deletion_bandwidth / 10;
+    if (priv->deletion_bandwidth && !spec->rate)
+        spec->rate = 1;
+    spec->maxlimit = priv->deletion_bandwidth;
+}
+
 static int
 __shard_delete_shards_of_entry(call_frame_t *cleanup_frame, xlator_t *this,
                                gf_dirent_t *entry, inode_t *inode)
@@ -3345,6 +3482,7 @@ __shard_delete_shards_of_entry(call_frame_t *cleanup_frame, xlator_t *this,
     int shard_count = 0;
     int first_block = 0;
     int now = 0;
+    uint64_t bytes = 0;
     uint64_t size = 0;
     uint64_t block_size = 0;
     uint64_t size_array[4] = {
@@ -3473,8 +3611,17 @@ __shard_delete_shards_of_entry(call_frame_t *cleanup_frame, xlator_t *this,
     }
 
     first_block = 1;
+    GF_ATOMIC_INC(priv->del_files_active);
+    GF_ATOMIC_ADD(priv->del_shards_pending, shard_count);
 
     while (shard_count) {
+        if (shard_bg_deletion_stopped(priv)) {
+            GF_ATOMIC_SUB(priv->del_shards_pending, shard_count);
+            GF_ATOMIC_DEC(priv->del_files_active);
+            ret = -ESHUTDOWN;
+            goto err;
+        }
+
         if (shard_count < local->deletion_rate) {
             now = shard_count;
             shard_count = 0;
@@ -3483,16 +3630,27 @@ __shard_delete_shards_of_entry(call_frame_t *cleanup_frame, xlator_t *this,
             shard_count -= local->deletion_rate;
         }
 
+        bytes = min(size, (first_block + now) * block_size) -
+                first_block * block_size;
+        shard_deletion_throttle(this, bytes);
+
         gf_msg_debug(this->name, 0,
                      "deleting %d shards starting from "
                      "block %d of gfid %s",
                      now, first_block, entry->d_name);
         ret = shard_regulated_shards_deletion(cleanup_frame, this, now,
                                               first_block, entry);
-        if (ret)
+        GF_ATOMIC_SUB(priv->del_shards_pending, now);
+        if (ret) {
+            GF_ATOMIC_SUB(priv->del_shards_pending, shard_count);
+            GF_ATOMIC_DEC(priv->del_files_active);
             goto err;
+        }
+        GF_ATOMIC_ADD(priv->del_shards_done, now);
+        GF_ATOMIC_ADD(priv->del_bytes_done, bytes);
         first_block += now;
     }
+    GF_ATOMIC_DEC(priv->del_files_active);
 
 delete_marker:
     loc_wipe(&loc);
@@ -3552,13 +3710,6 @@ out:
     return ret;
 }
 
-static int
-shard_delete_shards_cbk(int ret, call_frame_t *frame, void *data)
-{
-    SHARD_STACK_DESTROY(frame);
-    return 0;
-}
-
 static int
 shard_resolve_internal_dir(xlator_t *this, shard_local_t *local,
                            shard_internal_dir_type_t type)
@@ -3701,45 +3852,28 @@ out:
     return ret;
 }
 
-int
-shard_delete_shards(void *opaque)
+static int
+shard_delete_shards_init(xlator_t *this, call_frame_t *cleanup_frame)
 {
     int ret = 0;
-    off_t offset = 0;
-    loc_t loc = {
-        0,
-    };
-    inode_t *link_inode = NULL;
-    xlator_t *this = NULL;
     shard_priv_t *priv = NULL;
     shard_local_t *local = NULL;
-    gf_dirent_t entries;
-    gf_dirent_t *entry = NULL;
-    call_frame_t *cleanup_frame = NULL;
-    gf_boolean_t done = _gf_false;
 
-    this = THIS;
     priv = this->private;
-    INIT_LIST_HEAD(&entries.list);
-
-    cleanup_frame = opaque;
 
     local = mem_get0(this->local_pool);
     if (!local) {
         gf_msg(this->name, GF_LOG_WARNING, ENOMEM, SHARD_MSG_MEMALLOC_FAILED,
                "Failed to create local to "
                "delete shards");
-        ret = -ENOMEM;
-        goto err;
+        return -ENOMEM;
     }
     cleanup_frame->local = local;
     local->fop = GF_FOP_UNLINK;
 
     local->xattr_req = dict_new();
-    if (!local->xattr_req) {
-        ret = -ENOMEM;
-        goto err;
-    }
+    if (!local->xattr_req)
+        return -ENOMEM;
     local->deletion_rate = priv->deletion_rate;
 
     ret = shard_resolve_internal_dir(this, local, SHARD_INTERNAL_DIR_DOT_SHARD);
@@ -3747,10 +3881,9 @@ shard_delete_shards(void *opaque)
         gf_msg_debug(this->name, 0,
                      ".shard absent. Nothing to"
                      " delete. Exiting");
-        ret = 0;
-        goto err;
+        return ret;
     } else if (ret < 0) {
-        goto err;
+        return ret;
     }
 
     ret = shard_resolve_internal_dir(this, local,
@@ -3759,20 +3892,157 @@ shard_delete_shards(void *opaque)
         gf_msg_debug(this->name, 0,
                      ".remove_me absent. "
                      "Nothing to delete. Exiting");
-        ret = 0;
-        goto err;
+        return ret;
     } else if (ret < 0) {
-        goto err;
+        return ret;
     }
 
     local->fd = fd_anonymous(local->dot_shard_rm_loc.inode);
-    if (!local->fd) {
-        ret = -ENOMEM;
+    if (!local->fd)
+        return -ENOMEM;
+
+    return 0;
+}
+
+/* Deleter @index out of @count takes care of the markers whose gfids hash
+ * to it.
+ */
+static gf_boolean_t
+shard_deleter_owns_entry(gf_dirent_t *entry, int index, int count)
+{
+    char hash[9] = {
+        0,
+    };
+
+    if (count <= 1)
+        return _gf_true;
+
+    memcpy(hash, entry->d_name, min(entry->d_len, sizeof(hash) - 1));
+    return (strtoul(hash, NULL, 16) % count) == index;
+}
+
+static int
+shard_delete_marker_entries(xlator_t *this, call_frame_t *cleanup_frame,
+                            int index, int count)
+{
+    int ret = 0;
+    off_t offset = 0;
+    inode_t *link_inode = NULL;
+    shard_local_t *local = NULL;
+    gf_dirent_t entries;
+    gf_dirent_t *entry = NULL;
+
+    local = cleanup_frame->local;
+    INIT_LIST_HEAD(&entries.list);
+
+    while ((ret = syncop_readdirp(FIRST_CHILD(this), local->fd, 131072, offset,
+                                  &entries, local->xattr_req, NULL))) {
+        if (ret > 0)
+            ret = 0;
+        list_for_each_entry(entry, &entries.list, list)
+        {
+            if (shard_bg_deletion_stopped(this->private)) {
+                ret = -ESHUTDOWN;
+                break;
+            }
+
+            offset = entry->d_off;
+            /* skip . and .. */
+            if (inode_dir_or_parentdir(entry))
+                continue;
+
+            if (!shard_deleter_owns_entry(entry, index, count))
+                continue;
+
+            if (!entry->inode) {
+                ret = shard_lookup_marker_entry(this, local, entry);
+                if (ret < 0)
+                    continue;
+            }
+
+            ret = shard_nameless_lookup_base_file(this, entry->d_name);
+            if (!ret)
+                continue;
+
+            link_inode = inode_link(entry->inode, local->fd->inode,
+                                    entry->d_name, &entry->d_stat);
+
+            gf_msg_debug(this->name, 0,
+                         "Initiating deletion of "
+                         "shards of gfid %s",
+                         entry->d_name);
+            ret = shard_delete_shards_of_entry(cleanup_frame, this, entry,
+                                               link_inode);
+            inode_unlink(link_inode, local->fd->inode, entry->d_name);
+            inode_unref(link_inode);
+            if (ret) {
+                gf_msg(this->name, GF_LOG_ERROR, -ret,
+                       SHARD_MSG_SHARDS_DELETION_FAILED,
+                       "Failed to clean up shards of gfid %s",
+                       entry->d_name);
+                continue;
+            }
+            gf_msg(this->name, GF_LOG_INFO, 0,
+                   SHARD_MSG_SHARD_DELETION_COMPLETED,
+                   "Deleted "
+                   "shards of gfid=%s from backend",
+                   entry->d_name);
+        }
+        gf_dirent_free(&entries);
+        if (ret)
+            break;
+    }
+
+    return ret;
+}
+
+static void *
+shard_deleter(void *data)
+{
+    int ret = 0;
+    shard_deleter_t *deleter = data;
+    xlator_t *this = deleter->this;
+    call_frame_t *cleanup_frame = NULL;
+
+    THIS = this;
+
+    cleanup_frame = create_frame(this, this->ctx->pool);
+    if (!cleanup_frame)
+        return NULL;
+    set_lk_owner_from_ptr(&cleanup_frame->root->lk_owner, cleanup_frame->root);
+
+    ret = shard_delete_shards_init(this, cleanup_frame);
+    if (!ret)
+        shard_delete_marker_entries(this, cleanup_frame, deleter->index,
+                                    deleter->count);
+
+    SHARD_STACK_DESTROY(cleanup_frame);
+    return NULL;
+}
+
+static int
+shard_delete_shards(call_frame_t *cleanup_frame)
+{
+    int i = 0;
+    int ret = 0;
+    uint32_t count = 0;
+    xlator_t *this = NULL;
+    shard_priv_t *priv = NULL;
+    shard_deleter_t *deleters = NULL;
+    gf_boolean_t done = _gf_false;
+
+    this = THIS;
+    priv = this->private;
+
+    ret = shard_delete_shards_init(this, cleanup_frame);
+    if (ret == -ENOENT) {
+        ret = 0;
+        goto err;
+    } else if (ret < 0) {
         goto err;
     }
 
     for (;;) {
-        offset = 0;
         LOCK(&priv->lock);
         {
             if (priv->bg_del_state == SHARD_BG_DELETION_LAUNCHING) {
@@ -3783,62 +4053,39 @@ shard_delete_shards(void *opaque)
             }
         }
         UNLOCK(&priv->lock);
-        if (done)
+        if (done || shard_bg_deletion_stopped(priv))
             break;
-        while (
-            (ret = syncop_readdirp(FIRST_CHILD(this), local->fd, 131072, offset,
-                                   &entries, local->xattr_req, NULL))) {
-            if (ret > 0)
-                ret = 0;
-            list_for_each_entry(entry, &entries.list, list)
-            {
-                offset = entry->d_off;
-                /* skip . and .. */
-                if (inode_dir_or_parentdir(entry))
-                    continue;
 
-                if (!entry->inode) {
-                    ret = shard_lookup_marker_entry(this, local, entry);
-                    if (ret < 0)
-                        continue;
-                }
+        /* This thread is deleter 0, the others get their own frames */
+        count = priv->deletion_threads;
+        deleters = GF_CALLOC(count, sizeof(*deleters), gf_shard_mt_deleter_t);
+        if (!deleters)
+            count = 1;
+        for (i = 1; i < count; i++) {
+            deleters[i].this = this;
+            deleters[i].index = i;
+            deleters[i].count = count;
+            if (gf_thread_create(&deleters[i].thread, NULL, shard_deleter,
+                                 &deleters[i], "shard_del%d", i)) {
+                gf_msg(this->name, GF_LOG_WARNING, errno,
+                       SHARD_MSG_SHARDS_DELETION_FAILED,
+                       "failed to create shard deleter %d of %d, the "
+                       "others will delete its shards next time",
+                       i, count);
+                deleters[i].this = NULL;
+            }
+        }
 
-                ret = shard_nameless_lookup_base_file(this, entry->d_name);
-                if (!ret)
-                    continue;
+        shard_delete_marker_entries(this, cleanup_frame, 0, count);
 
-                link_inode = inode_link(entry->inode, local->fd->inode,
-                                        entry->d_name, &entry->d_stat);
-
-                gf_msg_debug(this->name, 0,
-                             "Initiating deletion of "
-                             "shards of gfid %s",
-                             entry->d_name);
-                ret = shard_delete_shards_of_entry(cleanup_frame, this, entry,
-                                                   link_inode);
-                inode_unlink(link_inode, local->fd->inode, entry->d_name);
-                inode_unref(link_inode);
-                if (ret) {
-                    gf_msg(this->name, GF_LOG_ERROR, -ret,
-                           SHARD_MSG_SHARDS_DELETION_FAILED,
-                           "Failed to clean up shards of gfid %s",
-                           entry->d_name);
-                    continue;
-                }
-                gf_msg(this->name, GF_LOG_INFO, 0,
-                       SHARD_MSG_SHARD_DELETION_COMPLETED,
-                       "Deleted "
-                       "shards of gfid=%s from backend",
-                       entry->d_name);
-            }
-            gf_dirent_free(&entries);
-            if (ret)
-                break;
+        for (i = 1; i < count; i++) {
+            if (deleters[i].this)
+                pthread_join(deleters[i].thread, NULL);
         }
+        GF_FREE(deleters);
+        deleters = NULL;
     }
-    ret = 0;
-    loc_wipe(&loc);
-    return ret;
+    return 0;
 
 err:
     LOCK(&priv->lock);
@@ -3846,10 +4093,24 @@ err:
         priv->bg_del_state = SHARD_BG_DELETION_NONE;
     }
     UNLOCK(&priv->lock);
-    loc_wipe(&loc);
     return ret;
 }
 
+static void *
+shard_delete_shards_thread(void *data)
+{
+    call_frame_t *cleanup_frame = data;
+
+    xlator_t *this = cleanup_frame->this;
+
+    THIS = this;
+
+    shard_delete_shards(cleanup_frame);
+    SHARD_STACK_DESTROY(cleanup_frame);
+    shard_bg_deletion_exit(this->private);
+    return NULL;
+}
+
 int
 shard_unlock_inodelk_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
                          int32_t op_ret, int32_t op_errno, dict_t *xdata)
@@ -4937,6 +5198,10 @@ shard_readv_do_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
         local->op_errno = op_errno;
     }
 
+    /* holes have nothing to copy */
+    if (!anon_fd)
+        goto out;
+
     shard_inode_ctx_get(anon_fd->inode, this, &ctx);
     block_num = ctx->block_num;
 
@@ -4977,6 +5242,7 @@ out:
                 local->total_size = local->prebuf.ia_size - local->offset;
             vec.iov_len = local->total_size;
             local->op_ret = local->total_size;
+            shard_fanout_account(this, local);
             SHARD_STACK_UNWIND(readv, frame, local->op_ret, local->op_errno,
                                &vec, 1, &local->prebuf, local->iobref,
                                local->xattr_rsp);
@@ -4987,73 +5253,191 @@ out:
     return 0;
 }
 
-int
-shard_readv_do(call_frame_t *frame, xlator_t *this)
+/* Offset into the shard and size of the part of block_num the read covers,
+ * which lands in the read buffer right after the parts of the preceding
+ * blocks.
+ */
+static void
+shard_readv_block_range(shard_local_t *local, uint64_t block_num,
+                        off_t *shard_offset, size_t *read_size)
+{
+    size_t done = 0;
+
+    if (block_num == local->first_block) {
+        *shard_offset = local->offset % local->block_size;
+        *read_size = local->block_size - *shard_offset;
+    } else {
+        done = (local->block_size - (local->offset % local->block_size)) +
+               ((block_num - local->first_block - 1) * local->block_size);
+        *shard_offset = 0;
+        *read_size = local->total_size - done;
+    }
+
+    if (*read_size > local->total_size)
+        *read_size = local->total_size;
+    if (*read_size > local->block_size)
+        *read_size = local->block_size;
+}
+
+static int
+shard_readv_block(call_frame_t *frame, xlator_t *this, uint64_t block_num,
+                  inode_t *inode)
 {
-    int i = 0;
-    int call_count = 0;
-    int last_block = 0;
-    int cur_block = 0;
-    off_t orig_offset = 0;
     off_t shard_offset = 0;
     size_t read_size = 0;
-    size_t remaining_size = 0;
-    fd_t *fd = NULL;
     fd_t *anon_fd = NULL;
     shard_local_t *local = NULL;
-    gf_boolean_t wind_failed = _gf_false;
 
     local = frame->local;
-    fd = local->fd;
-
-    orig_offset = local->offset;
-    cur_block = local->first_block;
-    last_block = local->last_block;
-    remaining_size = local->total_size;
-    local->call_count = call_count = local->num_blocks;
 
-    SHARD_SET_ROOT_FS_ID(frame, local);
+    if (block_num == 0)
+        anon_fd = fd_ref(local->fd);
+    else
+        anon_fd = fd_anonymous(inode);
+    if (!anon_fd)
+        return -1;
 
-    if (fd->flags & O_DIRECT)
-        local->flags = O_DIRECT;
+    shard_readv_block_range(local, block_num, &shard_offset, &read_size);
 
-    while (cur_block <= last_block) {
-        if (wind_failed) {
-            shard_readv_do_cbk(frame, (void *)(long)0, this, -1, ENOMEM, NULL,
-                               0, NULL, NULL, NULL);
-            goto next;
-        }
+    STACK_WIND_COOKIE(frame, shard_readv_do_cbk, anon_fd, FIRST_CHILD(this),
+                      FIRST_CHILD(this)->fops->readv, anon_fd, read_size,
+                      shard_offset, local->flags, local->xattr_req);
+    return 0;
+}
 
-        shard_offset = orig_offset % local->block_size;
-        read_size = local->block_size - shard_offset;
-        if (read_size > remaining_size)
-            read_size = remaining_size;
+static int
+shard_readv_lookup_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
+                       int32_t op_ret, int32_t op_errno, inode_t *inode,
+                       struct iatt *buf, dict_t *xdata, struct iatt *postparent)
+{
+    uint64_t block_num = (long)cookie;
+    shard_local_t *local = NULL;
 
-        remaining_size -= read_size;
+    local = frame->local;
 
-        if (cur_block == 0) {
-            anon_fd = fd_ref(fd);
-        } else {
-            anon_fd = fd_anonymous(local->inode_list[i]);
-            if (!anon_fd) {
-                local->op_ret = -1;
-                local->op_errno = ENOMEM;
-                wind_failed = _gf_true;
-                shard_readv_do_cbk(frame, (void *)(long)anon_fd, this, -1,
-                                   ENOMEM, NULL, 0, NULL, NULL, NULL);
-                goto next;
-            }
+    if (op_ret < 0) {
+        /* A shard which was never written to is a hole, and the read
+         * buffer is already zeroed for it.
+         */
+        if (op_errno == ENOENT)
+            shard_readv_do_cbk(frame, NULL, this, 0, 0, NULL, 0, NULL, NULL,
+                               NULL);
+        else
+            shard_readv_do_cbk(frame, NULL, this, op_ret, op_errno, NULL, 0,
+                               NULL, NULL, NULL);
+        return 0;
+    }
+
+    shard_link_block_inode(local, block_num, inode, buf);
+
+    if (shard_readv_block(frame, this, block_num,
+                          local->inode_list[block_num - local->first_block]))
+        shard_readv_do_cbk(frame, NULL, this, -1, ENOMEM, NULL, 0, NULL, NULL,
+                           NULL);
+    return 0;
+}
+
+static int
+shard_readv_lookup_block(call_frame_t *frame, xlator_t *this,
+                         uint64_t block_num)
+{
+    int ret = 0;
+    int prefix_len = 0;
+    char path[SHARD_PATH_MAX];
+    char *bname = NULL;
+    loc_t loc = {
+        0,
+    };
+    dict_t *xattr_req = NULL;
+    shard_local_t *local = NULL;
+    shard_priv_t *priv = NULL;
+
+    priv = this->private;
+    local = frame->local;
+
+    prefix_len = shard_make_base_path(path, local->resolver_base_inode->gfid);
+    shard_append_index(path, SHARD_PATH_MAX, prefix_len, block_num);
+    bname = path + sizeof(GF_SHARD_DIR) + 1;
+
+    loc.inode = inode_new(this->itable);
+    loc.parent = inode_ref(priv->dot_shard_inode);
+    gf_uuid_copy(loc.pargfid, priv->dot_shard_gfid);
+    ret = inode_path(loc.parent, bname, (char **)&(loc.path));
+    if (ret < 0 || !(loc.inode)) {
+        gf_msg(this->name, GF_LOG_ERROR, 0, SHARD_MSG_INODE_PATH_FAILED,
+               "Inode path failed on %s", bname);
+        goto err;
+    }
+
+    loc.name = strrchr(loc.path, '/');
+    if (loc.name)
+        loc.name++;
+
+    xattr_req = shard_create_gfid_dict(local->xattr_req);
+    if (!xattr_req)
+        goto err;
+
+    STACK_WIND_COOKIE(frame, shard_readv_lookup_cbk, (void *)(long)block_num,
+                      FIRST_CHILD(this), FIRST_CHILD(this)->fops->lookup, &loc,
+                      xattr_req);
+    loc_wipe(&loc);
+    dict_unref(xattr_req);
+    return 0;
+err:
+    loc_wipe(&loc);
+    return -1;
+}
+
+/* Reads every block as soon as it can, i.e. the ones whose inodes were
+ * resolved right away and the others as soon as their lookups return,
+ * rather than waiting for all the lookups to complete first.
+ */
+int
+shard_readv_do(call_frame_t *frame, xlator_t *this)
+{
+    int i = 0;
+    int ret = 0;
+    uint64_t cur_block = 0;
+    uint64_t last_block = 0;
+    fd_t *fd = NULL;
+    shard_local_t *local = NULL;
+    gf_boolean_t wind_failed = _gf_false;
+
+    local = frame->local;
+    fd = local->fd;
+
+    cur_block = local->first_block;
+    last_block = local->last_block;
+    local->call_count = local->num_blocks;
+
+    SHARD_SET_ROOT_FS_ID(frame, local);
+
+    if (fd->flags & O_DIRECT)
+        local->flags = O_DIRECT;
+
+    while (cur_block <= last_block) {
+        if (wind_failed) {
+            shard_readv_do_cbk(frame, (void *)(long)0, this, -1, ENOMEM, NULL,
+                               0, NULL, NULL, NULL);
+            goto next;
         }
 
-        STACK_WIND_COOKIE(frame, shard_readv_do_cbk, anon_fd, FIRST_CHILD(this),
-                          FIRST_CHILD(this)->fops->readv, anon_fd, read_size,
-                          shard_offset, local->flags, local->xattr_req);
+        if ((cur_block == 0) || local->inode_list[i])
+            ret = shard_readv_block(frame, this, cur_block,
+                                    local->inode_list[i]);
+        else
+            ret = shard_readv_lookup_block(frame, this, cur_block);
 
-        orig_offset += read_size;
+        if (ret) {
+            local->op_ret = -1;
+            local->op_errno = ENOMEM;
+            wind_failed = _gf_true;
+            shard_readv_do_cbk(frame, (void *)(long)0, this, -1, ENOMEM, NULL,
+                               0, NULL, NULL, NULL);
+        }
     next:
         cur_block++;
         i++;
-        call_count--;
     }
     return 0;
 }
@@ -5220,54 +5604,6 @@ err:
     return 0;
 }
 
-int
-shard_post_mknod_readv_handler(call_frame_t *frame, xlator_t *this);
-
-int
-shard_post_lookup_shards_readv_handler(call_frame_t *frame, xlator_t *this)
-{
-    shard_local_t *local = NULL;
-
-    local = frame->local;
-
-    if (local->op_ret < 0) {
-        shard_common_failure_unwind(GF_FOP_READ, frame, local->op_ret,
-                                    local->op_errno);
-        return 0;
-    }
-
-    if (local->create_count) {
-        shard_common_resume_mknod(frame, this, shard_post_mknod_readv_handler);
-    } else {
-        shard_readv_do(frame, this);
-    }
-
-    return 0;
-}
-
-int
-shard_post_mknod_readv_handler(call_frame_t *frame, xlator_t *this)
-{
-    shard_local_t *local = NULL;
-
-    local = frame->local;
-
-    if (local->op_ret < 0) {
-        shard_common_failure_unwind(GF_FOP_READ, frame, local->op_ret,
-                                    local->op_errno);
-        return 0;
-    }
-
-    if (!local->eexist_count) {
-        shard_readv_do(frame, this);
-    } else {
-        local->call_count = local->eexist_count;
-        shard_common_lookup_shards(frame, this, local->loc.inode,
-                                   shard_post_lookup_shards_readv_handler);
-    }
-    return 0;
-}
-
 int
 shard_post_resolve_readv_handler(call_frame_t *frame, xlator_t *this)
 {
@@ -5294,12 +5630,7 @@ shard_post_resolve_readv_handler(call_frame_t *frame, xlator_t *this)
         }
     }
 
-    if (local->call_count) {
-        shard_common_lookup_shards(frame, this, local->resolver_base_inode,
-                                   shard_post_lookup_shards_readv_handler);
-    } else {
-        shard_readv_do(frame, this);
-    }
+    shard_readv_do(frame, this);
 
     return 0;
 }
@@ -5445,6 +5776,7 @@ shard_readv(call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
     local->req_size = size;
     local->flags = flags;
     local->fop = GF_FOP_READ;
+    timespec_now(&local->fop_start);
     local->xattr_req = (xdata) ? dict_ref(xdata) : dict_new();
     if (!local->xattr_req)
         goto err;
@@ -7207,6 +7539,7 @@ shard_common_inode_write_begin(call_frame_t *frame, xlator_t *this,
     local->fop = fop;
     local->offset = offset;
     local->flags = flags;
+    timespec_now(&local->fop_start);
     if (iobref)
         local->iobref = iobref_ref(iobref);
     local->fd = fd_ref(fd);
@@ -7269,6 +7602,467 @@ shard_discard(call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
     return 0;
 }
 
+/* Returns a ref on the inode of shard @block_num of @base_inode, linking it
+ * under /.shard the same way the fop path does. With @create set, a missing
+ * shard is created. Must be called from a synctask. */
+static inode_t *
+shard_copy_file_range_get_block(xlator_t *this, shard_local_t *local,
+                                inode_t *base_inode, int block_num,
+                                gf_boolean_t create, int *op_errno)
+{
+    int ret = 0;
+    int prefix_len = 0;
+    char path[SHARD_PATH_MAX];
+    char *bname = NULL;
+    mode_t mode = 0;
+    inode_t *inode = NULL;
+    inode_t *linked_inode = NULL;
+    inode_t *fsync_inode = NULL;
+    dict_t *xattr_req = NULL;
+    shard_priv_t *priv = NULL;
+    shard_inode_ctx_t ctx_tmp = {
+        0,
+    };
+    struct iatt stbuf = {
+        0,
+    };
+    loc_t loc = {
+        0,
+    };
+
+    priv = this->private;
+
+    prefix_len = shard_make_base_path(path, base_inode->gfid);
+    bname = path + sizeof(GF_SHARD_DIR) + 1;
+    shard_append_index(path, SHARD_PATH_MAX, prefix_len, block_num);
+
+    inode = inode_resolve(this->itable, path);
+    if (inode) {
+        linked_inode = inode;
+        goto update_list;
+    }
+
+    loc.inode = inode_new(this->itable);
+    loc.parent = inode_ref(priv->dot_shard_inode);
+    ret = inode_path(loc.parent, bname, (char **)&(loc.path));
+    if (ret < 0 || !(loc.inode)) {
+        *op_errno = ENOMEM;
+        goto out;
+    }
+    loc.name = strrchr(loc.path, '/');
+    if (loc.name)
+        loc.name++;
+
+    ret = syncop_lookup(FIRST_CHILD(this), &loc, &stbuf, NULL, NULL, NULL);
+    if ((ret == -ENOENT) && create) {
+        ret = shard_inode_ctx_get_all(local->fd->inode, this, &ctx_tmp);
+        if (ret) {
+            *op_errno = ENOMEM;
+            goto out;
+        }
+        mode = st_mode_from_ia(ctx_tmp.stat.ia_prot, ctx_tmp.stat.ia_type);
+
+        xattr_req = shard_create_gfid_dict(local->xattr_req);
+        if (!xattr_req) {
+            *op_errno = ENOMEM;
+            goto out;
+        }
+        ret = syncop_mknod(FIRST_CHILD(this), &loc, mode,
+                           ctx_tmp.stat.ia_rdev, &stbuf, xattr_req, NULL);
+        /* Somebody else may have created it in the meantime. */
+        if (ret == -EEXIST)
+            ret = syncop_lookup(FIRST_CHILD(this), &loc, &stbuf, NULL, NULL,
+                                NULL);
+    }
+    if (ret < 0) {
+        *op_errno = -ret;
+        goto out;
+    }
+
+    shard_inode_ctx_set(loc.inode, this, &stbuf, 0, SHARD_LOOKUP_MASK);
+    linked_inode = inode_link(loc.inode, priv->dot_shard_inode, bname, &stbuf);
+    inode_lookup(linked_inode);
+
+update_list:
+    LOCK(&priv->lock);
+    {
+        fsync_inode = __shard_update_shards_inode_list(
+            linked_inode, this, base_inode, block_num, base_inode->gfid);
+    }
+    UNLOCK(&priv->lock);
+    if (fsync_inode)
+        shard_initiate_evicted_inode_fsync(this, fsync_inode);
+
+out:
+    if (xattr_req)
+        dict_unref(xattr_req);
+    loc_wipe(&loc);
+    return linked_inode;
+}
+
+static int
+shard_copy_file_range_fstat(xlator_t *this, shard_local_t *local, fd_t *fd,
+                            struct iatt *stbuf)
+{
+    int ret = 0;
+    dict_t *xattr_req = NULL;
+    dict_t *xattr_rsp = NULL;
+
+    xattr_req = dict_new();
+    if (!xattr_req)
+        return -ENOMEM;
+
+    SHARD_MD_READ_FOP_INIT_REQ_DICT(this, xattr_req, fd->inode->gfid, local,
+                                    err);
+
+    ret = syncop_fstat(FIRST_CHILD(this), fd, stbuf, xattr_req, &xattr_rsp);
+    if (ret < 0)
+        goto out;
+
+    if (shard_modify_size_and_block_count(stbuf, xattr_rsp, _gf_true)) {
+        ret = -EINVAL;
+        goto out;
+    }
+    shard_inode_ctx_set(fd->inode, this, stbuf, 0, SHARD_LOOKUP_MASK);
+    goto out;
+err:
+    ret = -ENOMEM;
+out:
+    if (xattr_rsp)
+        dict_unref(xattr_rsp);
+    dict_unref(xattr_req);
+    return ret;
+}
+
+/* Zeroes [offset, offset + len) of a destination shard wherever it holds
+ * data. Ranges past the end of the shard already read back as zeroes. */
+static int
+shard_copy_file_range_zero(xlator_t *this, shard_local_t *local, fd_t *fd,
+                           off_t offset, size_t len)
+{
+    int ret = 0;
+    struct iatt pre = {
+        0,
+    };
+    struct iatt post = {
+        0,
+    };
+
+    ret = syncop_fstat(FIRST_CHILD(this), fd, &pre, NULL, NULL);
+    if (ret < 0)
+        return ret;
+    if (pre.ia_size <= offset)
+        return 0;
+    if (len > pre.ia_size - offset)
+        len = pre.ia_size - offset;
+
+    ret = syncop_zerofill(FIRST_CHILD(this), fd, offset, len, NULL, NULL);
+    if (ret < 0)
+        return ret;
+
+    ret = syncop_fstat(FIRST_CHILD(this), fd, &post, NULL, NULL);
+    if (ret < 0)
+        return ret;
+    GF_ATOMIC_ADD(local->delta_blocks, post.ia_blocks - pre.ia_blocks);
+
+    return 0;
+}
+
+/* Copies the range shard by shard. Each chunk ends at the next shard
+ * boundary of either file, so every brick level copy stays within one
+ * source and one destination shard. Missing source shards are holes. */
+static int
+shard_copy_file_range_task(void *data)
+{
+    int ret = 0;
+    int op_errno = 0;
+    int block_in = 0;
+    int block_out = 0;
+    off_t off_in = 0;
+    off_t off_out = 0;
+    off_t shard_off_in = 0;
+    off_t shard_off_out = 0;
+    size_t remaining = 0;
+    size_t chunk = 0;
+    inode_t *inode_in = NULL;
+    inode_t *inode_out = NULL;
+    fd_t *anon_fd_in = NULL;
+    fd_t *anon_fd_out = NULL;
+    int64_t *size_attr = NULL;
+    dict_t *xattr_req = NULL;
+    dict_t *xattr_rsp = NULL;
+    call_frame_t *frame = data;
+    shard_local_t *local = frame->local;
+    xlator_t *this = THIS;
+    struct iatt stbuf = {
+        0,
+    };
+    struct iatt pre = {
+        0,
+    };
+    struct iatt post = {
+        0,
+    };
+
+    synctask_setid(synctask_get(), 0, 0);
+
+    ret = shard_copy_file_range_fstat(this, local, local->fd_in,
+                                      &local->stbuf_in);
+    if (ret < 0)
+        goto err;
+    ret = shard_copy_file_range_fstat(this, local, local->fd, &local->prebuf);
+    if (ret < 0)
+        goto err;
+
+    off_in = local->offset_in;
+    off_out = local->offset;
+    if (off_in >= local->stbuf_in.ia_size)
+        local->total_size = 0;
+    else if (local->total_size > local->stbuf_in.ia_size - off_in)
+        local->total_size = local->stbuf_in.ia_size - off_in;
+    remaining = local->total_size;
+
+    while (remaining > 0) {
+        block_in = off_in / local->block_size;
+        block_out = off_out / local->dst_block_size;
+        shard_off_in = off_in % local->block_size;
+        shard_off_out = off_out % local->dst_block_size;
+
+        chunk = min(remaining, local->block_size - shard_off_in);
+        chunk = min(chunk, local->dst_block_size - shard_off_out);
+
+        op_errno = 0;
+        if (block_in == 0) {
+            inode_in = inode_ref(local->fd_in->inode);
+        } else {
+            inode_in = shard_copy_file_range_get_block(
+                this, local, local->fd_in->inode, block_in, _gf_false,
+                &op_errno);
+            if (!inode_in && (op_errno != ENOENT)) {
+                ret = -op_errno;
+                goto err;
+            }
+        }
+
+        if (block_out == 0) {
+            inode_out = inode_ref(local->fd->inode);
+        } else {
+            op_errno = 0;
+            inode_out = shard_copy_file_range_get_block(
+                this, local, local->fd->inode, block_out, (inode_in != NULL),
+                &op_errno);
+            if (!inode_out && (op_errno != ENOENT)) {
+                ret = -op_errno;
+                goto err;
+            }
+        }
+
+        if (inode_out) {
+            anon_fd_out = (block_out == 0) ? fd_ref(local->fd)
+                                           : fd_anonymous(inode_out);
+            if (!anon_fd_out) {
+                ret = -ENOMEM;
+                goto err;
+            }
+        }
+
+        ret = 0;
+        if (inode_in) {
+            anon_fd_in = (block_in == 0) ? fd_ref(local->fd_in)
+                                         : fd_anonymous(inode_in);
+            if (!anon_fd_in) {
+                ret = -ENOMEM;
+                goto err;
+            }
+            ret = syncop_copy_file_range(
+                FIRST_CHILD(this), anon_fd_in, shard_off_in, anon_fd_out,
+                shard_off_out, chunk, local->flags, &stbuf, &pre, &post,
+                local->xattr_req, NULL);
+            if (ret < 0) {
+                ret = -errno;
+                goto err;
+            }
+            GF_ATOMIC_ADD(local->delta_blocks, post.ia_blocks - pre.ia_blocks);
+        }
+
+        /* Whatever the source shard doesn't hold is a hole. */
+        if (anon_fd_out && (ret < chunk)) {
+            ret = shard_copy_file_range_zero(this, local, anon_fd_out,
+                                             shard_off_out + ret, chunk - ret);
+            if (ret < 0)
+                goto err;
+        }
+
+        if (anon_fd_out && (anon_fd_out->inode != local->fd->inode))
+            shard_inode_ctx_add_to_fsync_list(local->fd->inode, this,
+                                              anon_fd_out->inode);
+
+        local->written_size += chunk;
+        off_in += chunk;
+        off_out += chunk;
+        remaining -= chunk;
+
+        if (anon_fd_in)
+            fd_unref(anon_fd_in);
+        if (anon_fd_out)
+            fd_unref(anon_fd_out);
+        if (inode_in)
+            inode_unref(inode_in);
+        if (inode_out)
+            inode_unref(inode_out);
+        anon_fd_in = anon_fd_out = NULL;
+        inode_in = inode_out = NULL;
+    }
+
+    shard_get_delta_size_from_inode_ctx(local, local->fd->inode, this);
+
+    if ((local->delta_size == 0) && (GF_ATOMIC_GET(local->delta_blocks) == 0))
+        return 0;
+
+    ret = shard_set_size_attrs(local->delta_size,
+                               GF_ATOMIC_GET(local->delta_blocks), &size_attr);
+    if (ret) {
+        ret = -ENOMEM;
+        goto err;
+    }
+
+    xattr_req = dict_new();
+    if (!xattr_req) {
+        GF_FREE(size_attr);
+        ret = -ENOMEM;
+        goto err;
+    }
+    ret = dict_set_bin(xattr_req, GF_XATTR_SHARD_FILE_SIZE, size_attr, 8 * 4);
+    if (ret) {
+        GF_FREE(size_attr);
+        ret = -ENOMEM;
+        goto err;
+    }
+
+    ret = syncop_fxattrop(FIRST_CHILD(this), local->fd, GF_XATTROP_ADD_ARRAY64,
+                          xattr_req, NULL, &xattr_rsp, NULL);
+    if (ret < 0)
+        goto err;
+
+    if (shard_modify_size_and_block_count(&local->postbuf, xattr_rsp,
+                                          _gf_true)) {
+        ret = -EINVAL;
+        goto err;
+    }
+
+    ret = 0;
+err:
+    if (anon_fd_in)
+        fd_unref(anon_fd_in);
+    if (anon_fd_out)
+        fd_unref(anon_fd_out);
+    if (inode_in)
+        inode_unref(inode_in);
+    if (inode_out)
+        inode_unref(inode_out);
+    if (xattr_req)
+        dict_unref(xattr_req);
+    if (xattr_rsp)
+        dict_unref(xattr_rsp);
+    return ret;
+}
+
+static int
+shard_copy_file_range_done(int ret, call_frame_t *frame, void *data)
+{
+    shard_local_t *local = frame->local;
+
+    if (ret < 0) {
+        SHARD_STACK_UNWIND(copy_file_range, frame, -1, -ret, NULL, NULL, NULL,
+                           NULL);
+        return 0;
+    }
+
+    SHARD_STACK_UNWIND(copy_file_range, frame, local->written_size, 0,
+                       &local->stbuf_in, &local->prebuf, &local->postbuf,
+                       local->xattr_rsp);
+    return 0;
+}
+
+int32_t
+shard_copy_file_range(call_frame_t *frame, xlator_t *this, fd_t *fd_in,
+                      off64_t off_in, fd_t *fd_out, off64_t off_out,
+                      size_t len, uint32_t flags, dict_t *xdata)
+{
+    int ret = 0;
+    int op_errno = ENOMEM;
+    uint64_t block_size_in = 0;
+    uint64_t block_size_out = 0;
+    shard_priv_t *priv = NULL;
+    shard_local_t *local = NULL;
+
+    priv = this->private;
+
+    if (frame->root->pid == GF_CLIENT_PID_GSYNCD)
+        goto wind;
+
+    if (shard_inode_ctx_get_block_size(fd_in->inode, this, &block_size_in) ||
+        shard_inode_ctx_get_block_size(fd_out->inode, this, &block_size_out)) {
+        gf_msg(this->name, GF_LOG_ERROR, 0, SHARD_MSG_INODE_CTX_GET_FAILED,
+               "Failed to get block size of %s or %s from inode ctx",
+               uuid_utoa(fd_in->inode->gfid), uuid_utoa(fd_out->inode->gfid));
+        goto err;
+    }
+
+    if (!block_size_in && !block_size_out)
+        goto wind;
+
+    /* Copies between a sharded and an unsharded file, or before the shard
+     * directory has been resolved, are left to the caller. */
+    if (!block_size_in || !block_size_out || !priv->dot_shard_inode) {
+        op_errno = EXDEV;
+        goto err;
+    }
+
+    if (!this->itable)
+        this->itable = fd_out->inode->table;
+
+    local = mem_get0(this->local_pool);
+    if (!local)
+        goto err;
+
+    frame->local = local;
+
+    local->xattr_req = (xdata) ? dict_ref(xdata) : dict_new();
+    if (!local->xattr_req)
+        goto err;
+
+    local->fop = GF_FOP_COPY_FILE_RANGE;
+    local->fd_in = fd_ref(fd_in);
+    local->offset_in = off_in;
+    local->fd = fd_ref(fd_out);
+    local->offset = off_out;
+    local->total_size = len;
+    local->flags = flags;
+    local->block_size = block_size_in;
+    local->dst_block_size = block_size_out;
+    local->resolver_base_inode = local->fd->inode;
+    GF_ATOMIC_INIT(local->delta_blocks, 0);
+
+    ret = synctask_new(this->ctx->env, shard_copy_file_range_task,
+                       shard_copy_file_range_done, frame, frame);
+    if (ret < 0)
+        goto err;
+
+    return 0;
+
+wind:
+    STACK_WIND(frame, default_copy_file_range_cbk, FIRST_CHILD(this),
+               FIRST_CHILD(this)->fops->copy_file_range, fd_in, off_in, fd_out,
+               off_out, len, flags, xdata);
+    return 0;
+
+err:
+    SHARD_STACK_UNWIND(copy_file_range, frame, -1, op_errno, NULL, NULL, NULL,
+                       NULL);
+    return 0;
+}
+
 int32_t
 shard_seek(call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
            gf_seek_what_t what, dict_t *xdata)
@@ -7430,6 +8224,9 @@ int
 init(xlator_t *this)
 {
     int ret = -1;
+    tbf_opspec_t spec = {
+        0,
+    };
     shard_priv_t *priv = NULL;
 
     if (!this) {
@@ -7459,8 +8256,30 @@ init(xlator_t *this)
 
     GF_OPTION_INIT("shard-deletion-rate", priv->deletion_rate, uint32, out);
 
+    GF_OPTION_INIT("shard-deletion-threads", priv->deletion_threads, uint32,
+                   out);
+
+    GF_OPTION_INIT("shard-deletion-bandwidth", priv->deletion_bandwidth,
+                   size_uint64, out);
+
     GF_OPTION_INIT("shard-lru-limit", priv->lru_limit, uint64, out);
 
+    GF_ATOMIC_INIT(priv->lru_hits, 0);
+    GF_ATOMIC_INIT(priv->lru_misses, 0);
+    GF_ATOMIC_INIT(priv->lru_evictions, 0);
+    GF_ATOMIC_INIT(priv->del_files_active, 0);
+    GF_ATOMIC_INIT(priv->del_shards_pending, 0);
+    GF_ATOMIC_INIT(priv->del_shards_done, 0);
+    GF_ATOMIC_INIT(priv->del_bytes_done, 0);
+
+    pthread_mutex_init(&priv->bg_del_mutex, NULL);
+    pthread_cond_init(&priv->bg_del_cond, NULL);
+
+    shard_deletion_tbf_spec(priv, &spec);
+    priv->deletion_tbf = tbf_init(&spec, 1);
+    if (!priv->deletion_tbf)
+        goto out;
+
     this->local_pool = mem_pool_new(shard_local_t, 128);
     if (!this->local_pool) {
         ret = -1;
@@ -7483,6 +8302,11 @@ init(xlator_t *this)
     ret = 0;
 out:
     if (ret) {
+        if (priv) {
+            tbf_fini(priv->deletion_tbf);
+            pthread_cond_destroy(&priv->bg_del_cond);
+            pthread_mutex_destroy(&priv->bg_del_mutex);
+        }
         GF_FREE(priv);
         mem_pool_destroy(this->local_pool);
     }
@@ -7500,10 +8324,17 @@ fini(xlator_t *this)
     /*Itable was not created by shard, hence setting to NULL.*/
     this->itable = NULL;
 
+    priv = this->private;
+    if (priv) {
+        /* the deletion threads use priv, the tbf and the local pool */
+        shard_bg_deletion_fini(priv);
+        tbf_fini(priv->deletion_tbf);
+        priv->deletion_tbf = NULL;
+    }
+
     mem_pool_destroy(this->local_pool);
     this->local_pool = NULL;
 
-    priv = this->private;
     if (!priv)
         goto out;
 
@@ -7511,6 +8342,8 @@ fini(xlator_t *this)
 
     this->private = NULL;
     LOCK_DESTROY(&priv->lock);
+    pthread_cond_destroy(&priv->bg_del_cond);
+    pthread_mutex_destroy(&priv->bg_del_mutex);
     GF_FREE(priv);
 
 out:
@@ -7521,6 +8354,10 @@ int
 reconfigure(xlator_t *this, dict_t *options)
 {
     int ret = -1;
+    uint64_t bandwidth = 0;
+    tbf_opspec_t spec = {
+        0,
+    };
     shard_priv_t *priv = NULL;
 
     priv = this->private;
@@ -7529,6 +8366,18 @@ reconfigure(xlator_t *this, dict_t *options)
 
     GF_OPTION_RECONF("shard-deletion-rate", priv->deletion_rate, options,
                      uint32, out);
+
+    GF_OPTION_RECONF("shard-deletion-threads", priv->deletion_threads, options,
+                     uint32, out);
+
+    bandwidth = priv->deletion_bandwidth;
+    GF_OPTION_RECONF("shard-deletion-bandwidth", priv->deletion_bandwidth,
+                     options, size_uint64, out);
+    if (bandwidth != priv->deletion_bandwidth) {
+        shard_deletion_tbf_spec(priv, &spec);
+        if (tbf_mod(priv->deletion_tbf, &spec))
+            goto out;
+    }
     ret = 0;
 
 out:
@@ -7578,7 +8427,18 @@ shard_release(xlator_t *this, fd_t *fd)
 int
 shard_priv_dump(xlator_t *this)
 {
+    /* count and average latency in usecs, by number of shards touched */
+    static char *fanout_keys[SHARD_FANOUT_BUCKETS][2] = {
+        {"read-fanout-1", "write-fanout-1"},
+        {"read-fanout-2", "write-fanout-2"},
+        {"read-fanout-3-4", "write-fanout-3-4"},
+        {"read-fanout-5-8", "write-fanout-5-8"},
+        {"read-fanout-9+", "write-fanout-9+"},
+    };
     shard_priv_t *priv = NULL;
+    uint64_t count = 0;
+    uint64_t total_us = 0;
+    int i = 0;
     char key_prefix[GF_DUMP_MAX_BUF_LEN] = {
         0,
     };
@@ -7593,6 +8453,35 @@ shard_priv_dump(xlator_t *this)
     gf_proc_dump_write("inode-count", "%d", priv->inode_count);
     gf_proc_dump_write("ilist_head", "%p", &priv->ilist_head);
     gf_proc_dump_write("lru-max-limit", "%" PRIu64, priv->lru_limit);
+    gf_proc_dump_write("lru-hits", "%" PRIu64, GF_ATOMIC_GET(priv->lru_hits));
+    gf_proc_dump_write("lru-misses", "%" PRIu64,
+                       GF_ATOMIC_GET(priv->lru_misses));
+    gf_proc_dump_write("lru-evictions", "%" PRIu64,
+                       GF_ATOMIC_GET(priv->lru_evictions));
+
+    gf_proc_dump_write("deletion-threads", "%" PRIu32,
+                       priv->deletion_threads);
+    gf_proc_dump_write("deletion-bandwidth", "%" PRIu64,
+                       priv->deletion_bandwidth);
+    gf_proc_dump_write("deletion-files-active", "%" PRIu64,
+                       GF_ATOMIC_GET(priv->del_files_active));
+    gf_proc_dump_write("deletion-shards-pending", "%" PRIu64,
+                       GF_ATOMIC_GET(priv->del_shards_pending));
+    gf_proc_dump_write("deletion-shards-done", "%" PRIu64,
+                       GF_ATOMIC_GET(priv->del_shards_done));
+    gf_proc_dump_write("deletion-bytes-done", "%" PRIu64,
+                       GF_ATOMIC_GET(priv->del_bytes_done));
+
+    for (i = 0; i < SHARD_FANOUT_BUCKETS; i++) {
+        count = GF_ATOMIC_GET(priv->read_fanout[i].count);
+        total_us = GF_ATOMIC_GET(priv->read_fanout[i].total_us);
+        gf_proc_dump_write(fanout_keys[i][0], "%" PRIu64 ",%" PRIu64, count,
+                           count ? total_us / count : 0);
+        count = GF_ATOMIC_GET(priv->write_fanout[i].count);
+        total_us = GF_ATOMIC_GET(priv->write_fanout[i].total_us);
+        gf_proc_dump_write(fanout_keys[i][1], "%" PRIu64 ",%" PRIu64, count,
+                           count ? total_us / count : 0);
+    }
 
     GF_FREE(str);
 
@@ -7627,6 +8516,7 @@ struct xlator_fops fops = {
     .fremovexattr = shard_fremovexattr,
     .fallocate = shard_fallocate,
     .discard = shard_discard,
+    .copy_file_range = shard_copy_file_range,
     .zerofill = shard_zerofill,
     .readdir = shard_readdir,
     .readdirp = shard_readdirp,
@@ -7680,13 +8570,38 @@ struct volume_options options[] = {
         .max = INT_MAX,
         .description = "The number of shards to send deletes on at a time",
     },
+    {
+        .key = {"shard-deletion-threads"},
+        .type = GF_OPTION_TYPE_INT,
+        .op_version = {GD_OP_VERSION_11_0},
+        .flags = OPT_FLAG_SETTABLE | OPT_FLAG_CLIENT_OPT | OPT_FLAG_DOC,
+        .tags = {"shard"},
+        .default_value = "1",
+        .min = 1,
+        .max = 16,
+        .description = "The number of threads deleting the shards of removed "
+                       "files in the background, each taking care of a "
+                       "different set of files",
+    },
+    {
+        .key = {"shard-deletion-bandwidth"},
+        .type = GF_OPTION_TYPE_SIZET,
+        .op_version = {GD_OP_VERSION_11_0},
+        .flags = OPT_FLAG_SETTABLE | OPT_FLAG_CLIENT_OPT | OPT_FLAG_DOC,
+        .tags = {"shard"},
+        .default_value = "0",
+        .description = "The number of bytes of removed files whose shards "
+                       "are deleted per second in the background, by all "
+                       "threads together. 0 deletes them as fast as "
+                       "possible",
+    },
     {
         .key = {"shard-lru-limit"},
         .type = GF_OPTION_TYPE_INT,
         .op_version = {GD_OP_VERSION_5_0},
         .flags = OPT_FLAG_SETTABLE | OPT_FLAG_CLIENT_OPT,
         .tags = {"shard"},
-        .default_value = "16384",
+        .default_value = "65536",
         .min = 20,
         .max = INT_MAX,
         .description = "The number of resolved shard inodes to keep in "
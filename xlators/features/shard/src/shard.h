@@ -15,6 +15,7 @@
 #include <glusterfs/compat-errno.h>
 #include "shard-messages.h"
 #include <glusterfs/syncop.h>
+#include <glusterfs/throttle-tbf.h>
 
 #define GF_SHARD_DIR ".shard"
 #define GF_SHARD_REMOVE_ME_DIR ".remove_me"
@@ -217,6 +218,26 @@ typedef struct shard_unlink_thread {
     gf_boolean_t stop;
 } shard_unlink_thread_t;
 
+/* Latency of reads and writes, bucketed by the number of shards they
+ * touched (1, 2, 3-4, 5-8, 9 and more).
+ */
+#define SHARD_FANOUT_BUCKETS 5
+
+typedef struct shard_fanout_stats {
+    gf_atomic_t count;
+    gf_atomic_t total_us;
+} shard_fanout_stats_t;
+
+/* One of the threads deleting the shards of the files in .remove_me, each
+ * of which takes care of the files whose gfids hash to its index.
+ */
+typedef struct shard_deleter {
+    xlator_t *this;
+    pthread_t thread;
+    int index;
+    int count;
+} shard_deleter_t;
+
 typedef struct shard_priv {
     uint64_t block_size;
     uuid_t dot_shard_gfid;
@@ -227,9 +248,26 @@ typedef struct shard_priv {
     struct list_head ilist_head;
     int inode_count;
     uint32_t deletion_rate;
+    uint32_t deletion_threads;
+    uint64_t deletion_bandwidth;
+    tbf_t *deletion_tbf;
+    gf_atomic_t del_files_active;
+    gf_atomic_t del_shards_pending;
+    gf_atomic_t del_shards_done;
+    gf_atomic_t del_bytes_done;
     shard_bg_deletion_state_t bg_del_state;
+    /* running background deletion threads, waited for by fini */
+    pthread_mutex_t bg_del_mutex;
+    pthread_cond_t bg_del_cond;
+    int bg_del_threads;
+    gf_boolean_t bg_del_stop;
     gf_boolean_t first_lookup_done;
     uint64_t lru_limit;
+    gf_atomic_t lru_hits;
+    gf_atomic_t lru_misses;
+    gf_atomic_t lru_evictions;
+    shard_fanout_stats_t read_fanout[SHARD_FANOUT_BUCKETS];
+    shard_fanout_stats_t write_fanout[SHARD_FANOUT_BUCKETS];
     shard_unlink_thread_t thread_info;
 } shard_priv_t;
 
@@ -294,6 +332,9 @@ typedef struct shard_local {
     loc_t loc2;
     loc_t tmp_loc;
     fd_t *fd;
+    fd_t *fd_in;
+    off_t offset_in;
+    struct iatt stbuf_in;
     dict_t *xattr_req;
     dict_t *xattr_rsp;
     inode_t **inode_list;
@@ -330,6 +371,7 @@ typedef struct shard_local {
     char *name;
     uint32_t deletion_rate;
     uuid_t base_gfid;
+    struct timespec fop_start;
 } shard_local_t;
 
 typedef struct shard_inode_ctx {
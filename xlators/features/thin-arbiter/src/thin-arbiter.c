@@ -546,6 +546,15 @@ ta_zerofill(call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
     return 0;
 }
 
+int32_t
+ta_copy_file_range(call_frame_t *frame, xlator_t *this, fd_t *fd_in,
+                   off64_t off_in, fd_t *fd_out, off64_t off_out, size_t len,
+                   uint32_t flags, dict_t *xdata)
+{
+    TA_FAILED_FOP(copy_file_range, frame, EINVAL);
+    return 0;
+}
+
 int32_t
 ta_seek(call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
         gf_seek_what_t what, dict_t *xdata)
@@ -636,6 +645,7 @@ struct xlator_fops fops = {
     .fallocate = ta_fallocate,
     .discard = ta_discard,
     .zerofill = ta_zerofill,
+    .copy_file_range = ta_copy_file_range,
     .seek = ta_seek,
 };
 
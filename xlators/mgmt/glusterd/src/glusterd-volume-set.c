@@ -890,6 +890,18 @@ struct volopt_map_entry glusterd_volopt_map[] = {
         .voltype = "cluster/distribute",
         .op_version = GD_OP_VERSION_3_6_0,
     },
+    {
+        .key = "cluster.layout-type",
+        .voltype = "cluster/distribute",
+        .op_version = GD_OP_VERSION_11_0,
+        .flags = VOLOPT_FLAG_CLIENT_OPT,
+    },
+    {
+        .key = "cluster.readdirp-window",
+        .voltype = "cluster/distribute",
+        .op_version = GD_OP_VERSION_11_0,
+        .flags = VOLOPT_FLAG_CLIENT_OPT,
+    },
 
     /* Switch xlator options (Distribute special case) */
     {.key = "cluster.switch",
@@ -974,6 +986,10 @@ struct volopt_map_entry glusterd_volopt_map[] = {
      .option = "data-self-heal-algorithm",
      .op_version = 1,
      .flags = VOLOPT_FLAG_CLIENT_OPT},
+    {.key = "cluster.data-self-heal-checksum",
+     .voltype = "cluster/replicate",
+     .op_version = GD_OP_VERSION_11_0,
+     .flags = VOLOPT_FLAG_CLIENT_OPT},
     {.key = "cluster.eager-lock",
      .voltype = "cluster/replicate",
      .op_version = 1,
@@ -1018,6 +1034,10 @@ struct volopt_map_entry glusterd_volopt_map[] = {
      .type = NO_DOC,
      .op_version = 2,
      .flags = VOLOPT_FLAG_CLIENT_OPT},
+    {.key = "cluster.changelog-batch-size",
+     .voltype = "cluster/replicate",
+     .op_version = GD_OP_VERSION_11_0,
+     .flags = VOLOPT_FLAG_CLIENT_OPT},
     {.key = "cluster.ensure-durability",
      .voltype = "cluster/replicate",
      .op_version = 3,
@@ -1179,6 +1199,16 @@ struct volopt_map_entry glusterd_volopt_map[] = {
      .option = "cache-size",
      .op_version = GD_OP_VERSION_8_0,
      .flags = VOLOPT_FLAG_CLIENT_OPT},
+    {.key = "performance.io-cache-policy",
+     .voltype = "performance/io-cache",
+     .option = "cache-policy",
+     .op_version = GD_OP_VERSION_11_0,
+     .flags = VOLOPT_FLAG_CLIENT_OPT},
+    {.key = "performance.io-cache-shared-size",
+     .voltype = "performance/io-cache",
+     .option = "shared-cache-size",
+     .op_version = GD_OP_VERSION_11_0,
+     .flags = VOLOPT_FLAG_CLIENT_OPT},
     {
         .key = "performance.cache-size",
         .voltype = "performance/io-cache",
@@ -1222,6 +1252,10 @@ struct volopt_map_entry glusterd_volopt_map[] = {
      .voltype = "performance/io-threads",
      .option = "pass-through",
      .op_version = GD_OP_VERSION_4_1_0},
+    {.key = "performance.iot-queue-shards",
+     .voltype = "performance/io-threads",
+     .option = "queue-shards",
+     .op_version = GD_OP_VERSION_11_0},
 
     /* Other perf xlators' options */
     {.key = "performance.io-cache-pass-through",
@@ -1261,6 +1295,21 @@ struct volopt_map_entry glusterd_volopt_map[] = {
      .option = "ctime-invalidation",
      .op_version = GD_OP_VERSION_5_0,
      .flags = VOLOPT_FLAG_CLIENT_OPT},
+    {.key = "performance.quick-read-shared-size",
+     .voltype = "performance/quick-read",
+     .option = "shared-cache-size",
+     .op_version = GD_OP_VERSION_11_0,
+     .flags = VOLOPT_FLAG_CLIENT_OPT},
+    {.key = "performance.quick-read-max-chunked-file-size",
+     .voltype = "performance/quick-read",
+     .option = "max-chunked-file-size",
+     .op_version = GD_OP_VERSION_11_0,
+     .flags = VOLOPT_FLAG_CLIENT_OPT},
+    {.key = "performance.quick-read-chunk-size",
+     .voltype = "performance/quick-read",
+     .option = "chunk-size",
+     .op_version = GD_OP_VERSION_11_0,
+     .flags = VOLOPT_FLAG_CLIENT_OPT},
     {.key = "performance.flush-behind",
      .voltype = "performance/write-behind",
      .option = "flush-behind",
@@ -1419,6 +1468,35 @@ struct volopt_map_entry glusterd_volopt_map[] = {
      .voltype = "performance/nl-cache",
      .option = "pass-through",
      .op_version = GD_OP_VERSION_4_1_0},
+    {.key = "performance.disk-cache-dir",
+     .voltype = "performance/disk-cache",
+     .option = "cache-dir",
+     .op_version = GD_OP_VERSION_11_0,
+     .flags = VOLOPT_FLAG_CLIENT_OPT},
+    {.key = "performance.disk-cache-size",
+     .voltype = "performance/disk-cache",
+     .option = "cache-size",
+     .op_version = GD_OP_VERSION_11_0,
+     .flags = VOLOPT_FLAG_CLIENT_OPT},
+    {.key = "performance.disk-cache-block-size",
+     .voltype = "performance/disk-cache",
+     .option = "block-size",
+     .op_version = GD_OP_VERSION_11_0,
+     .flags = VOLOPT_FLAG_CLIENT_OPT},
+    {.key = "performance.disk-cache-timeout",
+     .voltype = "performance/disk-cache",
+     .option = "cache-timeout",
+     .op_version = GD_OP_VERSION_11_0,
+     .flags = VOLOPT_FLAG_CLIENT_OPT},
+    {.key = "performance.disk-cache-ctime-invalidation",
+     .voltype = "performance/disk-cache",
+     .option = "ctime-invalidation",
+     .op_version = GD_OP_VERSION_11_0,
+     .flags = VOLOPT_FLAG_CLIENT_OPT},
+    {.key = "performance.disk-cache-pass-through",
+     .voltype = "performance/disk-cache",
+     .option = "pass-through",
+     .op_version = GD_OP_VERSION_11_0},
 
     /* Client xlator options */
     {.key = "network.frame-timeout",
@@ -1482,6 +1560,17 @@ struct volopt_map_entry glusterd_volopt_map[] = {
      .op_version = GD_OP_VERSION_3_10_2,
      .value = "9",
      .flags = VOLOPT_FLAG_CLIENT_OPT},
+    {.key = "client.io-uring",
+     .voltype = "protocol/client",
+     .option = "transport.socket.io-uring",
+     .value = "off",
+     .op_version = GD_OP_VERSION_11_0,
+     .validate_fn = validate_boolean,
+     .description = "Send RPC messages to the bricks through the io_uring "
+                    "I/O engine, batching submissions across connections. "
+                    "Falls back to the regular path when the client is not "
+                    "running the io_uring engine or SSL is enabled.",
+     .flags = VOLOPT_FLAG_CLIENT_OPT},
     {.key = "client.strict-locks",
      .voltype = "protocol/client",
      .option = "strict-locks",
@@ -1637,6 +1726,18 @@ struct volopt_map_entry glusterd_volopt_map[] = {
         .op_version = GD_OP_VERSION_3_10_2,
         .value = "9",
     },
+    {
+        .key = "server.io-uring",
+        .voltype = "protocol/server",
+        .option = "transport.socket.io-uring",
+        .value = "off",
+        .op_version = GD_OP_VERSION_11_0,
+        .validate_fn = validate_boolean,
+        .description = "Send RPC replies to the clients through the io_uring "
+                       "I/O engine, batching submissions across connections. "
+                       "Falls back to the regular path when the brick is not "
+                       "running the io_uring engine or SSL is enabled.",
+    },
     {
         .key = "transport.listen-backlog",
         .voltype = "protocol/server",
@@ -1707,6 +1808,15 @@ struct volopt_map_entry glusterd_volopt_map[] = {
     },
 
     /* Performance xlators enable/disbable options */
+    {.key = "performance.disk-cache",
+     .voltype = "performance/disk-cache",
+     .option = "!perf",
+     .value = "off",
+     .op_version = GD_OP_VERSION_11_0,
+     .description = "enable/disable the translator keeping the data read "
+                    "by the client in a cache file on a local disk, which "
+                    "survives remounts.",
+     .flags = VOLOPT_FLAG_CLIENT_OPT | VOLOPT_FLAG_XLATOR_OPT},
     {.key = "performance.write-behind",
      .voltype = "performance/write-behind",
      .option = "!perf",
@@ -2586,6 +2696,14 @@ struct volopt_map_entry glusterd_volopt_map[] = {
      .voltype = "features/shard",
      .op_version = GD_OP_VERSION_5_0,
      .flags = VOLOPT_FLAG_CLIENT_OPT},
+    {.key = "features.shard-deletion-threads",
+     .voltype = "features/shard",
+     .op_version = GD_OP_VERSION_11_0,
+     .flags = VOLOPT_FLAG_CLIENT_OPT},
+    {.key = "features.shard-deletion-bandwidth",
+     .voltype = "features/shard",
+     .op_version = GD_OP_VERSION_11_0,
+     .flags = VOLOPT_FLAG_CLIENT_OPT},
     {
         .key = "features.scrub-throttle",
         .voltype = "features/bit-rot",
@@ -2682,6 +2800,10 @@ struct volopt_map_entry glusterd_volopt_map[] = {
      .voltype = "cluster/disperse",
      .op_version = GD_OP_VERSION_3_7_6,
      .flags = VOLOPT_FLAG_CLIENT_OPT},
+    {.key = "disperse.hedged-reads",
+     .voltype = "cluster/disperse",
+     .op_version = GD_OP_VERSION_11_0,
+     .flags = VOLOPT_FLAG_CLIENT_OPT},
     {.key = "cluster.shd-max-threads",
      .voltype = "cluster/replicate",
      .op_version = GD_OP_VERSION_3_7_12,
@@ -2691,6 +2813,10 @@ struct volopt_map_entry glusterd_volopt_map[] = {
      .voltype = "cluster/replicate",
      .op_version = GD_OP_VERSION_3_7_12,
      .flags = VOLOPT_FLAG_CLIENT_OPT},
+    {.key = "cluster.shd-crawl-threads",
+     .voltype = "cluster/replicate",
+     .op_version = GD_OP_VERSION_11_0,
+     .flags = VOLOPT_FLAG_CLIENT_OPT},
     {.key = "cluster.locking-scheme",
      .voltype = "cluster/replicate",
      .type = DOC,
@@ -2827,6 +2953,12 @@ struct volopt_map_entry glusterd_volopt_map[] = {
         .flags = VOLOPT_FLAG_CLIENT_OPT,
         .op_version = GD_OP_VERSION_3_11_0,
     },
+    {
+        .key = "performance.nl-cache-filter-size",
+        .voltype = "performance/nl-cache",
+        .flags = VOLOPT_FLAG_CLIENT_OPT,
+        .op_version = GD_OP_VERSION_11_0,
+    },
 
     /* Brick multiplexing options */
     {.key = GLUSTERD_BRICK_MULTIPLEX_KEY,
@@ -0,0 +1,30 @@
+/*
+ *   Copyright (c) 2026 Red Hat, Inc. <http://www.redhat.com>
+ *   This file is part of GlusterFS.
+ *
+ *   This file is licensed to you under your choice of the GNU Lesser
+ *   General Public License, version 3 or any later version (LGPLv3 or
+ *   later), or the GNU General Public License, version 2 (GPLv2), in all
+ *   cases as published by the Free Software Foundation.
+ */
+
+#ifndef __DISK_CACHE_MESSAGES_H__
+#define __DISK_CACHE_MESSAGES_H__
+
+#include <glusterfs/glfs-message-id.h>
+
+/* To add new message IDs, append new identifiers at the end of the list.
+ *
+ * Never remove a message ID. If it's not used anymore, you can rename it or
+ * leave it as it is, but not delete it. This is to prevent reutilization of
+ * IDs by other messages.
+ *
+ * The component name must match one of the entries defined in
+ * glfs-message-id.h.
+ */
+
+GLFS_MSGID(DISK_CACHE, DC_MSG_NO_MEMORY, DC_MSG_XLATOR_CHILD_MISCONFIGURED,
+           DC_MSG_STORE_OPEN_FAILED, DC_MSG_STORE_BUSY, DC_MSG_STORE_RESET,
+           DC_MSG_STORE_IO_FAILED, DC_MSG_THREAD_CREATE_FAILED);
+
+#endif /* __DISK_CACHE_MESSAGES_H__ */
@@ -0,0 +1,532 @@
+/*
+ *   Copyright (c) 2026 Red Hat, Inc. <http://www.redhat.com>
+ *   This file is part of GlusterFS.
+ *
+ *   This file is licensed to you under your choice of the GNU Lesser
+ *   General Public License, version 3 or any later version (LGPLv3 or
+ *   later), or the GNU General Public License, version 2 (GPLv2), in all
+ *   cases as published by the Free Software Foundation.
+ */
+
+#include <sys/file.h>
+
+#include "disk-cache.h"
+#include <glusterfs/syscall.h>
+
+#define DC_MAGIC 0x676c757364636331ULL /* "glusdcc1" */
+#define DC_VERSION 1
+#define DC_HEADER_SIZE 4096
+#define DC_ALIGN(x, a) (((x) + (a)-1) & ~((uint64_t)(a)-1))
+
+/* the cache files open in this process, one per path */
+static struct list_head dc_stores = {&dc_stores, &dc_stores};
+static pthread_mutex_t dc_stores_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static uint64_t
+dc_store_set(dc_store_t *store, uuid_t gfid, off_t offset)
+{
+    uint64_t hash = 0;
+
+    memcpy(&hash, &gfid[8], sizeof(hash));
+    hash ^= (uint64_t)(offset / store->block_size) * 0x9e3779b97f4a7c15ULL;
+
+    return hash % store->nsets;
+}
+
+static off_t
+dc_store_block_offset(dc_store_t *store, uint64_t idx)
+{
+    return store->data_offset + idx * store->block_size;
+}
+
+static int
+dc_store_header_write(dc_store_t *store, gf_boolean_t clean)
+{
+    dc_disk_header_t header = {
+        0,
+    };
+
+    header.magic = DC_MAGIC;
+    header.version = DC_VERSION;
+    header.block_size = store->block_size;
+    header.nsets = store->nsets;
+    header.ways = DC_WAYS;
+    header.clean = clean;
+    header.index_offset = store->index_offset;
+    header.data_offset = store->data_offset;
+
+    if (sys_pwrite(store->fd, &header, sizeof(header), 0) != sizeof(header))
+        return -1;
+
+    return sys_fdatasync(store->fd);
+}
+
+/* The index is kept in memory and written out whole at checkpoints and at
+ * close, it is read back only if the header says it holds: blocks written
+ * since the last checkpoint may disagree with it, and the cache then starts
+ * empty. */
+static int
+dc_store_load(dc_store_t *store)
+{
+    dc_disk_header_t header = {
+        0,
+    };
+    size_t len = 0;
+
+    if (sys_pread(store->fd, &header, sizeof(header), 0) != sizeof(header))
+        return -1;
+
+    if ((header.magic != DC_MAGIC) || (header.version != DC_VERSION) ||
+        (header.ways != DC_WAYS) || (header.block_size != store->block_size) ||
+        (header.nsets != store->nsets) ||
+        (header.index_offset != store->index_offset) ||
+        (header.data_offset != store->data_offset) || !header.clean)
+        return -1;
+
+    len = store->nsets * DC_WAYS * sizeof(dc_disk_entry_t);
+    if (sys_pread(store->fd, store->index, len, store->index_offset) != len)
+        return -1;
+
+    return 0;
+}
+
+static int
+dc_store_reset(dc_store_t *store)
+{
+    uint64_t size = 0;
+
+    memset(store->index, 0, store->nsets * DC_WAYS * sizeof(dc_disk_entry_t));
+
+    size = store->data_offset +
+           store->nsets * DC_WAYS * (uint64_t)store->block_size;
+    if ((sys_ftruncate(store->fd, 0) < 0) ||
+        (sys_ftruncate(store->fd, size) < 0))
+        return -1;
+
+    return 0;
+}
+
+static void
+dc_store_free(dc_store_t *store)
+{
+    if (store->fd >= 0)
+        sys_close(store->fd);
+
+    pthread_mutex_destroy(&store->lock);
+    pthread_mutex_destroy(&store->write_lock);
+    GF_FREE(store->index);
+    GF_FREE(store->snapshot);
+    GF_FREE(store->gen);
+    GF_FREE(store->path);
+    GF_FREE(store);
+}
+
+static dc_store_t *
+dc_store_find(const char *path)
+{
+    dc_store_t *store = NULL;
+
+    list_for_each_entry(store, &dc_stores, list)
+    {
+        if (!strcmp(store->path, path))
+            return store;
+    }
+
+    return NULL;
+}
+
+dc_store_t *
+dc_store_open(xlator_t *this, const char *dir, uint64_t size,
+              uint32_t block_size)
+{
+    dc_store_t *store = NULL;
+    char *path = NULL;
+    uint64_t nsets = 0;
+    uint64_t i = 0;
+    int ret = -1;
+
+    if (mkdir_p((char *)dir, 0700, _gf_true) < 0) {
+        gf_msg(this->name, GF_LOG_ERROR, errno, DC_MSG_STORE_OPEN_FAILED,
+               "could not create cache directory %s", dir);
+        return NULL;
+    }
+
+    if (gf_asprintf(&path, "%s/%s.cache", dir, this->name) < 0)
+        return NULL;
+
+    nsets = size / ((uint64_t)block_size * DC_WAYS);
+    if (!nsets)
+        nsets = 1;
+
+    pthread_mutex_lock(&dc_stores_lock);
+
+    /* opened by another graph of the volume, before a graph switch */
+    store = dc_store_find(path);
+    if (store) {
+        if ((store->block_size == block_size) && (store->nsets == nsets)) {
+            store->refs++;
+            ret = 0;
+        } else {
+            gf_msg(this->name, GF_LOG_WARNING, 0, DC_MSG_STORE_BUSY,
+                   "cache file %s is in use with another size", path);
+            store = NULL;
+        }
+        GF_FREE(path);
+        goto unlock;
+    }
+
+    store = GF_CALLOC(1, sizeof(*store), gf_dc_mt_dc_store_t);
+    if (!store)
+        goto out;
+
+    INIT_LIST_HEAD(&store->list);
+    store->refs = 1;
+    store->path = path;
+    store->fd = -1;
+    store->block_size = block_size;
+    store->nsets = nsets;
+    store->index_offset = DC_HEADER_SIZE;
+    store->data_offset = DC_ALIGN(
+        store->index_offset + store->nsets * DC_WAYS * sizeof(dc_disk_entry_t),
+        4096);
+    pthread_mutex_init(&store->lock, NULL);
+    pthread_mutex_init(&store->write_lock, NULL);
+
+    store->index = GF_CALLOC(store->nsets * DC_WAYS, sizeof(dc_disk_entry_t),
+                             gf_dc_mt_dc_index_t);
+    store->snapshot = GF_CALLOC(store->nsets * DC_WAYS,
+                                sizeof(dc_disk_entry_t), gf_dc_mt_dc_index_t);
+    store->gen = GF_CALLOC(store->nsets * DC_WAYS, sizeof(uint32_t),
+                           gf_dc_mt_dc_index_t);
+    if (!store->index || !store->snapshot || !store->gen)
+        goto out;
+
+    store->fd = sys_open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (store->fd < 0) {
+        gf_msg(this->name, GF_LOG_ERROR, errno, DC_MSG_STORE_OPEN_FAILED,
+               "could not open cache file %s", path);
+        goto out;
+    }
+
+    /* one process at a time, the index is kept in its memory */
+    if (flock(store->fd, LOCK_EX | LOCK_NB) < 0) {
+        gf_msg(this->name, GF_LOG_WARNING, errno, DC_MSG_STORE_BUSY,
+               "cache file %s is in use by another process", path);
+        goto out;
+    }
+
+    /* the index on disk holds until the first block is written, an empty
+     * one once the file is cut back to zeroes */
+    if (dc_store_load(store) < 0) {
+        gf_msg(this->name, GF_LOG_INFO, 0, DC_MSG_STORE_RESET,
+               "starting with an empty cache in %s", path);
+        if ((dc_store_reset(store) < 0) ||
+            (dc_store_header_write(store, _gf_true) < 0)) {
+            gf_msg(this->name, GF_LOG_ERROR, errno, DC_MSG_STORE_OPEN_FAILED,
+                   "could not size cache file %s", path);
+            goto out;
+        }
+    }
+    store->clean = _gf_true;
+
+    for (i = 0; i < store->nsets * DC_WAYS; i++) {
+        if (store->index[i].used > store->clock)
+            store->clock = store->index[i].used;
+    }
+
+    list_add_tail(&store->list, &dc_stores);
+
+    ret = 0;
+out:
+    if (ret < 0) {
+        if (store)
+            dc_store_free(store);
+        else
+            GF_FREE(path);
+        store = NULL;
+    }
+unlock:
+    pthread_mutex_unlock(&dc_stores_lock);
+
+    return store;
+}
+
+/* Writes the index out behind the blocks it describes, and marks the header
+ * clean once both are on disk. Returns 1 if the index was written, 0 if the
+ * file was clean already, -1 on failure. */
+int
+dc_store_checkpoint(dc_store_t *store)
+{
+    size_t len = 0;
+    gf_boolean_t write = _gf_false;
+    int ret = 0;
+
+    len = store->nsets * DC_WAYS * sizeof(dc_disk_entry_t);
+
+    pthread_mutex_lock(&store->write_lock);
+    {
+        pthread_mutex_lock(&store->lock);
+        {
+            write = (store->dirty || !store->clean);
+            if (write) {
+                memcpy(store->snapshot, store->index, len);
+                store->dirty = _gf_false;
+            }
+        }
+        pthread_mutex_unlock(&store->lock);
+
+        if (!write)
+            goto unlock;
+
+        if ((sys_fdatasync(store->fd) < 0) ||
+            (sys_pwrite(store->fd, store->snapshot, len,
+                        store->index_offset) != len) ||
+            (sys_fdatasync(store->fd) < 0) ||
+            (dc_store_header_write(store, _gf_true) < 0)) {
+            gf_msg(THIS->name, GF_LOG_WARNING, errno, DC_MSG_STORE_IO_FAILED,
+                   "could not write the index of %s", store->path);
+            pthread_mutex_lock(&store->lock);
+            {
+                store->dirty = _gf_true;
+            }
+            pthread_mutex_unlock(&store->lock);
+            ret = -1;
+            goto unlock;
+        }
+
+        store->clean = _gf_true;
+        ret = 1;
+    }
+unlock:
+    pthread_mutex_unlock(&store->write_lock);
+
+    return ret;
+}
+
+void
+dc_store_close(dc_store_t *store)
+{
+    if (!store)
+        return;
+
+    pthread_mutex_lock(&dc_stores_lock);
+    {
+        if (--store->refs > 0)
+            store = NULL;
+        else
+            list_del_init(&store->list);
+    }
+    pthread_mutex_unlock(&dc_stores_lock);
+
+    if (!store)
+        return;
+
+    dc_store_checkpoint(store);
+    dc_store_free(store);
+}
+
+static gf_boolean_t
+dc_store_entry_match(dc_disk_entry_t *entry, uuid_t gfid, off_t offset)
+{
+    return (entry->size && (entry->offset == offset) &&
+            !gf_uuid_compare(entry->gfid, gfid));
+}
+
+/* Reads from offset up to the end of its block at most, and returns how much
+ * was read into buf, 0 past the end of a block cut short by the end of the
+ * file, or -1 if the cache has no such block of the file as of stamp. */
+ssize_t
+dc_store_read(dc_store_t *store, uuid_t gfid, off_t offset,
+              struct iatt *stamp, gf_boolean_t check_ctime, char *buf,
+              size_t size)
+{
+    dc_disk_entry_t *entry = NULL;
+    uint64_t set = 0;
+    uint64_t idx = 0;
+    uint32_t gen = 0;
+    off_t inner = 0;
+    ssize_t ret = -1;
+    int i = 0;
+
+    inner = offset % store->block_size;
+    offset -= inner;
+    set = dc_store_set(store, gfid, offset);
+
+    pthread_mutex_lock(&store->lock);
+    {
+        for (i = 0; i < DC_WAYS; i++) {
+            idx = set * DC_WAYS + i;
+            entry = &store->index[idx];
+            if (!dc_store_entry_match(entry, gfid, offset))
+                continue;
+
+            if ((entry->mtime == stamp->ia_mtime) &&
+                (entry->mtime_nsec == stamp->ia_mtime_nsec) &&
+                (!check_ctime || ((entry->ctime == stamp->ia_ctime) &&
+                                  (entry->ctime_nsec == stamp->ia_ctime_nsec)))) {
+                ret = (inner < entry->size) ? min(size, entry->size - inner)
+                                            : 0;
+                entry->used = ++store->clock;
+                gen = store->gen[idx];
+            }
+            break;
+        }
+    }
+    pthread_mutex_unlock(&store->lock);
+
+    if (ret <= 0)
+        return ret;
+
+    if (sys_pread(store->fd, buf, ret,
+                  dc_store_block_offset(store, idx) + inner) != ret)
+        return -1;
+
+    /* replaced or dropped while it was being read */
+    pthread_mutex_lock(&store->lock);
+    {
+        if (store->gen[idx] != gen)
+            ret = -1;
+    }
+    pthread_mutex_unlock(&store->lock);
+
+    return ret;
+}
+
+/* Writers are serialized on write_lock, they only race readers and
+ * invalidations. */
+int
+dc_store_write(dc_store_t *store, uuid_t gfid, off_t offset,
+               struct iatt *stamp, struct iovec *vector, int count)
+{
+    dc_disk_entry_t *entry = NULL;
+    uint64_t set = 0;
+    uint64_t idx = 0;
+    uint64_t victim = 0;
+    uint32_t gen = 0;
+    size_t size = 0;
+    int ret = -1;
+    int i = 0;
+
+    size = iov_length(vector, count);
+    if (!size || (size > store->block_size) || (offset % store->block_size))
+        return -1;
+
+    set = dc_store_set(store, gfid, offset);
+
+    pthread_mutex_lock(&store->write_lock);
+
+    /* the index on disk may describe the block about to be overwritten */
+    if (store->clean) {
+        if (dc_store_header_write(store, _gf_false) < 0) {
+            gf_msg(THIS->name, GF_LOG_WARNING, errno, DC_MSG_STORE_IO_FAILED,
+                   "could not write the header of %s", store->path);
+            goto out;
+        }
+        store->clean = _gf_false;
+    }
+
+    pthread_mutex_lock(&store->lock);
+    {
+        victim = set * DC_WAYS;
+        for (i = 0; i < DC_WAYS; i++) {
+            idx = set * DC_WAYS + i;
+            entry = &store->index[idx];
+            if (dc_store_entry_match(entry, gfid, offset)) {
+                victim = idx;
+                break;
+            }
+
+            if (store->index[victim].size &&
+                (!entry->size || (entry->used < store->index[victim].used)))
+                victim = idx;
+        }
+
+        memset(&store->index[victim], 0, sizeof(dc_disk_entry_t));
+        gen = ++store->gen[victim];
+        store->dirty = _gf_true;
+    }
+    pthread_mutex_unlock(&store->lock);
+
+    if (sys_pwritev(store->fd, vector, count,
+                    dc_store_block_offset(store, victim)) != size) {
+        gf_msg(THIS->name, GF_LOG_WARNING, errno, DC_MSG_STORE_IO_FAILED,
+               "could not write block %" PRIu64 " of %s", victim, store->path);
+        goto out;
+    }
+
+    pthread_mutex_lock(&store->lock);
+    {
+        /* dropped by an invalidation meanwhile */
+        if (store->gen[victim] != gen)
+            goto unlock;
+
+        entry = &store->index[victim];
+        gf_uuid_copy(entry->gfid, gfid);
+        entry->offset = offset;
+        entry->mtime = stamp->ia_mtime;
+        entry->mtime_nsec = stamp->ia_mtime_nsec;
+        entry->ctime = stamp->ia_ctime;
+        entry->ctime_nsec = stamp->ia_ctime_nsec;
+        entry->size = size;
+        entry->used = ++store->clock;
+        ret = 0;
+    }
+unlock:
+    pthread_mutex_unlock(&store->lock);
+out:
+    pthread_mutex_unlock(&store->write_lock);
+
+    return ret;
+}
+
+/* Drops the blocks of a file in [offset, offset + size). The index on disk
+ * keeps them until the next checkpoint, which is harmless: they are still
+ * checked against the times of the file. */
+void
+dc_store_invalidate(dc_store_t *store, uuid_t gfid, off_t offset, size_t size)
+{
+    uint64_t set = 0;
+    uint64_t idx = 0;
+    off_t end = 0;
+    int i = 0;
+
+    end = offset + size;
+    offset -= offset % store->block_size;
+
+    for (; offset < end; offset += store->block_size) {
+        set = dc_store_set(store, gfid, offset);
+
+        pthread_mutex_lock(&store->lock);
+        {
+            for (i = 0; i < DC_WAYS; i++) {
+                idx = set * DC_WAYS + i;
+                if (!dc_store_entry_match(&store->index[idx], gfid, offset))
+                    continue;
+
+                memset(&store->index[idx], 0, sizeof(dc_disk_entry_t));
+                store->gen[idx]++;
+                store->dirty = _gf_true;
+                break;
+            }
+        }
+        pthread_mutex_unlock(&store->lock);
+    }
+}
+
+uint64_t
+dc_store_used(dc_store_t *store)
+{
+    uint64_t used = 0;
+    uint64_t i = 0;
+
+    pthread_mutex_lock(&store->lock);
+    {
+        for (i = 0; i < store->nsets * DC_WAYS; i++) {
+            if (store->index[i].size)
+                used++;
+        }
+    }
+    pthread_mutex_unlock(&store->lock);
+
+    return used;
+}
@@ -0,0 +1,1148 @@
+/*
+ *   Copyright (c) 2026 Red Hat, Inc. <http://www.redhat.com>
+ *   This file is part of GlusterFS.
+ *
+ *   This file is licensed to you under your choice of the GNU Lesser
+ *   General Public License, version 3 or any later version (LGPLv3 or
+ *   later), or the GNU General Public License, version 2 (GPLv2), in all
+ *   cases as published by the Free Software Foundation.
+ */
+
+#include <math.h>
+
+#include "disk-cache.h"
+#include <glusterfs/statedump.h>
+#include <glusterfs/syncop.h>
+#include <glusterfs/upcall-utils.h>
+
+void
+dc_local_wipe(dc_local_t *local)
+{
+    if (!local)
+        return;
+
+    if (local->fd)
+        fd_unref(local->fd);
+
+    if (local->inode)
+        inode_unref(local->inode);
+
+    if (local->xdata)
+        dict_unref(local->xdata);
+
+    GF_FREE(local);
+}
+
+static dc_local_t *
+dc_local_new(call_frame_t *frame, inode_t *inode, off_t offset, size_t size)
+{
+    dc_local_t *local = NULL;
+
+    local = GF_CALLOC(1, sizeof(*local), gf_dc_mt_dc_local_t);
+    if (!local)
+        return NULL;
+
+    if (inode)
+        local->inode = inode_ref(inode);
+    local->offset = offset;
+    local->size = size;
+    frame->local = local;
+
+    return local;
+}
+
+static dc_inode_t *
+dc_inode_ctx_get(xlator_t *this, inode_t *inode, gf_boolean_t create)
+{
+    dc_inode_t *ctx = NULL;
+    uint64_t value = 0;
+
+    LOCK(&inode->lock);
+    {
+        if (__inode_ctx_get(inode, this, &value) == 0) {
+            ctx = (dc_inode_t *)(uintptr_t)value;
+            goto unlock;
+        }
+
+        if (!create)
+            goto unlock;
+
+        ctx = GF_CALLOC(1, sizeof(*ctx), gf_dc_mt_dc_inode_t);
+        if (!ctx)
+            goto unlock;
+
+        LOCK_INIT(&ctx->lock);
+        value = (uint64_t)(uintptr_t)ctx;
+        if (__inode_ctx_set(inode, this, &value) < 0) {
+            LOCK_DESTROY(&ctx->lock);
+            GF_FREE(ctx);
+            ctx = NULL;
+        }
+    }
+unlock:
+    UNLOCK(&inode->lock);
+
+    return ctx;
+}
+
+/* Remembers the attributes of a regular file the bricks returned, the
+ * blocks of the cache are served only if they were read at the same times. */
+static void
+dc_inode_update(xlator_t *this, inode_t *inode, struct iatt *stbuf)
+{
+    dc_inode_t *ctx = NULL;
+
+    if (!inode || !stbuf || (stbuf->ia_type != IA_IFREG) || !stbuf->ia_ctime)
+        return;
+
+    ctx = dc_inode_ctx_get(this, inode, _gf_true);
+    if (!ctx)
+        return;
+
+    LOCK(&ctx->lock);
+    {
+        /* a reply overtaken by the one of a later change */
+        if (ctx->valid &&
+            ((stbuf->ia_ctime < ctx->stbuf.ia_ctime) ||
+             ((stbuf->ia_ctime == ctx->stbuf.ia_ctime) &&
+              (stbuf->ia_ctime_nsec < ctx->stbuf.ia_ctime_nsec))))
+            goto unlock;
+
+        ctx->stbuf = *stbuf;
+        ctx->stamped = gf_time();
+        ctx->valid = _gf_true;
+    }
+unlock:
+    UNLOCK(&ctx->lock);
+}
+
+static void
+dc_inode_forget_stbuf(xlator_t *this, inode_t *inode)
+{
+    dc_inode_t *ctx = NULL;
+
+    ctx = dc_inode_ctx_get(this, inode, _gf_false);
+    if (!ctx)
+        return;
+
+    LOCK(&ctx->lock);
+    {
+        ctx->valid = _gf_false;
+    }
+    UNLOCK(&ctx->lock);
+}
+
+static gf_boolean_t
+dc_inode_stbuf(xlator_t *this, inode_t *inode, struct iatt *stbuf,
+               time_t *stamped)
+{
+    dc_inode_t *ctx = NULL;
+    gf_boolean_t valid = _gf_false;
+
+    ctx = dc_inode_ctx_get(this, inode, _gf_false);
+    if (!ctx)
+        return _gf_false;
+
+    LOCK(&ctx->lock);
+    {
+        valid = ctx->valid;
+        if (valid) {
+            *stbuf = ctx->stbuf;
+            if (stamped)
+                *stamped = ctx->stamped;
+        }
+    }
+    UNLOCK(&ctx->lock);
+
+    return valid;
+}
+
+/* A local change: the attributes it returned replace the old ones, and the
+ * blocks it touched are dropped, they would have the same times if it came
+ * within the granularity of the clock of the brick. */
+static void
+dc_inode_modified(xlator_t *this, inode_t *inode, struct iatt *postbuf,
+                  off_t offset, size_t size)
+{
+    dc_conf_t *conf = this->private;
+
+    if (!inode)
+        return;
+
+    if (postbuf && postbuf->ia_ctime)
+        dc_inode_update(this, inode, postbuf);
+    else
+        dc_inode_forget_stbuf(this, inode);
+
+    if (conf->store && size)
+        dc_store_invalidate(conf->store, inode->gfid, offset, size);
+}
+
+static void
+dc_block_free(dc_block_t *block)
+{
+    if (block->iobref)
+        iobref_unref(block->iobref);
+    GF_FREE(block->vector);
+    GF_FREE(block);
+}
+
+static void *
+dc_writer(void *data)
+{
+    xlator_t *this = data;
+    dc_conf_t *conf = this->private;
+    dc_block_t *block = NULL;
+    struct timespec deadline = {
+        0,
+    };
+    time_t checkpointed = 0;
+    gf_boolean_t stop = _gf_false;
+
+    THIS = this;
+
+    checkpointed = gf_time();
+
+    while (!stop) {
+        pthread_mutex_lock(&conf->lock);
+        {
+            deadline.tv_sec = checkpointed + DC_CHECKPOINT_INTERVAL;
+            while (list_empty(&conf->queue) && !conf->fini) {
+                if (pthread_cond_timedwait(&conf->cond, &conf->lock,
+                                           &deadline) == ETIMEDOUT)
+                    break;
+            }
+
+            block = NULL;
+            if (!list_empty(&conf->queue)) {
+                block = list_first_entry(&conf->queue, dc_block_t, list);
+                list_del_init(&block->list);
+                conf->queued -= block->size;
+            } else {
+                stop = conf->fini;
+            }
+        }
+        pthread_mutex_unlock(&conf->lock);
+
+        if (block) {
+            if (dc_store_write(conf->store, block->gfid, block->offset,
+                               &block->stamp, block->vector,
+                               block->count) == 0)
+                GF_ATOMIC_INC(conf->counter.stores);
+
+            dc_block_free(block);
+        }
+
+        /* fini is not sure to run, a client may just exit */
+        if (!stop && (gf_time() - checkpointed >= DC_CHECKPOINT_INTERVAL)) {
+            if (dc_store_checkpoint(conf->store) > 0)
+                GF_ATOMIC_INC(conf->counter.checkpoints);
+            checkpointed = gf_time();
+        }
+    }
+
+    return NULL;
+}
+
+/* Hands the whole blocks of a read to the writer, and the last one if the
+ * read reached the end of the file. */
+static void
+dc_queue_blocks(xlator_t *this, uuid_t gfid, off_t offset,
+                struct iovec *vector, int count, size_t size,
+                struct iatt *stbuf, struct iobref *iobref)
+{
+    dc_conf_t *conf = this->private;
+    dc_block_t *block = NULL;
+    uint64_t bs = conf->block_size;
+    off_t start = 0;
+    off_t end = 0;
+    size_t len = 0;
+    gf_boolean_t queued = _gf_false;
+
+    end = offset + size;
+    start = offset + (bs - offset % bs) % bs;
+
+    for (; start < end; start += bs) {
+        len = min(bs, end - start);
+        if ((len < bs) && (start + len != stbuf->ia_size))
+            break;
+
+        block = GF_CALLOC(1, sizeof(*block), gf_dc_mt_dc_block_t);
+        if (!block)
+            break;
+
+        block->count = iov_subset(vector, count, start - offset, len,
+                                  &block->vector, 0);
+        if (block->count <= 0) {
+            GF_FREE(block);
+            break;
+        }
+
+        INIT_LIST_HEAD(&block->list);
+        gf_uuid_copy(block->gfid, gfid);
+        block->offset = start;
+        block->stamp = *stbuf;
+        block->size = len;
+        block->iobref = iobref_ref(iobref);
+
+        pthread_mutex_lock(&conf->lock);
+        {
+            if (!conf->fini && (conf->queued + len <= DC_MAX_QUEUED)) {
+                list_add_tail(&block->list, &conf->queue);
+                conf->queued += len;
+                queued = _gf_true;
+                block = NULL;
+            }
+        }
+        pthread_mutex_unlock(&conf->lock);
+
+        if (block) {
+            GF_ATOMIC_INC(conf->counter.store_drops);
+            dc_block_free(block);
+        }
+    }
+
+    if (queued)
+        pthread_cond_signal(&conf->cond);
+}
+
+int32_t
+dc_lookup_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
+              int32_t op_ret, int32_t op_errno, inode_t *inode,
+              struct iatt *buf, dict_t *xdata, struct iatt *postparent)
+{
+    if (op_ret == 0)
+        dc_inode_update(this, inode, buf);
+
+    STACK_UNWIND_STRICT(lookup, frame, op_ret, op_errno, inode, buf, xdata,
+                        postparent);
+    return 0;
+}
+
+int32_t
+dc_lookup(call_frame_t *frame, xlator_t *this, loc_t *loc, dict_t *xdata)
+{
+    STACK_WIND(frame, dc_lookup_cbk, FIRST_CHILD(this),
+               FIRST_CHILD(this)->fops->lookup, loc, xdata);
+    return 0;
+}
+
+int32_t
+dc_stat_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int32_t op_ret,
+            int32_t op_errno, struct iatt *buf, dict_t *xdata)
+{
+    dc_local_t *local = frame->local;
+
+    if (op_ret == 0)
+        dc_inode_update(this, local->inode, buf);
+
+    DC_STACK_UNWIND(stat, frame, op_ret, op_errno, buf, xdata);
+    return 0;
+}
+
+int32_t
+dc_stat(call_frame_t *frame, xlator_t *this, loc_t *loc, dict_t *xdata)
+{
+    if (!dc_local_new(frame, loc->inode, 0, 0)) {
+        STACK_UNWIND_STRICT(stat, frame, -1, ENOMEM, NULL, NULL);
+        return 0;
+    }
+
+    STACK_WIND(frame, dc_stat_cbk, FIRST_CHILD(this),
+               FIRST_CHILD(this)->fops->stat, loc, xdata);
+    return 0;
+}
+
+int32_t
+dc_fstat(call_frame_t *frame, xlator_t *this, fd_t *fd, dict_t *xdata)
+{
+    if (!dc_local_new(frame, fd->inode, 0, 0)) {
+        STACK_UNWIND_STRICT(fstat, frame, -1, ENOMEM, NULL, NULL);
+        return 0;
+    }
+
+    STACK_WIND(frame, dc_stat_cbk, FIRST_CHILD(this),
+               FIRST_CHILD(this)->fops->fstat, fd, xdata);
+    return 0;
+}
+
+int32_t
+dc_readdirp_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
+                int32_t op_ret, int32_t op_errno, gf_dirent_t *entries,
+                dict_t *xdata)
+{
+    gf_dirent_t *entry = NULL;
+
+    if (op_ret > 0) {
+        list_for_each_entry(entry, &entries->list, list)
+        {
+            dc_inode_update(this, entry->inode, &entry->d_stat);
+        }
+    }
+
+    STACK_UNWIND_STRICT(readdirp, frame, op_ret, op_errno, entries, xdata);
+    return 0;
+}
+
+int32_t
+dc_readdirp(call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
+            off_t offset, dict_t *xdata)
+{
+    STACK_WIND(frame, dc_readdirp_cbk, FIRST_CHILD(this),
+               FIRST_CHILD(this)->fops->readdirp, fd, size, offset, xdata);
+    return 0;
+}
+
+/* Serves a read from the cache, if it holds all of it as of stbuf. */
+static int
+dc_readv_cached(call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
+                off_t offset, struct iatt *stbuf)
+{
+    dc_conf_t *conf = this->private;
+    struct iobuf *iobuf = NULL;
+    struct iobref *iobref = NULL;
+    struct iovec vector = {
+        0,
+    };
+    size_t done = 0;
+    size_t want = 0;
+
+    size = (offset < stbuf->ia_size) ? min(size, stbuf->ia_size - offset) : 0;
+
+    if (size) {
+        iobuf = iobuf_get2(this->ctx->iobuf_pool, size);
+        if (!iobuf)
+            return -1;
+
+        while (done < size) {
+            want = min(size - done,
+                       conf->block_size - (offset + done) % conf->block_size);
+            if (dc_store_read(conf->store, fd->inode->gfid, offset + done,
+                              stbuf, conf->ctime_invalidation,
+                              (char *)iobuf->ptr + done, want) != want)
+                goto miss;
+            done += want;
+        }
+
+        iobref = iobref_new();
+        if (!iobref)
+            goto miss;
+        iobref_add(iobref, iobuf);
+
+        vector.iov_base = iobuf->ptr;
+        vector.iov_len = size;
+    }
+
+    GF_ATOMIC_INC(conf->counter.hits);
+
+    DC_STACK_UNWIND(readv, frame, size, 0, &vector, 1, stbuf, iobref, NULL);
+
+    if (iobref)
+        iobref_unref(iobref);
+    if (iobuf)
+        iobuf_unref(iobuf);
+
+    return 0;
+miss:
+    iobuf_unref(iobuf);
+    return -1;
+}
+
+int32_t
+dc_readv_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
+             int32_t op_ret, int32_t op_errno, struct iovec *vector,
+             int32_t count, struct iatt *stbuf, struct iobref *iobref,
+             dict_t *xdata)
+{
+    dc_conf_t *conf = this->private;
+    dc_local_t *local = frame->local;
+
+    if ((op_ret >= 0) && stbuf && (stbuf->ia_type == IA_IFREG) &&
+        stbuf->ia_ctime) {
+        dc_inode_update(this, local->inode, stbuf);
+        if (conf->store && (op_ret > 0))
+            dc_queue_blocks(this, local->inode->gfid, local->offset, vector,
+                            count, op_ret, stbuf, iobref);
+    }
+
+    DC_STACK_UNWIND(readv, frame, op_ret, op_errno, vector, count, stbuf,
+                    iobref, xdata);
+    return 0;
+}
+
+static int
+dc_readv_wind(call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
+              off_t offset, uint32_t flags, dict_t *xdata)
+{
+    dc_conf_t *conf = this->private;
+    dc_local_t *local = frame->local;
+
+    if (!local) {
+        local = dc_local_new(frame, fd->inode, offset, size);
+        if (!local) {
+            STACK_UNWIND_STRICT(readv, frame, -1, ENOMEM, NULL, 0, NULL, NULL,
+                                NULL);
+            return 0;
+        }
+    }
+
+    if (conf->store)
+        GF_ATOMIC_INC(conf->counter.misses);
+
+    STACK_WIND(frame, dc_readv_cbk, FIRST_CHILD(this),
+               FIRST_CHILD(this)->fops->readv, fd, size, offset, flags, xdata);
+    return 0;
+}
+
+static int
+dc_readv_cached_task(void *opaque)
+{
+    call_frame_t *frame = opaque;
+    dc_local_t *local = frame->local;
+    struct iatt stbuf = {
+        0,
+    };
+
+    if (!dc_inode_stbuf(frame->this, local->inode, &stbuf, NULL))
+        return -1;
+
+    return dc_readv_cached(frame, frame->this, local->fd, local->size,
+                           local->offset, &stbuf);
+}
+
+static int
+dc_readv_cached_done(int ret, call_frame_t *sync_frame, void *opaque)
+{
+    call_frame_t *frame = opaque;
+    dc_local_t *local = NULL;
+
+    if (ret == 0)
+        return 0;
+
+    local = frame->local;
+    dc_readv_wind(frame, frame->this, local->fd, local->size, local->offset,
+                  local->flags, local->xdata);
+    return 0;
+}
+
+int32_t
+dc_readv_validate_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
+                      int32_t op_ret, int32_t op_errno, struct iatt *buf,
+                      dict_t *xdata)
+{
+    dc_local_t *local = frame->local;
+
+    /* the cache file is read with blocking preads, not on the thread
+     * which brought the reply */
+    if (op_ret == 0) {
+        dc_inode_update(this, local->inode, buf);
+        if (synctask_new(this->ctx->env, dc_readv_cached_task,
+                         dc_readv_cached_done, NULL, frame) == 0)
+            return 0;
+    }
+
+    dc_readv_wind(frame, this, local->fd, local->size, local->offset,
+                  local->flags, local->xdata);
+    return 0;
+}
+
+int32_t
+dc_readv(call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
+         off_t offset, uint32_t flags, dict_t *xdata)
+{
+    dc_conf_t *conf = this->private;
+    dc_local_t *local = NULL;
+    struct iatt stbuf = {
+        0,
+    };
+    time_t stamped = 0;
+
+    if (!conf->store || !dc_inode_stbuf(this, fd->inode, &stbuf, &stamped))
+        goto wind;
+
+    if (gf_time() - stamped < conf->cache_timeout) {
+        if (dc_readv_cached(frame, this, fd, size, offset, &stbuf) == 0)
+            return 0;
+        goto wind;
+    }
+
+    /* the attributes are too old to trust the cache with, fetch them */
+    local = dc_local_new(frame, fd->inode, offset, size);
+    if (!local)
+        goto wind;
+
+    local->fd = fd_ref(fd);
+    local->flags = flags;
+    if (xdata)
+        local->xdata = dict_ref(xdata);
+
+    STACK_WIND(frame, dc_readv_validate_cbk, FIRST_CHILD(this),
+               FIRST_CHILD(this)->fops->fstat, fd, NULL);
+    return 0;
+
+wind:
+    return dc_readv_wind(frame, this, fd, size, offset, flags, xdata);
+}
+
+int32_t
+dc_writev_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
+              int32_t op_ret, int32_t op_errno, struct iatt *prebuf,
+              struct iatt *postbuf, dict_t *xdata)
+{
+    dc_local_t *local = frame->local;
+
+    dc_inode_modified(this, local->inode, (op_ret >= 0) ? postbuf : NULL,
+                      local->offset, local->size);
+
+    DC_STACK_UNWIND(writev, frame, op_ret, op_errno, prebuf, postbuf, xdata);
+    return 0;
+}
+
+int32_t
+dc_writev(call_frame_t *frame, xlator_t *this, fd_t *fd, struct iovec *vector,
+          int32_t count, off_t offset, uint32_t flags, struct iobref *iobref,
+          dict_t *xdata)
+{
+    if (!dc_local_new(frame, fd->inode, offset, iov_length(vector, count))) {
+        STACK_UNWIND_STRICT(writev, frame, -1, ENOMEM, NULL, NULL, NULL);
+        return 0;
+    }
+
+    STACK_WIND(frame, dc_writev_cbk, FIRST_CHILD(this),
+               FIRST_CHILD(this)->fops->writev, fd, vector, count, offset,
+               flags, iobref, xdata);
+    return 0;
+}
+
+int32_t
+dc_truncate_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
+                int32_t op_ret, int32_t op_errno, struct iatt *prebuf,
+                struct iatt *postbuf, dict_t *xdata)
+{
+    dc_local_t *local = frame->local;
+    size_t size = 0;
+
+    /* the block the file now ends in, and the ones after it */
+    if ((op_ret >= 0) && prebuf && (prebuf->ia_size > local->offset))
+        size = prebuf->ia_size - local->offset;
+
+    dc_inode_modified(this, local->inode, (op_ret >= 0) ? postbuf : NULL,
+                      local->offset, size);
+
+    DC_STACK_UNWIND(truncate, frame, op_ret, op_errno, prebuf, postbuf, xdata);
+    return 0;
+}
+
+int32_t
+dc_truncate(call_frame_t *frame, xlator_t *this, loc_t *loc, off_t offset,
+            dict_t *xdata)
+{
+    if (!dc_local_new(frame, loc->inode, offset, 0)) {
+        STACK_UNWIND_STRICT(truncate, frame, -1, ENOMEM, NULL, NULL, NULL);
+        return 0;
+    }
+
+    STACK_WIND(frame, dc_truncate_cbk, FIRST_CHILD(this),
+               FIRST_CHILD(this)->fops->truncate, loc, offset, xdata);
+    return 0;
+}
+
+int32_t
+dc_ftruncate(call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
+             dict_t *xdata)
+{
+    if (!dc_local_new(frame, fd->inode, offset, 0)) {
+        STACK_UNWIND_STRICT(ftruncate, frame, -1, ENOMEM, NULL, NULL, NULL);
+        return 0;
+    }
+
+    STACK_WIND(frame, dc_truncate_cbk, FIRST_CHILD(this),
+               FIRST_CHILD(this)->fops->ftruncate, fd, offset, xdata);
+    return 0;
+}
+
+int32_t
+dc_range_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int32_t op_ret,
+             int32_t op_errno, struct iatt *pre, struct iatt *post,
+             dict_t *xdata)
+{
+    dc_local_t *local = frame->local;
+
+    dc_inode_modified(this, local->inode, (op_ret >= 0) ? post : NULL,
+                      local->offset, local->size);
+
+    /* fallocate, discard and zerofill have the same callback */
+    DC_STACK_UNWIND(discard, frame, op_ret, op_errno, pre, post, xdata);
+    return 0;
+}
+
+int32_t
+dc_fallocate(call_frame_t *frame, xlator_t *this, fd_t *fd, int32_t keep_size,
+             off_t offset, size_t len, dict_t *xdata)
+{
+    if (!dc_local_new(frame, fd->inode, offset, len)) {
+        STACK_UNWIND_STRICT(fallocate, frame, -1, ENOMEM, NULL, NULL, NULL);
+        return 0;
+    }
+
+    STACK_WIND(frame, dc_range_cbk, FIRST_CHILD(this),
+               FIRST_CHILD(this)->fops->fallocate, fd, keep_size, offset, len,
+               xdata);
+    return 0;
+}
+
+int32_t
+dc_discard(call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
+           size_t len, dict_t *xdata)
+{
+    if (!dc_local_new(frame, fd->inode, offset, len)) {
+        STACK_UNWIND_STRICT(discard, frame, -1, ENOMEM, NULL, NULL, NULL);
+        return 0;
+    }
+
+    STACK_WIND(frame, dc_range_cbk, FIRST_CHILD(this),
+               FIRST_CHILD(this)->fops->discard, fd, offset, len, xdata);
+    return 0;
+}
+
+int32_t
+dc_zerofill(call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
+            off_t len, dict_t *xdata)
+{
+    if (!dc_local_new(frame, fd->inode, offset, len)) {
+        STACK_UNWIND_STRICT(zerofill, frame, -1, ENOMEM, NULL, NULL, NULL);
+        return 0;
+    }
+
+    STACK_WIND(frame, dc_range_cbk, FIRST_CHILD(this),
+               FIRST_CHILD(this)->fops->zerofill, fd, offset, len, xdata);
+    return 0;
+}
+
+int32_t
+dc_copy_file_range_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
+                       int32_t op_ret, int32_t op_errno, struct iatt *stbuf,
+                       struct iatt *prebuf_dst, struct iatt *postbuf_dst,
+                       dict_t *xdata)
+{
+    dc_local_t *local = frame->local;
+
+    dc_inode_modified(this, local->inode, (op_ret >= 0) ? postbuf_dst : NULL,
+                      local->offset, local->size);
+
+    DC_STACK_UNWIND(copy_file_range, frame, op_ret, op_errno, stbuf,
+                    prebuf_dst, postbuf_dst, xdata);
+    return 0;
+}
+
+int32_t
+dc_copy_file_range(call_frame_t *frame, xlator_t *this, fd_t *fd_in,
+                   off64_t off_in, fd_t *fd_out, off64_t off_out, size_t len,
+                   uint32_t flags, dict_t *xdata)
+{
+    if (!dc_local_new(frame, fd_out->inode, off_out, len)) {
+        STACK_UNWIND_STRICT(copy_file_range, frame, -1, ENOMEM, NULL, NULL,
+                            NULL, NULL);
+        return 0;
+    }
+
+    STACK_WIND(frame, dc_copy_file_range_cbk, FIRST_CHILD(this),
+               FIRST_CHILD(this)->fops->copy_file_range, fd_in, off_in, fd_out,
+               off_out, len, flags, xdata);
+    return 0;
+}
+
+int32_t
+dc_setattr_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
+               int32_t op_ret, int32_t op_errno, struct iatt *statpre,
+               struct iatt *statpost, dict_t *xdata)
+{
+    dc_local_t *local = frame->local;
+
+    dc_inode_modified(this, local->inode, (op_ret >= 0) ? statpost : NULL, 0,
+                      0);
+
+    DC_STACK_UNWIND(setattr, frame, op_ret, op_errno, statpre, statpost,
+                    xdata);
+    return 0;
+}
+
+int32_t
+dc_setattr(call_frame_t *frame, xlator_t *this, loc_t *loc, struct iatt *stbuf,
+           int32_t valid, dict_t *xdata)
+{
+    if (!dc_local_new(frame, loc->inode, 0, 0)) {
+        STACK_UNWIND_STRICT(setattr, frame, -1, ENOMEM, NULL, NULL, NULL);
+        return 0;
+    }
+
+    STACK_WIND(frame, dc_setattr_cbk, FIRST_CHILD(this),
+               FIRST_CHILD(this)->fops->setattr, loc, stbuf, valid, xdata);
+    return 0;
+}
+
+int32_t
+dc_fsetattr(call_frame_t *frame, xlator_t *this, fd_t *fd, struct iatt *stbuf,
+            int32_t valid, dict_t *xdata)
+{
+    if (!dc_local_new(frame, fd->inode, 0, 0)) {
+        STACK_UNWIND_STRICT(fsetattr, frame, -1, ENOMEM, NULL, NULL, NULL);
+        return 0;
+    }
+
+    STACK_WIND(frame, dc_setattr_cbk, FIRST_CHILD(this),
+               FIRST_CHILD(this)->fops->fsetattr, fd, stbuf, valid, xdata);
+    return 0;
+}
+
+/* A change through another client: the blocks are left in the cache, they
+ * stop matching the times of the file as soon as new attributes come. */
+static int
+dc_invalidate(xlator_t *this, void *data)
+{
+    struct gf_upcall *up_data = NULL;
+    struct gf_upcall_cache_invalidation *up_ci = NULL;
+    dc_conf_t *conf = this->private;
+    inode_t *inode = NULL;
+
+    up_data = (struct gf_upcall *)data;
+    if (!conf || (up_data->event_type != GF_UPCALL_CACHE_INVALIDATION))
+        return 0;
+
+    up_ci = (struct gf_upcall_cache_invalidation *)up_data->data;
+    if (!(up_ci->flags & UP_WRITE_FLAGS))
+        return 0;
+
+    inode = inode_find(((xlator_t *)this->graph->top)->itable, up_data->gfid);
+    if (!inode)
+        return 0;
+
+    dc_inode_forget_stbuf(this, inode);
+    GF_ATOMIC_INC(conf->counter.invalidations);
+
+    inode_unref(inode);
+    return 0;
+}
+
+int32_t
+dc_notify(xlator_t *this, int event, void *data, ...)
+{
+    int ret = 0;
+
+    if (event == GF_EVENT_UPCALL)
+        ret = dc_invalidate(this, data);
+
+    if (default_notify(this, event, data) != 0)
+        ret = -1;
+
+    return ret;
+}
+
+static int32_t
+dc_forget(xlator_t *this, inode_t *inode)
+{
+    dc_inode_t *ctx = NULL;
+    uint64_t value = 0;
+
+    inode_ctx_del(inode, this, &value);
+    ctx = (dc_inode_t *)(uintptr_t)value;
+    if (ctx) {
+        LOCK_DESTROY(&ctx->lock);
+        GF_FREE(ctx);
+    }
+
+    return 0;
+}
+
+static int32_t
+dc_priv_dump(xlator_t *this)
+{
+    dc_conf_t *conf = NULL;
+    char key_prefix[GF_DUMP_MAX_BUF_LEN];
+
+    conf = this->private;
+
+    snprintf(key_prefix, GF_DUMP_MAX_BUF_LEN, "%s.%s", this->type, this->name);
+    gf_proc_dump_add_section("%s", key_prefix);
+
+    gf_proc_dump_write("cache_file", "%s",
+                       conf->store ? conf->store->path : "(none)");
+    gf_proc_dump_write("cache_size", "%" PRIu64, conf->cache_size);
+    gf_proc_dump_write("block_size", "%" PRIu64, conf->block_size);
+    gf_proc_dump_write("blocks_cached", "%" PRIu64,
+                       conf->store ? dc_store_used(conf->store) : 0);
+    gf_proc_dump_write("hits", "%" PRId64, GF_ATOMIC_GET(conf->counter.hits));
+    gf_proc_dump_write("misses", "%" PRId64,
+                       GF_ATOMIC_GET(conf->counter.misses));
+    gf_proc_dump_write("stores", "%" PRId64,
+                       GF_ATOMIC_GET(conf->counter.stores));
+    gf_proc_dump_write("store_drops", "%" PRId64,
+                       GF_ATOMIC_GET(conf->counter.store_drops));
+    gf_proc_dump_write("invalidations", "%" PRId64,
+                       GF_ATOMIC_GET(conf->counter.invalidations));
+    gf_proc_dump_write("checkpoints", "%" PRId64,
+                       GF_ATOMIC_GET(conf->counter.checkpoints));
+
+    return 0;
+}
+
+static int32_t
+dc_dump_metrics(xlator_t *this, int fd)
+{
+    dc_conf_t *conf = NULL;
+
+    conf = this->private;
+
+    dprintf(fd, "%s.hits %" PRId64 "\n", this->name,
+            GF_ATOMIC_GET(conf->counter.hits));
+    dprintf(fd, "%s.misses %" PRId64 "\n", this->name,
+            GF_ATOMIC_GET(conf->counter.misses));
+    dprintf(fd, "%s.stores %" PRId64 "\n", this->name,
+            GF_ATOMIC_GET(conf->counter.stores));
+    dprintf(fd, "%s.store_drops %" PRId64 "\n", this->name,
+            GF_ATOMIC_GET(conf->counter.store_drops));
+    dprintf(fd, "%s.invalidations %" PRId64 "\n", this->name,
+            GF_ATOMIC_GET(conf->counter.invalidations));
+    dprintf(fd, "%s.checkpoints %" PRId64 "\n", this->name,
+            GF_ATOMIC_GET(conf->counter.checkpoints));
+
+    return 0;
+}
+
+void
+dc_fini(xlator_t *this)
+{
+    dc_conf_t *conf = NULL;
+    dc_block_t *block = NULL;
+    dc_block_t *tmp = NULL;
+
+    conf = this->private;
+    if (!conf)
+        return;
+
+    this->private = NULL;
+
+    /* the writer drains the queue before it exits */
+    if (conf->writer_running) {
+        pthread_mutex_lock(&conf->lock);
+        {
+            conf->fini = _gf_true;
+            pthread_cond_broadcast(&conf->cond);
+        }
+        pthread_mutex_unlock(&conf->lock);
+        pthread_join(conf->writer, NULL);
+    }
+
+    list_for_each_entry_safe(block, tmp, &conf->queue, list)
+    {
+        list_del_init(&block->list);
+        dc_block_free(block);
+    }
+
+    dc_store_close(conf->store);
+
+    pthread_cond_destroy(&conf->cond);
+    pthread_mutex_destroy(&conf->lock);
+    GF_FREE(conf);
+}
+
+int32_t
+dc_mem_acct_init(xlator_t *this)
+{
+    int ret = -1;
+
+    ret = xlator_mem_acct_init(this, gf_dc_mt_end);
+    return ret;
+}
+
+int32_t
+dc_reconfigure(xlator_t *this, dict_t *options)
+{
+    dc_conf_t *conf = NULL;
+
+    conf = this->private;
+
+    GF_OPTION_RECONF("cache-timeout", conf->cache_timeout, options, time, out);
+    GF_OPTION_RECONF("ctime-invalidation", conf->ctime_invalidation, options,
+                     bool, out);
+    GF_OPTION_RECONF("pass-through", this->pass_through, options, bool, out);
+
+out:
+    return 0;
+}
+
+int32_t
+dc_init(xlator_t *this)
+{
+    dc_conf_t *conf = NULL;
+    int ret = -1;
+
+    if (!this->children || this->children->next) {
+        gf_msg(this->name, GF_LOG_ERROR, 0, DC_MSG_XLATOR_CHILD_MISCONFIGURED,
+               "FATAL: disk-cache not configured with exactly one child");
+        return -1;
+    }
+
+    conf = GF_CALLOC(1, sizeof(*conf), gf_dc_mt_dc_conf_t);
+    if (!conf)
+        goto out;
+
+    pthread_mutex_init(&conf->lock, NULL);
+    pthread_cond_init(&conf->cond, NULL);
+    INIT_LIST_HEAD(&conf->queue);
+
+    GF_ATOMIC_INIT(conf->counter.hits, 0);
+    GF_ATOMIC_INIT(conf->counter.misses, 0);
+    GF_ATOMIC_INIT(conf->counter.stores, 0);
+    GF_ATOMIC_INIT(conf->counter.store_drops, 0);
+    GF_ATOMIC_INIT(conf->counter.invalidations, 0);
+    GF_ATOMIC_INIT(conf->counter.checkpoints, 0);
+
+    this->private = conf;
+
+    GF_OPTION_INIT("cache-dir", conf->cache_dir, path, out);
+    GF_OPTION_INIT("cache-size", conf->cache_size, size_uint64, out);
+    GF_OPTION_INIT("block-size", conf->block_size, size_uint64, out);
+    GF_OPTION_INIT("cache-timeout", conf->cache_timeout, time, out);
+    GF_OPTION_INIT("ctime-invalidation", conf->ctime_invalidation, bool, out);
+    GF_OPTION_INIT("pass-through", this->pass_through, bool, out);
+
+    /* without its cache file the xlator only passes the fops on */
+    conf->store = dc_store_open(this, conf->cache_dir, conf->cache_size,
+                                conf->block_size);
+    if (!conf->store) {
+        ret = 0;
+        goto out;
+    }
+
+    if (gf_thread_create(&conf->writer, NULL, dc_writer, this, "dcwriter")) {
+        gf_msg(this->name, GF_LOG_WARNING, errno, DC_MSG_THREAD_CREATE_FAILED,
+               "could not start the cache writer, not caching");
+        dc_store_close(conf->store);
+        conf->store = NULL;
+    } else {
+        conf->writer_running = _gf_true;
+    }
+
+    ret = 0;
+out:
+    if (ret < 0)
+        dc_fini(this);
+
+    return ret;
+}
+
+struct xlator_fops dc_fops = {
+    .lookup = dc_lookup,
+    .stat = dc_stat,
+    .fstat = dc_fstat,
+    .readdirp = dc_readdirp,
+    .readv = dc_readv,
+    .writev = dc_writev,
+    .truncate = dc_truncate,
+    .ftruncate = dc_ftruncate,
+    .fallocate = dc_fallocate,
+    .discard = dc_discard,
+    .zerofill = dc_zerofill,
+    .copy_file_range = dc_copy_file_range,
+    .setattr = dc_setattr,
+    .fsetattr = dc_fsetattr,
+};
+
+struct xlator_cbks dc_cbks = {
+    .forget = dc_forget,
+};
+
+struct xlator_dumpops dc_dumpops = {
+    .priv = dc_priv_dump,
+};
+
+struct volume_options dc_options[] = {
+    {
+        .key = {"disk-cache"},
+        .type = GF_OPTION_TYPE_BOOL,
+        .default_value = "off",
+        .description = "enable/disable disk-cache",
+        .op_version = {GD_OP_VERSION_11_0},
+        .flags = OPT_FLAG_SETTABLE,
+    },
+    {
+        .key = {"cache-dir"},
+        .type = GF_OPTION_TYPE_PATH,
+        .default_value = "/var/cache/glusterfs",
+        .op_version = {GD_OP_VERSION_11_0},
+        .flags = OPT_FLAG_SETTABLE | OPT_FLAG_CLIENT_OPT | OPT_FLAG_DOC,
+        .description = "Directory on a local disk, best an NVMe one, to keep "
+                       "the cache file in. Read when the client starts.",
+    },
+    {
+        .key = {"cache-size"},
+        .type = GF_OPTION_TYPE_SIZET,
+        .min = 16 * GF_UNIT_MB,
+        .max = INFINITY,
+        .default_value = "1GB",
+        .op_version = {GD_OP_VERSION_11_0},
+        .flags = OPT_FLAG_SETTABLE | OPT_FLAG_CLIENT_OPT | OPT_FLAG_DOC,
+        .description = "Size of the data in the cache file. Read when the "
+                       "client starts, a new size empties the cache.",
+    },
+    {
+        .key = {"block-size"},
+        .type = GF_OPTION_TYPE_SIZET,
+        .min = 4 * GF_UNIT_KB,
+        .max = 1 * GF_UNIT_MB,
+        .default_value = "128KB",
+        .op_version = {GD_OP_VERSION_11_0},
+        .flags = OPT_FLAG_SETTABLE | OPT_FLAG_CLIENT_OPT | OPT_FLAG_DOC,
+        .description = "Size of the blocks files are cached in. Read when the "
+                       "client starts, a new size empties the cache.",
+    },
+    {
+        .key = {"cache-timeout"},
+        .type = GF_OPTION_TYPE_INT,
+        .min = 0,
+        .max = 600,
+        .default_value = "1",
+        .op_version = {GD_OP_VERSION_11_0},
+        .flags = OPT_FLAG_SETTABLE | OPT_FLAG_CLIENT_OPT | OPT_FLAG_DOC,
+        .description = "Seconds the attributes of a file are trusted to tell "
+                       "whether its cached blocks are current, after which "
+                       "they are fetched again. With "
+                       "features.cache-invalidation it can be raised.",
+    },
+    {
+        .key = {"ctime-invalidation"},
+        .type = GF_OPTION_TYPE_BOOL,
+        .default_value = "false",
+        .op_version = {GD_OP_VERSION_11_0},
+        .flags = OPT_FLAG_SETTABLE | OPT_FLAG_CLIENT_OPT | OPT_FLAG_DOC,
+        .description = "Check the ctime of a file as well as its mtime "
+                       "before serving its cached blocks, so that data "
+                       "written with the mtime set back is not served.",
+    },
+    {.key = {"pass-through"},
+     .type = GF_OPTION_TYPE_BOOL,
+     .default_value = "false",
+     .op_version = {GD_OP_VERSION_11_0},
+     .flags = OPT_FLAG_SETTABLE | OPT_FLAG_DOC | OPT_FLAG_CLIENT_OPT,
+     .tags = {"disk-cache"},
+     .description = "Enable/Disable disk cache translator"},
+
+    {.key = {NULL}},
+};
+
+xlator_api_t xlator_api = {
+    .init = dc_init,
+    .fini = dc_fini,
+    .notify = dc_notify,
+    .reconfigure = dc_reconfigure,
+    .mem_acct_init = dc_mem_acct_init,
+    .dump_metrics = dc_dump_metrics,
+    .op_version = {1}, /* Present from the initial version */
+    .dumpops = &dc_dumpops,
+    .fops = &dc_fops,
+    .cbks = &dc_cbks,
+    .options = dc_options,
+    .identifier = "disk-cache",
+    .category = GF_TECH_PREVIEW,
+};
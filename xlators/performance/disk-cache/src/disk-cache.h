@@ -0,0 +1,186 @@
+/*
+ *   Copyright (c) 2026 Red Hat, Inc. <http://www.redhat.com>
+ *   This file is part of GlusterFS.
+ *
+ *   This file is licensed to you under your choice of the GNU Lesser
+ *   General Public License, version 3 or any later version (LGPLv3 or
+ *   later), or the GNU General Public License, version 2 (GPLv2), in all
+ *   cases as published by the Free Software Foundation.
+ */
+
+#ifndef __DISK_CACHE_H__
+#define __DISK_CACHE_H__
+
+#include "disk-cache-mem-types.h"
+#include "disk-cache-messages.h"
+#include <glusterfs/defaults.h>
+#include <glusterfs/atomic.h>
+
+/* disk-cache keeps the blocks of the files read through it in a cache file
+ * on a local disk, which outlives the process so that a remount, or an
+ * application restart, finds the data it read before there.
+ *
+ * The cache file holds a header, then an index of DC_WAYS entries per set,
+ * then the blocks, block i of the file being described by entry i. A block
+ * of a file goes in the set picked by a hash of its gfid and offset, in the
+ * least recently used way of the set. Each entry records the mtime and ctime
+ * of the file the block was read at, and a block is only served to a reader
+ * which knows the file with the same times, from the attributes the bricks
+ * returned to the lookups, stats and reads which went through. Attributes
+ * older than cache-timeout are checked again with an fstat before a read is
+ * served from the cache, and are dropped on upcall.
+ *
+ * The index lives in memory. The writer checkpoints it every
+ * DC_CHECKPOINT_INTERVAL seconds, as a client is not sure to run fini on
+ * exit, and the header is marked unclean again before the next block is
+ * written. A cache file is opened once per process and shared by the
+ * graphs of the volume, so that a graph switch finds it open. */
+
+#define DC_WAYS 8
+#define DC_MAX_QUEUED (64 * GF_UNIT_MB) /* blocks waiting to be written */
+#define DC_CHECKPOINT_INTERVAL 5        /* seconds */
+
+#define DC_STACK_UNWIND(fop, frame, params...)                                 \
+    do {                                                                       \
+        dc_local_t *__local = NULL;                                            \
+        if (frame) {                                                           \
+            __local = frame->local;                                            \
+            frame->local = NULL;                                               \
+        }                                                                      \
+        STACK_UNWIND_STRICT(fop, frame, params);                               \
+        dc_local_wipe(__local);                                                \
+    } while (0)
+
+/* on disk, in host byte order as the cache never leaves the host */
+typedef struct dc_disk_header {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t block_size;
+    uint64_t nsets;
+    uint32_t ways;
+    uint32_t clean; /* the index describes the blocks */
+    uint64_t index_offset;
+    uint64_t data_offset;
+} dc_disk_header_t;
+
+typedef struct dc_disk_entry {
+    unsigned char gfid[16];
+    uint64_t offset;
+    int64_t mtime;
+    int64_t ctime;
+    uint32_t mtime_nsec;
+    uint32_t ctime_nsec;
+    uint32_t size; /* 0 when the entry is free */
+    uint32_t pad;
+    uint64_t used;
+} dc_disk_entry_t;
+
+typedef struct dc_store {
+    struct list_head list; /* in the stores of the process */
+    int refs;              /* graphs using it */
+    char *path;
+    int fd;
+    uint32_t block_size;
+    uint64_t nsets;
+    uint64_t index_offset;
+    uint64_t data_offset;
+    dc_disk_entry_t *index; /* copy of the index on disk */
+    uint32_t *gen;          /* bumped when an entry is replaced or dropped */
+    uint64_t clock;
+    gf_boolean_t dirty; /* the index changed since it was written */
+    pthread_mutex_t lock;
+
+    /* serializes block writes and checkpoints, the writers of several
+     * graphs may share the store */
+    pthread_mutex_t write_lock;
+    gf_boolean_t clean;        /* the header on disk says clean */
+    dc_disk_entry_t *snapshot; /* the index as it is written out */
+} dc_store_t;
+
+/* a block read from the bricks, waiting to be written to the cache */
+typedef struct dc_block {
+    struct list_head list;
+    uuid_t gfid;
+    off_t offset;
+    struct iatt stamp;
+    struct iovec *vector;
+    int count;
+    size_t size;
+    struct iobref *iobref;
+} dc_block_t;
+
+typedef struct dc_inode {
+    gf_lock_t lock;
+    struct iatt stbuf;
+    time_t stamped;     /* when stbuf was seen */
+    gf_boolean_t valid; /* stbuf holds the last attributes seen */
+} dc_inode_t;
+
+typedef struct dc_local {
+    fd_t *fd;
+    inode_t *inode;
+    off_t offset;
+    size_t size;
+    uint32_t flags;
+    dict_t *xdata;
+} dc_local_t;
+
+struct dc_statistics {
+    gf_atomic_t hits;
+    gf_atomic_t misses;
+    gf_atomic_t stores;
+    gf_atomic_t store_drops; /* blocks not written as the queue was full */
+    gf_atomic_t invalidations;
+    gf_atomic_t checkpoints;
+};
+
+typedef struct dc_conf {
+    char *cache_dir;
+    uint64_t cache_size;
+    uint64_t block_size;
+    time_t cache_timeout;
+    gf_boolean_t ctime_invalidation;
+    dc_store_t *store;
+
+    pthread_t writer;
+    gf_boolean_t writer_running;
+    gf_boolean_t fini;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    struct list_head queue;
+    uint64_t queued;
+
+    struct dc_statistics counter;
+} dc_conf_t;
+
+dc_store_t *
+dc_store_open(xlator_t *this, const char *dir, uint64_t size,
+              uint32_t block_size);
+
+void
+dc_store_close(dc_store_t *store);
+
+int
+dc_store_checkpoint(dc_store_t *store);
+
+/* reads from offset up to the end of its block at most */
+ssize_t
+dc_store_read(dc_store_t *store, uuid_t gfid, off_t offset,
+              struct iatt *stamp, gf_boolean_t check_ctime, char *buf,
+              size_t size);
+
+int
+dc_store_write(dc_store_t *store, uuid_t gfid, off_t offset,
+               struct iatt *stamp, struct iovec *vector, int count);
+
+void
+dc_store_invalidate(dc_store_t *store, uuid_t gfid, off_t offset,
+                    size_t size);
+
+uint64_t
+dc_store_used(dc_store_t *store);
+
+void
+dc_local_wipe(dc_local_t *local);
+
+#endif /* __DISK_CACHE_H__ */
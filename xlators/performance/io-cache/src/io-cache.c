@@ -192,6 +192,43 @@ ioc_inode_flush(ioc_inode_t *ioc_inode)
     return;
 }
 
+/*
+ * ioc_shared_forget - forget the mtime the cache of the inode was validated
+ * against, for the shared cache, whose pages are tagged with it, not to be
+ * consulted for the inode until the next reply from the server.
+ */
+static void
+ioc_shared_forget(ioc_inode_t *ioc_inode)
+{
+    if (!ioc_inode->table->shm_cache)
+        return;
+
+    ioc_inode_lock(ioc_inode);
+    {
+        ioc_inode->cache.mtime = 0;
+        ioc_inode->cache.mtime_nsec = 0;
+    }
+    ioc_inode_unlock(ioc_inode);
+}
+
+/*
+ * ioc_shared_invalidate - drop the pages of a file modified by this client
+ * from the shared cache, size 0 meaning all of them.
+ */
+static void
+ioc_shared_invalidate(ioc_inode_t *ioc_inode, off_t offset, size_t size)
+{
+    ioc_table_t *table = NULL;
+
+    table = ioc_inode->table;
+    if (!table->shm_cache)
+        return;
+
+    ioc_shared_forget(ioc_inode);
+    gf_shm_cache_invalidate(table->shm_cache, ioc_inode->inode->gfid, offset,
+                            size);
+}
+
 int32_t
 ioc_setattr_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
                 int32_t op_ret, int32_t op_errno, struct iatt *preop,
@@ -213,6 +250,9 @@ ioc_setattr(call_frame_t *frame, xlator_t *this, loc_t *loc, struct iatt *stbuf,
         ((valid & GF_SET_ATTR_ATIME) || (valid & GF_SET_ATTR_MTIME)))
         ioc_inode_flush((ioc_inode_t *)(long)ioc_inode);
 
+    if (ioc_inode && (valid & GF_SET_ATTR_MTIME))
+        ioc_shared_invalidate((ioc_inode_t *)(long)ioc_inode, 0, 0);
+
     STACK_WIND(frame, ioc_setattr_cbk, FIRST_CHILD(this),
                FIRST_CHILD(this)->fops->setattr, loc, stbuf, valid, xdata);
 
@@ -378,8 +418,10 @@ ioc_invalidate(xlator_t *this, inode_t *inode)
 
     inode_ctx_get(inode, this, &ioc_inode);
 
-    if (ioc_inode)
+    if (ioc_inode) {
         ioc_inode_flush((ioc_inode_t *)(uintptr_t)ioc_inode);
+        ioc_shared_forget((ioc_inode_t *)(uintptr_t)ioc_inode);
+    }
 
     return 0;
 }
@@ -987,6 +1029,8 @@ ioc_dispatch_requests(call_frame_t *frame, ioc_inode_t *ioc_inode, fd_t *fd,
         {
             /* look for requested region in the cache */
             trav = __ioc_page_get(ioc_inode, trav_offset);
+            if (trav)
+                __ioc_page_access(trav);
 
             local_offset = max(trav_offset, offset);
             trav_size = min(((offset + size) - local_offset), table->page_size);
@@ -1233,6 +1277,10 @@ ioc_writev_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
                          local->op_ret, op_ret, local->offset);
     }
 
+    if ((op_ret > 0) && ioc_inode)
+        ioc_shared_invalidate((ioc_inode_t *)(long)ioc_inode, local->offset,
+                              op_ret);
+
     STACK_UNWIND_STRICT(writev, frame, op_ret, op_errno, prebuf, postbuf,
                         xdata);
     if (local->iobref) {
@@ -1349,8 +1397,10 @@ ioc_truncate(call_frame_t *frame, xlator_t *this, loc_t *loc, off_t offset,
 
     inode_ctx_get(loc->inode, this, &ioc_inode);
 
-    if (ioc_inode)
+    if (ioc_inode) {
         ioc_inode_flush((ioc_inode_t *)(long)ioc_inode);
+        ioc_shared_invalidate((ioc_inode_t *)(long)ioc_inode, 0, 0);
+    }
 
     STACK_WIND(frame, ioc_truncate_cbk, FIRST_CHILD(this),
                FIRST_CHILD(this)->fops->truncate, loc, offset, xdata);
@@ -1374,8 +1424,10 @@ ioc_ftruncate(call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
 
     inode_ctx_get(fd->inode, this, &ioc_inode);
 
-    if (ioc_inode)
+    if (ioc_inode) {
         ioc_inode_flush((ioc_inode_t *)(long)ioc_inode);
+        ioc_shared_invalidate((ioc_inode_t *)(long)ioc_inode, 0, 0);
+    }
 
     STACK_WIND(frame, ioc_ftruncate_cbk, FIRST_CHILD(this),
                FIRST_CHILD(this)->fops->ftruncate, fd, offset, xdata);
@@ -1475,8 +1527,10 @@ ioc_discard(call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
 
     inode_ctx_get(fd->inode, this, &ioc_inode);
 
-    if (ioc_inode)
+    if (ioc_inode) {
         ioc_inode_flush((ioc_inode_t *)(long)ioc_inode);
+        ioc_shared_invalidate((ioc_inode_t *)(long)ioc_inode, offset, len);
+    }
 
     STACK_WIND(frame, ioc_discard_cbk, FIRST_CHILD(this),
                FIRST_CHILD(this)->fops->discard, fd, offset, len, xdata);
@@ -1500,8 +1554,10 @@ ioc_zerofill(call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
 
     inode_ctx_get(fd->inode, this, &ioc_inode);
 
-    if (ioc_inode)
+    if (ioc_inode) {
         ioc_inode_flush((ioc_inode_t *)(long)ioc_inode);
+        ioc_shared_invalidate((ioc_inode_t *)(long)ioc_inode, offset, len);
+    }
 
     STACK_WIND(frame, ioc_zerofill_cbk, FIRST_CHILD(this),
                FIRST_CHILD(this)->fops->zerofill, fd, offset, len, xdata);
@@ -1657,6 +1713,24 @@ out:
     return ret;
 }
 
+/*
+ * ioc_shared_open - map the cache shared with the other clients of the volume
+ * on this host, once it is given a size. It is not unmapped before fini as
+ * page faults in flight may be reading from it.
+ */
+static void
+ioc_shared_open(xlator_t *this, ioc_table_t *table)
+{
+    if (!table->shm_cache_size || table->shm_cache)
+        return;
+
+    table->shm_cache = gf_shm_cache_open(this->name, table->shm_cache_size,
+                                         table->page_size);
+    if (!table->shm_cache)
+        gf_smsg(this->name, GF_LOG_WARNING, 0, IO_CACHE_MSG_SHARED_CACHE_FAILED,
+                "size=%" PRIu64, table->shm_cache_size, NULL);
+}
+
 int
 reconfigure(xlator_t *this, dict_t *options)
 {
@@ -1664,6 +1738,7 @@ reconfigure(xlator_t *this, dict_t *options)
     ioc_table_t *table = NULL;
     int ret = -1;
     uint64_t cache_size_new = 0;
+    char *policy = NULL;
     if (!this || !this->private)
         goto out;
 
@@ -1716,6 +1791,13 @@ reconfigure(xlator_t *this, dict_t *options)
         }
         table->cache_size = cache_size_new;
 
+        GF_OPTION_RECONF("cache-policy", policy, options, str, unlock);
+        ioc_policy_set(table, ioc_policy_type(policy));
+
+        GF_OPTION_RECONF("shared-cache-size", table->shm_cache_size, options,
+                         size_uint64, unlock);
+        ioc_shared_open(this, table);
+
         ret = 0;
     }
 unlock:
@@ -1739,6 +1821,7 @@ init(xlator_t *this)
     glusterfs_ctx_t *ctx = NULL;
     data_t *data = 0;
     uint32_t num_pages = 0;
+    char *policy = NULL;
 
     xl_options = this->options;
 
@@ -1772,6 +1855,11 @@ init(xlator_t *this)
 
     GF_OPTION_INIT("max-file-size", table->max_file_size, size_uint64, out);
 
+    GF_OPTION_INIT("cache-policy", policy, str, out);
+
+    GF_OPTION_INIT("shared-cache-size", table->shm_cache_size, size_uint64,
+                   out);
+
     if (!check_cache_size_ok(this, table->cache_size)) {
         ret = -1;
         goto out;
@@ -1820,6 +1908,12 @@ init(xlator_t *this)
         goto out;
     }
 
+    if (ioc_policy_init(table)) {
+        gf_smsg(this->name, GF_LOG_ERROR, ENOMEM, IO_CACHE_MSG_NO_MEMORY, NULL);
+        goto out;
+    }
+    ioc_policy_set(table, ioc_policy_type(policy));
+
     pthread_mutex_init(&table->table_lock, NULL);
     this->private = table;
 
@@ -1833,6 +1927,8 @@ init(xlator_t *this)
         goto out;
     }
 
+    ioc_shared_open(this, table);
+
     ret = 0;
 
     ctx = this->ctx;
@@ -1841,6 +1937,7 @@ init(xlator_t *this)
 out:
     if (ret == -1) {
         if (table != NULL) {
+            ioc_policy_fini(table);
             GF_FREE(table->inode_lru);
             GF_FREE(table);
         }
@@ -2060,6 +2157,9 @@ ioc_priv_dump(xlator_t *this)
         gf_proc_dump_write("cache_timeout", "%ld", priv->cache_timeout);
         gf_proc_dump_write("min-file-size", "%" PRIu64, priv->min_file_size);
         gf_proc_dump_write("max-file-size", "%" PRIu64, priv->max_file_size);
+        ioc_policy_dump(priv);
+        if (priv->shm_cache)
+            gf_shm_cache_dump(priv->shm_cache, "shared-cache");
     }
     pthread_mutex_unlock(&priv->table_lock);
 out:
@@ -2122,6 +2222,8 @@ fini(xlator_t *this)
 
     GF_ASSERT (list_empty (&table->inodes));
     */
+    ioc_policy_fini(table);
+    gf_shm_cache_close(table->shm_cache);
     pthread_mutex_destroy(&table->table_lock);
     GF_FREE(table);
 
@@ -2207,6 +2309,28 @@ struct volume_options options[] = {
                     "io-cache translator.",
      .op_version = {1},
      .flags = OPT_FLAG_CLIENT_OPT | OPT_FLAG_SETTABLE | OPT_FLAG_DOC},
+    {.key = {"cache-policy"},
+     .type = GF_OPTION_TYPE_STR,
+     .value = {"lru", "2q", "arc"},
+     .default_value = "lru",
+     .description = "Replacement policy of the cache. lru evicts the least "
+                    "recently used pages of the least recently used files "
+                    "first. 2q and arc keep the pages read more than once "
+                    "apart from those read only once, so that reading "
+                    "through many files once does not evict the hot ones.",
+     .op_version = {GD_OP_VERSION_11_0},
+     .flags = OPT_FLAG_CLIENT_OPT | OPT_FLAG_SETTABLE | OPT_FLAG_DOC},
+    {.key = {"shared-cache-size"},
+     .type = GF_OPTION_TYPE_SIZET,
+     .min = 0,
+     .max = 32 * GF_UNIT_GB,
+     .default_value = "0",
+     .description = "Size of a second cache tier in shared memory, holding "
+                    "the pages read by all the clients of the volume on this "
+                    "host, so that FUSE mounts and gfapi applications do not "
+                    "each read the same data from the bricks. 0 disables it.",
+     .op_version = {GD_OP_VERSION_11_0},
+     .flags = OPT_FLAG_CLIENT_OPT | OPT_FLAG_SETTABLE | OPT_FLAG_DOC},
     {.key = {"pass-through"},
      .type = GF_OPTION_TYPE_BOOL,
      .default_value = "false",
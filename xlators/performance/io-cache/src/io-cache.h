@@ -17,6 +17,7 @@
 #include <glusterfs/dict.h>
 #include <glusterfs/call-stub.h>
 #include <glusterfs/rbthash.h>
+#include <glusterfs/shm-cache.h>
 #include <sys/time.h>
 #include <fnmatch.h>
 #include "io-cache-messages.h"
@@ -24,12 +25,72 @@
 #define IOC_PAGE_SIZE (1024 * 128) /* 128KB */
 #define IOC_CACHE_SIZE (32 * 1024 * 1024)
 #define IOC_PAGE_TABLE_BUCKET_COUNT 1
+#define IOC_GHOST_BUCKET_COUNT 4096
+/* hits on a page this soon after it was read in or promoted come from the
+ * same scan (small reads within the page), arc does not promote on them */
+#define IOC_CORRELATED_PERIOD_NS (1000LL * 1000 * 1000)
+/* pages of a list the 2q and arc eviction looks at for one not in use */
+#define IOC_EVICT_SCAN_MAX 64
 
 struct ioc_table;
 struct ioc_local;
 struct ioc_page;
 struct ioc_inode;
 
+/*
+ * ioc_policy_type - how pages are chosen for eviction.
+ *
+ * lru: least recently used pages of the least recently used inodes of the
+ *      lowest priority first.
+ * 2q:  pages read once go through a FIFO (A1in) and are evicted from it
+ *      unless read again after leaving it (while still on the ghost list
+ *      A1out), in which case they make it to the LRU list of hot pages (Am).
+ * arc: like 2q with the share of the cache given to pages read once and to
+ *      pages read more than once adapting to the hits on the ghosts of each.
+ */
+typedef enum {
+    IOC_POLICY_LRU,
+    IOC_POLICY_2Q,
+    IOC_POLICY_ARC,
+} ioc_policy_type_t;
+
+/* lists of the 2q and arc policies: T1/A1in, T2/Am, B1/A1out and B2 */
+enum {
+    IOC_LIST_RECENT,
+    IOC_LIST_FREQUENT,
+    IOC_LIST_RECENT_GHOST,
+    IOC_LIST_FREQUENT_GHOST,
+    IOC_LIST_MAX,
+};
+
+struct ioc_policy_list {
+    struct list_head pages; /* least recently used first */
+    uint64_t count;
+    uint64_t hits;
+    uint64_t evictions;
+};
+
+/*
+ * ioc_ghost - the memory of a page evicted by the 2q or arc policy
+ */
+struct ioc_ghost {
+    struct list_head list; /* on the ghost list */
+    struct list_head hash; /* on the bucket of the ghost table */
+    uuid_t gfid;
+    off_t offset;
+    int32_t list_index;
+};
+
+struct ioc_policy {
+    ioc_policy_type_t type;
+    struct ioc_policy_list lists[IOC_LIST_MAX];
+    struct list_head *ghost_table;
+    uint64_t capacity; /* pages which fit in the cache */
+    uint64_t target;   /* arc: pages wanted on the recent list */
+    uint64_t misses;
+    pthread_mutex_t lock; /* nests inside the inode lock */
+};
+
 struct ioc_priority {
     struct list_head list;
     char *pattern;
@@ -90,6 +151,7 @@ struct ioc_local {
     struct iobref *iobref;
     int32_t need_xattr;
     dict_t *xattr_req;
+    gf_boolean_t from_shm; /* page fault served by the shared cache */
 };
 
 /*
@@ -111,6 +173,9 @@ struct ioc_page {
     pthread_mutex_t page_lock;
     int32_t op_errno;
     char stale;
+    struct list_head policy_list; /* on a list of the replacement policy */
+    int32_t list_index;
+    int64_t referenced; /* ns, when admitted or last promoted */
 };
 
 struct ioc_cache {
@@ -160,6 +225,10 @@ struct ioc_table {
     time_t cache_timeout;
     int32_t max_pri;
     struct mem_pool *mem_pool;
+    struct ioc_policy policy;
+    gf_shm_cache_t *shm_cache; /* shared with the other clients of the
+                                * volume on this host */
+    uint64_t shm_cache_size;
 };
 
 typedef struct ioc_table ioc_table_t;
@@ -168,6 +237,8 @@ typedef struct ioc_page ioc_page_t;
 typedef struct ioc_inode ioc_inode_t;
 typedef struct ioc_waitq ioc_waitq_t;
 typedef struct ioc_fill ioc_fill_t;
+typedef struct ioc_policy ioc_policy_t;
+typedef struct ioc_ghost ioc_ghost_t;
 
 void *
 str_to_ptr(char *string);
@@ -288,4 +359,22 @@ ioc_prune(ioc_table_t *table);
 int32_t
 ioc_need_prune(ioc_table_t *table);
 
+int32_t
+ioc_policy_init(ioc_table_t *table);
+
+void
+ioc_policy_fini(ioc_table_t *table);
+
+int32_t
+ioc_policy_type(const char *name);
+
+void
+ioc_policy_set(ioc_table_t *table, ioc_policy_type_t type);
+
+void
+__ioc_page_access(ioc_page_t *page);
+
+void
+ioc_policy_dump(ioc_table_t *table);
+
 #endif /* __IO_CACHE_H */
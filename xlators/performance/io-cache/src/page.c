@@ -11,11 +11,16 @@
 #include <glusterfs/glusterfs.h>
 #include <glusterfs/logging.h>
 #include <glusterfs/dict.h>
+#include <glusterfs/statedump.h>
+#include <glusterfs/timespec.h>
 #include "io-cache.h"
 #include "ioc-mem-types.h"
 #include <assert.h>
 #include <sys/time.h>
 #include "io-cache-messages.h"
+
+extern int ioc_log2_page_size;
+
 char
 ioc_empty(struct ioc_cache *cache)
 {
@@ -74,6 +79,328 @@ out:
     return page;
 }
 
+static char *ioc_policy_names[] = {"lru", "2q", "arc"};
+
+static char *ioc_list_names[IOC_LIST_MAX] = {"recent", "frequent",
+                                             "recent-ghost", "frequent-ghost"};
+
+int32_t
+ioc_policy_type(const char *name)
+{
+    int32_t type = 0;
+
+    for (type = IOC_POLICY_ARC; type > IOC_POLICY_LRU; type--) {
+        if (!strcmp(name, ioc_policy_names[type]))
+            break;
+    }
+
+    return type;
+}
+
+static struct list_head *
+ioc_ghost_bucket(ioc_policy_t *policy, uuid_t gfid, off_t offset)
+{
+    uint32_t hash = 0;
+
+    memcpy(&hash, &gfid[12], sizeof(hash));
+    hash ^= (uint32_t)(offset >> ioc_log2_page_size);
+
+    return &policy->ghost_table[hash % IOC_GHOST_BUCKET_COUNT];
+}
+
+static ioc_ghost_t *
+__ioc_ghost_get(ioc_policy_t *policy, uuid_t gfid, off_t offset)
+{
+    struct list_head *bucket = NULL;
+    ioc_ghost_t *ghost = NULL;
+
+    bucket = ioc_ghost_bucket(policy, gfid, offset);
+    list_for_each_entry(ghost, bucket, hash)
+    {
+        if (ghost->offset == offset && !gf_uuid_compare(ghost->gfid, gfid))
+            return ghost;
+    }
+
+    return NULL;
+}
+
+static void
+__ioc_ghost_drop(ioc_policy_t *policy, ioc_ghost_t *ghost)
+{
+    list_del(&ghost->list);
+    list_del(&ghost->hash);
+    policy->lists[ghost->list_index].count--;
+    GF_FREE(ghost);
+}
+
+static void
+__ioc_ghost_drop_lru(ioc_policy_t *policy, int32_t index)
+{
+    ioc_ghost_t *ghost = NULL;
+
+    ghost = list_first_entry(&policy->lists[index].pages, ioc_ghost_t, list);
+    policy->lists[index].evictions++;
+    __ioc_ghost_drop(policy, ghost);
+}
+
+/*
+ * __ioc_ghosts_trim - keep the ghost lists within their bounds: 2q
+ * remembers half a cache worth of pages evicted from A1in, arc keeps T1 and
+ * B1 within one cache and all four lists within two.
+ *
+ * assumes the policy lock is held
+ */
+static void
+__ioc_ghosts_trim(ioc_policy_t *policy)
+{
+    struct ioc_policy_list *lists = policy->lists;
+    uint64_t capacity = policy->capacity;
+
+    if (policy->type == IOC_POLICY_2Q) {
+        while (lists[IOC_LIST_RECENT_GHOST].count > capacity / 2)
+            __ioc_ghost_drop_lru(policy, IOC_LIST_RECENT_GHOST);
+        return;
+    }
+
+    while (lists[IOC_LIST_RECENT_GHOST].count &&
+           (lists[IOC_LIST_RECENT].count +
+                lists[IOC_LIST_RECENT_GHOST].count >
+            capacity))
+        __ioc_ghost_drop_lru(policy, IOC_LIST_RECENT_GHOST);
+
+    while (lists[IOC_LIST_FREQUENT_GHOST].count &&
+           (lists[IOC_LIST_RECENT].count + lists[IOC_LIST_FREQUENT].count +
+                lists[IOC_LIST_RECENT_GHOST].count +
+                lists[IOC_LIST_FREQUENT_GHOST].count >
+            2 * capacity))
+        __ioc_ghost_drop_lru(policy, IOC_LIST_FREQUENT_GHOST);
+}
+
+static void
+__ioc_ghost_add(ioc_policy_t *policy, ioc_page_t *page)
+{
+    ioc_ghost_t *ghost = NULL;
+    int32_t index = IOC_LIST_RECENT_GHOST;
+
+    if (page->list_index == IOC_LIST_FREQUENT) {
+        /* 2q forgets the pages evicted from Am */
+        if (policy->type == IOC_POLICY_2Q)
+            return;
+        index = IOC_LIST_FREQUENT_GHOST;
+    }
+
+    ghost = GF_CALLOC(1, sizeof(*ghost), gf_ioc_mt_ioc_ghost_t);
+    if (ghost == NULL)
+        return;
+
+    gf_uuid_copy(ghost->gfid, page->inode->inode->gfid);
+    ghost->offset = page->offset;
+    ghost->list_index = index;
+
+    list_add_tail(&ghost->list, &policy->lists[index].pages);
+    list_add(&ghost->hash,
+             ioc_ghost_bucket(policy, ghost->gfid, ghost->offset));
+    policy->lists[index].count++;
+
+    __ioc_ghosts_trim(policy);
+}
+
+static void
+__ioc_ghosts_drop_all(ioc_policy_t *policy)
+{
+    ioc_ghost_t *ghost = NULL, *tmp = NULL;
+    int32_t index = 0;
+
+    for (index = IOC_LIST_RECENT_GHOST; index < IOC_LIST_MAX; index++) {
+        list_for_each_entry_safe(ghost, tmp, &policy->lists[index].pages, list)
+        {
+            __ioc_ghost_drop(policy, ghost);
+        }
+    }
+}
+
+int32_t
+ioc_policy_init(ioc_table_t *table)
+{
+    ioc_policy_t *policy = &table->policy;
+    int32_t i = 0;
+
+    policy->ghost_table = GF_CALLOC(IOC_GHOST_BUCKET_COUNT,
+                                    sizeof(struct list_head),
+                                    gf_ioc_mt_list_head);
+    if (policy->ghost_table == NULL)
+        return -1;
+
+    for (i = 0; i < IOC_GHOST_BUCKET_COUNT; i++)
+        INIT_LIST_HEAD(&policy->ghost_table[i]);
+
+    for (i = 0; i < IOC_LIST_MAX; i++)
+        INIT_LIST_HEAD(&policy->lists[i].pages);
+
+    pthread_mutex_init(&policy->lock, NULL);
+
+    return 0;
+}
+
+void
+ioc_policy_fini(ioc_table_t *table)
+{
+    ioc_policy_t *policy = &table->policy;
+
+    if (policy->ghost_table == NULL)
+        return;
+
+    __ioc_ghosts_drop_all(policy);
+    GF_FREE(policy->ghost_table);
+    policy->ghost_table = NULL;
+    pthread_mutex_destroy(&policy->lock);
+}
+
+/*
+ * ioc_policy_set - switch to a replacement policy and size it to the cache
+ *
+ * assumes the table lock is held
+ */
+void
+ioc_policy_set(ioc_table_t *table, ioc_policy_type_t type)
+{
+    ioc_policy_t *policy = &table->policy;
+
+    pthread_mutex_lock(&policy->lock);
+    {
+        if (type != policy->type) {
+            __ioc_ghosts_drop_all(policy);
+            policy->target = 0;
+        }
+
+        policy->type = type;
+        policy->capacity = max(table->cache_size / table->page_size, 1);
+        policy->target = min(policy->target, policy->capacity);
+        if (type != IOC_POLICY_LRU)
+            __ioc_ghosts_trim(policy);
+    }
+    pthread_mutex_unlock(&policy->lock);
+}
+
+static int64_t
+ioc_now_ns(void)
+{
+    struct timespec now;
+
+    timespec_now(&now);
+    return TS(now);
+}
+
+/*
+ * __ioc_page_admit - put a new page on the recent list, or on the frequent
+ * one if it was evicted not long ago.  arc moves its target towards the
+ * list whose ghost was hit.
+ *
+ * assumes the inode lock is held
+ */
+
+static void
+__ioc_page_admit(ioc_page_t *page)
+{
+    ioc_policy_t *policy = &page->inode->table->policy;
+    struct ioc_policy_list *lists = policy->lists;
+    ioc_ghost_t *ghost = NULL;
+    int32_t index = IOC_LIST_RECENT;
+    uint64_t delta = 0;
+
+    pthread_mutex_lock(&policy->lock);
+    {
+        if (policy->type != IOC_POLICY_LRU)
+            ghost = __ioc_ghost_get(policy, page->inode->inode->gfid,
+                                    page->offset);
+
+        if (ghost == NULL) {
+            policy->misses++;
+        } else {
+            lists[ghost->list_index].hits++;
+
+            if (policy->type == IOC_POLICY_ARC) {
+                if (ghost->list_index == IOC_LIST_RECENT_GHOST) {
+                    delta = max(lists[IOC_LIST_FREQUENT_GHOST].count /
+                                    lists[IOC_LIST_RECENT_GHOST].count,
+                                1);
+                    policy->target = min(policy->target + delta,
+                                         policy->capacity);
+                } else {
+                    delta = max(lists[IOC_LIST_RECENT_GHOST].count /
+                                    lists[IOC_LIST_FREQUENT_GHOST].count,
+                                1);
+                    policy->target = (policy->target > delta)
+                                         ? policy->target - delta
+                                         : 0;
+                }
+            }
+
+            __ioc_ghost_drop(policy, ghost);
+            index = IOC_LIST_FREQUENT;
+        }
+
+        page->list_index = index;
+        page->referenced = ioc_now_ns();
+        list_add_tail(&page->policy_list, &lists[index].pages);
+        lists[index].count++;
+    }
+    pthread_mutex_unlock(&policy->lock);
+}
+
+/*
+ * __ioc_page_access - account a read served from a cached page.  arc moves
+ * the page to the frequent list, unless it was read in or promoted less than
+ * IOC_CORRELATED_PERIOD_NS ago: a scan reading a page in small pieces hits it
+ * several times in a row and must not look like reuse.  2q only refreshes
+ * pages already on the frequent list.
+ *
+ * assumes the inode lock is held
+ */
+void
+__ioc_page_access(ioc_page_t *page)
+{
+    ioc_policy_t *policy = &page->inode->table->policy;
+    struct ioc_policy_list *lists = policy->lists;
+    int64_t now = 0;
+
+    pthread_mutex_lock(&policy->lock);
+    {
+        lists[page->list_index].hits++;
+
+        if (policy->type == IOC_POLICY_ARC) {
+            now = ioc_now_ns();
+            if (now - page->referenced < IOC_CORRELATED_PERIOD_NS)
+                goto unlock;
+            page->referenced = now;
+        }
+
+        if (policy->type == IOC_POLICY_ARC ||
+            (policy->type == IOC_POLICY_2Q &&
+             page->list_index == IOC_LIST_FREQUENT)) {
+            lists[page->list_index].count--;
+            page->list_index = IOC_LIST_FREQUENT;
+            list_move_tail(&page->policy_list, &lists[page->list_index].pages);
+            lists[page->list_index].count++;
+        }
+    }
+unlock:
+    pthread_mutex_unlock(&policy->lock);
+}
+
+static void
+__ioc_page_unlink(ioc_page_t *page)
+{
+    ioc_policy_t *policy = &page->inode->table->policy;
+
+    pthread_mutex_lock(&policy->lock);
+    {
+        list_del_init(&page->policy_list);
+        policy->lists[page->list_index].count--;
+    }
+    pthread_mutex_unlock(&policy->lock);
+}
+
 /*
  * __ioc_page_destroy -
  *
@@ -95,6 +422,7 @@ __ioc_page_destroy(ioc_page_t *page)
         page_size = -1;
         page->stale = 1;
     } else {
+        __ioc_page_unlink(page);
         rbthash_remove(page->inode->cache.page_table, &page->offset,
                        sizeof(page->offset));
         list_del(&page->page_lru);
@@ -151,6 +479,7 @@ __ioc_inode_prune(ioc_inode_t *curr, uint64_t *size_pruned,
     ioc_page_t *page = NULL, *next = NULL;
     int32_t ret = 0;
     ioc_table_t *table = NULL;
+    int32_t list_index = 0;
 
     if (curr == NULL) {
         goto out;
@@ -161,11 +490,17 @@ __ioc_inode_prune(ioc_inode_t *curr, uint64_t *size_pruned,
     list_for_each_entry_safe(page, next, &curr->cache.page_lru, page_lru)
     {
         *size_pruned += page->size;
+        list_index = page->list_index;
         ret = __ioc_page_destroy(page);
 
-        if (ret != -1)
+        if (ret != -1) {
             table->cache_used -= ret;
 
+            pthread_mutex_lock(&table->policy.lock);
+            table->policy.lists[list_index].evictions++;
+            pthread_mutex_unlock(&table->policy.lock);
+        }
+
         gf_msg_trace(table->xl->name, 0,
                      "index = %d && "
                      "table->cache_used = %" PRIu64
@@ -184,6 +519,106 @@ __ioc_inode_prune(ioc_inode_t *curr, uint64_t *size_pruned,
 out:
     return 0;
 }
+/*
+ * __ioc_policy_evict - evict the least recently used page of a list of the
+ * 2q or arc policy which no frame is waiting on, leaving its ghost behind.
+ * Inodes are locked with trylock as the policy lock nests inside them, and
+ * only the first IOC_EVICT_SCAN_MAX pages are looked at so that a list full
+ * of pages in use does not keep the table lock for long.
+ *
+ * assumes the table lock is held, which keeps the inodes of the pages alive
+ */
+static int64_t
+__ioc_policy_evict(ioc_table_t *table, int32_t index)
+{
+    ioc_policy_t *policy = &table->policy;
+    ioc_page_t *page = NULL;
+    ioc_page_t *victim = NULL;
+    ioc_inode_t *ioc_inode = NULL;
+    int64_t ret = -1;
+    int scanned = 0;
+
+    pthread_mutex_lock(&policy->lock);
+    {
+        list_for_each_entry(page, &policy->lists[index].pages, policy_list)
+        {
+            if (scanned++ == IOC_EVICT_SCAN_MAX)
+                break;
+
+            if (pthread_mutex_trylock(&page->inode->inode_lock))
+                continue;
+
+            if (page->ready && !page->waitq) {
+                victim = page;
+                break;
+            }
+            pthread_mutex_unlock(&page->inode->inode_lock);
+        }
+
+        if (victim) {
+            policy->lists[index].evictions++;
+            __ioc_ghost_add(policy, victim);
+        }
+    }
+    pthread_mutex_unlock(&policy->lock);
+
+    if (victim == NULL)
+        goto out;
+
+    ioc_inode = victim->inode;
+    ret = __ioc_page_destroy(victim);
+    if (ret != -1)
+        table->cache_used -= ret;
+
+    if (ioc_empty(&ioc_inode->cache))
+        list_del_init(&ioc_inode->inode_lru);
+
+    ioc_inode_unlock(ioc_inode);
+out:
+    return ret;
+}
+
+/*
+ * __ioc_policy_prune - evict pages as the 2q or arc policy says until
+ * size_to_prune bytes are freed: 2q keeps A1in at a quarter of the cache,
+ * arc keeps T1 at its target.
+ *
+ * assumes the table lock is held
+ */
+static void
+__ioc_policy_prune(ioc_table_t *table, uint64_t size_to_prune)
+{
+    ioc_policy_t *policy = &table->policy;
+    struct ioc_policy_list *lists = policy->lists;
+    uint64_t size_pruned = 0;
+    uint64_t limit = 0;
+    int32_t index = 0;
+    int64_t ret = 0;
+
+    while (size_pruned < size_to_prune) {
+        pthread_mutex_lock(&policy->lock);
+        {
+            limit = (policy->type == IOC_POLICY_2Q) ? policy->capacity / 4
+                                                    : policy->target;
+            if (lists[IOC_LIST_RECENT].count &&
+                (lists[IOC_LIST_RECENT].count > limit ||
+                 !lists[IOC_LIST_FREQUENT].count))
+                index = IOC_LIST_RECENT;
+            else
+                index = IOC_LIST_FREQUENT;
+        }
+        pthread_mutex_unlock(&policy->lock);
+
+        ret = __ioc_policy_evict(table, index);
+        if (ret == -1)
+            ret = __ioc_policy_evict(table, IOC_LIST_FREQUENT - index);
+        if (ret == -1)
+            break;
+
+        size_pruned += ret;
+    }
+}
+
 /*
  * ioc_prune - prune the cache. we have a limit to the number of pages we
  *             can have in-memory.
@@ -204,6 +639,12 @@ ioc_prune(ioc_table_t *table)
     ioc_table_lock(table);
     {
         size_to_prune = table->cache_used - table->cache_size;
+
+        if (table->policy.type != IOC_POLICY_LRU) {
+            __ioc_policy_prune(table, size_to_prune);
+            goto unlock;
+        }
+
         /* take out the least recently used inode */
         for (index = 0; index < table->max_pri; index++) {
             list_for_each_entry_safe(curr, next_ioc_inode,
@@ -226,6 +667,7 @@ ioc_prune(ioc_table_t *table)
         } /* for(index=0;...) */
 
     } /* ioc_inode_table locked region end */
+unlock:
     ioc_table_unlock(table);
 
 out:
@@ -274,6 +716,9 @@ __ioc_page_create(ioc_inode_t *ioc_inode, off_t offset)
 
     list_add_tail(&newpage->page_lru, &ioc_inode->cache.page_lru);
 
+    INIT_LIST_HEAD(&newpage->policy_list);
+    __ioc_page_admit(newpage);
+
     page = newpage;
 
     gf_msg_trace("io-cache", 0, "returning new page %p", page);
@@ -443,7 +888,9 @@ ioc_fault_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int32_t op_ret,
             ioc_inode->cache.mtime_nsec = stbuf->ia_mtime_nsec;
         }
 
-        ioc_inode->cache.last_revalidate = gf_time();
+        /* a page from the shared cache does not revalidate the file */
+        if (!local->from_shm)
+            ioc_inode->cache.last_revalidate = gf_time();
 
         if (op_ret < 0) {
             /* error, readv returned -1 */
@@ -514,6 +961,11 @@ unlock:
 
     ioc_waitq_return(waitq);
 
+    if ((op_ret > 0) && !zero_filled && !local->from_shm &&
+        table->shm_cache_size && table->shm_cache)
+        gf_shm_cache_put(table->shm_cache, ioc_inode->inode->gfid, offset,
+                         stbuf, vector, count);
+
     if (iobref_page_size) {
         ioc_table_lock(table);
         {
@@ -545,6 +997,77 @@ unlock:
     return 0;
 }
 
+/*
+ * ioc_shared_fault - serve a page fault from the cache shared with the other
+ * clients of the volume on this host, if it has the page as of the mtime the
+ * cache of the inode was last validated against.
+ *
+ * @frame: the fault frame
+ * @ioc_inode:
+ * @offset:
+ *
+ */
+static gf_boolean_t
+ioc_shared_fault(call_frame_t *frame, ioc_inode_t *ioc_inode, off_t offset)
+{
+    ioc_table_t *table = NULL;
+    ioc_local_t *local = NULL;
+    struct iobuf *iobuf = NULL;
+    struct iobref *iobref = NULL;
+    struct iovec iov = {
+        0,
+    };
+    struct iatt stbuf = {
+        0,
+    };
+    ssize_t size = -1;
+
+    table = ioc_inode->table;
+    if (!table->shm_cache_size || !table->shm_cache)
+        return _gf_false;
+
+    ioc_inode_lock(ioc_inode);
+    {
+        stbuf.ia_mtime = ioc_inode->cache.mtime;
+        stbuf.ia_mtime_nsec = ioc_inode->cache.mtime_nsec;
+    }
+    ioc_inode_unlock(ioc_inode);
+
+    /* not validated since it was last modified */
+    if (!stbuf.ia_mtime)
+        return _gf_false;
+
+    iobuf = iobuf_get2(frame->this->ctx->iobuf_pool, table->page_size);
+    if (!iobuf)
+        return _gf_false;
+
+    size = gf_shm_cache_get(table->shm_cache, ioc_inode->inode->gfid, offset,
+                            &stbuf, iobuf->ptr, table->page_size);
+    if (size < 0)
+        goto out;
+
+    iobref = iobref_new();
+    if (!iobref) {
+        size = -1;
+        goto out;
+    }
+    iobref_add(iobref, iobuf);
+
+    iov.iov_base = iobuf->ptr;
+    iov.iov_len = size;
+
+    local = frame->local;
+    local->from_shm = _gf_true;
+
+    ioc_fault_cbk(frame, NULL, frame->this, size, 0, &iov, 1, &stbuf, iobref,
+                  NULL);
+
+    iobref_unref(iobref);
+out:
+    iobuf_unref(iobuf);
+    return (size >= 0);
+}
+
 /*
  * ioc_page_fault -
  *
@@ -608,6 +1131,9 @@ ioc_page_fault(ioc_inode_t *ioc_inode, call_frame_t *frame, fd_t *fd,
     if (local && local->xattr_req)
         fault_local->xattr_req = dict_ref(local->xattr_req);
 
+    if (ioc_shared_fault(fault_frame, ioc_inode, offset))
+        return;
+
     gf_msg_trace(frame->this->name, 0,
                  "stack winding page fault for offset = %" PRId64
                  " with "
@@ -1026,3 +1552,49 @@ ioc_page_error(ioc_page_t *page, int32_t op_ret, int32_t op_errno)
 out:
     return waitq;
 }
+
+/*
+ * ioc_policy_dump - hits, evictions and size of each list of the
+ * replacement policy, and the share of the reads each list served
+ */
+void
+ioc_policy_dump(ioc_table_t *table)
+{
+    ioc_policy_t *policy = &table->policy;
+    struct ioc_policy_list *list = NULL;
+    char key[GF_DUMP_MAX_BUF_LEN] = {
+        0,
+    };
+    uint64_t reads = 0;
+    int32_t i = 0;
+
+    if (pthread_mutex_trylock(&policy->lock))
+        return;
+    {
+        reads = policy->misses;
+        for (i = 0; i < IOC_LIST_MAX; i++)
+            reads += policy->lists[i].hits;
+
+        gf_proc_dump_write("policy", "%s", ioc_policy_names[policy->type]);
+        gf_proc_dump_write("policy.misses", "%" PRIu64, policy->misses);
+        if (policy->type == IOC_POLICY_ARC)
+            gf_proc_dump_write("policy.target", "%" PRIu64, policy->target);
+
+        for (i = 0; i < IOC_LIST_MAX; i++) {
+            list = &policy->lists[i];
+
+            snprintf(key, sizeof(key), "policy.%s.pages", ioc_list_names[i]);
+            gf_proc_dump_write(key, "%" PRIu64, list->count);
+            snprintf(key, sizeof(key), "policy.%s.hits", ioc_list_names[i]);
+            gf_proc_dump_write(key, "%" PRIu64, list->hits);
+            snprintf(key, sizeof(key), "policy.%s.hit-ratio",
+                     ioc_list_names[i]);
+            gf_proc_dump_write(key, "%.2f",
+                               reads ? (double)list->hits / reads : 0.0);
+            snprintf(key, sizeof(key), "policy.%s.evictions",
+                     ioc_list_names[i]);
+            gf_proc_dump_write(key, "%" PRIu64, list->evictions);
+        }
+    }
+    pthread_mutex_unlock(&policy->lock);
+}
@@ -22,6 +22,7 @@
 #include <glusterfs/locking.h>
 #include "io-threads-messages.h"
 #include <glusterfs/timespec.h>
+#include <urcu/uatomic.h>
 
 static void *
 iot_worker(void *arg);
@@ -79,57 +80,119 @@ iot_get_ctx(xlator_t *this, client_t *client)
     return ctx;
 }
 
+static iot_shard_t *
+iot_get_shard(iot_conf_t *conf, client_t *client)
+{
+    uint32_t hash = 0;
+
+    if (!client)
+        return &conf->shards[uatomic_add_return(&conf->shard_rotor, 1) %
+                             conf->shard_count];
+
+    /* keep all the requests of a client in the same shard */
+    hash = (uint32_t)(((uintptr_t)client >> 4) * 2654435761U);
+    return &conf->shards[(hash >> 16) % conf->shard_count];
+}
+
+/* Called with shard->mutex held */
 static call_stub_t *
-__iot_dequeue(iot_conf_t *conf, int *pri)
+__iot_dequeue(iot_conf_t *conf, iot_shard_t *shard, int pri)
 {
     call_stub_t *stub = NULL;
-    int i = 0;
     iot_client_ctx_t *ctx;
+    iot_shard_pri_t *queue = &shard->pri[pri];
+
+    if (list_empty(&queue->clients)) {
+        return NULL;
+    }
+
+    /* Get the first per-client queue for this priority. */
+    ctx = list_first_entry(&queue->clients, iot_client_ctx_t, clients);
+    if (list_empty(&ctx->reqs)) {
+        return NULL;
+    }
+
+    /* Get the first request on that queue. */
+    stub = list_first_entry(&ctx->reqs, call_stub_t, list);
+    list_del_init(&stub->list);
+    if (list_empty(&ctx->reqs)) {
+        list_del_init(&ctx->clients);
+    } else {
+        list_rotate_left(&queue->clients);
+    }
+
+    uatomic_set(&conf->fops_data[pri].queue_marked, _gf_false);
+    uatomic_dec(&conf->fops_data[pri].queue_sizes);
+    uatomic_dec(&conf->queue_size);
+    uatomic_dec(&queue->queue_size);
+    shard->queue_size--;
+
+    return stub;
+}
+
+/*
+ * Priorities are served in order across all the shards: a worker looks for
+ * the highest priority with queued requests and a free thread slot, first
+ * in its home shard and then in the others.
+ */
+static call_stub_t *
+iot_dequeue(iot_conf_t *conf, iot_shard_t *home, int *pri)
+{
+    call_stub_t *stub = NULL;
     iot_fop_data_t *fop_data;
+    iot_shard_t *shard;
+    int home_idx = home - conf->shards;
+    int i = 0;
+    int j = 0;
 
     for (i = 0; i < GF_FOP_PRI_MAX; i++) {
         fop_data = &conf->fops_data[i];
-        if (fop_data->ac_iot_count >= fop_data->ac_iot_limit) {
+        if (!uatomic_read(&fop_data->queue_sizes)) {
             continue;
         }
 
-        else if (list_empty(&fop_data->clients)) {
+        /* Reserve a thread slot for this priority. */
+        if (uatomic_add_return(&fop_data->ac_iot_count, 1) >
+            fop_data->ac_iot_limit) {
+            uatomic_dec(&fop_data->ac_iot_count);
             continue;
         }
 
-        /* Get the first per-client queue for this priority. */
-        ctx = list_first_entry(&fop_data->clients, iot_client_ctx_t, clients);
-        if (list_empty(&ctx->reqs)) {
-            continue;
-        }
+        for (j = 0; j < conf->shard_count; j++) {
+            shard = &conf->shards[(home_idx + j) % conf->shard_count];
+            if (!uatomic_read(&shard->pri[i].queue_size)) {
+                continue;
+            }
 
-        /* Get the first request on that queue. */
-        stub = list_first_entry(&ctx->reqs, call_stub_t, list);
-        list_del_init(&stub->list);
-        if (list_empty(&ctx->reqs)) {
-            list_del_init(&ctx->clients);
-        } else {
-            list_rotate_left(&fop_data->clients);
-        }
+            pthread_mutex_lock(&shard->mutex);
+            {
+                stub = __iot_dequeue(conf, shard, i);
+                if (stub && (shard != home)) {
+                    shard->stolen++;
+                }
+            }
+            pthread_mutex_unlock(&shard->mutex);
 
-        fop_data->ac_iot_count++;
-        fop_data->queue_marked = _gf_false;
-        fop_data->queue_sizes--;
-        *pri = i;
-        conf->queue_size--;
+            if (stub) {
+                *pri = i;
+                return stub;
+            }
+        }
 
-        return stub;
+        uatomic_dec(&fop_data->ac_iot_count);
     }
 
     return NULL;
 }
 
+/* Called with shard->mutex held */
 static void
-__iot_enqueue(iot_conf_t *conf, call_stub_t *stub, int pri)
+__iot_enqueue(iot_conf_t *conf, iot_shard_t *shard, call_stub_t *stub,
+              int pri)
 {
     client_t *client = stub->frame->root->client;
     iot_client_ctx_t *ctx;
-    iot_fop_data_t *fop_data = &conf->fops_data[pri];
+    iot_shard_pri_t *queue = &shard->pri[pri];
 
     if (client) {
         ctx = iot_get_ctx(conf->this, client);
@@ -140,17 +203,122 @@ __iot_enqueue(iot_conf_t *conf, call_stub_t *stub, int pri)
         ctx = NULL;
     }
     if (!ctx) {
-        ctx = &fop_data->no_client;
+        ctx = &queue->no_client;
     }
 
     if (list_empty(&ctx->reqs)) {
-        list_add_tail(&ctx->clients, &fop_data->clients);
+        list_add_tail(&ctx->clients, &queue->clients);
     }
     list_add_tail(&stub->list, &ctx->reqs);
 
-    conf->queue_size++;
+    shard->queue_size++;
+    uatomic_inc(&queue->queue_size);
+    uatomic_inc(&conf->queue_size);
     GF_ATOMIC_INC(conf->stub_cnt);
-    fop_data->queue_sizes++;
+    uatomic_inc(&conf->fops_data[pri].queue_sizes);
+}
+
+/* Is there a request some worker could run right now ? */
+static gf_boolean_t
+iot_has_work(iot_conf_t *conf)
+{
+    iot_fop_data_t *fop_data;
+    int i = 0;
+
+    for (i = 0; i < GF_FOP_PRI_MAX; i++) {
+        fop_data = &conf->fops_data[i];
+        if (uatomic_read(&fop_data->queue_sizes) &&
+            (uatomic_read(&fop_data->ac_iot_count) < fop_data->ac_iot_limit))
+            return _gf_true;
+    }
+
+    return _gf_false;
+}
+
+/*
+ * Wake up a worker for a request just queued in @shard. If none of the
+ * workers of that shard is idle, wake up an idle one of another shard, it
+ * will steal the request.
+ *
+ * The sleep count of a shard is raised before its workers check for work,
+ * and the queue sizes are raised before this checks for sleepers, so either
+ * the worker sees the request or we see the worker.
+ */
+static void
+iot_wakeup_worker(iot_conf_t *conf, iot_shard_t *shard)
+{
+    iot_shard_t *other;
+    int idx = shard - conf->shards;
+    int i = 0;
+
+    cmm_smp_mb();
+
+    for (i = 0; i < conf->shard_count; i++) {
+        other = &conf->shards[(idx + i) % conf->shard_count];
+        if (uatomic_read(&other->sleep_count)) {
+            pthread_mutex_lock(&other->mutex);
+            {
+                pthread_cond_signal(&other->cond);
+            }
+            pthread_mutex_unlock(&other->mutex);
+            return;
+        }
+    }
+}
+
+/* Returns true if the worker should exit */
+static gf_boolean_t
+iot_worker_wait(iot_conf_t *conf, iot_shard_t *shard)
+{
+    struct timespec sleep_till;
+    gf_boolean_t bye = _gf_false;
+    int ret = 0;
+
+    pthread_mutex_lock(&shard->mutex);
+    {
+        uatomic_inc(&shard->sleep_count);
+        cmm_smp_mb();
+        while (!iot_has_work(conf)) {
+            if (conf->down) {
+                bye = _gf_true; /*Avoid sleep*/
+                break;
+            }
+
+            clock_gettime(CLOCK_REALTIME_COARSE, &sleep_till);
+            sleep_till.tv_sec += conf->idle_time;
+
+            ret = pthread_cond_timedwait(&shard->cond, &shard->mutex,
+                                         &sleep_till);
+
+            if (conf->down || ret == ETIMEDOUT) {
+                bye = _gf_true;
+                break;
+            }
+        }
+        uatomic_dec(&shard->sleep_count);
+    }
+    pthread_mutex_unlock(&shard->mutex);
+
+    return bye;
+}
+
+static iot_shard_t *
+iot_worker_home(iot_conf_t *conf)
+{
+    iot_shard_t *home = &conf->shards[0];
+    int i = 0;
+
+    pthread_mutex_lock(&conf->mutex);
+    {
+        for (i = 1; i < conf->shard_count; i++) {
+            if (conf->shards[i].workers < home->workers)
+                home = &conf->shards[i];
+        }
+        home->workers++;
+    }
+    pthread_mutex_unlock(&conf->mutex);
+
+    return home;
 }
 
 static void *
@@ -159,8 +327,7 @@ iot_worker(void *data)
     iot_conf_t *conf = NULL;
     xlator_t *this = NULL;
     call_stub_t *stub = NULL;
-    struct timespec sleep_till;
-    int ret = 0;
+    iot_shard_t *home = NULL;
     int pri = -1;
     gf_boolean_t bye = _gf_false;
 
@@ -168,35 +335,25 @@ iot_worker(void *data)
     this = conf->this;
     THIS = this;
 
-    for (;;) {
-        pthread_mutex_lock(&conf->mutex);
-        {
-            if (pri != -1) {
-                conf->fops_data[pri].ac_iot_count--;
-                pri = -1;
-            }
-            while (conf->queue_size == 0) {
-                if (conf->down) {
-                    bye = _gf_true; /*Avoid sleep*/
-                    break;
-                }
+    home = iot_worker_home(conf);
 
-                clock_gettime(CLOCK_REALTIME_COARSE, &sleep_till);
-                sleep_till.tv_sec += conf->idle_time;
-
-                conf->sleep_count++;
-                ret = pthread_cond_timedwait(&conf->cond, &conf->mutex,
-                                             &sleep_till);
-                conf->sleep_count--;
+    for (;;) {
+        if (pri != -1) {
+            uatomic_dec(&conf->fops_data[pri].ac_iot_count);
+            pri = -1;
+        }
 
-                if (conf->down || ret == ETIMEDOUT) {
-                    bye = _gf_true;
-                    break;
-                }
+        stub = iot_dequeue(conf, home, &pri);
+        if (!stub) {
+            if (!iot_worker_wait(conf, home)) {
+                continue;
             }
 
-            if (bye) {
+            pthread_mutex_lock(&conf->mutex);
+            {
                 if (conf->down || conf->curr_count > IOT_MIN_THREADS) {
+                    bye = _gf_true;
+                    home->workers--;
                     conf->curr_count--;
                     if (conf->curr_count == 0)
                         pthread_cond_broadcast(&conf->cond);
@@ -204,30 +361,24 @@ iot_worker(void *data)
                                  "terminated. "
                                  "conf->curr_count=%d",
                                  conf->curr_count);
-                } else {
-                    bye = _gf_false;
                 }
             }
+            pthread_mutex_unlock(&conf->mutex);
 
-            if (!bye)
-                stub = __iot_dequeue(conf, &pri);
+            if (bye)
+                break;
+            continue;
         }
-        pthread_mutex_unlock(&conf->mutex);
 
-        if (stub) { /* guard against spurious wakeups */
-            if (stub->poison) {
-                gf_log(this->name, GF_LOG_INFO, "Dropping poisoned request %p.",
-                       stub);
-                call_stub_destroy(stub);
-            } else {
-                call_resume(stub);
-            }
-            GF_ATOMIC_DEC(conf->stub_cnt);
+        if (stub->poison) {
+            gf_log(this->name, GF_LOG_INFO, "Dropping poisoned request %p.",
+                   stub);
+            call_stub_destroy(stub);
+        } else {
+            call_resume(stub);
         }
+        GF_ATOMIC_DEC(conf->stub_cnt);
         stub = NULL;
-
-        if (bye)
-            break;
     }
 
     return NULL;
@@ -236,19 +387,17 @@ iot_worker(void *data)
 static int
 do_iot_schedule(iot_conf_t *conf, call_stub_t *stub, int pri)
 {
-    int ret = 0;
+    iot_shard_t *shard = iot_get_shard(conf, stub->frame->root->client);
 
-    pthread_mutex_lock(&conf->mutex);
+    pthread_mutex_lock(&shard->mutex);
     {
-        __iot_enqueue(conf, stub, pri);
-
-        pthread_cond_signal(&conf->cond);
-
-        ret = __iot_workers_scale(conf);
+        __iot_enqueue(conf, shard, stub, pri);
     }
-    pthread_mutex_unlock(&conf->mutex);
+    pthread_mutex_unlock(&shard->mutex);
 
-    return ret;
+    iot_wakeup_worker(conf, shard);
+
+    return iot_workers_scale(conf);
 }
 
 static char *
@@ -797,24 +946,33 @@ iot_setactivelk(call_frame_t *frame, xlator_t *this, loc_t *loc,
 }
 
 static int
-__iot_workers_scale(iot_conf_t *conf)
+iot_workers_wanted(iot_conf_t *conf)
 {
     int scale = 0;
-    int diff = 0;
-    pthread_t thread;
-    int ret = 0;
     int i = 0;
 
     for (i = 0; i < GF_FOP_PRI_MAX; i++)
         scale += min(conf->fops_data[i].ac_iot_limit,
-                     conf->fops_data[i].queue_sizes);
+                     uatomic_read(&conf->fops_data[i].queue_sizes));
 
     if (scale < IOT_MIN_THREADS)
         scale = IOT_MIN_THREADS;
-
     else if (scale > conf->max_count)
         scale = conf->max_count;
 
+    return scale;
+}
+
+static int
+__iot_workers_scale(iot_conf_t *conf)
+{
+    int scale = 0;
+    int diff = 0;
+    pthread_t thread;
+    int ret = 0;
+
+    scale = iot_workers_wanted(conf);
+
     if (conf->curr_count < scale) {
         diff = scale - conf->curr_count;
     }
@@ -829,7 +987,8 @@ __iot_workers_scale(iot_conf_t *conf)
             conf->curr_count++;
             gf_msg_debug(conf->this->name, 0,
                          "scaled threads to %d (queue_size=%d/%d)",
-                         conf->curr_count, conf->queue_size, scale);
+                         conf->curr_count, uatomic_read(&conf->queue_size),
+                         scale);
         } else {
             break;
         }
@@ -843,6 +1002,10 @@ iot_workers_scale(iot_conf_t *conf)
 {
     int ret;
 
+    /* don't take the mutex on every request when there are enough */
+    if (uatomic_read(&conf->curr_count) >= iot_workers_wanted(conf))
+        return 0;
+
     pthread_mutex_lock(&conf->mutex);
     {
         ret = __iot_workers_scale(conf);
@@ -910,6 +1073,8 @@ iot_priv_dump(xlator_t *this)
     iot_conf_t *conf = NULL;
     char key_prefix[GF_DUMP_MAX_BUF_LEN];
     char key[GF_DUMP_MAX_BUF_LEN];
+    iot_shard_t *shard = NULL;
+    int32_t sleep_count = 0;
     int i = 0;
 
     if (!this)
@@ -919,13 +1084,16 @@ iot_priv_dump(xlator_t *this)
     if (!conf)
         return 0;
 
+    for (i = 0; i < conf->shards_inited; i++)
+        sleep_count += uatomic_read(&conf->shards[i].sleep_count);
+
     snprintf(key_prefix, GF_DUMP_MAX_BUF_LEN, "%s.%s", this->type, this->name);
 
     gf_proc_dump_add_section("%s", key_prefix);
 
     gf_proc_dump_write("maximum_threads_count", "%d", conf->max_count);
     gf_proc_dump_write("current_threads_count", "%d", conf->curr_count);
-    gf_proc_dump_write("sleep_count", "%d", conf->sleep_count);
+    gf_proc_dump_write("sleep_count", "%d", sleep_count);
     gf_proc_dump_write("idle_time", "%ld", conf->idle_time);
     gf_proc_dump_write("stack_size", "%zd", conf->stack_size);
     gf_proc_dump_write("max_high_priority_threads", "%d",
@@ -945,11 +1113,25 @@ iot_priv_dump(xlator_t *this)
     gf_proc_dump_write("current_least_priority_threads", "%d",
                        conf->fops_data[GF_FOP_PRI_LEAST].ac_iot_count);
     for (i = 0; i < GF_FOP_PRI_MAX; i++) {
-        if (!conf->fops_data[i].queue_sizes)
+        if (!uatomic_read(&conf->fops_data[i].queue_sizes))
             continue;
         snprintf(key, sizeof(key), "%s_priority_queue_length",
                  iot_get_pri_meaning(i));
-        gf_proc_dump_write(key, "%d", conf->fops_data[i].queue_sizes);
+        gf_proc_dump_write(key, "%d",
+                           uatomic_read(&conf->fops_data[i].queue_sizes));
+    }
+
+    gf_proc_dump_write("queue_shards", "%d", conf->shard_count);
+    for (i = 0; i < conf->shards_inited; i++) {
+        shard = &conf->shards[i];
+        snprintf(key, sizeof(key), "shard[%d].queue_length", i);
+        gf_proc_dump_write(key, "%d", shard->queue_size);
+        snprintf(key, sizeof(key), "shard[%d].workers", i);
+        gf_proc_dump_write(key, "%d", shard->workers);
+        snprintf(key, sizeof(key), "shard[%d].sleep_count", i);
+        gf_proc_dump_write(key, "%d", uatomic_read(&shard->sleep_count));
+        snprintf(key, sizeof(key), "shard[%d].stolen", i);
+        gf_proc_dump_write(key, "%" PRIu64, shard->stolen);
     }
 
     return 0;
@@ -1050,7 +1232,7 @@ iot_watchdog(void *arg)
         pthread_mutex_lock(&priv->mutex);
         for (i = 0; i < GF_FOP_PRI_MAX; ++i) {
             fop_data = &priv->fops_data[i];
-            if (fop_data->queue_marked) {
+            if (uatomic_read(&fop_data->queue_marked)) {
                 if (++bad_times[i] >= 5) {
                     gf_log(this->name, GF_LOG_WARNING, "queue %d stalled", i);
                     iot_apply_event(this, &thresholds[i]);
@@ -1064,7 +1246,8 @@ iot_watchdog(void *arg)
             } else {
                 bad_times[i] = 0;
             }
-            fop_data->queue_marked = (fop_data->queue_sizes > 0);
+            uatomic_set(&fop_data->queue_marked,
+                        (uatomic_read(&fop_data->queue_sizes) > 0));
         }
         pthread_mutex_unlock(&priv->mutex);
         pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
@@ -1164,12 +1347,68 @@ out:
     return ret;
 }
 
+static int
+iot_shards_init(iot_conf_t *conf)
+{
+    iot_shard_t *shard = NULL;
+    int ret = 0;
+    int i = 0;
+    int j = 0;
+
+    conf->shards = GF_CALLOC(conf->shard_count, sizeof(*conf->shards),
+                             gf_iot_mt_shard_t);
+    if (!conf->shards) {
+        gf_smsg(conf->this->name, GF_LOG_ERROR, ENOMEM,
+                IO_THREADS_MSG_OUT_OF_MEMORY, NULL);
+        return -1;
+    }
+
+    for (i = 0; i < conf->shard_count; i++) {
+        shard = &conf->shards[i];
+        if ((ret = pthread_mutex_init(&shard->mutex, NULL)) != 0) {
+            gf_smsg(conf->this->name, GF_LOG_ERROR, 0,
+                    IO_THREADS_MSG_PTHREAD_INIT_FAILED,
+                    "pthread_mutex_init ret=%d", ret, NULL);
+            return -1;
+        }
+        if ((ret = pthread_cond_init(&shard->cond, NULL)) != 0) {
+            pthread_mutex_destroy(&shard->mutex);
+            gf_smsg(conf->this->name, GF_LOG_ERROR, 0,
+                    IO_THREADS_MSG_PTHREAD_INIT_FAILED,
+                    "pthread_cond_init ret=%d", ret, NULL);
+            return -1;
+        }
+        for (j = 0; j < GF_FOP_PRI_MAX; j++) {
+            INIT_LIST_HEAD(&shard->pri[j].clients);
+            INIT_LIST_HEAD(&shard->pri[j].no_client.reqs);
+            INIT_LIST_HEAD(&shard->pri[j].no_client.clients);
+        }
+        conf->shards_inited++;
+    }
+
+    return 0;
+}
+
+static void
+iot_shards_fini(iot_conf_t *conf)
+{
+    int i = 0;
+
+    for (i = 0; i < conf->shards_inited; i++) {
+        pthread_cond_destroy(&conf->shards[i].cond);
+        pthread_mutex_destroy(&conf->shards[i].mutex);
+    }
+    conf->shards_inited = 0;
+
+    GF_FREE(conf->shards);
+    conf->shards = NULL;
+}
+
 int
 init(xlator_t *this)
 {
     iot_conf_t *conf = NULL;
     int ret = -1;
-    int i = 0;
 
     if (!this->children || this->children->next) {
         gf_smsg("io-threads", GF_LOG_ERROR, 0,
@@ -1233,14 +1472,22 @@ init(xlator_t *this)
 
     GF_OPTION_INIT("pass-through", this->pass_through, bool, out);
 
+    GF_OPTION_INIT("queue-shards", conf->shard_count, int32, out);
+    if (conf->shard_count == 0) {
+        conf->shard_count = conf->max_count / IOT_THREADS_PER_SHARD;
+        if (conf->shard_count < 1)
+            conf->shard_count = 1;
+    }
+    if (conf->shard_count > IOT_MAX_QUEUE_SHARDS)
+        conf->shard_count = IOT_MAX_QUEUE_SHARDS;
+
     conf->this = this;
     GF_ATOMIC_INIT(conf->stub_cnt, 0);
 
-    for (i = 0; i < GF_FOP_PRI_MAX; i++) {
-        INIT_LIST_HEAD(&conf->fops_data[i].clients);
-        INIT_LIST_HEAD(&conf->fops_data[i].no_client.reqs);
-        INIT_LIST_HEAD(&conf->fops_data[i].no_client.clients);
-    }
+    ret = iot_shards_init(conf);
+    if (ret != 0)
+        goto out;
+    ret = -1;
 
     if (!this->pass_through) {
         ret = iot_workers_scale(conf);
@@ -1262,8 +1509,10 @@ init(xlator_t *this)
 
     ret = 0;
 out:
-    if (ret)
+    if (ret && conf) {
+        iot_shards_fini(conf);
         GF_FREE(conf);
+    }
 
     return ret;
 }
@@ -1271,11 +1520,22 @@ out:
 static void
 iot_exit_threads(iot_conf_t *conf)
 {
+    iot_shard_t *shard = NULL;
+    int i = 0;
+
     pthread_mutex_lock(&conf->mutex);
     {
         conf->down = _gf_true;
         /*Let all the threads know that xl is going down*/
         pthread_cond_broadcast(&conf->cond);
+        for (i = 0; i < conf->shards_inited; i++) {
+            shard = &conf->shards[i];
+            pthread_mutex_lock(&shard->mutex);
+            {
+                pthread_cond_broadcast(&shard->cond);
+            }
+            pthread_mutex_unlock(&shard->mutex);
+        }
         while (conf->curr_count) /*Wait for threads to exit*/
             pthread_cond_wait(&conf->cond, &conf->mutex);
     }
@@ -1347,6 +1607,8 @@ fini(xlator_t *this)
     if (conf->mutex_inited)
         pthread_mutex_destroy(&conf->mutex);
 
+    iot_shards_fini(conf);
+
     stop_iot_watchdog(this);
 
     GF_FREE(conf);
@@ -1376,26 +1638,31 @@ iot_disconnect_cbk(xlator_t *this, client_t *client)
     call_stub_t *next;
     iot_conf_t *conf = this->private;
     iot_client_ctx_t *ctx;
+    iot_shard_t *shard;
+    int j;
 
     if (!conf || !conf->cleanup_disconnected_reqs) {
         goto out;
     }
 
-    pthread_mutex_lock(&conf->mutex);
-    for (i = 0; i < GF_FOP_PRI_MAX; i++) {
-        ctx = &conf->fops_data[i].no_client;
-        list_for_each_entry_safe(curr, next, &ctx->reqs, list)
-        {
-            if (curr->frame->root->client != client) {
-                continue;
+    for (j = 0; j < conf->shards_inited; j++) {
+        shard = &conf->shards[j];
+        pthread_mutex_lock(&shard->mutex);
+        for (i = 0; i < GF_FOP_PRI_MAX; i++) {
+            ctx = &shard->pri[i].no_client;
+            list_for_each_entry_safe(curr, next, &ctx->reqs, list)
+            {
+                if (curr->frame->root->client != client) {
+                    continue;
+                }
+                gf_log(this->name, GF_LOG_INFO,
+                       "poisoning %s fop at %p for client %s",
+                       gf_fop_list[curr->fop], curr, client->client_uid);
+                curr->poison = _gf_true;
             }
-            gf_log(this->name, GF_LOG_INFO,
-                   "poisoning %s fop at %p for client %s",
-                   gf_fop_list[curr->fop], curr, client->client_uid);
-            curr->poison = _gf_true;
         }
+        pthread_mutex_unlock(&shard->mutex);
     }
-    pthread_mutex_unlock(&conf->mutex);
 
 out:
     return 0;
@@ -1552,6 +1819,19 @@ struct volume_options options[] = {
      .flags = OPT_FLAG_SETTABLE | OPT_FLAG_DOC | OPT_FLAG_CLIENT_OPT,
      .tags = {"io-threads"},
      .description = "Enable/Disable io threads translator"},
+    {.key = {"queue-shards"},
+     .type = GF_OPTION_TYPE_INT,
+     .min = 0,
+     .max = IOT_MAX_QUEUE_SHARDS,
+     .default_value = "0",
+     .op_version = {GD_OP_VERSION_11_0},
+     .flags = OPT_FLAG_SETTABLE | OPT_FLAG_DOC | OPT_FLAG_RANGE,
+     .tags = {"io-threads"},
+     .description = "Number of independently locked request queues. Idle "
+                    "threads steal requests from the queues of other "
+                    "threads. 0 picks one queue per 4 threads of "
+                    "thread-count. Takes effect when the translator is "
+                    "restarted."},
     {
         .key = {NULL},
     },
@@ -26,14 +26,17 @@
 
 #define IOT_THREAD_STACK_SIZE ((size_t)(256 * 1024))
 
+#define IOT_MAX_QUEUE_SHARDS 16
+/* threads per queue shard when queue-shards is left to 0 */
+#define IOT_THREADS_PER_SHARD 4
+
 typedef struct {
     struct list_head reqs;
     struct list_head clients;
 } iot_client_ctx_t;
 
+/* The requests of one priority queued in one shard */
 typedef struct {
-    int32_t ac_iot_limit;
-    int32_t ac_iot_count;
     struct list_head clients;
     /*
      * It turns out that there are several ways a frame can get to us
@@ -42,18 +45,47 @@ typedef struct {
      * we use this to queue them.
      */
     iot_client_ctx_t no_client;
-    int queue_sizes;
+    int32_t queue_size;
+} iot_shard_pri_t;
+
+/*
+ * Requests are queued in shards, each one with its own lock, so that
+ * enqueuing and dequeuing don't serialize all the workers. All the requests
+ * of a client go to the same shard and keep being served round-robin with
+ * the other clients of that shard. Every worker has a home shard it sleeps
+ * on, and steals from the other shards when its own has nothing to run for
+ * the highest priority that has work.
+ */
+typedef struct {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    iot_shard_pri_t pri[GF_FOP_PRI_MAX];
+    int32_t queue_size;
+    int32_t sleep_count; /* workers of this shard waiting for work */
+    int32_t workers;     /* workers having this shard as home */
+    uint64_t stolen;     /* requests run by workers of other shards */
+} iot_shard_t;
+
+/* Updated atomically, without conf->mutex, except for ac_iot_limit */
+typedef struct {
+    int32_t ac_iot_limit;
+    int32_t ac_iot_count;
+    int queue_sizes; /* sum over all the shards */
     uint queue_marked;
 } iot_fop_data_t;
 
 struct iot_conf {
+    /* protects the set of workers, not the queues */
     pthread_mutex_t mutex;
     int32_t max_count;  /* configured maximum */
     int32_t curr_count; /* actual number of threads running */
-    int32_t sleep_count;
-    int32_t queue_size;
-    time_t idle_time; /* in seconds */
+    int32_t queue_size; /* sum over all the shards */
+    time_t idle_time;   /* in seconds */
     pthread_cond_t cond;
+    iot_shard_t *shards;
+    int32_t shard_count;
+    int32_t shards_inited;
+    uint32_t shard_rotor; /* picks the shard of requests with no client */
     gf_atomic_t stub_cnt;
     uint32_t down;               /*PARENT_DOWN event is notified*/
     gf_boolean_t least_priority; /*Enable/Disable least-priority */
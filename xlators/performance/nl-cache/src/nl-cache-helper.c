@@ -26,6 +26,12 @@
  *        Freed on receiving upcall(with dentry change flag) or on expiring
  *        timeout of the cache.
  *
+ *      - Filter of names: Bloom filter of all the names in the directory,
+ *        returned by the lookup of the directory when nl-cache-filter-size
+ *        is set. A name which doesn't pass it is not in the directory. The
+ *        creates done through this client add their names to it.
+ *        Freed like the negative entries.
+ *
  *      - Positive entries: Populated as a part of readdirp, and as a part of
  *        mkdir followed by creates inside that directory. Lookups and other
  *        fops do not populate the positive entry (as it can grow long and is
@@ -204,6 +210,7 @@ nlc_inode_ctx_get(xlator_t *this, inode_t *inode, nlc_ctx_t **nlc_ctx_p)
 static void
 __nlc_inode_clear_entries(xlator_t *this, nlc_ctx_t *nlc_ctx)
 {
+    nlc_conf_t *conf = this->private;
     nlc_pe_t *pe = NULL;
     nlc_pe_t *tmp = NULL;
     nlc_ne_t *ne = NULL;
@@ -224,6 +231,16 @@ __nlc_inode_clear_entries(xlator_t *this, nlc_ctx_t *nlc_ctx)
             __nlc_free_ne(this, nlc_ctx, ne);
         }
 
+    if (nlc_ctx->filter) {
+        nlc_ctx->cache_size -= gf_names_filter_len(nlc_ctx->filter);
+        GF_ATOMIC_SUB(conf->current_cache_size,
+                      gf_names_filter_len(nlc_ctx->filter));
+        GF_FREE(nlc_ctx->filter);
+        nlc_ctx->filter = NULL;
+    }
+
+    /* Drops the filters requested before */
+    nlc_ctx->gen++;
     nlc_ctx->cache_time = 0;
     nlc_ctx->state = 0;
     GF_ASSERT(nlc_ctx->cache_size == sizeof(*nlc_ctx));
@@ -958,6 +975,97 @@ out:
     return;
 }
 
+/* Whether the lookup of a directory should ask for the filter of its names.
+ * 'gen' tells nlc_dir_set_filter() whether the cache was cleared since. */
+gf_boolean_t
+nlc_dir_filter_req(xlator_t *this, inode_t *inode, uint64_t *gen)
+{
+    nlc_conf_t *conf = this->private;
+    nlc_ctx_t *nlc_ctx = NULL;
+    gf_boolean_t req = _gf_false;
+
+    if (!IS_FILTER_ENABLED(conf) || (inode->ia_type != IA_IFDIR))
+        goto out;
+
+    nlc_inode_ctx_get_set(this, inode, &nlc_ctx);
+    if (!nlc_ctx)
+        goto out;
+
+    LOCK(&nlc_ctx->lock);
+    {
+        if (!nlc_ctx->filter) {
+            *gen = nlc_ctx->gen;
+            req = _gf_true;
+        }
+    }
+    UNLOCK(&nlc_ctx->lock);
+out:
+    return req;
+}
+
+void
+nlc_dir_set_filter(xlator_t *this, inode_t *inode, uint64_t gen,
+                   data_t *data)
+{
+    nlc_conf_t *conf = this->private;
+    nlc_ctx_t *nlc_ctx = NULL;
+    gf_names_filter_t *filter = NULL;
+    size_t size = 0;
+
+    filter = gf_names_filter_from_data(data);
+    if (!filter)
+        goto out;
+
+    nlc_inode_ctx_get(this, inode, &nlc_ctx);
+    if (!nlc_ctx)
+        goto out;
+
+    LOCK(&nlc_ctx->lock);
+    {
+        /* An invalidation or a create of this client came after the
+         * filter was built, it may miss names. */
+        if ((nlc_ctx->gen != gen) || nlc_ctx->filter ||
+            !__nlc_is_cache_valid(this, nlc_ctx))
+            goto unlock;
+
+        size = gf_names_filter_len(filter);
+        nlc_ctx->filter = filter;
+        filter = NULL;
+
+        nlc_ctx->cache_size += size;
+        GF_ATOMIC_ADD(conf->current_cache_size, size);
+    }
+unlock:
+    UNLOCK(&nlc_ctx->lock);
+
+    if (size)
+        nlc_lru_prune(this, NULL);
+out:
+    GF_FREE(filter);
+    return;
+}
+
+void
+nlc_dir_filter_add(xlator_t *this, inode_t *inode, const char *name)
+{
+    nlc_ctx_t *nlc_ctx = NULL;
+
+    nlc_inode_ctx_get(this, inode, &nlc_ctx);
+    if (!nlc_ctx)
+        goto out;
+
+    LOCK(&nlc_ctx->lock);
+    {
+        if (nlc_ctx->filter)
+            gf_names_filter_add(nlc_ctx->filter, name);
+        else
+            nlc_ctx->gen++;
+    }
+    UNLOCK(&nlc_ctx->lock);
+out:
+    return;
+}
+
 gf_boolean_t
 __nlc_search_ne(nlc_ctx_t *nlc_ctx, const char *name)
 {
@@ -1035,6 +1143,7 @@ out:
 gf_boolean_t
 nlc_is_negative_lookup(xlator_t *this, loc_t *loc)
 {
+    nlc_conf_t *conf = this->private;
     nlc_ctx_t *nlc_ctx = NULL;
     inode_t *inode = NULL;
     gf_boolean_t neg_entry = _gf_false;
@@ -1066,6 +1175,12 @@ nlc_is_negative_lookup(xlator_t *this, loc_t *loc)
             neg_entry = _gf_true;
             goto unlock;
         }
+        if (nlc_ctx->filter &&
+            !gf_names_filter_has(nlc_ctx->filter, loc->name)) {
+            GF_ATOMIC_INC(conf->nlc_counter.filter_hit);
+            neg_entry = _gf_true;
+            goto unlock;
+        }
     }
 unlock:
     UNLOCK(&nlc_ctx->lock);
@@ -1124,6 +1239,13 @@ nlc_get_real_file_name(xlator_t *this, loc_t *loc, const char *fname,
             hit = _gf_true;
             goto unlock;
         }
+        if (nlc_ctx->filter &&
+            !gf_names_filter_has_nocase(nlc_ctx->filter, fname)) {
+            *op_ret = -1;
+            *op_errno = ENOENT;
+            hit = _gf_true;
+            goto unlock;
+        }
     }
 unlock:
     UNLOCK(&nlc_ctx->lock);
@@ -1176,6 +1298,9 @@ nlc_dump_inodectx(xlator_t *this, inode_t *inode)
         gf_proc_dump_write("cache-time", "%ld", nlc_ctx->cache_time);
         gf_proc_dump_write("cache-size", "%zu", nlc_ctx->cache_size);
         gf_proc_dump_write("refd-inodes", "%" PRIu64, nlc_ctx->refd_inodes);
+        if (nlc_ctx->filter)
+            gf_proc_dump_write("names-filter", "%zu bytes",
+                               gf_names_filter_len(nlc_ctx->filter));
 
         if (IS_PE_VALID(nlc_ctx->state))
             list_for_each_entry_safe(pe, tmp, &nlc_ctx->pe, list)
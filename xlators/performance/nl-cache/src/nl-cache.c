@@ -12,13 +12,41 @@
 #include <glusterfs/statedump.h>
 #include <glusterfs/upcall-utils.h>
 
+/* Keeps the filter of names of the parent right for the entries this
+ * client creates, no upcall comes for them. */
+static void
+nlc_dentry_filter_op(xlator_t *this, nlc_local_t *local)
+{
+    switch (local->fop) {
+        case GF_FOP_MKDIR:
+        case GF_FOP_MKNOD:
+        case GF_FOP_CREATE:
+        case GF_FOP_SYMLINK:
+        case GF_FOP_RENAME:
+            nlc_dir_filter_add(this, local->loc.parent, local->loc.name);
+            break;
+        case GF_FOP_LINK:
+            nlc_dir_filter_add(this, local->loc2.parent, local->loc2.name);
+            break;
+        default:
+            break;
+    }
+}
+
 static void
 nlc_dentry_op(call_frame_t *frame, xlator_t *this, gf_boolean_t multilink)
 {
     nlc_local_t *local = frame->local;
+    nlc_conf_t *conf = this->private;
 
     GF_VALIDATE_OR_GOTO(this->name, local, out);
 
+    if (IS_FILTER_ENABLED(conf))
+        nlc_dentry_filter_op(this, local);
+
+    if (!IS_PEC_ENABLED(conf))
+        goto out;
+
     switch (local->fop) {
         case GF_FOP_MKDIR:
             nlc_set_dir_state(this, local->loc.inode, NLC_PE_FULL);
@@ -65,7 +93,7 @@ out:
                                                                                \
         conf = this->private;                                                  \
                                                                                \
-        if (!IS_PEC_ENABLED(conf))                                             \
+        if (!IS_PEC_ENABLED(conf) && !IS_FILTER_ENABLED(conf))                 \
             goto disabled;                                                     \
                                                                                \
         __local = nlc_local_init(frame, this, _op, loc1, loc2);                \
@@ -92,7 +120,7 @@ out:
                                                                                \
         conf = this->private;                                                  \
                                                                                \
-        if (op_ret < 0 || !IS_PEC_ENABLED(conf))                               \
+        if (op_ret < 0 || (!IS_PEC_ENABLED(conf) && !IS_FILTER_ENABLED(conf))) \
             goto out;                                                          \
         nlc_dentry_op(frame, this, multilink);                                 \
     out:                                                                       \
@@ -200,6 +228,11 @@ nlc_lookup_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
         GF_ATOMIC_INC(conf->nlc_counter.nlc_miss);
     }
 
+    if ((op_ret == 0) && local->filter_req && xdata && buf &&
+        IA_ISDIR(buf->ia_type))
+        nlc_dir_set_filter(this, local->loc.inode, local->filter_gen,
+                           dict_get(xdata, GF_NAMES_FILTER_KEY));
+
 out:
     NLC_STACK_UNWIND(lookup, frame, op_ret, op_errno, inode, buf, xdata,
                      postparent);
@@ -212,6 +245,7 @@ nlc_lookup(call_frame_t *frame, xlator_t *this, loc_t *loc, dict_t *xdata)
     nlc_local_t *local = NULL;
     nlc_conf_t *conf = NULL;
     inode_t *inode = NULL;
+    dict_t *filter_xdata = NULL;
 
     if (loc_is_nameless(loc))
         goto wind;
@@ -238,8 +272,23 @@ nlc_lookup(call_frame_t *frame, xlator_t *this, loc_t *loc, dict_t *xdata)
     }
 
 wind:
+    /* Revalidating a directory: get the filter of its names if there is
+     * none yet */
+    if (local && nlc_dir_filter_req(this, loc->inode, &local->filter_gen)) {
+        filter_xdata = xdata ? dict_copy_with_ref(xdata, NULL) : dict_new();
+        if (filter_xdata &&
+            !dict_set_uint32(filter_xdata, GF_NAMES_FILTER_KEY,
+                             conf->filter_size)) {
+            local->filter_req = _gf_true;
+            xdata = filter_xdata;
+        }
+    }
+
     STACK_WIND(frame, nlc_lookup_cbk, FIRST_CHILD(this),
                FIRST_CHILD(this)->fops->lookup, loc, xdata);
+
+    if (filter_xdata)
+        dict_unref(filter_xdata);
     return 0;
 unwind:
     NLC_STACK_UNWIND(lookup, frame, -1, ENOENT, NULL, NULL, NULL, NULL);
@@ -604,6 +653,8 @@ nlc_priv_dump(xlator_t *this)
                        GF_ATOMIC_GET(conf->nlc_counter.ne_inode_cnt));
     gf_proc_dump_write("dentry_invalidations_received", "%" PRId64,
                        GF_ATOMIC_GET(conf->nlc_counter.nlc_invals));
+    gf_proc_dump_write("names_filter_hit_count", "%" PRId64,
+                       GF_ATOMIC_GET(conf->nlc_counter.filter_hit));
     gf_proc_dump_write("cache_limit", "%" PRIu64, conf->cache_size);
     gf_proc_dump_write("consumed_cache_size", "%" PRId64,
                        GF_ATOMIC_GET(conf->current_cache_size));
@@ -637,6 +688,8 @@ nlc_dump_metrics(xlator_t *this, int fd)
             this->name, GF_ATOMIC_GET(conf->nlc_counter.ne_inode_cnt));
     dprintf(fd, "%s.dentry_invalidations_received %" PRId64 "\n", this->name,
             GF_ATOMIC_GET(conf->nlc_counter.nlc_invals));
+    dprintf(fd, "%s.names_filter_hit_count %" PRId64 "\n", this->name,
+            GF_ATOMIC_GET(conf->nlc_counter.filter_hit));
     dprintf(fd, "%s.cache_limit %" PRIu64 "\n", this->name, conf->cache_size);
     dprintf(fd, "%s.consumed_cache_size %" PRId64 "\n", this->name,
             GF_ATOMIC_GET(conf->current_cache_size));
@@ -682,6 +735,8 @@ nlc_reconfigure(xlator_t *this, dict_t *options)
                      options, bool, out);
     GF_OPTION_RECONF("nl-cache-limit", conf->cache_size, options, size_uint64,
                      out);
+    GF_OPTION_RECONF("nl-cache-filter-size", conf->filter_size, options,
+                     size_uint64, out);
     GF_OPTION_RECONF("pass-through", this->pass_through, options, bool, out);
 
 out:
@@ -703,6 +758,7 @@ nlc_init(xlator_t *this)
     GF_OPTION_INIT("nl-cache-positive-entry", conf->positive_entry_cache, bool,
                    out);
     GF_OPTION_INIT("nl-cache-limit", conf->cache_size, size_uint64, out);
+    GF_OPTION_INIT("nl-cache-filter-size", conf->filter_size, size_uint64, out);
     GF_OPTION_INIT("pass-through", this->pass_through, bool, out);
 
     /* Since the positive entries are stored as list of refs on
@@ -727,6 +783,7 @@ nlc_init(xlator_t *this)
     GF_ATOMIC_INIT(conf->nlc_counter.pe_inode_cnt, 0);
     GF_ATOMIC_INIT(conf->nlc_counter.ne_inode_cnt, 0);
     GF_ATOMIC_INIT(conf->nlc_counter.nlc_invals, 0);
+    GF_ATOMIC_INIT(conf->nlc_counter.filter_hit, 0);
 
     INIT_LIST_HEAD(&conf->lru);
     conf->last_child_down = gf_time();
@@ -803,6 +860,19 @@ struct volume_options nlc_options[] = {
         .description = "the value over which caching will be disabled for"
                        "a while and the cache is cleared based on LRU",
     },
+    {
+        .key = {"nl-cache-filter-size"},
+        .type = GF_OPTION_TYPE_SIZET,
+        .min = 0,
+        .max = GF_NAMES_FILTER_MAX_SIZE,
+        .default_value = "0",
+        .op_version = {GD_OP_VERSION_11_0},
+        .flags = OPT_FLAG_SETTABLE | OPT_FLAG_CLIENT_OPT | OPT_FLAG_DOC,
+        .description = "Size of the filter of the names of a directory the "
+                       "bricks return, which answers the lookups of names "
+                       "not in it without going to the bricks. Needs "
+                       "features.cache-invalidation. 0 disables it.",
+    },
     {
         .key = {"nl-cache-timeout"},
         .type = GF_OPTION_TYPE_TIME,
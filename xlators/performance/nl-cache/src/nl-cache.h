@@ -15,6 +15,7 @@
 #include "nl-cache-messages.h"
 #include <glusterfs/defaults.h>
 #include <glusterfs/atomic.h>
+#include <glusterfs/names-filter.h>
 
 #define NLC_INVALID 0x0000
 #define NLC_PE_FULL 0x0001
@@ -27,6 +28,7 @@
 
 #define IS_PEC_ENABLED(conf) (conf->positive_entry_cache)
 #define IS_CACHE_ENABLED(conf) ((!conf->cache_disabled))
+#define IS_FILTER_ENABLED(conf) (conf->filter_size)
 
 #define NLC_STACK_UNWIND(fop, frame, params...)                                \
     do {                                                                       \
@@ -80,6 +82,8 @@ struct nlc_ctx {
     nlc_timer_data_t *timer_data;
     size_t cache_size;
     uint64_t refd_inodes;
+    gf_names_filter_t *filter; /* the names which may be in the dir */
+    uint64_t gen;              /* bumped every time the cache is cleared */
     gf_lock_t lock;
 };
 typedef struct nlc_ctx nlc_ctx_t;
@@ -92,6 +96,8 @@ struct nlc_local {
     fd_t *fd;
     char *linkname;
     glusterfs_fop_t fop;
+    uint64_t filter_gen;
+    gf_boolean_t filter_req;
 };
 typedef struct nlc_local nlc_local_t;
 
@@ -105,6 +111,7 @@ struct nlc_statistics {
     gf_atomic_t pe_inode_cnt;
     gf_atomic_t ne_inode_cnt;
     gf_atomic_t nlc_invals; /* No. of invalidates received from upcall*/
+    gf_atomic_t filter_hit; /* No. of negative lookups served by a filter */
 };
 
 struct nlc_conf {
@@ -115,6 +122,7 @@ struct nlc_conf {
     uint64_t cache_size;
     gf_atomic_t current_cache_size;
     uint64_t inode_limit;
+    uint64_t filter_size;
     gf_atomic_t refd_inodes;
     struct tvec_base *timer_wheel;
     time_t last_child_down;
@@ -145,6 +153,16 @@ nlc_dir_remove_pe(xlator_t *this, inode_t *inode, inode_t *entry_ino,
 void
 nlc_dir_add_ne(xlator_t *this, inode_t *inode, const char *name);
 
+gf_boolean_t
+nlc_dir_filter_req(xlator_t *this, inode_t *inode, uint64_t *gen);
+
+void
+nlc_dir_set_filter(xlator_t *this, inode_t *inode, uint64_t gen,
+                   data_t *data);
+
+void
+nlc_dir_filter_add(xlator_t *this, inode_t *inode, const char *name);
+
 void
 nlc_local_wipe(xlator_t *this, nlc_local_t *local);
 
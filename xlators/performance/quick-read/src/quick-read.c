@@ -19,8 +19,29 @@ typedef struct qr_local {
     inode_t *inode;
     uint64_t incident_gen;
     fd_t *fd;
+    gf_boolean_t shm_lookup; /* content left to the shared cache */
 } qr_local_t;
 
+/* A read of a file cached in chunks, the chunks it needs which are not
+ * cached yet being fetched in parallel. */
+typedef struct qr_fetch {
+    call_frame_t *frame; /* of the read */
+    fd_t *fd;
+    size_t size;
+    off_t offset;
+    uint32_t flags;
+    dict_t *xdata;
+    struct iatt stamp; /* attributes of the file the chunks are cached as of */
+    uint32_t chunk_size;
+    struct iobuf *iobuf;
+    size_t len; /* of the reply */
+    gf_lock_t lock;
+    int pending;
+    gf_boolean_t failed;
+    int count;
+    uint32_t missing[]; /* the chunks to fetch */
+} qr_fetch_t;
+
 qr_inode_t *
 qr_inode_ctx_get(xlator_t *this, inode_t *inode);
 
@@ -242,7 +263,7 @@ __qr_inode_register(xlator_t *this, qr_inode_table_t *table,
 {
     qr_private_t *priv = NULL;
 
-    if (!qr_inode->data)
+    if (!qr_inode->data && !qr_inode->chunks)
         return;
 
     priv = this->private;
@@ -299,12 +320,21 @@ __qr_inode_prune_data(xlator_t *this, qr_inode_table_t *table,
                       qr_inode_t *qr_inode)
 {
     qr_private_t *priv = NULL;
+    uint32_t i = 0;
 
     priv = this->private;
 
     GF_FREE(qr_inode->data);
     qr_inode->data = NULL;
 
+    if (qr_inode->chunks) {
+        for (i = 0; i < qr_inode->nchunks; i++)
+            GF_FREE(qr_inode->chunks[i]);
+        GF_FREE(qr_inode->chunks);
+        qr_inode->chunks = NULL;
+        qr_inode->nchunks = 0;
+    }
+
     if (!list_empty(&qr_inode->lru)) {
         table->cache_used -= qr_inode->size;
         qr_inode->size = 0;
@@ -462,6 +492,15 @@ qr_size_fits(qr_conf_t *conf, struct iatt *buf)
     return (buf->ia_size <= conf->max_file_size);
 }
 
+/* too large for the lookup to fetch, but cached in chunks */
+gf_boolean_t
+qr_chunked_fits(qr_conf_t *conf, struct iatt *buf)
+{
+    return ((buf->ia_type == IA_IFREG) && conf->max_chunked_file_size &&
+            (buf->ia_size > conf->max_file_size) &&
+            (buf->ia_size <= conf->max_chunked_file_size));
+}
+
 gf_boolean_t
 qr_mtime_equal(qr_inode_t *qr_inode, struct iatt *buf)
 {
@@ -511,7 +550,9 @@ __qr_content_refresh(xlator_t *this, qr_inode_t *qr_inode, struct iatt *buf,
 
     qr_inode->gen = gen;
 
-    if (qr_size_fits(conf, buf) && qr_time_equal(conf, qr_inode, buf)) {
+    if ((qr_inode->chunks ? (buf->ia_size == qr_inode->buf.ia_size)
+                          : qr_size_fits(conf, buf)) &&
+        qr_time_equal(conf, qr_inode, buf)) {
         qr_inode->buf = *buf;
         qr_inode->last_refresh = gf_time();
         __qr_inode_register(this, table, qr_inode);
@@ -540,6 +581,75 @@ qr_content_refresh(xlator_t *this, qr_inode_t *qr_inode, struct iatt *buf,
     UNLOCK(&table->lock);
 }
 
+/* Keeps the chunks of a file cached if it did not change, else starts over
+ * with no chunk cached, the reads fetching them as they need them. */
+void
+qr_chunks_refresh(xlator_t *this, qr_inode_t *qr_inode, struct iatt *buf,
+                  uint64_t gen)
+{
+    qr_private_t *priv = NULL;
+    qr_inode_table_t *table = NULL;
+    qr_conf_t *conf = NULL;
+    void **chunks = NULL;
+    uint32_t nchunks = 0;
+    uint32_t chunk_size = 0;
+    uint32_t rollover = 0;
+
+    rollover = gen >> 32;
+    gen = gen & 0xffffffff;
+
+    priv = this->private;
+    table = &priv->table;
+    conf = &priv->conf;
+
+    chunk_size = conf->chunk_size;
+    nchunks = (buf->ia_size + chunk_size - 1) / chunk_size;
+
+    /* a hint, checked again under the lock */
+    if (!qr_inode->chunks || !qr_time_equal(conf, qr_inode, buf))
+        chunks = GF_CALLOC(nchunks, sizeof(*chunks), gf_qr_mt_content_t);
+
+    LOCK(&table->lock);
+    {
+        if ((rollover != qr_inode->gen_rollover) ||
+            (gen && qr_inode->gen && (qr_inode->gen >= gen)))
+            goto unlock;
+
+        if (!qr_inode->chunks && (qr_inode->invalidation_time >= gen))
+            goto unlock;
+
+        if (qr_inode->chunks && (qr_inode->buf.ia_size == buf->ia_size) &&
+            qr_time_equal(conf, qr_inode, buf)) {
+            qr_inode->gen = gen;
+            qr_inode->buf = *buf;
+            qr_inode->last_refresh = gf_time();
+            __qr_inode_register(this, table, qr_inode);
+            goto unlock;
+        }
+
+        __qr_inode_prune(this, table, qr_inode, gen);
+        if (!chunks)
+            goto unlock;
+
+        qr_inode->chunks = chunks;
+        chunks = NULL;
+        qr_inode->nchunks = nchunks;
+        qr_inode->chunk_size = chunk_size;
+
+        qr_inode->ia_mtime = buf->ia_mtime;
+        qr_inode->ia_mtime_nsec = buf->ia_mtime_nsec;
+        qr_inode->ia_ctime = buf->ia_ctime;
+        qr_inode->ia_ctime_nsec = buf->ia_ctime_nsec;
+
+        qr_inode->buf = *buf;
+        qr_inode->last_refresh = gf_time();
+    }
+unlock:
+    UNLOCK(&table->lock);
+
+    GF_FREE(chunks);
+}
+
 gf_boolean_t
 __qr_cache_is_fresh(xlator_t *this, qr_inode_t *qr_inode)
 {
@@ -558,6 +668,105 @@ __qr_cache_is_fresh(xlator_t *this, qr_inode_t *qr_inode)
     return _gf_true;
 }
 
+/* The content of a file is kept in the shared cache as its block at offset
+ * 0, tagged with the time quick-read validates its own copy against. */
+static gf_boolean_t
+qr_shared_enabled(qr_private_t *priv)
+{
+    return (priv->shm_cache && priv->conf.shm_cache_size);
+}
+
+static void
+qr_shared_stamp(qr_conf_t *conf, struct iatt *buf, struct iatt *stamp)
+{
+    if (conf->ctime_invalidation) {
+        stamp->ia_mtime = buf->ia_ctime;
+        stamp->ia_mtime_nsec = buf->ia_ctime_nsec;
+    } else {
+        stamp->ia_mtime = buf->ia_mtime;
+        stamp->ia_mtime_nsec = buf->ia_mtime_nsec;
+    }
+}
+
+static void
+qr_shared_put(xlator_t *this, qr_inode_t *qr_inode, inode_t *inode,
+              void *content, struct iatt *buf)
+{
+    qr_private_t *priv = NULL;
+    struct iatt stamp = {
+        0,
+    };
+    struct iovec iov = {
+        0,
+    };
+
+    priv = this->private;
+    if (!qr_shared_enabled(priv))
+        return;
+
+    if (!buf->ia_size || (buf->ia_size > priv->shm_cache->block_size))
+        return;
+
+    qr_shared_stamp(&priv->conf, buf, &stamp);
+    iov.iov_base = content;
+    iov.iov_len = buf->ia_size;
+    gf_shm_cache_put(priv->shm_cache, inode->gfid, 0, &stamp, &iov, 1);
+
+    qr_inode->shm_miss = _gf_false;
+}
+
+/* Looks up the content of a file the lookup did not fetch from the shared
+ * cache, remembering a miss for the next lookup to fetch it. */
+static gf_boolean_t
+qr_shared_get(xlator_t *this, inode_t *inode, struct iatt *buf, uint64_t gen)
+{
+    qr_private_t *priv = NULL;
+    qr_inode_t *qr_inode = NULL;
+    void *content = NULL;
+    struct iatt stamp = {
+        0,
+    };
+    ssize_t ret = -1;
+
+    priv = this->private;
+
+    if ((buf->ia_type != IA_IFREG) || !qr_size_fits(&priv->conf, buf))
+        return _gf_false;
+
+    qr_inode = qr_inode_ctx_get_or_new(this, inode);
+    if (!qr_inode)
+        return _gf_false;
+
+    if (buf->ia_size && (buf->ia_size <= priv->shm_cache->block_size)) {
+        content = GF_MALLOC(buf->ia_size, gf_qr_mt_content_t);
+        if (!content)
+            return _gf_false;
+
+        qr_shared_stamp(&priv->conf, buf, &stamp);
+        ret = gf_shm_cache_get(priv->shm_cache, inode->gfid, 0, &stamp,
+                               content, buf->ia_size);
+    }
+
+    if (ret != buf->ia_size) {
+        GF_FREE(content);
+        qr_inode->shm_miss = _gf_true;
+        return _gf_false;
+    }
+
+    qr_content_update(this, qr_inode, content, buf, gen);
+    return _gf_true;
+}
+
+static void
+qr_shared_invalidate(xlator_t *this, inode_t *inode)
+{
+    qr_private_t *priv = NULL;
+
+    priv = this->private;
+    if (priv->shm_cache)
+        gf_shm_cache_invalidate(priv->shm_cache, inode->gfid, 0, 1);
+}
+
 static int
 qr_lookup_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int32_t op_ret,
               int32_t op_errno, inode_t *inode_ret, struct iatt *buf,
@@ -567,9 +776,11 @@ qr_lookup_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int32_t op_ret,
     qr_inode_t *qr_inode = NULL;
     inode_t *inode = NULL;
     qr_local_t *local = NULL;
+    qr_private_t *priv = NULL;
 
     local = frame->local;
     inode = local->inode;
+    priv = this->private;
 
     if (op_ret == -1) {
         qr_inode_prune(this, inode, local->incident_gen);
@@ -592,7 +803,17 @@ qr_lookup_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int32_t op_ret,
             goto out;
         }
 
+        qr_shared_put(this, qr_inode, inode, content, buf);
         qr_content_update(this, qr_inode, content, buf, local->incident_gen);
+    } else if (local->shm_lookup &&
+               qr_shared_get(this, inode, buf, local->incident_gen)) {
+        /* content from the shared cache */
+    } else if (qr_chunked_fits(&priv->conf, buf)) {
+        qr_inode = qr_inode_ctx_get_or_new(this, inode);
+        if (!qr_inode)
+            goto out;
+
+        qr_chunks_refresh(this, qr_inode, buf, local->incident_gen);
     } else {
         /* purge old content if necessary */
         qr_inode = qr_inode_ctx_get(this, inode);
@@ -627,14 +848,20 @@ qr_lookup(call_frame_t *frame, xlator_t *this, loc_t *loc, dict_t *xdata)
         /* cached. only validate in qr_lookup_cbk */
         goto wind;
 
+    priv = this->private;
+    conf = &priv->conf;
+    if (qr_shared_enabled(priv) && !(qr_inode && qr_inode->shm_miss)) {
+        /* try the shared cache with the attributes of the reply first */
+        local->shm_lookup = _gf_true;
+        goto wind;
+    }
+
     if (!xdata) {
         xdata = new_xdata = dict_new();
         if (!xdata)
             goto wind;
     }
 
-    priv = this->private;
-    conf = &priv->conf;
     if (conf->max_file_size) {
         ret = dict_set_sizen(xdata, GF_CONTENT_KEY,
                              data_from_uint64(conf->max_file_size));
@@ -776,17 +1003,355 @@ unlock:
     return op_ret;
 }
 
+static size_t
+qr_chunk_len(uint64_t file_size, uint32_t chunk_size, uint32_t index)
+{
+    return min(chunk_size, file_size - (uint64_t)index * chunk_size);
+}
+
+/* Copies what the chunk at start holds of [offset, offset + size) to buf. */
+static void
+qr_chunk_copy(char *buf, off_t offset, size_t size, off_t start, char *chunk,
+              size_t len)
+{
+    off_t from = 0;
+    off_t to = 0;
+
+    from = max(start, offset);
+    to = min(start + len, offset + size);
+    if (from < to)
+        memcpy(buf + (from - offset), chunk + (from - start), to - from);
+}
+
+static gf_boolean_t
+qr_stamp_equal(qr_conf_t *conf, struct iatt *stamp, struct iatt *buf)
+{
+    if (conf->ctime_invalidation)
+        return (stamp->ia_ctime == buf->ia_ctime &&
+                stamp->ia_ctime_nsec == buf->ia_ctime_nsec);
+    else
+        return (stamp->ia_mtime == buf->ia_mtime &&
+                stamp->ia_mtime_nsec == buf->ia_mtime_nsec);
+}
+
+/* Caches a chunk fetched as of stamp, unless the file changed meanwhile. */
+static void
+qr_chunk_store(xlator_t *this, inode_t *inode, uint32_t index, char *chunk,
+               size_t len, uint32_t chunk_size, struct iatt *stamp)
+{
+    qr_private_t *priv = NULL;
+    qr_inode_table_t *table = NULL;
+    qr_inode_t *qr_inode = NULL;
+    gf_boolean_t listed = _gf_false;
+
+    priv = this->private;
+    table = &priv->table;
+
+    qr_inode = qr_inode_ctx_get(this, inode);
+    if (!qr_inode)
+        goto out;
+
+    LOCK(&table->lock);
+    {
+        if (!qr_inode->chunks || (qr_inode->chunk_size != chunk_size) ||
+            (index >= qr_inode->nchunks) || qr_inode->chunks[index] ||
+            (qr_inode->buf.ia_size != stamp->ia_size) ||
+            !qr_time_equal(&priv->conf, qr_inode, stamp))
+            goto unlock;
+
+        qr_inode->chunks[index] = chunk;
+        chunk = NULL;
+
+        listed = !list_empty(&qr_inode->lru);
+        qr_inode->size += len;
+        if (listed)
+            table->cache_used += len;
+
+        __qr_inode_register(this, table, qr_inode);
+    }
+unlock:
+    UNLOCK(&table->lock);
+
+    qr_cache_prune(this);
+out:
+    GF_FREE(chunk);
+}
+
+static void
+qr_fetch_free(qr_fetch_t *fetch)
+{
+    fd_unref(fetch->fd);
+    if (fetch->xdata)
+        dict_unref(fetch->xdata);
+    iobuf_unref(fetch->iobuf);
+    LOCK_DESTROY(&fetch->lock);
+    GF_FREE(fetch);
+}
+
+/* Answers the read once all its chunks are in, or sends it on to the
+ * bricks as it came if one of them could not be fetched. */
+static void
+qr_fetch_done(xlator_t *this, qr_fetch_t *fetch)
+{
+    call_frame_t *frame = NULL;
+    struct iobref *iobref = NULL;
+    struct iovec iov = {
+        0,
+    };
+    int pending = 0;
+
+    LOCK(&fetch->lock);
+    {
+        pending = --fetch->pending;
+    }
+    UNLOCK(&fetch->lock);
+
+    if (pending)
+        return;
+
+    frame = fetch->frame;
+
+    if (!fetch->failed)
+        iobref = iobref_new();
+
+    if (iobref) {
+        iobref_add(iobref, fetch->iobuf);
+        iov.iov_base = fetch->iobuf->ptr;
+        iov.iov_len = fetch->len;
+
+        STACK_UNWIND_STRICT(readv, frame, fetch->len, 0, &iov, 1,
+                            &fetch->stamp, iobref, NULL);
+        iobref_unref(iobref);
+    } else {
+        STACK_WIND(frame, default_readv_cbk, FIRST_CHILD(this),
+                   FIRST_CHILD(this)->fops->readv, fetch->fd, fetch->size,
+                   fetch->offset, fetch->flags, fetch->xdata);
+    }
+
+    qr_fetch_free(fetch);
+}
+
+static int32_t
+qr_chunk_readv_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
+                   int32_t op_ret, int32_t op_errno, struct iovec *vector,
+                   int32_t count, struct iatt *stbuf, struct iobref *iobref,
+                   dict_t *xdata)
+{
+    qr_private_t *priv = NULL;
+    qr_fetch_t *fetch = NULL;
+    uint32_t index = 0;
+    char *chunk = NULL;
+    size_t len = 0;
+
+    priv = this->private;
+    fetch = frame->local;
+    frame->local = NULL;
+    index = (uint32_t)(long)cookie;
+
+    len = qr_chunk_len(fetch->stamp.ia_size, fetch->chunk_size, index);
+
+    /* short, or read from a file which changed */
+    if ((op_ret != len) || !stbuf ||
+        !qr_stamp_equal(&priv->conf, &fetch->stamp, stbuf))
+        goto failed;
+
+    chunk = GF_MALLOC(len, gf_qr_mt_content_t);
+    if (!chunk)
+        goto failed;
+
+    iov_unload(chunk, vector, count);
+    qr_chunk_copy(fetch->iobuf->ptr, fetch->offset, fetch->len,
+                  (off_t)index * fetch->chunk_size, chunk, len);
+
+    GF_ATOMIC_INC(priv->qr_counter.chunks_fetched);
+    qr_chunk_store(this, fetch->fd->inode, index, chunk, len,
+                   fetch->chunk_size, &fetch->stamp);
+    goto out;
+
+failed:
+    LOCK(&fetch->lock);
+    {
+        fetch->failed = _gf_true;
+    }
+    UNLOCK(&fetch->lock);
+out:
+    STACK_DESTROY(frame->root);
+    qr_fetch_done(this, fetch);
+    return 0;
+}
+
+/* Serves a read of a file cached in chunks from the chunks it covers,
+ * fetching those which are not cached in parallel. */
+int
+qr_readv_chunked(call_frame_t *frame, qr_inode_t *qr_inode, fd_t *fd,
+                 size_t size, off_t offset, uint32_t flags, dict_t *xdata)
+{
+    xlator_t *this = NULL;
+    qr_private_t *priv = NULL;
+    qr_inode_table_t *table = NULL;
+    qr_fetch_t *fetch = NULL;
+    call_frame_t *chunk_frame = NULL;
+    struct iobuf *iobuf = NULL;
+    struct iobref *iobref = NULL;
+    struct iovec iov = {
+        0,
+    };
+    struct iatt buf = {
+        0,
+    };
+    uint64_t file_size = 0;
+    uint32_t chunk_size = 0;
+    uint32_t first = 0;
+    uint32_t last = 0;
+    uint32_t index = 0;
+    size_t len = 0;
+    int missing = 0;
+    int op_ret = -1;
+    int i = 0;
+
+    this = frame->this;
+    priv = this->private;
+    table = &priv->table;
+
+    LOCK(&table->lock);
+    {
+        if (!size || !qr_inode->chunks || (offset >= qr_inode->buf.ia_size))
+            goto unlock;
+
+        if (!__qr_cache_is_fresh(this, qr_inode))
+            goto unlock;
+
+        file_size = qr_inode->buf.ia_size;
+        chunk_size = qr_inode->chunk_size;
+        len = min(size, (file_size - offset));
+        first = offset / chunk_size;
+        last = (offset + len - 1) / chunk_size;
+
+        for (index = first; index <= last; index++) {
+            if (!qr_inode->chunks[index])
+                missing++;
+        }
+
+        iobuf = iobuf_get2(this->ctx->iobuf_pool, len);
+        if (!iobuf)
+            goto unlock;
+
+        if (missing) {
+            fetch = GF_CALLOC(1, sizeof(*fetch) + missing * sizeof(uint32_t),
+                              gf_qr_mt_qr_fetch_t);
+            if (!fetch)
+                goto unlock;
+        }
+
+        missing = 0;
+        for (index = first; index <= last; index++) {
+            if (qr_inode->chunks[index])
+                qr_chunk_copy(iobuf->ptr, offset, len,
+                              (off_t)index * chunk_size,
+                              qr_inode->chunks[index],
+                              qr_chunk_len(file_size, chunk_size, index));
+            else
+                fetch->missing[missing++] = index;
+        }
+
+        buf = qr_inode->buf;
+
+        /* bump LRU */
+        __qr_inode_register(this, table, qr_inode);
+        op_ret = len;
+    }
+unlock:
+    UNLOCK(&table->lock);
+
+    if (op_ret < 0) {
+        if (iobuf)
+            iobuf_unref(iobuf);
+        GF_ATOMIC_INC(priv->qr_counter.cache_miss);
+        return op_ret;
+    }
+
+    if (!fetch) {
+        iobref = iobref_new();
+        if (!iobref) {
+            iobuf_unref(iobuf);
+            return -1;
+        }
+
+        iobref_add(iobref, iobuf);
+        iov.iov_base = iobuf->ptr;
+        iov.iov_len = op_ret;
+
+        GF_ATOMIC_INC(priv->qr_counter.cache_hit);
+        STACK_UNWIND_STRICT(readv, frame, op_ret, 0, &iov, 1, &buf, iobref,
+                            NULL);
+
+        iobref_unref(iobref);
+        iobuf_unref(iobuf);
+        return op_ret;
+    }
+
+    GF_ATOMIC_INC(priv->qr_counter.cache_miss);
+
+    fetch->frame = frame;
+    fetch->fd = fd_ref(fd);
+    fetch->size = size;
+    fetch->offset = offset;
+    fetch->flags = flags;
+    if (xdata)
+        fetch->xdata = dict_ref(xdata);
+    fetch->stamp = buf;
+    fetch->chunk_size = chunk_size;
+    fetch->iobuf = iobuf;
+    fetch->len = len;
+    LOCK_INIT(&fetch->lock);
+    fetch->count = missing;
+    /* one more, dropped once all the fetches are sent */
+    fetch->pending = missing + 1;
+
+    for (i = 0; i < fetch->count; i++) {
+        chunk_frame = copy_frame(frame);
+        if (!chunk_frame) {
+            LOCK(&fetch->lock);
+            {
+                fetch->failed = _gf_true;
+                fetch->pending -= fetch->count - i;
+            }
+            UNLOCK(&fetch->lock);
+            break;
+        }
+
+        index = fetch->missing[i];
+        chunk_frame->local = fetch;
+        STACK_WIND_COOKIE(chunk_frame, qr_chunk_readv_cbk,
+                          (void *)(long)index, FIRST_CHILD(this),
+                          FIRST_CHILD(this)->fops->readv, fd,
+                          qr_chunk_len(file_size, chunk_size, index),
+                          (off_t)index * chunk_size, flags, NULL);
+    }
+
+    qr_fetch_done(this, fetch);
+    return op_ret;
+}
+
 int
 qr_readv(call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
          off_t offset, uint32_t flags, dict_t *xdata)
 {
     qr_inode_t *qr_inode = NULL;
+    int ret = -1;
 
     qr_inode = qr_inode_ctx_get(this, fd->inode);
     if (!qr_inode)
         goto wind;
 
-    if (qr_readv_cached(frame, qr_inode, size, offset, flags, xdata) < 0)
+    /* both check again under the lock of the table */
+    if (qr_inode->chunks)
+        ret = qr_readv_chunked(frame, qr_inode, fd, size, offset, flags,
+                               xdata);
+    else
+        ret = qr_readv_cached(frame, qr_inode, size, offset, flags, xdata);
+
+    if (ret < 0)
         goto wind;
 
     return 0;
@@ -806,6 +1371,7 @@ qr_writev_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int32_t op_ret,
     local = frame->local;
 
     qr_inode_prune(this, local->fd->inode, local->incident_gen);
+    qr_shared_invalidate(this, local->fd->inode);
 
     QR_STACK_UNWIND(writev, frame, op_ret, op_errno, prebuf, postbuf, xdata);
     return 0;
@@ -838,6 +1404,7 @@ qr_truncate_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
 
     local = frame->local;
     qr_inode_prune(this, local->inode, local->incident_gen);
+    qr_shared_invalidate(this, local->inode);
 
     QR_STACK_UNWIND(truncate, frame, op_ret, op_errno, prebuf, postbuf, xdata);
     return 0;
@@ -867,6 +1434,7 @@ qr_ftruncate_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
 
     local = frame->local;
     qr_inode_prune(this, local->fd->inode, local->incident_gen);
+    qr_shared_invalidate(this, local->fd->inode);
 
     QR_STACK_UNWIND(ftruncate, frame, op_ret, op_errno, prebuf, postbuf, xdata);
     return 0;
@@ -896,6 +1464,7 @@ qr_fallocate_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
 
     local = frame->local;
     qr_inode_prune(this, local->fd->inode, local->incident_gen);
+    qr_shared_invalidate(this, local->fd->inode);
 
     QR_STACK_UNWIND(fallocate, frame, op_ret, op_errno, pre, post, xdata);
     return 0;
@@ -926,6 +1495,7 @@ qr_discard_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
 
     local = frame->local;
     qr_inode_prune(this, local->fd->inode, local->incident_gen);
+    qr_shared_invalidate(this, local->fd->inode);
 
     QR_STACK_UNWIND(discard, frame, op_ret, op_errno, pre, post, xdata);
     return 0;
@@ -955,6 +1525,7 @@ qr_zerofill_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
 
     local = frame->local;
     qr_inode_prune(this, local->fd->inode, local->incident_gen);
+    qr_shared_invalidate(this, local->fd->inode);
 
     QR_STACK_UNWIND(zerofill, frame, op_ret, op_errno, pre, post, xdata);
     return 0;
@@ -1025,6 +1596,8 @@ qr_inodectx_dump(xlator_t *this, inode_t *inode)
 
     gf_proc_dump_write("entire-file-cached", "%s",
                        qr_inode->data ? "yes" : "no");
+    if (qr_inode->chunks)
+        gf_proc_dump_write("chunks", "%" PRIu32, qr_inode->nchunks);
 
     if (qr_inode->last_refresh) {
         gf_time_fmt_FT(buf, sizeof buf, qr_inode->last_refresh);
@@ -1086,6 +1659,10 @@ qr_priv_dump(xlator_t *this)
                        GF_ATOMIC_GET(priv->qr_counter.cache_miss));
     gf_proc_dump_write("cache-invalidations", "%" GF_PRI_ATOMIC,
                        GF_ATOMIC_GET(priv->qr_counter.file_data_invals));
+    gf_proc_dump_write("chunks-fetched", "%" GF_PRI_ATOMIC,
+                       GF_ATOMIC_GET(priv->qr_counter.chunks_fetched));
+    if (priv->shm_cache)
+        gf_shm_cache_dump(priv->shm_cache, "shared-cache");
 
 out:
     return 0;
@@ -1110,6 +1687,8 @@ qr_dump_metrics(xlator_t *this, int fd)
             GF_ATOMIC_GET(priv->qr_counter.cache_miss));
     dprintf(fd, "%s.cache-invalidations %" PRId64 "\n", this->name,
             GF_ATOMIC_GET(priv->qr_counter.file_data_invals));
+    dprintf(fd, "%s.chunks-fetched %" PRId64 "\n", this->name,
+            GF_ATOMIC_GET(priv->qr_counter.chunks_fetched));
 
     return 0;
 }
@@ -1170,6 +1749,24 @@ out:
     return ret;
 }
 
+/* The shared cache is not unmapped before fini, lookups in flight may be
+ * reading from it. */
+static void
+qr_shared_open(xlator_t *this, qr_private_t *priv)
+{
+    if (!priv->conf.shm_cache_size || priv->shm_cache)
+        return;
+
+    priv->shm_cache = gf_shm_cache_open(this->name, priv->conf.shm_cache_size,
+                                        this->ctx->page_size);
+    if (!priv->shm_cache)
+        gf_msg(this->name, GF_LOG_WARNING, 0,
+               QUICK_READ_MSG_SHARED_CACHE_FAILED,
+               "could not map the shared cache of %" PRIu64
+               " bytes, continuing without it",
+               priv->conf.shm_cache_size);
+}
+
 int
 qr_reconfigure(xlator_t *this, dict_t *options)
 {
@@ -1206,6 +1803,16 @@ qr_reconfigure(xlator_t *this, dict_t *options)
     }
     conf->cache_size = cache_size_new;
 
+    GF_OPTION_RECONF("shared-cache-size", conf->shm_cache_size, options,
+                     size_uint64, out);
+    qr_shared_open(this, priv);
+
+    GF_OPTION_RECONF("max-chunked-file-size", conf->max_chunked_file_size,
+                     options, size_uint64, out);
+
+    GF_OPTION_RECONF("chunk-size", conf->chunk_size, options, size_uint64,
+                     out);
+
     ret = 0;
 out:
     return ret;
@@ -1354,6 +1961,14 @@ qr_init(xlator_t *this)
 
     GF_OPTION_INIT("ctime-invalidation", conf->ctime_invalidation, bool, out);
 
+    GF_OPTION_INIT("shared-cache-size", conf->shm_cache_size, size_uint64,
+                   out);
+
+    GF_OPTION_INIT("max-chunked-file-size", conf->max_chunked_file_size,
+                   size_uint64, out);
+
+    GF_OPTION_INIT("chunk-size", conf->chunk_size, size_uint64, out);
+
     INIT_LIST_HEAD(&conf->priority_list);
     conf->max_pri = 1;
     if (dict_get(this->options, "priority")) {
@@ -1383,6 +1998,7 @@ qr_init(xlator_t *this)
 
     priv->last_child_down = gf_time();
     GF_ATOMIC_INIT(priv->generation, 0);
+    qr_shared_open(this, priv);
     this->private = priv;
 out:
     if ((ret == -1) && priv) {
@@ -1471,6 +2087,7 @@ qr_invalidate(xlator_t *this, void *data)
             goto out;
         }
         qr_inode_prune(this, inode, qr_get_generation(this, inode));
+        qr_shared_invalidate(this, inode);
     }
 
 out:
@@ -1525,6 +2142,7 @@ qr_fini(xlator_t *this)
 
     qr_inode_table_destroy(priv);
     qr_conf_destroy(&priv->conf);
+    gf_shm_cache_close(priv->shm_cache);
     LOCK_DESTROY(&priv->lock);
 
     this->private = NULL;
@@ -1617,6 +2235,44 @@ struct volume_options qr_options[] = {
                        "changes to file data. So, use this only when mtime "
                        "is not reliable",
     },
+    {
+        .key = {"shared-cache-size"},
+        .type = GF_OPTION_TYPE_SIZET,
+        .min = 0,
+        .max = 32 * GF_UNIT_GB,
+        .default_value = "0",
+        .op_version = {GD_OP_VERSION_11_0},
+        .flags = OPT_FLAG_CLIENT_OPT | OPT_FLAG_SETTABLE | OPT_FLAG_DOC,
+        .description = "Size of a second cache tier in shared memory, holding "
+                       "the small files read by all the clients of the volume "
+                       "on this host. Lookups then take the content of a file "
+                       "from it instead of the bricks when it is there. 0 "
+                       "disables it.",
+    },
+    {
+        .key = {"max-chunked-file-size"},
+        .type = GF_OPTION_TYPE_SIZET,
+        .min = 0,
+        .max = 1 * GF_UNIT_GB,
+        .default_value = "0",
+        .op_version = {GD_OP_VERSION_11_0},
+        .flags = OPT_FLAG_CLIENT_OPT | OPT_FLAG_SETTABLE | OPT_FLAG_DOC,
+        .description = "Files larger than max-file-size, up to this size, "
+                       "are cached in chunks of chunk-size, fetched in "
+                       "parallel as the reads need them instead of with the "
+                       "lookup. 0 disables it.",
+    },
+    {
+        .key = {"chunk-size"},
+        .type = GF_OPTION_TYPE_SIZET,
+        .min = 4 * GF_UNIT_KB,
+        .max = 1 * GF_UNIT_MB,
+        .default_value = "128KB",
+        .op_version = {GD_OP_VERSION_11_0},
+        .flags = OPT_FLAG_CLIENT_OPT | OPT_FLAG_SETTABLE | OPT_FLAG_DOC,
+        .description = "Size of the chunks files larger than max-file-size "
+                       "are cached in.",
+    },
     {.key = {NULL}}};
 
 xlator_api_t xlator_api = {
@@ -23,6 +23,7 @@
 #include <sys/stat.h>
 #include <unistd.h>
 #include <fnmatch.h>
+#include <glusterfs/shm-cache.h>
 #include "quick-read-mem-types.h"
 
 struct qr_inode {
@@ -39,6 +40,11 @@ struct qr_inode {
     struct list_head lru;
     uint64_t gen;
     time_t invalidation_time;
+    gf_boolean_t shm_miss; /* not in the shared cache at the last lookup */
+    /* a file larger than max-file-size, cached in chunks as it is read */
+    void **chunks;
+    uint32_t nchunks;
+    uint32_t chunk_size;
 };
 typedef struct qr_inode qr_inode_t;
 
@@ -57,6 +63,9 @@ struct qr_conf {
     gf_boolean_t qr_invalidation;
     gf_boolean_t ctime_invalidation;
     struct list_head priority_list;
+    uint64_t shm_cache_size;
+    uint64_t max_chunked_file_size;
+    uint64_t chunk_size;
 };
 typedef struct qr_conf qr_conf_t;
 
@@ -72,6 +81,7 @@ struct qr_statistics {
     gf_atomic_t cache_miss;
     gf_atomic_t file_data_invals; /* No. of invalidates received from upcall */
     gf_atomic_t files_cached;
+    gf_atomic_t chunks_fetched;
 };
 
 struct qr_private {
@@ -81,6 +91,8 @@ struct qr_private {
     gf_lock_t lock;
     struct qr_statistics qr_counter;
     gf_atomic_int32_t generation;
+    gf_shm_cache_t *shm_cache; /* shared with the other clients of the
+                                * volume on this host */
 };
 typedef struct qr_private qr_private_t;
 
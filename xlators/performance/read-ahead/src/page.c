@@ -11,6 +11,7 @@
 #include <glusterfs/glusterfs.h>
 #include <glusterfs/logging.h>
 #include <glusterfs/dict.h>
+#include <glusterfs/timespec.h>
 #include "read-ahead.h"
 #include <assert.h>
 #include "read-ahead-messages.h"
@@ -133,6 +134,8 @@ ra_fault_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int32_t op_ret,
     ra_waitq_t *waitq = NULL;
     fd_t *fd = NULL;
     gf_boolean_t stale = _gf_false;
+    struct timespec now;
+    uint64_t rtt = 0;
 
     GF_ASSERT(frame);
 
@@ -152,11 +155,16 @@ ra_fault_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int32_t op_ret,
         goto out;
     }
 
+    timespec_now(&now);
+    rtt = gf_tsdiff(&local->start, &now) / 1000;
+
     ra_file_lock(file);
     {
         if (op_ret >= 0)
             file->stbuf = *stbuf;
 
+        file->rtt = file->rtt ? (file->rtt * 7 + rtt) / 8 : rtt;
+
         page = ra_page_get(file, pending_offset);
 
         if (!page) {
@@ -220,6 +228,7 @@ unlock:
     ra_file_unlock(file);
 
     if (stale) {
+        local->start = now;
         STACK_WIND(frame, ra_fault_cbk, FIRST_CHILD(frame->this),
                    FIRST_CHILD(frame->this)->fops->readv, local->fd,
                    local->pending_size, local->pending_offset, 0, NULL);
@@ -271,6 +280,7 @@ ra_page_fault(ra_file_t *file, call_frame_t *frame, off_t offset)
     fault_local->pending_size = file->page_size;
 
     fault_local->fd = fd_ref(file->fd);
+    timespec_now(&fault_local->start);
 
     STACK_WIND(fault_frame, ra_fault_cbk, FIRST_CHILD(fault_frame->this),
                FIRST_CHILD(fault_frame->this)->fops->readv, file->fd,
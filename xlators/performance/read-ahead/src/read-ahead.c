@@ -20,13 +20,11 @@
 #include <glusterfs/dict.h>
 #include "read-ahead.h"
 #include <glusterfs/statedump.h>
+#include <glusterfs/timespec.h>
 #include <assert.h>
 #include <sys/time.h>
 #include "read-ahead-messages.h"
 
-static void
-read_ahead(call_frame_t *frame, ra_file_t *file);
-
 int
 ra_open_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int32_t op_ret,
             int32_t op_errno, fd_t *fd, dict_t *xdata)
@@ -56,7 +54,8 @@ ra_open_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int32_t op_ret,
     if ((fd->flags & O_DIRECT) || ((fd->flags & O_ACCMODE) == O_WRONLY))
         file->disabled = 1;
 
-    file->offset = (unsigned long long)0;
+    /* the first read of a file is expected at its start */
+    file->streams[0].active = 1;
     file->conf = conf;
     file->pages.next = &file->pages;
     file->pages.prev = &file->pages;
@@ -73,14 +72,9 @@ ra_open_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int32_t op_ret,
     ra_conf_unlock(conf);
 
     file->fd = fd;
-    file->page_count = conf->page_count;
     file->page_size = conf->page_size;
     pthread_mutex_init(&file->file_lock, NULL);
 
-    if (!file->disabled) {
-        file->page_count = 1;
-    }
-
     ret = fd_ctx_set(fd, this, (uint64_t)(long)file);
     if (ret == -1) {
         gf_msg(frame->this->name, GF_LOG_WARNING, 0, READ_AHEAD_MSG_NO_MEMORY,
@@ -130,7 +124,7 @@ ra_create_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int32_t op_ret,
     if ((fd->flags & O_DIRECT) || ((fd->flags & O_ACCMODE) == O_WRONLY))
         file->disabled = 1;
 
-    file->offset = (unsigned long long)0;
+    file->streams[0].active = 1;
     // file->size = fd->inode->buf.ia_size;
     file->conf = conf;
     file->pages.next = &file->pages;
@@ -148,7 +142,6 @@ ra_create_cbk(call_frame_t *frame, void *cookie, xlator_t *this, int32_t op_ret,
     ra_conf_unlock(conf);
 
     file->fd = fd;
-    file->page_count = conf->page_count;
     file->page_size = conf->page_size;
     pthread_mutex_init(&file->file_lock, NULL);
 
@@ -248,65 +241,234 @@ out:
     return 0;
 }
 
-void
-read_ahead(call_frame_t *frame, ra_file_t *file)
+/* Finds the stream a read of size bytes at offset belongs to and moves it
+ * on to that read.  Returns the stream if the read confirmed it, NULL for
+ * reads which are not (yet) part of a pattern. */
+static ra_stream_t *
+__ra_stream_update(ra_file_t *file, off_t offset, size_t size)
 {
-    off_t ra_offset = 0;
-    size_t ra_size = 0;
-    off_t trav_offset = 0;
-    ra_page_t *trav = NULL;
-    off_t cap = 0;
-    char fault = 0;
+    ra_stream_t *stream = NULL;
+    ra_stream_t *near = NULL;
+    ra_stream_t *victim = NULL;
+    struct timespec now;
+    off_t max_stride = 0;
+    off_t distance = 0;
+    uint64_t interval = 0;
+    int i = 0;
 
-    GF_VALIDATE_OR_GOTO("read-ahead", frame, out);
-    GF_VALIDATE_OR_GOTO(frame->this->name, file, out);
+    timespec_now(&now);
+    file->reads++;
+    max_stride = file->page_size * RA_MAX_STRIDE_PAGES;
 
-    if (!file->page_count) {
-        goto out;
-    }
+    for (i = 0; i < RA_MAX_STREAMS; i++) {
+        stream = &file->streams[i];
+        if (!stream->active) {
+            if (!victim || victim->active)
+                victim = stream;
+            continue;
+        }
 
-    ra_size = file->page_size * file->page_count;
-    ra_offset = gf_floor(file->offset, file->page_size);
-    cap = file->size ? file->size : file->offset + ra_size;
+        if (offset == stream->offset + stream->stride)
+            goto found;
 
-    while (ra_offset < min(file->offset + ra_size, cap)) {
-        ra_file_lock(file);
-        {
-            trav = ra_page_get(file, ra_offset);
+        distance = offset - stream->offset;
+        if (!distance) {
+            /* the same read again, nothing to learn from it */
+            stream->last_used = file->reads;
+            return NULL;
         }
-        ra_file_unlock(file);
 
-        if (!trav)
-            break;
+        if (!stream->window && distance >= -max_stride &&
+            distance <= max_stride)
+            near = stream;
 
-        ra_offset += file->page_size;
+        if (!victim ||
+            (victim->active && stream->last_used < victim->last_used))
+            victim = stream;
     }
 
-    if (trav) {
-        /* comfortable enough */
-        goto out;
+    if (near) {
+        /* a second read close to an unconfirmed one: guess the stride,
+         * the next read will tell */
+        stream = near;
+        stream->stride = offset - stream->offset;
+    } else {
+        stream = victim;
+        stream->active = 1;
+        stream->stride = size;
+        stream->window = 0;
+        stream->hits = 0;
+        stream->interval = 0;
+    }
+
+    stream->offset = offset;
+    stream->size = size;
+    stream->last = now;
+    stream->last_used = file->reads;
+
+    return NULL;
+
+found:
+    /* sequential streams follow the size of the reads */
+    if (stream->stride == (off_t)stream->size)
+        stream->stride = size;
+
+    if (!stream->window)
+        stream->window = 1;
+
+    if (stream->hits) {
+        interval = gf_tsdiff(&stream->last, &now) / 1000;
+        stream->interval = stream->interval
+                               ? (stream->interval * 7 + interval) / 8
+                               : interval;
+    }
+    stream->hits++;
+
+    stream->offset = offset;
+    stream->size = size;
+    stream->last = now;
+    stream->last_used = file->reads;
+
+    return stream;
+}
+
+/* Reads of a strided stream whose pages fit in page-count pages, each read
+ * counted with the page an unaligned offset makes it straddle */
+static uint32_t
+ra_stream_max_reads(ra_file_t *file, ra_stream_t *stream)
+{
+    uint64_t pages = 0;
+
+    pages = (stream->size + file->page_size - 1) / file->page_size + 1;
+
+    return file->conf->page_count / pages;
+}
+
+/* Widens the window of a stream when its last read was not served entirely
+ * from read ahead pages, and keeps it as wide as the reads arriving within
+ * one page fault round trip need otherwise. */
+static void
+__ra_stream_adapt(ra_file_t *file, ra_stream_t *stream, ra_local_t *local)
+{
+    uint32_t max = file->conf->page_count;
+    uint64_t target = 0;
+
+    /* the window of a strided stream counts reads, not pages */
+    if (stream->stride != (off_t)stream->size)
+        max = max(ra_stream_max_reads(file, stream), 1);
+
+    if (local->missed || local->waited) {
+        stream->window *= 2;
+    } else if (stream->interval) {
+        target = file->rtt / stream->interval + 1;
+        if (stream->stride == (off_t)stream->size)
+            target = (target * stream->size + file->page_size - 1) /
+                     file->page_size;
+
+        if (stream->window < target)
+            stream->window++;
+    }
+
+    if (stream->window > max)
+        stream->window = max;
+}
+
+/* Range of the file a stream is going to read, its last read included */
+static void
+ra_stream_range(ra_file_t *file, ra_stream_t *stream, off_t *start,
+                off_t *end)
+{
+    *start = stream->offset;
+    *end = stream->offset + stream->size;
+
+    if (!stream->window)
+        return;
+
+    if (stream->stride == (off_t)stream->size)
+        *end += stream->window * file->page_size;
+    else if (stream->stride > 0)
+        *end += stream->stride * (off_t)stream->window;
+    else
+        *start += stream->stride * (off_t)stream->window;
+}
+
+/* Drops the pages none of the streams is going to read.  Pages which were
+ * read ahead but never read are wasted, and narrow the window of the stream
+ * they were read ahead for. */
+static void
+__ra_prune_pages(ra_file_t *file)
+{
+    ra_page_t *trav = NULL;
+    ra_page_t *next = NULL;
+    off_t start[RA_MAX_STREAMS];
+    off_t end[RA_MAX_STREAMS];
+    int i = 0;
+
+    for (i = 0; i < RA_MAX_STREAMS; i++) {
+        start[i] = end[i] = 0;
+        if (file->streams[i].active)
+            ra_stream_range(file, &file->streams[i], &start[i], &end[i]);
+    }
+
+    for (trav = file->pages.next; trav != &file->pages; trav = next) {
+        next = trav->next;
+
+        if (trav->waitq)
+            continue;
+
+        for (i = 0; i < RA_MAX_STREAMS; i++) {
+            if (trav->offset < end[i] &&
+                trav->offset + (off_t)file->page_size > start[i])
+                break;
+        }
+        if (i < RA_MAX_STREAMS)
+            continue;
+
+        if (trav->dirty) {
+            file->prefetch_wasted++;
+            if (trav->stream && trav->stream->window > 1)
+                trav->stream->window /= 2;
+        }
+
+        ra_page_purge(trav);
     }
+}
 
-    trav_offset = ra_offset;
+static void
+ra_prefetch_range(call_frame_t *frame, ra_file_t *file, ra_stream_t *stream,
+                  off_t offset, off_t end)
+{
+    off_t trav_offset = 0;
+    ra_page_t *trav = NULL;
+    char fault = 0;
 
-    cap = file->size ? file->size : ra_offset + ra_size;
+    trav_offset = gf_floor(max(offset, 0), file->page_size);
 
-    while (trav_offset < min(ra_offset + ra_size, cap)) {
+    while (trav_offset < end) {
         fault = 0;
         ra_file_lock(file);
         {
+            if (file->stbuf.ia_size && trav_offset >= file->stbuf.ia_size) {
+                trav = NULL;
+                goto unlock;
+            }
+
             trav = ra_page_get(file, trav_offset);
             if (!trav) {
-                fault = 1;
                 trav = ra_page_create(file, trav_offset);
-                if (trav)
+                if (trav) {
+                    fault = 1;
                     trav->dirty = 1;
+                    trav->stream = stream;
+                    file->prefetched++;
+                }
             }
         }
+    unlock:
         ra_file_unlock(file);
 
         if (!trav) {
-            /* OUT OF MEMORY */
+            /* end of file or OUT OF MEMORY */
             break;
         }
 
@@ -317,9 +479,33 @@ read_ahead(call_frame_t *frame, ra_file_t *file)
         }
         trav_offset += file->page_size;
     }
+}
 
-out:
-    return;
+/* Reads ahead the window of a stream, as it was after its last read, no
+ * more than page-count pages of it */
+static void
+read_ahead(call_frame_t *frame, ra_file_t *file, ra_stream_t *stream,
+           ra_stream_t *last)
+{
+    off_t start = 0;
+    uint32_t window = 0;
+    uint32_t i = 0;
+
+    if (last->stride == (off_t)last->size) {
+        start = last->offset + last->size;
+        ra_prefetch_range(frame, file, stream, start,
+                          start + last->window * file->page_size);
+        return;
+    }
+
+    window = min(last->window, ra_stream_max_reads(file, last));
+    for (i = 1; i <= window; i++) {
+        start = last->offset + last->stride * (off_t)i;
+        if (start + (off_t)last->size <= 0)
+            break;
+
+        ra_prefetch_range(frame, file, stream, start, start + last->size);
+    }
 }
 
 int
@@ -372,6 +558,9 @@ dispatch_requests(call_frame_t *frame, ra_file_t *file)
                 }
                 fault = 1;
                 need_atime_update = 0;
+                local->missed++;
+            } else if (trav->dirty) {
+                file->prefetch_used++;
             }
             trav->dirty = 0;
 
@@ -386,6 +575,8 @@ dispatch_requests(call_frame_t *frame, ra_file_t *file)
                              trav_offset);
                 ra_wait_on_page(trav, frame);
                 need_atime_update = 0;
+                if (!fault)
+                    local->waited++;
             }
         }
     unlock:
@@ -441,16 +632,16 @@ ra_readv(call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
 {
     ra_file_t *file = NULL;
     ra_local_t *local = NULL;
-    ra_conf_t *conf = NULL;
+    ra_stream_t *stream = NULL;
+    ra_stream_t last = {
+        0,
+    };
     int op_errno = EINVAL;
-    char expected_offset = 1;
 
     GF_ASSERT(frame);
     GF_VALIDATE_OR_GOTO(frame->this->name, this, unwind);
     GF_VALIDATE_OR_GOTO(frame->this->name, fd, unwind);
 
-    conf = this->private;
-
     gf_msg_trace(this->name, 0,
                  "NEW REQ at offset=%" PRId64 " for size=%" GF_PRI_SIZET "",
                  offset, size);
@@ -461,30 +652,6 @@ ra_readv(call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
         goto disabled;
     }
 
-    if (file->offset != offset) {
-        gf_msg_trace(this->name, 0,
-                     "unexpected offset (%" PRId64 " != %" PRId64
-                     ") "
-                     "resetting",
-                     file->offset, offset);
-
-        expected_offset = file->expected = file->page_count = 0;
-    } else {
-        gf_msg_trace(this->name, 0,
-                     "expected offset (%" PRId64 ") when page_count=%d", offset,
-                     file->page_count);
-
-        if (file->expected < (file->page_size * conf->page_count)) {
-            file->expected += size;
-            file->page_count = min((file->expected / file->page_size),
-                                   conf->page_count);
-        }
-    }
-
-    if (!expected_offset) {
-        flush_region(frame, file, 0, file->pages.prev->offset + 1, 0);
-    }
-
     local = mem_get0(this->local_pool);
     if (!local) {
         op_errno = ENOMEM;
@@ -503,13 +670,29 @@ ra_readv(call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
 
     frame->local = local;
 
-    dispatch_requests(frame, file);
+    ra_file_lock(file);
+    {
+        stream = __ra_stream_update(file, offset, size);
+    }
+    ra_file_unlock(file);
 
-    flush_region(frame, file, 0, gf_floor(offset, file->page_size), 0);
+    gf_msg_trace(this->name, 0, "%s offset (%" PRId64 ")",
+                 stream ? "expected" : "unexpected", offset);
 
-    read_ahead(frame, file);
+    dispatch_requests(frame, file);
 
-    file->offset = offset + size;
+    ra_file_lock(file);
+    {
+        if (stream) {
+            __ra_stream_adapt(file, stream, local);
+            last = *stream;
+        }
+        __ra_prune_pages(file);
+    }
+    ra_file_unlock(file);
+
+    if (stream)
+        read_ahead(frame, file, stream, &last);
 
     ra_frame_return(frame);
 
@@ -613,6 +796,7 @@ ra_writev(call_frame_t *frame, xlator_t *this, fd_t *fd, struct iovec *vector,
     int32_t op_errno = EINVAL;
     inode_t *inode = NULL;
     fd_t *iter_fd = NULL;
+    int i = 0;
 
     GF_ASSERT(frame);
     GF_VALIDATE_OR_GOTO(frame->this->name, this, unwind);
@@ -633,8 +817,13 @@ ra_writev(call_frame_t *frame, xlator_t *this, fd_t *fd, struct iovec *vector,
 
             flush_region(frame, file, 0, file->pages.prev->offset + 1, 1);
 
-            /* reset the read-ahead counters too */
-            file->expected = file->page_count = 0;
+            /* streams have to be confirmed again before reading ahead */
+            ra_file_lock(file);
+            {
+                for (i = 0; i < RA_MAX_STREAMS; i++)
+                    file->streams[i].window = 0;
+            }
+            ra_file_unlock(file);
         }
     }
     UNLOCK(&inode->lock);
@@ -755,6 +944,7 @@ ra_fdctx_dump(xlator_t *this, fd_t *fd)
 {
     ra_file_t *file = NULL;
     ra_page_t *page = NULL;
+    ra_stream_t *stream = NULL;
     int32_t ret = 0, i = 0;
     char *path = NULL;
     char key_prefix[GF_DUMP_MAX_BUF_LEN] = {
@@ -788,11 +978,29 @@ ra_fdctx_dump(xlator_t *this, fd_t *fd)
 
     gf_proc_dump_write("page-size", "%" PRId64, file->page_size);
 
-    gf_proc_dump_write("page-count", "%u", file->page_count);
-
-    gf_proc_dump_write("next-expected-offset-for-sequential-reads", "%" PRId64,
-                       file->offset);
+    gf_proc_dump_write("reads", "%" PRIu64, file->reads);
+    gf_proc_dump_write("prefetched", "%" PRIu64, file->prefetched);
+    gf_proc_dump_write("prefetch-used", "%" PRIu64, file->prefetch_used);
+    gf_proc_dump_write("prefetch-wasted", "%" PRIu64, file->prefetch_wasted);
+    if (file->prefetch_used + file->prefetch_wasted)
+        gf_proc_dump_write("prefetch-accuracy", "%" PRIu64 "%%",
+                           file->prefetch_used * 100 /
+                               (file->prefetch_used + file->prefetch_wasted));
+    gf_proc_dump_write("fault-rtt-usecs", "%" PRIu64, file->rtt);
+
+    for (i = 0; i < RA_MAX_STREAMS; i++) {
+        stream = &file->streams[i];
+        if (!stream->active)
+            continue;
+
+        gf_proc_dump_write("stream",
+                           "%d: offset=%" PRId64 ", size=%" GF_PRI_SIZET
+                           ", stride=%" PRId64 ", window=%u, hits=%" PRIu64,
+                           i, stream->offset, stream->size, stream->stride,
+                           stream->window, stream->hits);
+    }
 
+    i = 0;
     for (page = file->pages.next; page != &file->pages; page = page->next) {
         gf_proc_dump_write("page", "%d: %p", i++, (void *)page);
         ra_page_dump(page);
@@ -1205,11 +1413,12 @@ struct volume_options options[] = {
     {.key = {"page-count"},
      .type = GF_OPTION_TYPE_INT,
      .min = 1,
-     .max = 16,
+     .max = 256,
      .default_value = "4",
      .op_version = {1},
      .tags = {"read-ahead"},
-     .description = "Number of pages that will be pre-fetched"},
+     .description = "Maximum number of pages that will be pre-fetched for "
+                    "a stream of reads"},
     {.key = {"page-size"},
      .type = GF_OPTION_TYPE_SIZET,
      .min = 4096,
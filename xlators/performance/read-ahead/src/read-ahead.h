@@ -16,11 +16,19 @@
 #include <glusterfs/xlator.h>
 #include "read-ahead-mem-types.h"
 
+/* Number of read streams tracked per fd */
+#define RA_MAX_STREAMS 4
+
+/* Farthest, in pages, a read may be from the last read of a stream for the
+ * two to be taken as a stride of that stream */
+#define RA_MAX_STRIDE_PAGES 64
+
 struct ra_conf;
 struct ra_local;
 struct ra_page;
 struct ra_file;
 struct ra_waitq;
+struct ra_stream;
 
 struct ra_waitq {
     struct ra_waitq *next;
@@ -49,6 +57,9 @@ struct ra_local {
     size_t pending_size;
     fd_t *fd;
     pthread_mutex_t local_lock;
+    struct timespec start; /* when a page fault was wound */
+    int32_t missed;        /* pages the request had to fault itself */
+    int32_t waited;        /* pages the request found in transit */
 };
 
 struct ra_page {
@@ -65,6 +76,24 @@ struct ra_page {
     size_t size;
     struct ra_waitq *waitq;
     struct iobref *iobref;
+    struct ra_stream *stream; /* stream a dirty page was read ahead for */
+};
+
+/* A pattern of reads through an fd, each one 'stride' bytes from the one
+ * before it.  A negative stride is a backward scan; a stride equal to the
+ * size of the reads is a sequential stream.  The stream is confirmed once a
+ * read lands where it was expected, from then on 'window' is how far ahead
+ * it is prefetched: in pages for sequential streams, in reads otherwise. */
+struct ra_stream {
+    off_t offset; /* offset of the last read */
+    size_t size;  /* size of the last read */
+    off_t stride;
+    uint32_t window; /* 0 until the stream is confirmed */
+    char active;
+    uint64_t hits;
+    uint64_t last_used;     /* read count of the fd when last matched */
+    struct timespec last;   /* time of the last read */
+    uint64_t interval;      /* average time between two reads, usecs */
 };
 
 struct ra_file {
@@ -74,14 +103,17 @@ struct ra_file {
     fd_t *fd;
     int disabled;
     int32_t refcount;
-    size_t expected;
     struct ra_page pages;
-    off_t offset;
     size_t size;
     pthread_mutex_t file_lock;
     struct iatt stbuf;
     uint64_t page_size;
-    uint32_t page_count;
+    struct ra_stream streams[RA_MAX_STREAMS];
+    uint64_t reads;
+    uint64_t prefetched;      /* pages read ahead */
+    uint64_t prefetch_used;   /* read ahead pages a request was served from */
+    uint64_t prefetch_wasted; /* read ahead pages dropped unread */
+    uint64_t rtt;             /* average time to fault a page, usecs */
 };
 
 struct ra_conf {
@@ -99,6 +131,7 @@ typedef struct ra_page ra_page_t;
 typedef struct ra_file ra_file_t;
 typedef struct ra_waitq ra_waitq_t;
 typedef struct ra_fill ra_fill_t;
+typedef struct ra_stream ra_stream_t;
 
 ra_page_t *
 ra_page_get(ra_file_t *file, off_t offset);
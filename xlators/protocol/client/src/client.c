@@ -2825,6 +2825,7 @@ client_priv_dump(xlator_t *this)
                            conn->trans->total_bytes_write);
         gf_proc_dump_write("ping_msgs_sent", "%" PRIu64, conn->pingcnt);
         gf_proc_dump_write("msgs_sent", "%" PRIu64, conn->msgcnt);
+        rpc_transport_dump(conn->trans, "transport");
     }
     pthread_mutex_unlock(&conf->lock);
 
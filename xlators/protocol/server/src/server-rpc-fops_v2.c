@@ -2908,6 +2908,243 @@ err:
     return 0;
 }
 
+static void
+server4_xattrop_batch_set(server_xattrop_batch_t *batch, int idx, int error,
+                          dict_t *dict)
+{
+    char key[64];
+    char *buf = NULL;
+    u_int len = 0;
+
+    if (!error && dict && dict_allocate_and_serialize(dict, &buf, &len))
+        error = ENOMEM;
+
+    snprintf(key, sizeof(key), GF_XATTROP_BATCH_ERRNO_FMT, idx);
+    dict_set_int32(batch->rsp, key, gf_errno_to_error(error));
+
+    if (buf) {
+        snprintf(key, sizeof(key), GF_XATTROP_BATCH_FMT, idx);
+        if (dict_set_dynptr(batch->rsp, key, buf, len))
+            GF_FREE(buf);
+    }
+}
+
+static void
+server4_xattrop_batch_done(server_xattrop_batch_t *batch)
+{
+    call_frame_t *frame = batch->frame;
+    dict_t *xdata = NULL;
+    int pending = 0;
+
+    LOCK(&batch->lock);
+    {
+        pending = --batch->pending;
+    }
+    UNLOCK(&batch->lock);
+
+    if (pending)
+        return;
+
+    /* the acknowledgement must reach the client, else it sends the
+     * xattrops of the other inodes again */
+    if (batch->xdata)
+        xdata = dict_copy_with_ref(batch->xdata, NULL);
+    if (xdata)
+        dict_copy(batch->rsp, xdata);
+    else
+        xdata = dict_ref(batch->rsp);
+
+    batch->unwind(frame, NULL, frame->this, batch->op_ret, batch->op_errno,
+                  batch->dict, xdata);
+
+    dict_unref(xdata);
+    if (batch->dict)
+        dict_unref(batch->dict);
+    if (batch->xdata)
+        dict_unref(batch->xdata);
+    dict_unref(batch->rsp);
+    LOCK_DESTROY(&batch->lock);
+    GF_FREE(batch);
+}
+
+static int
+server4_xattrop_batch_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
+                          int32_t op_ret, int32_t op_errno, dict_t *dict,
+                          dict_t *xdata)
+{
+    server_xattrop_batch_t *batch = frame->local;
+
+    frame->local = NULL;
+    server4_xattrop_batch_set(batch, (long)cookie, (op_ret < 0) ? op_errno : 0,
+                              dict);
+
+    gf_client_unref(frame->root->client);
+    STACK_DESTROY(frame->root);
+
+    server4_xattrop_batch_done(batch);
+    return 0;
+}
+
+static int
+server4_xattrop_batch_main_cbk(call_frame_t *frame, void *cookie,
+                               xlator_t *this, int32_t op_ret,
+                               int32_t op_errno, dict_t *dict, dict_t *xdata)
+{
+    server_xattrop_batch_t *batch = cookie;
+
+    batch->op_ret = op_ret;
+    batch->op_errno = op_errno;
+    if (dict)
+        batch->dict = dict_ref(dict);
+    if (xdata)
+        batch->xdata = dict_ref(xdata);
+
+    server4_xattrop_batch_done(batch);
+    return 0;
+}
+
+/* Drops the xattrops of the other inodes from the request, they are not
+ * acknowledged and the client sends them again one by one. */
+static void
+server4_xattrop_batch_strip(dict_t *xdata, uint32_t count)
+{
+    char key[64];
+    uint32_t i = 0;
+
+    for (i = 1; i <= count; i++) {
+        snprintf(key, sizeof(key), GF_XATTROP_BATCH_GFID_FMT, i);
+        dict_del(xdata, key);
+        snprintf(key, sizeof(key), GF_XATTROP_BATCH_FMT, i);
+        dict_del(xdata, key);
+    }
+}
+
+/* Winds the [f]xattrop of the request and the plain xattrops of the inodes
+ * it carries in GF_XATTROP_BATCH_KEY in parallel. Returns -1 if the request
+ * is not a batch, a batch of more inodes than a client sends or than the
+ * request holds is failed with EINVAL. */
+static int
+server4_xattrop_batch_wind(call_frame_t *frame, xlator_t *bound_xl,
+                           fop_xattrop_cbk_t unwind)
+{
+    server_state_t *state = NULL;
+    server_xattrop_batch_t *batch = NULL;
+    call_frame_t *new_frame = NULL;
+    inode_t *inode = NULL;
+    dict_t *xattr = NULL;
+    dict_t *xdata = NULL;
+    data_t *data = NULL;
+    loc_t loc = {
+        0,
+    };
+    uuid_t gfid = {
+        0,
+    };
+    char key[64];
+    uint32_t count = 0;
+    uint32_t i = 0;
+    int error = 0;
+    int ret = 0;
+
+    state = CALL_STATE(frame);
+
+    if (!state->xdata ||
+        dict_get_uint32(state->xdata, GF_XATTROP_BATCH_KEY, &count))
+        return -1;
+
+    /* each inode comes with its gfid and its xattrs */
+    if ((count > GF_XATTROP_BATCH_MAX) ||
+        (count * 2 >= state->xdata->count)) {
+        gf_msg_debug(frame->this->name, 0,
+                     "rejecting an xattrop batch of %u inodes", count);
+        unwind(frame, NULL, frame->this, -1, EINVAL, NULL, NULL);
+        return 0;
+    }
+    dict_del_sizen(state->xdata, GF_XATTROP_BATCH_KEY);
+
+    batch = GF_CALLOC(1, sizeof(*batch), gf_server_mt_xattrop_batch_t);
+    if (batch)
+        batch->rsp = dict_new();
+    if (!batch || !batch->rsp ||
+        dict_set_uint32(batch->rsp, GF_XATTROP_BATCH_KEY, count)) {
+        server4_xattrop_batch_strip(state->xdata, count);
+        if (batch && batch->rsp)
+            dict_unref(batch->rsp);
+        GF_FREE(batch);
+        return -1;
+    }
+
+    LOCK_INIT(&batch->lock);
+    batch->frame = frame;
+    batch->unwind = unwind;
+    /* one for each inode and one held while winding */
+    batch->pending = count + 2;
+
+    for (i = 1; i <= count; i++) {
+        snprintf(key, sizeof(key), GF_XATTROP_BATCH_GFID_FMT, i);
+        ret = dict_get_gfuuid(state->xdata, key, &gfid);
+        snprintf(key, sizeof(key), GF_XATTROP_BATCH_FMT, i);
+        data = dict_get(state->xdata, key);
+
+        error = ESTALE;
+        if (!ret && data)
+            inode = inode_find(state->itable, gfid);
+        if (inode) {
+            error = EINVAL;
+            xattr = dict_new();
+            if (xattr && dict_unserialize(data->data, data->len, &xattr)) {
+                dict_unref(xattr);
+                xattr = NULL;
+            }
+        }
+        if (xattr) {
+            error = ENOMEM;
+            new_frame = copy_frame(frame);
+        }
+
+        if (!new_frame) {
+            server4_xattrop_batch_set(batch, i, error, NULL);
+            server4_xattrop_batch_done(batch);
+            goto next;
+        }
+
+        gf_client_ref(frame->root->client);
+        new_frame->root->client = frame->root->client;
+        new_frame->local = batch;
+
+        loc.inode = inode_ref(inode);
+        gf_uuid_copy(loc.gfid, inode->gfid);
+        STACK_WIND_COOKIE(new_frame, server4_xattrop_batch_cbk,
+                          (void *)(long)i, bound_xl, bound_xl->fops->xattrop,
+                          &loc, state->flags, xattr, NULL);
+        loc_wipe(&loc);
+    next:
+        if (xattr)
+            dict_unref(xattr);
+        if (inode)
+            inode_unref(inode);
+        xattr = NULL;
+        inode = NULL;
+        new_frame = NULL;
+    }
+
+    server4_xattrop_batch_strip(state->xdata, count);
+    if (state->xdata->count)
+        xdata = state->xdata;
+
+    if (state->fd)
+        STACK_WIND_COOKIE(frame, server4_xattrop_batch_main_cbk, batch,
+                          bound_xl, bound_xl->fops->fxattrop, state->fd,
+                          state->flags, state->dict, xdata);
+    else
+        STACK_WIND_COOKIE(frame, server4_xattrop_batch_main_cbk, batch,
+                          bound_xl, bound_xl->fops->xattrop, &state->loc,
+                          state->flags, state->dict, xdata);
+
+    server4_xattrop_batch_done(batch);
+    return 0;
+}
+
 int
 server4_xattrop_resume(call_frame_t *frame, xlator_t *bound_xl)
 {
@@ -2918,6 +3155,9 @@ server4_xattrop_resume(call_frame_t *frame, xlator_t *bound_xl)
     if (state->resolve.op_ret != 0)
         goto err;
 
+    if (!server4_xattrop_batch_wind(frame, bound_xl, server4_xattrop_cbk))
+        return 0;
+
     STACK_WIND(frame, server4_xattrop_cbk, bound_xl, bound_xl->fops->xattrop,
                &state->loc, state->flags, state->dict, state->xdata);
     return 0;
@@ -2937,6 +3177,9 @@ server4_fxattrop_resume(call_frame_t *frame, xlator_t *bound_xl)
     if (state->resolve.op_ret != 0)
         goto err;
 
+    if (!server4_xattrop_batch_wind(frame, bound_xl, server4_fxattrop_cbk))
+        return 0;
+
     STACK_WIND(frame, server4_fxattrop_cbk, bound_xl, bound_xl->fops->fxattrop,
                state->fd, state->flags, state->dict, state->xdata);
     return 0;
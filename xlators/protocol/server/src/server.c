@@ -234,6 +234,7 @@ server_priv(xlator_t *this)
     uint64_t total_read = 0;
     uint64_t total_write = 0;
     int32_t ret = -1;
+    int count = 0;
 
     GF_VALIDATE_OR_GOTO("server", this, out);
 
@@ -252,6 +253,9 @@ server_priv(xlator_t *this)
         {
             total_read += xprt->total_bytes_read;
             total_write += xprt->total_bytes_write;
+
+            snprintf(key, sizeof(key), "conn.%d", count++);
+            rpc_transport_dump(xprt, key);
         }
     }
     pthread_mutex_unlock(&conf->mutex);
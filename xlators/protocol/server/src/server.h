@@ -182,6 +182,20 @@ typedef struct _server_ctx {
     fdtable_t *fdtable;
 } server_ctx_t;
 
+/* an [f]xattrop which also carries the xattrops of other inodes, it is
+ * answered once the xattrops of all of them are done */
+typedef struct _server_xattrop_batch {
+    gf_lock_t lock;
+    call_frame_t *frame;
+    fop_xattrop_cbk_t unwind;
+    int pending;
+    int32_t op_ret;
+    int32_t op_errno;
+    dict_t *dict;
+    dict_t *xdata;
+    dict_t *rsp; /* results of the other inodes */
+} server_xattrop_batch_t;
+
 typedef struct server_cleanup_xprt_arg {
     xlator_t *this;
     char *victim_name;
@@ -116,6 +116,22 @@ posix_priv(xlator_t *this)
     gf_proc_dump_write("max_read", "%" PRId64, GF_ATOMIC_GET(priv->read_value));
     gf_proc_dump_write("max_write", "%" PRId64,
                        GF_ATOMIC_GET(priv->write_value));
+#ifdef HAVE_LIBURING
+    if (priv->io_uring_capable) {
+        gf_proc_dump_write("io_uring.fixed_buffers", "%d",
+                           priv->uring_nr_bufs);
+        gf_proc_dump_write(
+            "io_uring.fixed_files", "%d",
+            priv->uring_files ? POSIX_URING_MAX_FILES - priv->uring_free_cnt
+                              : 0);
+        gf_proc_dump_write("io_uring.fixed_reads", "%" PRId64,
+                           GF_ATOMIC_GET(priv->uring_fixed_reads));
+        gf_proc_dump_write("io_uring.fixed_writes", "%" PRId64,
+                           GF_ATOMIC_GET(priv->uring_fixed_writes));
+        gf_proc_dump_write("io_uring.unfixed_reads", "%" PRId64,
+                           GF_ATOMIC_GET(priv->uring_unfixed_reads));
+    }
+#endif
 
     return 0;
 }
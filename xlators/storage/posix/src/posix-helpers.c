@@ -417,6 +417,123 @@ _get_filler_inode(posix_xattr_filler_t *filler)
         return NULL;
 }
 
+posix_inode_ctx_t *
+__posix_inode_ctx_get(inode_t *inode, xlator_t *this);
+
+static gf_boolean_t
+__posix_names_filter_valid(posix_inode_ctx_t *ctx, struct stat *st,
+                           size_t size)
+{
+    gf_names_filter_t *filter = ctx->names_filter;
+
+    return filter &&
+           (gf_names_filter_len(filter) ==
+            sizeof(*filter) + gf_names_filter_round(size)) &&
+           (ctx->names_mtime == st->st_mtime) &&
+           (ctx->names_mtime_nsec == ST_MTIM_NSEC(st)) &&
+           (ctx->names_ctime == st->st_ctime) &&
+           (ctx->names_ctime_nsec == ST_CTIM_NSEC(st));
+}
+
+/* Sets in 'xattr' the filter of the names in the directory, built again
+ * only when the directory changed since the last time.
+ *
+ * The filter is keyed on the times of the backend directory, which the
+ * local filesystem updates on any entry change, and not on the ones
+ * clients set through ctime, which only ever move forward. It is built
+ * after they are read, so it has at least all the names the directory
+ * had then. A change within the granularity of the filesystem clock
+ * would leave them as they are, so a filter read less than a second
+ * after the last change is not kept. */
+static int
+posix_names_filter_get(xlator_t *this, inode_t *inode, const char *real_path,
+                       size_t size, dict_t *xattr)
+{
+    posix_inode_ctx_t *ctx = NULL;
+    gf_names_filter_t *filter = NULL;
+    gf_names_filter_t *old = NULL;
+    gf_names_filter_t *filter_tmp = NULL;
+    struct dirent *entry = NULL;
+    struct dirent scratch[2] = {
+        {
+            0,
+        },
+    };
+    struct stat st = {
+        0,
+    };
+    DIR *dir = NULL;
+    time_t now = 0;
+    int ret = -1;
+
+    if (sys_lstat(real_path, &st) != 0) {
+        gf_msg_debug(this->name, errno, "lstat on %s failed", real_path);
+        goto out;
+    }
+
+    LOCK(&inode->lock);
+    {
+        ctx = __posix_inode_ctx_get(inode, this);
+        if (ctx && __posix_names_filter_valid(ctx, &st, size))
+            filter = gf_names_filter_dup(ctx->names_filter);
+    }
+    UNLOCK(&inode->lock);
+
+    if (filter)
+        goto out;
+
+    dir = sys_opendir(real_path);
+    if (!dir) {
+        gf_msg_debug(this->name, errno, "opendir on %s failed", real_path);
+        goto out;
+    }
+
+    now = gf_time();
+    if (sys_fstat(dirfd(dir), &st) != 0) {
+        gf_msg_debug(this->name, errno, "fstat on %s failed", real_path);
+        goto out;
+    }
+
+    filter = gf_names_filter_new(size);
+    if (!filter)
+        goto out;
+
+    while ((entry = sys_readdir(dir, scratch)) != NULL) {
+        if (!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, ".."))
+            continue;
+        gf_names_filter_add(filter, entry->d_name);
+    }
+
+    if (ctx && (now > max(st.st_mtime, st.st_ctime))) {
+        old = gf_names_filter_dup(filter);
+        LOCK(&inode->lock);
+        {
+            if (old) {
+                filter_tmp = ctx->names_filter;
+                ctx->names_filter = old;
+                old = filter_tmp;
+                ctx->names_mtime = st.st_mtime;
+                ctx->names_mtime_nsec = ST_MTIM_NSEC(&st);
+                ctx->names_ctime = st.st_ctime;
+                ctx->names_ctime_nsec = ST_CTIM_NSEC(&st);
+            }
+        }
+        UNLOCK(&inode->lock);
+        GF_FREE(old);
+    }
+
+out:
+    if (dir)
+        sys_closedir(dir);
+
+    if (filter) {
+        ret = gf_names_filter_to_dict(xattr, filter);
+        GF_FREE(filter);
+    }
+
+    return ret;
+}
+
 static int
 _posix_xattr_get_set(dict_t *xattr_req, char *key, data_t *data,
                      void *xattrargs)
@@ -554,6 +671,13 @@ _posix_xattr_get_set(dict_t *xattr_req, char *key, data_t *data,
     } else if (len == SLEN(GF_REQUEST_LINK_COUNT_XDATA) &&
                strcmp(key, GF_REQUEST_LINK_COUNT_XDATA) == 0) {
         ret = dict_set_sizen(filler->xattr, GF_REQUEST_LINK_COUNT_XDATA, data);
+    } else if (len == SLEN(GF_NAMES_FILTER_KEY) &&
+               strcmp(key, GF_NAMES_FILTER_KEY) == 0) {
+        inode = _get_filler_inode(filler);
+        if (filler->stbuf && IA_ISDIR(filler->stbuf->ia_type) && inode &&
+            filler->real_path)
+            ret = posix_names_filter_get(filler->this, inode, filler->real_path,
+                                         data_to_uint32(data), filler->xattr);
     } else if (len == SLEN(GF_GET_SIZE) && strcmp(key, GF_GET_SIZE) == 0) {
         if (filler->stbuf && IA_ISREG(filler->stbuf->ia_type)) {
             ret = dict_set_uint64(filler->xattr, GF_GET_SIZE,
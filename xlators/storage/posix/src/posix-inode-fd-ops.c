@@ -51,7 +51,9 @@
 #include "posix-metadata.h"
 #include <glusterfs/events.h>
 #include "posix-gfid-path.h"
+#include "posix-io-uring.h"
 #include <glusterfs/compat-uuid.h>
+#include <glusterfs/range-map.h>
 
 extern char *marker_xattrs[];
 #define ALIGN_SIZE 4096
@@ -2660,6 +2662,7 @@ posix_release(xlator_t *this, fd_t *fd)
                "pfd->dir is %p (not NULL) for file fd=%p", pfd->dir, fd);
     }
 
+    posix_io_uring_fd_release(this, pfd);
     posix_add_fd_to_cleanup(this, pfd);
 
 out:
@@ -5217,6 +5220,104 @@ out:
     return op_ret;
 }
 
+/* Only the range maps of AFR, AFR_XATTR_PREFIX ".<client>" AFR_RANGES_SUFFIX,
+ * may be named by a client, the other xattrs are not for it to write. */
+static gf_boolean_t
+posix_is_range_map_key(const char *name)
+{
+    size_t prefix = SLEN(AFR_XATTR_PREFIX ".");
+    size_t suffix = SLEN(AFR_RANGES_SUFFIX);
+    size_t len = strlen(name);
+
+    return ((len > prefix + suffix) &&
+            !strncmp(name, AFR_XATTR_PREFIX ".", prefix) &&
+            !strcmp(name + len - suffix, AFR_RANGES_SUFFIX));
+}
+
+/* Records the byte range of GF_XATTROP_DIRTY_RANGE in each of the range
+ * maps it names. Failing to do so does not fail the xattrop: the map then
+ * counts less modifications than expected and is not trusted by readers. */
+static void
+posix_xattrop_record_range(posix_xattr_filler_t *filler, const char *value)
+{
+    xlator_t *this = filler->this;
+    posix_inode_ctx_t *ctx = NULL;
+    gf_range_map_t map;
+    uint64_t offset = 0;
+    uint64_t len = 0;
+    char *names = NULL;
+    char *name = NULL;
+    char *saveptr = NULL;
+    ssize_t size = 0;
+    int op_errno = 0;
+    int n = 0;
+
+    if (sscanf(value, "%" SCNu64 " %" SCNu64 " %n", &offset, &len, &n) < 2) {
+        gf_msg(this->name, GF_LOG_WARNING, EINVAL, P_MSG_XATTR_FAILED,
+               "invalid %s on gfid=%s: %s", GF_XATTROP_DIRTY_RANGE,
+               uuid_utoa(filler->inode->gfid), value);
+        return;
+    }
+    names = gf_strdup(value + n);
+    if (!names)
+        return;
+
+    if (posix_inode_ctx_get_all(filler->inode, this, &ctx) < 0)
+        goto out;
+
+    for (name = strtok_r(names, " ", &saveptr); name;
+         name = strtok_r(NULL, " ", &saveptr)) {
+        if (!posix_is_range_map_key(name)) {
+            gf_msg(this->name, GF_LOG_WARNING, EINVAL, P_MSG_XATTR_FAILED,
+                   "not recording modified range in %s on gfid=%s, not a "
+                   "range map",
+                   name, uuid_utoa(filler->inode->gfid));
+            continue;
+        }
+
+        pthread_mutex_lock(&ctx->xattrop_lock);
+        {
+            if (filler->real_path)
+                size = sys_lgetxattr(filler->real_path, name, &map,
+                                     sizeof(map));
+            else
+                size = sys_fgetxattr(filler->fdnum, name, &map, sizeof(map));
+            op_errno = errno;
+            if ((size == -1) &&
+                ((op_errno == ENODATA) || (op_errno == ENOATTR))) {
+                gf_range_map_init(&map);
+                size = sizeof(map);
+            }
+
+            /* never overwrite what is not a range map */
+            if (!gf_range_map_valid(&map, size)) {
+                if (size != -1)
+                    op_errno = EINVAL;
+                size = -1;
+                goto unlock;
+            }
+
+            gf_range_map_record(&map, offset, len);
+            if (filler->real_path)
+                size = sys_lsetxattr(filler->real_path, name, &map,
+                                     sizeof(map), 0);
+            else
+                size = sys_fsetxattr(filler->fdnum, name, &map, sizeof(map),
+                                     0);
+            op_errno = errno;
+        }
+    unlock:
+        pthread_mutex_unlock(&ctx->xattrop_lock);
+
+        if (size == -1)
+            gf_msg(this->name, GF_LOG_WARNING, op_errno, P_MSG_XATTR_FAILED,
+                   "failed to record modified range in %s on gfid=%s", name,
+                   uuid_utoa(filler->inode->gfid));
+    }
+out:
+    GF_FREE(names);
+}
+
 /**
  * xattrop - xattr operations - for internal use by GlusterFS
  * @optype: ADD_ARRAY:
@@ -5240,6 +5341,7 @@ do_xattrop(call_frame_t *frame, xlator_t *this, loc_t *loc, fd_t *fd,
     dict_t *xattr_rsp = NULL;
     dict_t *xdata_rsp = NULL;
     struct iatt stbuf = {0};
+    char *range = NULL;
 
     VALIDATE_OR_GOTO(frame, out);
     VALIDATE_OR_GOTO(xattr, out);
@@ -5296,6 +5398,13 @@ do_xattrop(call_frame_t *frame, xlator_t *this, loc_t *loc, fd_t *fd,
     if (!xdata)
         goto out;
 
+    if (dict_get_str_sizen(xdata, GF_XATTROP_DIRTY_RANGE, &range) == 0) {
+        posix_xattrop_record_range(&filler, range);
+        dict_del_sizen(xdata, GF_XATTROP_DIRTY_RANGE);
+        if (!xdata->count)
+            goto out;
+    }
+
     if (fd) {
         op_ret = posix_fdstat(this, inode, _fd, &stbuf, _gf_false);
     } else {
@@ -6167,7 +6276,22 @@ posix_rchecksum(call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
     weak_checksum = gf_rsync_weak_checksum((unsigned char *)buf,
                                            (size_t)bytes_read);
 
-    if (priv->fips_mode_rchecksum) {
+    /* the fast checksum is not for bricks which must stick to FIPS */
+    if (!priv->fips_mode_rchecksum && xdata &&
+        dict_get_sizen(xdata, GF_RCHECKSUM_ALGO_KEY)) {
+        ret = dict_set_str_sizen(rsp_xdata, GF_RCHECKSUM_ALGO_KEY,
+                                 (char *)gf_rsync_xxh128_name());
+        if (ret) {
+            gf_msg(this->name, GF_LOG_WARNING, -ret, P_MSG_DICT_SET_FAILED,
+                   "%s: Failed to set "
+                   "dictionary value for key: %s",
+                   uuid_utoa(fd->inode->gfid), GF_RCHECKSUM_ALGO_KEY);
+            goto out;
+        }
+        checksum = strong_checksum;
+        gf_rsync_xxh128_checksum((unsigned char *)buf, (size_t)bytes_read,
+                                 (unsigned char *)checksum);
+    } else if (priv->fips_mode_rchecksum) {
         ret = dict_set_int32(rsp_xdata, "fips-mode-rchecksum", 1);
         if (ret) {
             gf_msg(this->name, GF_LOG_WARNING, -ret, P_MSG_DICT_SET_FAILED,
@@ -6232,6 +6356,7 @@ posix_forget(xlator_t *this, inode_t *inode)
     pthread_mutex_destroy(&ctx->xattrop_lock);
     pthread_mutex_destroy(&ctx->write_atomic_lock);
     pthread_mutex_destroy(&ctx->pgfid_lock);
+    GF_FREE(ctx->names_filter);
     GF_FREE(ctx);
 
     return ret;
@@ -12,6 +12,8 @@
 #include "posix-messages.h"
 #include "posix-io-uring.h"
 #include "posix-handle.h"
+#include "posix-metadata.h"
+#include <glusterfs/syncop.h>
 
 #ifdef HAVE_LIBURING
 #include <liburing.h>
@@ -27,7 +29,9 @@ struct posix_uring_ctx {
     struct iatt prebuf;
     dict_t *xdata;
     fd_t *fd;
+    struct posix_fd *pfd;
     int _fd;
+    int fixed; /* fixed file slot, -1 to use _fd */
     int op;
 
     union {
@@ -35,17 +39,25 @@ struct posix_uring_ctx {
             struct iovec *iov;
             int count;
             off_t offset;
+            int buf_index; /* fixed buffer holding iov[0], or -1 */
         } write;
 
         struct {
             struct iobuf *iobuf;
             struct iovec iovec;
             off_t offset;
+            int buf_index; /* fixed buffer holding iobuf, or -1 */
         } read;
 
         struct {
             int32_t datasync;
         } fsync;
+
+        struct {
+            int32_t mode;
+            off_t offset;
+            off_t len;
+        } falloc;
     } fop;
 
     fop_prep_f *prepare;
@@ -100,10 +112,14 @@ posix_io_uring_ctx_init(call_frame_t *frame, xlator_t *this, fd_t *fd, int op,
                "pfd is NULL from fd=%p", fd);
         goto err;
     }
+    ctx->pfd = pfd;
     ctx->_fd = pfd->fd;
+    ctx->fixed = -1;
 
     /* TODO: Explore filling up pre and post bufs using IOSQE_IO_LINK*/
-    if ((op == GF_FOP_WRITE) || (op == GF_FOP_FSYNC)) {
+    if ((op == GF_FOP_WRITE) || (op == GF_FOP_FSYNC) ||
+        (op == GF_FOP_FALLOCATE) || (op == GF_FOP_DISCARD) ||
+        (op == GF_FOP_ZEROFILL)) {
         if (posix_fdstat(this, fd->inode, pfd->fd, &ctx->prebuf, _gf_true) !=
             0) {
             *op_errno = errno;
@@ -195,18 +211,75 @@ out:
     posix_io_uring_ctx_free(ctx);
 }
 
+/* Index of the registered iobuf arena @iobuf was carved from, or -1. */
+static int
+posix_io_uring_buf_index(struct posix_private *priv, struct iobuf *iobuf)
+{
+    struct iobuf_arena *iobuf_arena = iobuf->iobuf_arena;
+
+    if (iobuf_arena && iobuf_arena->pinned &&
+        (iobuf_arena->pin_index < priv->uring_nr_bufs))
+        return iobuf_arena->pin_index;
+
+    return -1;
+}
+
+/* Index of the registered iobuf arena holding the single vector of a write,
+ * or -1 if there is none (the payload is then passed as a plain iovec). */
+static int
+posix_io_uring_iov_buf_index(struct posix_private *priv, struct iovec *iov,
+                             int count, struct iobref *iobref)
+{
+    struct iobuf_arena *iobuf_arena = NULL;
+    char *base = NULL;
+    char *start = NULL;
+    int index = -1;
+    int i = 0;
+
+    if ((count != 1) || !iobref || (priv->uring_nr_bufs == 0))
+        return -1;
+
+    start = iov[0].iov_base;
+    LOCK(&iobref->lock);
+    {
+        for (i = 0; i < iobref->used; i++) {
+            if (!iobref->iobrefs[i])
+                continue;
+            if (posix_io_uring_buf_index(priv, iobref->iobrefs[i]) < 0)
+                continue;
+            iobuf_arena = iobref->iobrefs[i]->iobuf_arena;
+            base = iobuf_arena->mem_base;
+            if ((start >= base) &&
+                (start + iov[0].iov_len <= base + iobuf_arena->arena_size)) {
+                index = iobuf_arena->pin_index;
+                break;
+            }
+        }
+    }
+    UNLOCK(&iobref->lock);
+
+    return index;
+}
+
 static void
 posix_prep_readv(struct io_uring_sqe *sqe, struct posix_uring_ctx *ctx)
 {
+    if (ctx->fop.read.buf_index >= 0)
+        io_uring_prep_read_fixed(sqe, ctx->_fd, ctx->fop.read.iovec.iov_base,
+                                 ctx->fop.read.iovec.iov_len,
+                                 ctx->fop.read.offset, ctx->fop.read.buf_index);
+    else
+        io_uring_prep_readv(sqe, ctx->_fd, &ctx->fop.read.iovec, 1,
+                            ctx->fop.read.offset);
+    /* prep resets the flags, so this has to come last */
     sqe->flags |= IOSQE_ASYNC;
-    io_uring_prep_readv(sqe, ctx->_fd, &ctx->fop.read.iovec, 1,
-                        ctx->fop.read.offset);
 }
 
 static int
 posix_io_uring_readv(call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
                      off_t offset, uint32_t flags, dict_t *xdata)
 {
+    struct posix_private *priv = this->private;
     struct posix_uring_ctx *ctx = NULL;
     int32_t op_errno = ENOMEM;
     struct iobuf *iobuf = NULL;
@@ -219,7 +292,10 @@ posix_io_uring_readv(call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
         goto err;
     }
 
-    iobuf = iobuf_get2(this->ctx->iobuf_pool, size);
+    if (priv->uring_nr_bufs)
+        iobuf = iobuf_get_pinned(this->ctx->iobuf_pool, size);
+    else
+        iobuf = iobuf_get2(this->ctx->iobuf_pool, size);
     if (!iobuf) {
         op_errno = ENOMEM;
         goto err;
@@ -228,6 +304,11 @@ posix_io_uring_readv(call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
     ctx->fop.read.iovec.iov_base = iobuf_ptr(iobuf);
     ctx->fop.read.iovec.iov_len = size;
     ctx->fop.read.offset = offset;
+    ctx->fop.read.buf_index = posix_io_uring_buf_index(priv, iobuf);
+    if (ctx->fop.read.buf_index >= 0)
+        GF_ATOMIC_INC(priv->uring_fixed_reads);
+    else if (priv->uring_nr_bufs)
+        GF_ATOMIC_INC(priv->uring_unfixed_reads);
 
     ret = posix_io_uring_submit(this, ctx);
     if (ret < 0) {
@@ -314,8 +395,14 @@ out:
 static void
 posix_prep_writev(struct io_uring_sqe *sqe, struct posix_uring_ctx *ctx)
 {
-    io_uring_prep_writev(sqe, ctx->_fd, ctx->fop.write.iov,
-                         ctx->fop.write.count, ctx->fop.write.offset);
+    if (ctx->fop.write.buf_index >= 0)
+        io_uring_prep_write_fixed(
+            sqe, ctx->_fd, ctx->fop.write.iov[0].iov_base,
+            ctx->fop.write.iov[0].iov_len, ctx->fop.write.offset,
+            ctx->fop.write.buf_index);
+    else
+        io_uring_prep_writev(sqe, ctx->_fd, ctx->fop.write.iov,
+                             ctx->fop.write.count, ctx->fop.write.offset);
 }
 
 static int
@@ -323,6 +410,7 @@ posix_io_uring_writev(call_frame_t *frame, xlator_t *this, fd_t *fd,
                       struct iovec *iov, int count, off_t offset,
                       uint32_t flags, struct iobref *iobref, dict_t *xdata)
 {
+    struct posix_private *priv = this->private;
     struct posix_uring_ctx *ctx = NULL;
     int32_t op_errno = ENOMEM;
     int ret = 0;
@@ -337,6 +425,10 @@ posix_io_uring_writev(call_frame_t *frame, xlator_t *this, fd_t *fd,
     ctx->fop.write.iov = iov;
     ctx->fop.write.count = count;
     ctx->fop.write.offset = offset;
+    ctx->fop.write.buf_index = posix_io_uring_iov_buf_index(priv, iov, count,
+                                                            iobref);
+    if (ctx->fop.write.buf_index >= 0)
+        GF_ATOMIC_INC(priv->uring_fixed_writes);
 
     ret = posix_io_uring_submit(this, ctx);
     if (ret < 0) {
@@ -445,6 +537,304 @@ err:
     return 0;
 }
 
+/* Writing the zeroes out can take long, it is done in a synctask so that
+ * the other completions are not held up behind it. */
+static int
+posix_io_uring_zerofill_task(void *opaque)
+{
+    struct posix_uring_ctx *ctx = opaque;
+    call_frame_t *frame = ctx->frame;
+
+    posix_zerofill(frame, frame->this, ctx->fd, ctx->fop.falloc.offset,
+                   ctx->fop.falloc.len, ctx->xdata);
+    return 0;
+}
+
+static int
+posix_io_uring_zerofill_done(int ret, call_frame_t *frame, void *opaque)
+{
+    posix_io_uring_ctx_free(opaque);
+    return 0;
+}
+
+/* fallocate, discard and zerofill all map onto IORING_OP_FALLOCATE and only
+ * differ in the mode passed down and the fop they unwind. */
+static void
+posix_io_uring_falloc_complete(struct posix_uring_ctx *ctx, int32_t res)
+{
+    call_frame_t *frame = NULL;
+    xlator_t *this = NULL;
+    struct posix_private *priv = NULL;
+    struct iatt postbuf = {
+        0,
+    };
+    fd_t *fd = NULL;
+    int _fd = -1;
+    int ret = 0;
+    int op_ret = -1;
+    int op_errno = 0;
+
+    frame = ctx->frame;
+    this = frame->this;
+    priv = this->private;
+    fd = ctx->fd;
+    _fd = ctx->_fd;
+
+    if (res < 0) {
+        if ((ctx->op == GF_FOP_ZEROFILL) &&
+            ((res == -EOPNOTSUPP) || (res == -ENOSYS))) {
+            /* The backend can't zero a range in place. Remember it and let
+             * the synchronous path write the zeroes out. */
+            priv->uring_zero_range_nosupp = _gf_true;
+            ret = synctask_new(this->ctx->env, posix_io_uring_zerofill_task,
+                               posix_io_uring_zerofill_done, NULL, ctx);
+            if (ret == 0)
+                return;
+            op_errno = ENOMEM;
+            gf_msg(this->name, GF_LOG_ERROR, op_errno, P_MSG_ZEROFILL_FAILED,
+                   "could not hand zerofill on %s over to a synctask",
+                   uuid_utoa(fd->inode->gfid));
+            goto out;
+        }
+        op_ret = -1;
+        op_errno = -res;
+        gf_msg(this->name, GF_LOG_ERROR, op_errno,
+               (ctx->op == GF_FOP_ZEROFILL) ? P_MSG_ZEROFILL_FAILED
+                                            : P_MSG_FALLOCATE_FAILED,
+               "fallocate(async) failed on %s offset: %jd, len:%jd, "
+               "mode: %d",
+               uuid_utoa(fd->inode->gfid), (intmax_t)ctx->fop.falloc.offset,
+               (intmax_t)ctx->fop.falloc.len, ctx->fop.falloc.mode);
+        goto out;
+    }
+
+    ret = posix_fdstat(this, fd->inode, _fd, &postbuf, _gf_true);
+    if (ret != 0) {
+        op_ret = -1;
+        op_errno = errno;
+        gf_msg(this->name, GF_LOG_ERROR, op_errno, P_MSG_FSTAT_FAILED,
+               "fstat failed on fd=%d", _fd);
+        goto out;
+    }
+
+    posix_set_ctime(frame, this, NULL, _fd, fd->inode, &postbuf);
+
+    op_ret = 0;
+    op_errno = 0;
+out:
+    switch (ctx->op) {
+        case GF_FOP_FALLOCATE:
+            STACK_UNWIND_STRICT(fallocate, frame, op_ret, op_errno,
+                                &ctx->prebuf, &postbuf, NULL);
+            break;
+        case GF_FOP_DISCARD:
+            STACK_UNWIND_STRICT(discard, frame, op_ret, op_errno, &ctx->prebuf,
+                                &postbuf, NULL);
+            break;
+        case GF_FOP_ZEROFILL:
+            STACK_UNWIND_STRICT(zerofill, frame, op_ret, op_errno,
+                                &ctx->prebuf, &postbuf, NULL);
+            break;
+        default:
+            break;
+    }
+    posix_io_uring_ctx_free(ctx);
+}
+
+static void
+posix_prep_fallocate(struct io_uring_sqe *sqe, struct posix_uring_ctx *ctx)
+{
+    io_uring_prep_fallocate(sqe, ctx->_fd, ctx->fop.falloc.mode,
+                            ctx->fop.falloc.offset, ctx->fop.falloc.len);
+}
+
+/* Requests that need the write-atomic lock, cloudsync maintenance or the
+ * storage.reserve overwrite exception are left to the synchronous path,
+ * which already knows how to handle them. */
+static gf_boolean_t
+posix_io_uring_falloc_sync(xlator_t *this, dict_t *xdata)
+{
+    struct posix_private *priv = this->private;
+
+    if (!priv->uring_fallocate)
+        return _gf_true;
+
+    if (priv->disk_reserve)
+        posix_disk_space_check(priv);
+    if (priv->disk_space_full)
+        return _gf_true;
+
+    if (xdata && (dict_get_sizen(xdata, GLUSTERFS_WRITE_UPDATE_ATOMIC) ||
+                  dict_get_sizen(xdata, GF_CS_OBJECT_STATUS) ||
+                  dict_get_sizen(xdata, GF_CS_OBJECT_REPAIR)))
+        return _gf_true;
+
+    return _gf_false;
+}
+
+static int
+posix_io_uring_falloc_submit(call_frame_t *frame, xlator_t *this, fd_t *fd,
+                             glusterfs_fop_t op, int32_t mode, off_t offset,
+                             off_t len, dict_t *xdata)
+{
+    struct posix_uring_ctx *ctx = NULL;
+    int32_t op_errno = ENOMEM;
+    int ret = 0;
+
+    ctx = posix_io_uring_ctx_init(frame, this, fd, op, posix_prep_fallocate,
+                                  posix_io_uring_falloc_complete, &op_errno,
+                                  xdata);
+    if (!ctx) {
+        goto err;
+    }
+
+    ctx->fop.falloc.mode = mode;
+    ctx->fop.falloc.offset = offset;
+    ctx->fop.falloc.len = len;
+
+    ret = posix_io_uring_submit(this, ctx);
+    if (ret < 0) {
+        gf_msg(this->name, GF_LOG_ERROR, -ret, P_MSG_POSIX_IO_URING,
+               "Failed to submit sqe");
+        op_errno = -ret;
+        goto err;
+    }
+    if (ret == 0) {
+        gf_msg(this->name, GF_LOG_WARNING, -ret, P_MSG_POSIX_IO_URING,
+               "submit sqe got zero");
+    }
+    return 0;
+err:
+    posix_io_uring_ctx_free(ctx);
+    switch (op) {
+        case GF_FOP_FALLOCATE:
+            STACK_UNWIND_STRICT(fallocate, frame, -1, op_errno, NULL, NULL,
+                                NULL);
+            break;
+        case GF_FOP_DISCARD:
+            STACK_UNWIND_STRICT(discard, frame, -1, op_errno, NULL, NULL,
+                                NULL);
+            break;
+        case GF_FOP_ZEROFILL:
+            STACK_UNWIND_STRICT(zerofill, frame, -1, op_errno, NULL, NULL,
+                                NULL);
+            break;
+        default:
+            break;
+    }
+    return 0;
+}
+
+static int
+posix_io_uring_fallocate(call_frame_t *frame, xlator_t *this, fd_t *fd,
+                         int32_t keep_size, off_t offset, size_t len,
+                         dict_t *xdata)
+{
+    int32_t mode = 0;
+
+    if (posix_io_uring_falloc_sync(this, xdata))
+        return posix_glfallocate(frame, this, fd, keep_size, offset, len,
+                                 xdata);
+
+#ifdef FALLOC_FL_KEEP_SIZE
+    if (keep_size)
+        mode = FALLOC_FL_KEEP_SIZE;
+#endif /* FALLOC_FL_KEEP_SIZE */
+
+    return posix_io_uring_falloc_submit(frame, this, fd, GF_FOP_FALLOCATE,
+                                        mode, offset, len, xdata);
+}
+
+static int
+posix_io_uring_discard(call_frame_t *frame, xlator_t *this, fd_t *fd,
+                       off_t offset, size_t len, dict_t *xdata)
+{
+#ifdef FALLOC_FL_KEEP_SIZE
+    if (!posix_io_uring_falloc_sync(this, xdata))
+        return posix_io_uring_falloc_submit(
+            frame, this, fd, GF_FOP_DISCARD,
+            FALLOC_FL_KEEP_SIZE | FALLOC_FL_PUNCH_HOLE, offset, len, xdata);
+#endif /* FALLOC_FL_KEEP_SIZE */
+
+    return posix_discard(frame, this, fd, offset, len, xdata);
+}
+
+static int
+posix_io_uring_zerofill(call_frame_t *frame, xlator_t *this, fd_t *fd,
+                        off_t offset, off_t len, dict_t *xdata)
+{
+    struct posix_private *priv = this->private;
+    struct posix_fd *pfd = NULL;
+    int32_t op_errno = 0;
+
+    if (priv->uring_zero_range_nosupp ||
+        posix_io_uring_falloc_sync(this, xdata))
+        goto sync;
+
+    /* O_SYNC/O_DSYNC fds need an fsync after the zeroes land. */
+    if (posix_fd_ctx_get(fd, this, &pfd, &op_errno) < 0 ||
+        (pfd->flags & (O_SYNC | O_DSYNC)))
+        goto sync;
+
+    return posix_io_uring_falloc_submit(frame, this, fd, GF_FOP_ZEROFILL,
+                                        FALLOC_FL_ZERO_RANGE, offset, len,
+                                        xdata);
+sync:
+    return posix_zerofill(frame, this, fd, offset, len, xdata);
+}
+
+/* Slot of @pfd in the fixed file table, registering it on first use.
+ * Returns -1 if the fd has to be passed as is. Called with sq_mutex held. */
+static int
+__posix_io_uring_fixed_file(struct posix_private *priv, struct posix_fd *pfd)
+{
+    int slot = -1;
+    int ret = 0;
+
+    if (!priv->uring_files)
+        return -1;
+
+    if (pfd->uring_gen == priv->uring_gen)
+        return pfd->uring_slot;
+
+    if (priv->uring_free_cnt == 0)
+        return -1;
+
+    slot = priv->uring_free_slots[priv->uring_free_cnt - 1];
+    ret = io_uring_register_files_update(&priv->ring, slot, &pfd->fd, 1);
+    if (ret != 1)
+        return -1;
+
+    priv->uring_free_cnt--;
+    pfd->uring_slot = slot;
+    pfd->uring_gen = priv->uring_gen;
+
+    return slot;
+}
+
+void
+posix_io_uring_fd_release(xlator_t *this, struct posix_fd *pfd)
+{
+    struct posix_private *priv = this->private;
+    int fd = -1;
+
+    /* No fop can be in flight on a released fd, so the slot can be
+     * cleared and handed out again right away. */
+    if (!pfd->uring_gen || (pfd->uring_gen != priv->uring_gen))
+        return;
+
+    pthread_mutex_lock(&priv->sq_mutex);
+    {
+        if (pfd->uring_gen == priv->uring_gen) {
+            (void)io_uring_register_files_update(&priv->ring, pfd->uring_slot,
+                                                 &fd, 1);
+            priv->uring_free_slots[priv->uring_free_cnt++] = pfd->uring_slot;
+            pfd->uring_gen = 0;
+        }
+    }
+    pthread_mutex_unlock(&priv->sq_mutex);
+}
+
 static int
 posix_io_uring_submit(xlator_t *this, struct posix_uring_ctx *ctx)
 {
@@ -464,6 +854,11 @@ posix_io_uring_submit(xlator_t *this, struct posix_uring_ctx *ctx)
             goto out;
         }
         ctx->prepare(sqe, ctx);
+        ctx->fixed = __posix_io_uring_fixed_file(priv, ctx->pfd);
+        if (ctx->fixed >= 0) {
+            sqe->fd = ctx->fixed;
+            sqe->flags |= IOSQE_FIXED_FILE;
+        }
         io_uring_sqe_set_data(sqe, ctx);
         ret = io_uring_submit(&priv->ring);
     }
@@ -511,12 +906,87 @@ posix_io_uring_thread(void *data)
     return NULL;
 }
 
+/* Register the iobuf arenas as fixed buffers and set up an empty fixed
+ * file table. Either can fail (old kernel, RLIMIT_MEMLOCK), in which case
+ * the plain buffers and fds are used. */
+static void
+posix_io_uring_register(xlator_t *this)
+{
+    struct posix_private *priv = this->private;
+    struct iovec *iov = NULL;
+    int *slots = NULL;
+    int count = 0;
+    int ret = 0;
+    int i = 0;
+
+    priv->uring_gen++;
+    priv->uring_nr_bufs = 0;
+    priv->uring_files = _gf_false;
+    priv->uring_free_cnt = 0;
+    GF_ATOMIC_INIT(priv->uring_fixed_reads, 0);
+    GF_ATOMIC_INIT(priv->uring_fixed_writes, 0);
+    GF_ATOMIC_INIT(priv->uring_unfixed_reads, 0);
+
+    iov = GF_CALLOC(POSIX_URING_MAX_BUFS, sizeof(*iov), gf_common_mt_iovec);
+    if (iov) {
+        count = iobuf_pool_pin_arenas(this->ctx->iobuf_pool, iov,
+                                      POSIX_URING_MAX_BUFS);
+        if (count > 0) {
+            ret = io_uring_register_buffers(&priv->ring, iov, count);
+            if (ret == 0)
+                priv->uring_nr_bufs = count;
+            else
+                gf_msg(this->name, GF_LOG_WARNING, -ret, P_MSG_POSIX_IO_URING,
+                       "Failed to register %d iobuf arenas, continuing "
+                       "without fixed buffers",
+                       count);
+        }
+        GF_FREE(iov);
+    }
+
+    slots = GF_MALLOC(POSIX_URING_MAX_FILES * sizeof(*slots),
+                      gf_posix_mt_uring_slots);
+    if (!slots)
+        return;
+
+    for (i = 0; i < POSIX_URING_MAX_FILES; i++)
+        slots[i] = -1;
+    ret = io_uring_register_files(&priv->ring, slots, POSIX_URING_MAX_FILES);
+    if (ret != 0) {
+        gf_msg(this->name, GF_LOG_WARNING, -ret, P_MSG_POSIX_IO_URING,
+               "Failed to register the fixed file table, continuing "
+               "without fixed files");
+        GF_FREE(slots);
+        return;
+    }
+
+    /* Reuse the array as the stack of free slots, lowest on top. */
+    for (i = 0; i < POSIX_URING_MAX_FILES; i++)
+        slots[i] = POSIX_URING_MAX_FILES - 1 - i;
+    priv->uring_free_slots = slots;
+    priv->uring_free_cnt = POSIX_URING_MAX_FILES;
+    priv->uring_files = _gf_true;
+}
+
+/* Called once the ring is gone, which dropped all registrations. */
+static void
+posix_io_uring_unregister(struct posix_private *priv)
+{
+    priv->uring_gen++;
+    priv->uring_nr_bufs = 0;
+    priv->uring_files = _gf_false;
+    priv->uring_free_cnt = 0;
+    GF_FREE(priv->uring_free_slots);
+    priv->uring_free_slots = NULL;
+}
+
 int
 posix_io_uring_init(xlator_t *this)
 {
     int ret = -1;
     unsigned flags = 0;
     struct posix_private *priv = this->private;
+    struct io_uring_probe *probe = NULL;
 
     // TODO:Try-out flags |= IORING_SETUP_IOPOLL;
     ret = io_uring_queue_init(POSIX_URING_MAX_ENTRIES, &priv->ring, flags);
@@ -526,12 +996,24 @@ posix_io_uring_init(xlator_t *this)
         goto out;
     }
 
+    /* Only hand over the fops whose opcodes this kernel knows about. */
+    priv->uring_fallocate = _gf_false;
+    probe = io_uring_get_probe_ring(&priv->ring);
+    if (probe) {
+        if (io_uring_opcode_supported(probe, IORING_OP_FALLOCATE))
+            priv->uring_fallocate = _gf_true;
+        io_uring_free_probe(probe);
+    }
+
+    posix_io_uring_register(this);
+
     pthread_mutex_init(&priv->sq_mutex, NULL);
     pthread_mutex_init(&priv->cq_mutex, NULL);
     ret = gf_thread_create(&priv->uring_thread, NULL, posix_io_uring_thread,
                            this, "posix-iouring");
     if (ret != 0) {
         io_uring_queue_exit(&priv->ring);
+        posix_io_uring_unregister(priv);
         pthread_mutex_destroy(&priv->sq_mutex);
         pthread_mutex_destroy(&priv->cq_mutex);
         goto out;
@@ -566,6 +1048,7 @@ posix_io_uring_fini(struct posix_private *priv)
     posix_io_uring_drain(priv);
     (void)pthread_join(priv->uring_thread, NULL);
     io_uring_queue_exit(&priv->ring);
+    posix_io_uring_unregister(priv);
     pthread_mutex_destroy(&priv->sq_mutex);
     pthread_mutex_destroy(&priv->cq_mutex);
 }
@@ -591,6 +1074,9 @@ posix_io_uring_on(xlator_t *this)
         this->fops->readv = posix_io_uring_readv;
         this->fops->writev = posix_io_uring_writev;
         this->fops->fsync = posix_io_uring_fsync;
+        this->fops->fallocate = posix_io_uring_fallocate;
+        this->fops->discard = posix_io_uring_discard;
+        this->fops->zerofill = posix_io_uring_zerofill;
         ret = 0;
     }
 
@@ -610,13 +1096,25 @@ posix_io_uring_off(xlator_t *this)
     this->fops->readv = posix_readv;
     this->fops->writev = posix_writev;
     this->fops->fsync = posix_fsync;
-    if (priv->io_uring_capable)
+    this->fops->fallocate = posix_glfallocate;
+    this->fops->discard = posix_discard;
+    this->fops->zerofill = posix_zerofill;
+    if (priv->io_uring_capable) {
         posix_io_uring_fini(priv);
+        /* the ring is gone, set it up again if io_uring is turned back on */
+        priv->io_uring_init_done = _gf_false;
+        priv->io_uring_capable = _gf_false;
+    }
 
     return 0;
 }
 
 #else
+void
+posix_io_uring_fd_release(xlator_t *this, struct posix_fd *pfd)
+{
+}
+
 int
 posix_io_uring_on(xlator_t *this)
 {
@@ -11,12 +11,20 @@
 #define _POSIX_IO_URING_H
 
 #define POSIX_URING_MAX_ENTRIES 512
+#define POSIX_URING_MAX_FILES 4096
+#define POSIX_URING_MAX_BUFS 1024
+
+struct posix_fd;
+
 int
 posix_io_uring_on(xlator_t *this);
 
 int
 posix_io_uring_off(xlator_t *this);
 
+void
+posix_io_uring_fd_release(xlator_t *this, struct posix_fd *pfd);
+
 #ifdef HAVE_LIBURING
 int
 posix_readv(call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
@@ -32,6 +32,7 @@
 #include <glusterfs/compat.h>
 #include "posix-mem-types.h"
 #include <glusterfs/call-stub.h>
+#include <glusterfs/names-filter.h>
 
 #ifdef HAVE_LIBAIO
 #include <libaio.h>
@@ -143,6 +144,10 @@ struct posix_fd {
     struct list_head list; /* to add to the janitor list */
     xlator_t *xl;
     int odirect;
+#ifdef HAVE_LIBURING
+    uint32_t uring_gen; /* ring generation uring_slot belongs to */
+    int uring_slot;     /* index in the io_uring fixed file table */
+#endif
 };
 
 struct posix_diskxl {
@@ -289,6 +294,23 @@ struct posix_private {
     gf_boolean_t io_uring_init_done;
     gf_boolean_t io_uring_capable;
     gf_boolean_t uring_thread_exit;
+    /* kernel supports IORING_OP_FALLOCATE */
+    gf_boolean_t uring_fallocate;
+    /* backend has no FALLOC_FL_ZERO_RANGE, zerofill goes synchronous */
+    gf_boolean_t uring_zero_range_nosupp;
+    /* bumped on every ring setup, stale fixed file slots are ignored */
+    uint32_t uring_gen;
+    /* iobuf arenas registered with the ring as fixed buffers */
+    int uring_nr_bufs;
+    /* fixed file table registered, and the stack of its unused slots */
+    gf_boolean_t uring_files;
+    int *uring_free_slots;
+    int uring_free_cnt;
+    gf_atomic_t uring_fixed_reads;
+    gf_atomic_t uring_fixed_writes;
+    /* reads that could not use a fixed buffer, e.g. carved from an arena
+     * mapped after the ring was set up */
+    gf_atomic_t uring_unfixed_reads;
     struct io_uring ring;
     pthread_t uring_thread;
     pthread_mutex_t sq_mutex;
@@ -320,6 +342,13 @@ typedef struct {
     pthread_mutex_t xattrop_lock;
     pthread_mutex_t write_atomic_lock;
     pthread_mutex_t pgfid_lock;
+    /* directories: filter of the names, valid while the backend mtime and
+     * ctime are the ones it was built at. Protected by inode->lock. */
+    gf_names_filter_t *names_filter;
+    int64_t names_mtime;
+    int64_t names_ctime;
+    uint32_t names_mtime_nsec;
+    uint32_t names_ctime_nsec;
 } posix_inode_ctx_t;
 
 #define POSIX_BASE_PATH(this)                                                  \
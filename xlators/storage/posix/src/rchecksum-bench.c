@@ -0,0 +1,103 @@
+/*
+  Copyright (c) 2026 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/* Standalone benchmark of the strong checksums posix_rchecksum() can
+ * compute, to be run on the CPUs of a brick:
+ *
+ *     rchecksum-bench [-s block size] [-i iterations]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <openssl/md5.h>
+#include <openssl/sha.h>
+
+#include <glusterfs/checksum.h>
+
+typedef struct _rchecksum_bench_algo {
+    const char *name;
+    void (*sum)(unsigned char *data, size_t len, unsigned char *sum);
+} rchecksum_bench_algo_t;
+
+static double
+rchecksum_bench_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int
+main(int argc, char *argv[])
+{
+    rchecksum_bench_algo_t algos[] = {
+        {"md5", gf_rsync_md5_checksum},
+        {"sha256", gf_rsync_strong_checksum},
+        {gf_rsync_xxh128_name(), gf_rsync_xxh128_checksum},
+    };
+    unsigned char sum[SHA256_DIGEST_LENGTH];
+    unsigned char *buf = NULL;
+    size_t size = 128 * 1024;
+    uint32_t iterations = 2048;
+    uint32_t i = 0;
+    uint32_t j = 0;
+    double start = 0;
+    double secs = 0;
+    int opt = 0;
+
+    while ((opt = getopt(argc, argv, "s:i:")) != -1) {
+        switch (opt) {
+            case 's':
+                size = strtoul(optarg, NULL, 0);
+                break;
+            case 'i':
+                iterations = strtoul(optarg, NULL, 0);
+                break;
+            default:
+                fprintf(stderr, "usage: %s [-s block size] [-i iterations]\n",
+                        argv[0]);
+                return 1;
+        }
+    }
+    if (!size || !iterations) {
+        fprintf(stderr, "block size and iterations must not be 0\n");
+        return 1;
+    }
+
+    buf = malloc(size);
+    if (!buf) {
+        fprintf(stderr, "cannot allocate %zu bytes\n", size);
+        return 1;
+    }
+    srandom(time(NULL));
+    for (i = 0; i < size; i++)
+        buf[i] = random();
+
+    printf("%zu byte blocks, %u iterations\n", size, iterations);
+    for (j = 0; j < sizeof(algos) / sizeof(algos[0]); j++) {
+        start = rchecksum_bench_now();
+        for (i = 0; i < iterations; i++)
+            algos[j].sum(buf, size, sum);
+        secs = rchecksum_bench_now() - start;
+
+        printf("%-10s %10.1f MiB/s\n", algos[j].name,
+               ((double)size * iterations) / (1024 * 1024) / secs);
+    }
+
+    free(buf);
+
+    return 0;
+}